@@ -9,8 +9,24 @@
 #include "Statics/DevelopmentStatics.h"
 
 
+#if GAME_THREAD_FOG_OF_WAR || MULTITHREADED_FOG_OF_WAR
+/* Whether a location is outside fog for the local player's team */
+static bool IsLocationOutsideFogLocally(ARTSGameState * GameState, const FVector & Location, ETeam LocalPlayersTeam)
+{
+#if GAME_THREAD_FOG_OF_WAR
+	return GameState->GetFogManager()->IsLocationVisibleNotChecked(Location, LocalPlayersTeam);
+#else
+	return MultithreadedFogOfWarManager::Get().IsLocationVisibleNotChecked(Location, LocalPlayersTeam);
+#endif
+}
+#endif
+
+
 UFogObeyingAudioComponent::UFogObeyingAudioComponent()
 {
+	FogManager = nullptr;
+	FogTileIndex = INDEX_NONE;
+
 	OnAudioFinished.AddDynamic(this, &UFogObeyingAudioComponent::OnAudioFinishedFunc);
 }
 
@@ -55,7 +71,7 @@ bool UFogObeyingAudioComponent::IsMuted() const
 void UFogObeyingAudioComponent::PlaySound(ARTSGameState * GameState, USoundBase * InSound,
 	float StartTime, ETeam SoundInstigatorsTeam, ESoundFogRules FogRules)
 {	
-#if GAME_THREAD_FOG_OF_WAR
+#if GAME_THREAD_FOG_OF_WAR || MULTITHREADED_FOG_OF_WAR
 	if (InSound == nullptr)
 	{
 		return;
@@ -63,6 +79,8 @@ void UFogObeyingAudioComponent::PlaySound(ARTSGameState * GameState, USoundBase
 	
 	const ETeam LocalPlayersTeam = GameState->GetLocalPlayersTeam();
 	const FVector Location = GetComponentLocation();
+
+	FogObeyingRule = FogRules;
 	
 	// Quick case
 	if (FogRules == ESoundFogRules::InstigatingTeamOnly)
@@ -74,7 +92,7 @@ void UFogObeyingAudioComponent::PlaySound(ARTSGameState * GameState, USoundBase
 	}
 	else if (FogRules == ESoundFogRules::DecideOnSpawn)
 	{
-		const bool bOutsideFog = GameState->GetFogManager()->IsLocationVisibleNotChecked(Location, LocalPlayersTeam);
+		const bool bOutsideFog = IsLocationOutsideFogLocally(GameState, Location, LocalPlayersTeam);
 		if (!bOutsideFog)
 		{
 			return;
@@ -84,15 +102,14 @@ void UFogObeyingAudioComponent::PlaySound(ARTSGameState * GameState, USoundBase
 	/* Add audio component to container and possibly mute it if it shouldn't be heard right now */
 	if (FogRules == ESoundFogRules::AlwaysKnownOnceHeard)
 	{
-		const bool bOutsideFog = GameState->GetFogManager()->IsLocationVisibleNotChecked(Location, LocalPlayersTeam);
+		const bool bOutsideFog = IsLocationOutsideFogLocally(GameState, Location, LocalPlayersTeam);
 		if (!bOutsideFog)
 		{
 			/* If the component is already playing a sound then it will already be in the 
 			container and we shouldn't add it again */
 			if (!bInContainer)
 			{
-				GameState->FogSoundsContainer_AlwaysKnownOnceHeard.Add(this);
-				bInContainer = true;
+				AddToFogContainer(GameState, GameState->FogSoundsContainer_AlwaysKnownOnceHeard);
 			}
 
 			PseudoMute();
@@ -104,11 +121,10 @@ void UFogObeyingAudioComponent::PlaySound(ARTSGameState * GameState, USoundBase
 		{
 			if (!bInContainer)
 			{
-				GameState->FogSoundsContainer_DynamicExceptForInstigatorsTeam.Add(this);
-				bInContainer = true;
+				AddToFogContainer(GameState, GameState->FogSoundsContainer_DynamicExceptForInstigatorsTeam);
 			}
 			
-			const bool bOutsideFog = GameState->GetFogManager()->IsLocationVisibleNotChecked(Location, LocalPlayersTeam);
+			const bool bOutsideFog = IsLocationOutsideFogLocally(GameState, Location, LocalPlayersTeam);
 			if (!bOutsideFog)
 			{
 				PseudoMute();
@@ -119,11 +135,10 @@ void UFogObeyingAudioComponent::PlaySound(ARTSGameState * GameState, USoundBase
 	{
 		if (!bInContainer)
 		{
-			GameState->FogSoundsContainer_Dynamic.Add(this);
-			bInContainer = true;
+			AddToFogContainer(GameState, GameState->FogSoundsContainer_Dynamic);
 		}
 
-		const bool bOutsideFog = GameState->GetFogManager()->IsLocationVisibleNotChecked(Location, LocalPlayersTeam);
+		const bool bOutsideFog = IsLocationOutsideFogLocally(GameState, Location, LocalPlayersTeam);
 		if (!bOutsideFog)
 		{
 			PseudoMute();
@@ -133,14 +148,44 @@ void UFogObeyingAudioComponent::PlaySound(ARTSGameState * GameState, USoundBase
 	// Note: UAudioComponent::SetSound() calls Stop()
 	SetSound(InSound);
 	Play(StartTime);
-#elif MULTITHREADED_FOG_OF_WAR
-	//TODO
 #else
 	SetSound(InSound);
 	Play(StartTime);
 #endif
 }
 
+void UFogObeyingAudioComponent::AddToFogContainer(ARTSGameState * GameState, FAudioComponentContainer & Container)
+{
+	Container.Add(this);
+	bInContainer = true;
+
+#if GAME_THREAD_FOG_OF_WAR
+	GameState->GetFogManager()->RegisterFogAudio(this);
+#endif
+}
+
+void UFogObeyingAudioComponent::RemoveFromFogContainer(ARTSGameState * GameState, FAudioComponentContainer & Container)
+{
+	Container.RemoveChecked(this);
+	bInContainer = false;
+
+#if GAME_THREAD_FOG_OF_WAR
+	GameState->GetFogManager()->UnregisterFogAudio(this);
+#endif
+}
+
+void UFogObeyingAudioComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	Super::OnUpdateTransform(UpdateTransformFlags, Teleport);
+
+#if GAME_THREAD_FOG_OF_WAR
+	if (FogManager != nullptr)
+	{
+		FogManager->OnFogAudioMoved(this);
+	}
+#endif
+}
+
 void UFogObeyingAudioComponent::OnExitFogOfWar_Dynamic(ARTSGameState * GameState)
 {
 	UnPseudoMute();
@@ -165,13 +210,12 @@ void UFogObeyingAudioComponent::OnExitFogOfWar_AlwaysKnownOnceHeard(ARTSGameStat
 {
 	UnPseudoMute();
 
-	GameState->FogSoundsContainer_AlwaysKnownOnceHeard.RemoveChecked(this);
-	bInContainer = false;
+	RemoveFromFogContainer(GameState, GameState->FogSoundsContainer_AlwaysKnownOnceHeard);
 }
 
 void UFogObeyingAudioComponent::OnAudioFinishedFunc()
 {
-#if GAME_THREAD_FOG_OF_WAR
+#if GAME_THREAD_FOG_OF_WAR || MULTITHREADED_FOG_OF_WAR
 	ARTSGameState * GameState = CastChecked<ARTSGameState>(GetWorld()->GetGameState());
 
 	// Remove from relevant container
@@ -179,34 +223,25 @@ void UFogObeyingAudioComponent::OnAudioFinishedFunc()
 	{
 		if (bInContainer)
 		{
-			bInContainer = false;
-			GameState->FogSoundsContainer_AlwaysKnownOnceHeard.RemoveChecked(this);
+			RemoveFromFogContainer(GameState, GameState->FogSoundsContainer_AlwaysKnownOnceHeard);
 		}
 	}
 	else if (FogObeyingRule == ESoundFogRules::DynamicExceptForInstigatorsTeam)
 	{
 		if (bInContainer)
 		{
-			bInContainer = false;
-			GameState->FogSoundsContainer_DynamicExceptForInstigatorsTeam.RemoveChecked(this);
+			RemoveFromFogContainer(GameState, GameState->FogSoundsContainer_DynamicExceptForInstigatorsTeam);
 		}
 	}
 	else if (FogObeyingRule == ESoundFogRules::Dynamic)
 	{
 		if (bInContainer)
 		{
-			bInContainer = false;
-			GameState->FogSoundsContainer_Dynamic.RemoveChecked(this);
+			RemoveFromFogContainer(GameState, GameState->FogSoundsContainer_Dynamic);
 		}
 	}
 	else {} // Method where there is no container for it 
 
-#elif MULTITHREADED_FOG_OF_WAR
-
-	// TODO
-
-#else
-
 #endif
 
 	// So at this point is the audio comp going to be GCed since it's now stopped? Because 
@@ -9,6 +9,8 @@
 enum class ESoundFogRules : uint8;
 class ARTSGameState;
 enum class ETeam : uint8;
+struct FAudioComponentContainer;
+class AFogOfWarManager;
 
 
 /**
@@ -35,6 +37,11 @@ public:
 	void PlaySound(ARTSGameState * GameState, USoundBase * InSound, float StartTime,
 		ETeam SoundInstigatorsTeam, ESoundFogRules FogRules);
 
+	/* Add this to/remove this from one of the game state's fog sound containers. Also 
+	registers/unregisters with the fog manager */
+	void AddToFogContainer(ARTSGameState * GameState, FAudioComponentContainer & Container);
+	void RemoveFromFogContainer(ARTSGameState * GameState, FAudioComponentContainer & Container);
+
 	/* Functions called by the fog of war manager */
 	void OnExitFogOfWar_Dynamic(ARTSGameState * GameState);
 	void OnEnterFogOfWar_Dynamic(ARTSGameState * GameState);
@@ -43,6 +50,9 @@ public:
 	void OnExitFogOfWar_AlwaysKnownOnceHeard(ARTSGameState * GameState);
 
 protected:
+
+	/* Lets the fog manager know if we have moved */
+	virtual void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport) override;
 	
 	// Bound to OnAudioFinished
 	UFUNCTION()
@@ -66,4 +76,11 @@ public:
 
 	/* How audio played through this component obeys fog of war */
 	ESoundFogRules FogObeyingRule;
+
+	/* Fog manager this is registered with. Non-null while in a game state fog sound container. 
+	Only used with game thread fog of war */
+	AFogOfWarManager * FogManager;
+
+	/* Fog tile we are bucketed on in FogManager. INDEX_NONE if not registered or off the grid */
+	int32 FogTileIndex;
 };
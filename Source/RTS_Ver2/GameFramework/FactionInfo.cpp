@@ -2,6 +2,12 @@
 
 #include "FactionInfo.h"
 #include "GameFramework/Character.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Public/AssetRegistryModule.h"
 #include "Components/BoxComponent.h"
 #include "Engine/World.h"
 #include "EngineUtils.h"
@@ -137,8 +143,12 @@ void AFactionInfo::Initialize(URTSGameInstance * GameInst)
 	assert(PoolingManager != nullptr);
 
 	InitHUDPersistentTabButtons();
-	InitUnitInfo();
-	InitBuildingInfo();
+
+	TArray < FBuildingInfoCacheEntry > BuildingEntries;
+	TArray < FUnitInfoCacheEntry > UnitEntries;
+	GatherSelectableInfo(BuildingEntries, UnitEntries);
+	InitUnitInfo(UnitEntries);
+	InitBuildingInfo(BuildingEntries);
 	CreatePrerequisitesText();
 	InitUpgradeInfo();
 	SortHUDPersistentTabButtons();
@@ -159,43 +169,379 @@ void AFactionInfo::InitHUDPersistentTabButtons()
 	}
 }
 
-void AFactionInfo::InitBuildingInfo()
+void FBuildingInfoCacheEntry::Serialize(FArchive & Ar)
 {
-	/* Do this first */
-	for (uint8 i = 0; i < Statics::NUM_RESOURCE_TYPES; ++i)
+	Info.SerializeForCache(Ar);
+	Ar << ProjectileBP;
+	Ar << ResourceCollectionTypes;
+	Ar << ResearchableUpgrades;
+	Ar << ContextMenuSize;
+	Ar << ShopCapacity;
+	Ar << ProductionQueueCapacity;
+	Ar << GarrisonSlotCapacity;
+}
+
+void FUnitInfoCacheEntry::Serialize(FArchive & Ar)
+{
+	Info.SerializeForCache(Ar);
+	Ar << ProjectileBP;
+	Ar << CollectableResources;
+	Ar << ContextMenuSize;
+	Ar << InventoryCapacity;
+}
+
+void AFactionInfo::GatherSelectableInfo(TArray<FBuildingInfoCacheEntry>& OutBuildingEntries, 
+	TArray<FUnitInfoCacheEntry>& OutUnitEntries)
+{
+	/* Never use the cache in editor. Blueprints can be edited without being saved which the 
+	cache key would not pick up. Spawning also runs some checks on the blueprints we want 
+	to keep while developing */
+	if (GIsEditor)
 	{
-		ResourceDepotTypes.Emplace(Statics::ArrayIndexToResourceType(i), FBuildingTypeArray());
+		SpawnUnitsForInfo(OutUnitEntries);
+		SpawnBuildingsForInfo(OutBuildingEntries);
+		return;
 	}
-	
-	/* Clear array first */
-	EmptyBuildingInfo();
 
-	/* Spawn one of every building and create a FBuildInfo for each one, add
-	it to player state array, then destroy building */
+	const uint32 CacheKey = CalculateCacheKey();
+
+	if (TryLoadSelectableInfoCache(CacheKey, OutBuildingEntries, OutUnitEntries))
+	{
+		UE_LOG(RTSLOG, Log, TEXT("Faction info for faction %s loaded from cache"), 
+			TO_STRING(EFaction, Faction));
+		return;
+	}
+
+	SpawnUnitsForInfo(OutUnitEntries);
+	SpawnBuildingsForInfo(OutBuildingEntries);
+
+	SaveSelectableInfoCache(CacheKey, OutBuildingEntries, OutUnitEntries);
+}
+
+void AFactionInfo::SpawnBuildingsForInfo(TArray<FBuildingInfoCacheEntry>& OutEntries)
+{
+	OutEntries.Reserve(Buildings.Num());
+
+	/* Spawn one of every building and create a FBuildInfo for each one then destroy building */
 	for (const auto & Elem_BP : Buildings)
 	{
 		ABuilding * Building = Statics::SpawnBuildingForFactionInfo(Elem_BP, FVector::ZeroVector,
 			FRotator::ZeroRotator, GetWorld());
 		assert(Building != nullptr);
 
-		FBuildingInfo BuildInfo;
+		FBuildingInfoCacheEntry & Entry = OutEntries.Emplace_GetRef();
+
+		FBuildingInfo & BuildInfo = Entry.Info;
 		Building->SetupBuildingInfo(BuildInfo, this);
 		BuildInfo.SetSelectableBP(Elem_BP);
 		const TSubclassOf < AGhostBuilding > & GhostBP = Building->GetGhostBP();
 		BuildInfo.SetGhostBuildingBP(GhostBP);
 
-		PoolingManager->AddProjectileBP(Building->GetProjectileBP());
+		Entry.ProjectileBP = Building->GetProjectileBP();
+		Entry.ResourceCollectionTypes = Building->GetBuildingAttributes()->GetResourceCollectionTypes();
+		Entry.ContextMenuSize = Building->GetContextMenu()->GetButtonsArray().Num();
+
+		/* Loop through context menu buttons */
+		for (const auto & ButtonElem : Building->GetContextMenu()->GetButtonsArray())
+		{
+			if (ButtonElem.IsForResearchUpgrade())
+			{
+				Entry.ResearchableUpgrades.Emplace(ButtonElem.GetUpgradeType());
+			}
+		}
+
+		Entry.ShopCapacity = Building->GetBuildingAttributes()->GetShoppingInfo().GetItems().Num();
+		Entry.ProductionQueueCapacity = Building->GetBuildingAttributes()->CanProduce()
+			? Building->GetBuildingAttributes()->GetProductionQueueLimit() : 0;
+		Entry.GarrisonSlotCapacity = Building->GetBuildingAttributes()->GetGarrisonAttributes().GetTotalNumGarrisonSlots();
+
+#if WITH_EDITOR
+		/* Spawn ghost building, check its dimensions, then destroy it */
+
+		AGhostBuilding * GhostBuilding = GetWorld()->SpawnActor<AGhostBuilding>(GhostBP,
+			Statics::POOLED_ACTOR_SPAWN_LOCATION, FRotator::ZeroRotator);
+
+		/* If this throws even when BP is set there's a possibility that collision is preventing
+		ghost from spawning */
+		UE_CLOG(GhostBuilding == nullptr, RTSLOG, Fatal, TEXT("Building %s's ghost building "
+			"blueprint is null, building needs a ghost building assigned. Can use the default "
+			"class"),
+			*Building->GetName());
+
+		CheckGhost(GhostBuilding, Building);
+
+		GhostBuilding->Destroy();
+		
+#endif
+
+		Building->CheckAnimationProperties();
+
+		/* Building no longer needed */
+		Building->Destroy();
+	}
+}
+
+void AFactionInfo::SpawnUnitsForInfo(TArray<FUnitInfoCacheEntry>& OutEntries)
+{
+	OutEntries.Reserve(Units.Num());
+
+	/* Spawn one of every unit and create FBuildInfo for each one then destroy unit */
+	for (const auto & Elem_BP : Units)
+	{
+		UE_CLOG(Elem_BP == nullptr, RTSLOG, Fatal, TEXT("Faction [%s] has a null entry in the container "
+			"\"Unit Roster\". Please either remove the entry or make it something valid"), TO_STRING(EFaction, Faction));
+		
+		/* TODO: make this specific to each map instead of one const value, and use
+		that value for any other selectables created here e.g. buildings too. GroundVehicles
+		were having trouble without this. Asserts throw in strange places but I assume
+		the map is colliding with the vehicle and preventing it from spawning.
+		An alternative to this would be to set collision in constructor (not begin play)
+		to ignore all, then in begin play change collision to correct profile */
+		/* Some location that does not collide with anything on map */
+		const FVector SafeSpawnLoc = FVector(0.f, 0.f, 3000.f);
+
+		AInfantry * Unit = Statics::SpawnUnitForFactionInfo(Elem_BP, SafeSpawnLoc,
+			FRotator::ZeroRotator, GetWorld());
+
+		FUnitInfoCacheEntry & Entry = OutEntries.Emplace_GetRef();
+
+		FUnitInfo & BuildInfo = Entry.Info;
+		Unit->SetupBuildInfo(BuildInfo, this);
+		BuildInfo.SetSelectableBP(Elem_BP);
+
+		Entry.ProjectileBP = Unit->GetProjectileBP();
+		Unit->GetInfantryAttributes()->ResourceGatheringProperties.GetTMap().GenerateKeyArray(Entry.CollectableResources);
+		Entry.ContextMenuSize = Unit->GetContextMenu()->GetButtonsArray().Num();
+		Entry.InventoryCapacity = Unit->GetInfantryAttributes()->GetInventory().GetCapacity();
+
+		Unit->CheckAnimationProperties();
+
+		/* Unit is no longer needed */
+		Unit->Destroy();
+	}
+}
+
+uint32 AFactionInfo::CalculateCacheKey() const
+{
+	uint32 Hash = CACHE_VERSION;
+
+	/* Package GUIDs change whenever a package is saved/cooked so they stand in for hashing 
+	the content of every blueprint. What gets cached depends on more than the roster 
+	blueprints themselves so every package they depend on is included: parent blueprints, 
+	projectiles (FUnitInfo::SetDamageValues reads from them), data assets etc. The faction 
+	info is included because SetupBuildingInfo reads from it */
+	TSet < FName > Packages;
+
+	const IAssetRegistry & AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(
+		TEXT("AssetRegistry")).Get();
+
+	/* Add a package and everything it depends on. Engine and native packages are left out - 
+	changes to those need CACHE_VERSION bumped anyway */
+	TArray < FName > ToVisit;
+	auto AddPackage = [&](FName PackageName)
+	{
+		if (PackageName.ToString().StartsWith(TEXT("/Game/")))
+		{
+			bool bAlreadyInSet;
+			Packages.Add(PackageName, &bAlreadyInSet);
+			if (!bAlreadyInSet)
+			{
+				ToVisit.Emplace(PackageName);
+			}
+		}
+	};
+
+	auto AddClass = [&](const UClass * Class)
+	{
+		/* Parent blueprints too */
+		for (; Class != nullptr && !Class->HasAnyClassFlags(CLASS_Native); Class = Class->GetSuperClass())
+		{
+			AddPackage(Class->GetOutermost()->GetFName());
+		}
+	};
+
+	AddClass(GetClass());
+
+	/* Roster entries are hashed by path too so an empty entry or a reordering changes the key */
+	auto HashClassPath = [&Hash](const UClass * Class)
+	{
+		const FString PathName = (Class != nullptr) ? Class->GetPathName() : FString();
+		Hash = FCrc::StrCrc32(*PathName, Hash);
+	};
+
+	for (const auto & Elem : Buildings)
+	{
+		HashClassPath(Elem.Get());
+		AddClass(Elem.Get());
+	}
+
+	for (const auto & Elem : Units)
+	{
+		HashClassPath(Elem.Get());
+		AddClass(Elem.Get());
+
+		/* Asset registry might not have dependencies in packaged builds so add these 
+		explicitly */
+		const AInfantry * UnitDefault = (Elem.Get() != nullptr) ? Cast<AInfantry>(Elem.Get()->GetDefaultObject()) : nullptr;
+		if (UnitDefault != nullptr)
+		{
+			AddClass(UnitDefault->GetProjectileBP().Get());
+		}
+	}
+
+	TArray < FName > Dependencies;
+	while (ToVisit.Num() > 0)
+	{
+		const FName PackageName = ToVisit.Pop(false);
+
+		Dependencies.Reset();
+		AssetRegistry.GetDependencies(PackageName, Dependencies, EAssetRegistryDependencyType::Hard);
+		for (const FName & Dependency : Dependencies)
+		{
+			AddPackage(Dependency);
+		}
+	}
+
+	/* Sort so the key does not depend on the order packages were found in */
+	TArray < FName > SortedPackages = Packages.Array();
+	SortedPackages.Sort([](const FName & A, const FName & B) { return A.Compare(B) < 0; });
+
+	for (const FName & PackageName : SortedPackages)
+	{
+		const FString NameString = PackageName.ToString();
+		Hash = FCrc::StrCrc32(*NameString, Hash);
+
+		/* Loaded package's GUID, otherwise what the asset registry has for it */
+		FGuid PackageGuid;
+		if (const UPackage * Package = FindPackage(nullptr, *NameString))
+		{
+			PackageGuid = Package->GetGuid();
+		}
+		else if (const FAssetPackageData * PackageData = AssetRegistry.GetAssetPackageData(PackageName))
+		{
+			PackageGuid = PackageData->PackageGuid;
+		}
+		Hash = FCrc::MemCrc32(&PackageGuid, sizeof(PackageGuid), Hash);
+	}
+
+	return Hash;
+}
+
+FString AFactionInfo::GetCacheFilePath() const
+{
+	return FPaths::ProjectSavedDir() / TEXT("FactionInfoCache") 
+		/ FString::Printf(TEXT("Faction_%d.bin"), static_cast<uint8>(Faction));
+}
+
+bool AFactionInfo::TryLoadSelectableInfoCache(uint32 CacheKey, TArray<FBuildingInfoCacheEntry>& OutBuildingEntries, 
+	TArray<FUnitInfoCacheEntry>& OutUnitEntries) const
+{
+	TArray < uint8 > Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *GetCacheFilePath(), FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes, true);
+	
+	uint32 FileKey = 0;
+	Reader << FileKey;
+	if (FileKey != CacheKey)
+	{
+		return false;
+	}
+
+	int32 NumUnits = 0;
+	int32 NumBuildings = 0;
+	Reader << NumUnits;
+	Reader << NumBuildings;
+	if (Reader.IsError() || NumUnits != Units.Num() || NumBuildings != Buildings.Num())
+	{
+		return false;
+	}
+
+	/* Object references are stored as path names */
+	FObjectAndNameAsStringProxyArchive Ar(Reader, true);
+
+	OutUnitEntries.SetNum(NumUnits);
+	for (FUnitInfoCacheEntry & Entry : OutUnitEntries)
+	{
+		Entry.Serialize(Ar);
+	}
+
+	OutBuildingEntries.SetNum(NumBuildings);
+	for (FBuildingInfoCacheEntry & Entry : OutBuildingEntries)
+	{
+		Entry.Serialize(Ar);
+	}
+
+	if (Ar.IsError())
+	{
+		OutUnitEntries.Reset();
+		OutBuildingEntries.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+void AFactionInfo::SaveSelectableInfoCache(uint32 CacheKey, TArray<FBuildingInfoCacheEntry>& BuildingEntries, 
+	TArray<FUnitInfoCacheEntry>& UnitEntries) const
+{
+	TArray < uint8 > Bytes;
+	FMemoryWriter Writer(Bytes, true);
+
+	int32 NumUnits = UnitEntries.Num();
+	int32 NumBuildings = BuildingEntries.Num();
+	Writer << CacheKey;
+	Writer << NumUnits;
+	Writer << NumBuildings;
+
+	FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+
+	for (FUnitInfoCacheEntry & Entry : UnitEntries)
+	{
+		Entry.Serialize(Ar);
+	}
+
+	for (FBuildingInfoCacheEntry & Entry : BuildingEntries)
+	{
+		Entry.Serialize(Ar);
+	}
+
+	/* Not fatal if this fails, we will just spawn everything again next time */
+	const bool bSaved = FFileHelper::SaveArrayToFile(Bytes, *GetCacheFilePath());
+	UE_CLOG(!bSaved, RTSLOG, Warning, TEXT("Failed to write faction info cache for faction %s"), 
+		TO_STRING(EFaction, Faction));
+}
+
+void AFactionInfo::InitBuildingInfo(const TArray<FBuildingInfoCacheEntry>& Entries)
+{
+	/* Do this first */
+	for (uint8 i = 0; i < Statics::NUM_RESOURCE_TYPES; ++i)
+	{
+		ResourceDepotTypes.Emplace(Statics::ArrayIndexToResourceType(i), FBuildingTypeArray());
+	}
+	
+	/* Clear array first */
+	EmptyBuildingInfo();
+
+	for (const FBuildingInfoCacheEntry & Entry : Entries)
+	{
+		const FBuildingInfo & BuildInfo = Entry.Info;
+		
+		PoolingManager->AddProjectileBP(Entry.ProjectileBP);
 
 #if WITH_EDITORONLY_DATA
-		SelectableBPs.Emplace(Elem_BP);
+		SelectableBPs.Emplace(BuildInfo.GetSelectableBP());
 #endif
 
-		const EBuildingType BuildingType = Building->GetType();
+		const EBuildingType BuildingType = BuildInfo.GetBuildingType();
 
 		UE_CLOG(BuildingInfo.Contains(BuildingType), RTSLOG, Fatal, TEXT("For faction \"%s\" two "
 			"or more buildings share the same type which is \"%s\". The blueprint for one of "
 			"those buildings: %s"), TO_STRING(EFaction, Faction), TO_STRING(EBuildingType, BuildingType),
-			*Elem_BP->GetName());
+			*BuildInfo.GetSelectableBP()->GetName());
 
 		// Possibly add entry to PersistentQueueTypes (construction yards)
 		if (BuildInfo.IsAConstructionYardType())
@@ -204,7 +550,7 @@ void AFactionInfo::InitBuildingInfo()
 		}
 
 		// Add entries to ResourceDepotTypes
-		for (const auto & ResourceType : Building->GetBuildingAttributes()->GetResourceCollectionTypes())
+		for (const auto & ResourceType : Entry.ResourceCollectionTypes)
 		{
 			ResourceDepotTypes[ResourceType].Emplace(BuildingType);
 		}
@@ -221,25 +567,6 @@ void AFactionInfo::InitBuildingInfo()
 			BaseDefenseTypes.Emplace(BuildingType);
 		}
 
-#if WITH_EDITOR
-		/* Spawn ghost building, check its dimensions, then destroy it */
-
-		AGhostBuilding * GhostBuilding = GetWorld()->SpawnActor<AGhostBuilding>(GhostBP,
-			Statics::POOLED_ACTOR_SPAWN_LOCATION, FRotator::ZeroRotator);
-
-		/* If this throws even when BP is set there's a possibility that collision is preventing
-		ghost from spawning */
-		UE_CLOG(GhostBuilding == nullptr, RTSLOG, Fatal, TEXT("Building %s's ghost building "
-			"blueprint is null, building needs a ghost building assigned. Can use the default "
-			"class"),
-			*Building->GetName());
-
-		CheckGhost(GhostBuilding, Building);
-
-		GhostBuilding->Destroy();
-		
-#endif
-
 		const FBuildingInfo & Info = BuildingInfo.Emplace(BuildingType, BuildInfo);
 
 		/* Add button that would build this to HUDPersistentTabButtons */
@@ -262,39 +589,25 @@ void AFactionInfo::InitBuildingInfo()
 		const FContextButton Button = Info.ConstructBuildButton();
 		HUDPersistentTabButtons[HUDTabType].AddButton(Button);
 
-		LargestContextMenu = FMath::Max(Building->GetContextMenu()->GetButtonsArray().Num(), LargestContextMenu);
+		LargestContextMenu = FMath::Max(Entry.ContextMenuSize, LargestContextMenu);
 
-		/* Loop through context menu buttons */
-		for (const auto & ButtonElem : Building->GetContextMenu()->GetButtonsArray())
+		for (const EUpgradeType UpgradeType : Entry.ResearchableUpgrades)
 		{
-			if (ButtonElem.IsForResearchUpgrade())
-			{
-				UpgradesResearchableThroughBuildings.Emplace(ButtonElem.GetUpgradeType());
-			}
+			UpgradesResearchableThroughBuildings.Emplace(UpgradeType);
 		}
 
 		/* Take note of how many items it sells if it is a shop. HUD needs this info later */
-		const int32 BuildingShopCapacity = Building->GetBuildingAttributes()->GetShoppingInfo().GetItems().Num();
-		MaxNumberOfShopItemsOnAShop = FMath::Max(BuildingShopCapacity, MaxNumberOfShopItemsOnAShop);
+		MaxNumberOfShopItemsOnAShop = FMath::Max(Entry.ShopCapacity, MaxNumberOfShopItemsOnAShop);
 
 		/* Note down it's production queue capacity */
-		if (Building->GetBuildingAttributes()->CanProduce())
-		{
-			const int32 QueueCapacity = Building->GetBuildingAttributes()->GetProductionQueueLimit();
-			LargestProductionQueueCapacity = FMath::Max(QueueCapacity, LargestProductionQueueCapacity);
-		}
+		LargestProductionQueueCapacity = FMath::Max(Entry.ProductionQueueCapacity, LargestProductionQueueCapacity);
 
 		/* Note down how many garrison slots the building has */
-		LargestBuildingGarrisonSlotCapacity = FMath::Max<int32>(Building->GetBuildingAttributes()->GetGarrisonAttributes().GetTotalNumGarrisonSlots(), LargestBuildingGarrisonSlotCapacity);
-
-		Building->CheckAnimationProperties();
-
-		/* Building no longer needed */
-		Building->Destroy();
+		LargestBuildingGarrisonSlotCapacity = FMath::Max<int32>(Entry.GarrisonSlotCapacity, LargestBuildingGarrisonSlotCapacity);
 	}
 }
 
-void AFactionInfo::InitUnitInfo()
+void AFactionInfo::InitUnitInfo(const TArray<FUnitInfoCacheEntry>& Entries)
 {
 	// Do this first
 	for (uint8 i = 0; i < Statics::NUM_RESOURCE_TYPES; ++i)
@@ -305,57 +618,31 @@ void AFactionInfo::InitUnitInfo()
 	/* Clear array first */
 	EmptyUnitInfo();
 
-	/* Spawn one of every unit and create FBuildInfo for each one, add
-	it to player state array, then destroy unit */
-	for (const auto & Elem_BP : Units)
+	for (const FUnitInfoCacheEntry & Entry : Entries)
 	{
-		UE_CLOG(Elem_BP == nullptr, RTSLOG, Fatal, TEXT("Faction [%s] has a null entry in the container "
-			"\"Unit Roster\". Please either remove the entry or make it something valid"), TO_STRING(EFaction, Faction));
-		
-		/* TODO: make this specific to each map instead of one const value, and use
-		that value for any other selectables created here e.g. buildings too. GroundVehicles
-		were having trouble without this. Asserts throw in strange places but I assume
-		the map is colliding with the vehicle and preventing it from spawning.
-		An alternative to this would be to set collision in constructor (not begin play)
-		to ignore all, then in begin play change collision to correct profile */
-		/* Some location that does not collide with anything on map */
-		const FVector SafeSpawnLoc = FVector(0.f, 0.f, 3000.f);
-
-		AInfantry * Unit = Statics::SpawnUnitForFactionInfo(Elem_BP, SafeSpawnLoc,
-			FRotator::ZeroRotator, GetWorld());
-
-		FUnitInfo BuildInfo;
-		Unit->SetupBuildInfo(BuildInfo, this);
-		BuildInfo.SetSelectableBP(Elem_BP);
+		const FUnitInfo & BuildInfo = Entry.Info;
 
-		PoolingManager->AddProjectileBP(Unit->GetProjectileBP());
+		PoolingManager->AddProjectileBP(Entry.ProjectileBP);
 
 #if WITH_EDITORONLY_DATA
-		SelectableBPs.Emplace(Elem_BP);
+		SelectableBPs.Emplace(BuildInfo.GetSelectableBP());
 #endif
 
-		const EUnitType UnitType = Unit->GetType();
+		const EUnitType UnitType = BuildInfo.GetUnitType();
 
 		UE_CLOG(UnitInfo.Contains(UnitType), RTSLOG, Fatal, TEXT("For faction \"%s\" 2 or more units "
 			"share the same unit type \"%s\"."), TO_STRING(EFaction, Faction), TO_STRING(EUnitType, UnitType));
 
-		bool bIsWorker = false;
-		bool bIsCollector = false;
-
 		/* Possibly add entry to WorkerTypes. */
 		if (BuildInfo.IsAWorkerType())
 		{
 			WorkerTypes.Emplace(UnitType);
-			bIsWorker = true;
 		}
 		
 		/* Possibly add entries to CollectorTypes */
-		for (const auto & Elem : Unit->GetInfantryAttributes()->ResourceGatheringProperties.GetTMap())
+		for (const EResourceType ResourceType : Entry.CollectableResources)
 		{
-			const EResourceType ResourceType = Elem.Key;
-			
 			CollectorTypes[ResourceType].Emplace(UnitType);
-			bIsCollector = true;
 		}
 
 		/* Possibly add entry to AttackingUnitTypes. */
@@ -373,19 +660,13 @@ void AFactionInfo::InitUnitInfo()
 		const FContextButton Button = Info.ConstructBuildButton();
 		HUDPersistentTabButtons[HUDTabType].AddButton(Button);
 
-		LargestContextMenu = FMath::Max(Unit->GetContextMenu()->GetButtonsArray().Num(), LargestContextMenu);
+		LargestContextMenu = FMath::Max(Entry.ContextMenuSize, LargestContextMenu);
 
 		/* Take note of how many items this unit can carry. HUD needs this info later */
-		const int32 UnitInventoryCapacity = Unit->GetInfantryAttributes()->GetInventory().GetCapacity();
-		if (UnitInventoryCapacity > MaxUnitInventoryCapacity)
+		if (Entry.InventoryCapacity > MaxUnitInventoryCapacity)
 		{
-			MaxUnitInventoryCapacity = UnitInventoryCapacity;
+			MaxUnitInventoryCapacity = Entry.InventoryCapacity;
 		}
-
-		Unit->CheckAnimationProperties();
-
-		/* Unit is no longer needed */
-		Unit->Destroy();
 	}
 }
 
@@ -22,6 +22,7 @@ class UParticleSystem;
 class UUpgradeEffect;
 class USoundBase;
 class UCommanderSkillTreeWidget;
+class AProjectileBase;
 
 
 /* An integer that is clamped to always be at least 1 */
@@ -146,6 +147,51 @@ public:
 };
 
 
+/**
+ *	Everything AFactionInfo needs from spawning a building. Stored in the faction info cache 
+ *	so buildings only need to be spawned when the cache is out of date
+ */
+struct FBuildingInfoCacheEntry
+{
+	FBuildingInfo Info;
+
+	TSubclassOf < AProjectileBase > ProjectileBP;
+
+	/* FBuildingAttributes::GetResourceCollectionTypes */
+	TArray < EResourceType > ResourceCollectionTypes;
+
+	/* Upgrades on the building's context menu */
+	TArray < EUpgradeType > ResearchableUpgrades;
+
+	int32 ContextMenuSize;
+	int32 ShopCapacity;
+
+	/* 0 if the building cannot produce */
+	int32 ProductionQueueCapacity;
+
+	int32 GarrisonSlotCapacity;
+
+	void Serialize(FArchive & Ar);
+};
+
+
+/* Everything AFactionInfo needs from spawning a unit */
+struct FUnitInfoCacheEntry
+{
+	FUnitInfo Info;
+
+	TSubclassOf < AProjectileBase > ProjectileBP;
+
+	/* Resources the unit can gather */
+	TArray < EResourceType > CollectableResources;
+
+	int32 ContextMenuSize;
+	int32 InventoryCapacity;
+
+	void Serialize(FArchive & Ar);
+};
+
+
 /**
  *	A info class that holds all the data about a faction. It is a pure info class. This object 
  *	stores no state.
@@ -244,15 +290,44 @@ private:
 	/* Fill HUDPersistentTabButtons with emtpy arrays for all tab types */
 	void InitHUDPersistentTabButtons();
 
+	/** 
+	 *	Get the info for every building and unit on the faction's rosters. Loads it from the 
+	 *	faction info cache if the cache is up to date, otherwise spawns every building and unit 
+	 *	then writes the cache. 
+	 */
+	void GatherSelectableInfo(TArray < FBuildingInfoCacheEntry > & OutBuildingEntries,
+		TArray < FUnitInfoCacheEntry > & OutUnitEntries);
+
+	/* Spawn one of every building/unit, fill an entry from it, then destroy it */
+	void SpawnBuildingsForInfo(TArray < FBuildingInfoCacheEntry > & OutEntries);
+	void SpawnUnitsForInfo(TArray < FUnitInfoCacheEntry > & OutEntries);
+
+	/* Bump this whenever a C++ change affects what ends up in FBuildingInfo/FUnitInfo e.g. a 
+	change to SetupBuildingInfo or a new UPROPERTY on them. Blueprint changes are picked up 
+	automatically */
+	static constexpr uint32 CACHE_VERSION = 2;
+
+	/* Hash of everything that could change what GatherSelectableInfo produces */
+	uint32 CalculateCacheKey() const;
+
+	/* Path to this faction's cache file */
+	FString GetCacheFilePath() const;
+
+	/* @return - true if the cache file existed and its key matched */
+	bool TryLoadSelectableInfoCache(uint32 CacheKey, TArray < FBuildingInfoCacheEntry > & OutBuildingEntries,
+		TArray < FUnitInfoCacheEntry > & OutUnitEntries) const;
+	void SaveSelectableInfoCache(uint32 CacheKey, TArray < FBuildingInfoCacheEntry > & BuildingEntries,
+		TArray < FUnitInfoCacheEntry > & UnitEntries) const;
+
 	/* Fills the PS array BuildingInfo with info on all the
 	buildings this faction can make. The ordering is the
 	order they were added in the editor */
-	void InitBuildingInfo();
+	void InitBuildingInfo(const TArray < FBuildingInfoCacheEntry > & Entries);
 
 	/* Fills the PS array UnitInfo with info on all the
 	units this faction can make. The ordering is the
 	order they were added in the editor */
-	void InitUnitInfo();
+	void InitUnitInfo(const TArray < FUnitInfoCacheEntry > & Entries);
 
 	/** 
 	 *	Checks if the ghost building has all the right properties to be
@@ -11,6 +11,7 @@
 #include "GameFramework/DamageType.h" // Now need this include for 4.20 for UDamageType FIXME if possible
 //#include "Statics/Structs_4.h"
 #include "Statics/Structs/Structs_7.h"
+#include "Managers/CommandRecording.h"
 #include "RTSGameInstance.generated.h"
 
 class AFactionInfo;
@@ -1383,6 +1384,34 @@ protected:
 	work after OpenLevel because widgets must get destroyed after map change */
 	FMatchInfo MatchInfo;
 
+
+	//==========================================================================================
+	//	Command Replays
+	//==========================================================================================
+
+public:
+
+	/* Whether the game was launched with -RTSReplay=Path and the recording loaded */
+	bool IsReplayingCommands() const;
+
+	FCommandReplayer & GetCommandReplayer();
+
+	/* Where to write the replay benchmark's timings */
+	const FString & GetReplayOutputPath() const;
+
+protected:
+
+	/* Open the blank persistent level and stream in the lobby map, then start the recorded match */
+	void LoadLobbyMapForReplay();
+
+	UFUNCTION()
+	void StartReplayMatch();
+
+	/* Lives here instead of on the GS so it survives the map changes before the match starts */
+	FCommandReplayer CommandReplayer;
+
+	FString ReplayOutputPath;
+
 public:
 
 	/** 
@@ -29,6 +29,9 @@
 #include "Managers/UpgradeManager.h"
 #include "Networking/RTSReplicationGraph.h"
 #include "MapElements/CommanderAbilities/CommanderAbilityBase.h"
+#include "Managers/BuffAndDebuffManager.h"
+#include "Managers/InfantryControllerTickManager.h"
+#include "Statics/CommandNetSerialization.h"
 
 
 //----------------------------------------------------------------------------------------------
@@ -102,6 +105,7 @@ ARTSGameState::ARTSGameState()
 	TimeWhenMatchStarted = -FLT_MAX;
 	NextUniquePlayerID = 1;
 	MatchLoadingStatus = ELoadingStatus::None;
+	NumGameTicksElapsed = 0;
 }
 
 void ARTSGameState::Tick(float DeltaTime)
@@ -110,9 +114,16 @@ void ARTSGameState::Tick(float DeltaTime)
 	Super::Tick(DeltaTime);
 
 #if MULTITHREADED_FOG_OF_WAR
-	MultithreadedFogOfWarManager::Get().OnGameThreadTick(DeltaTime);
+	{
+		BENCHMARK_SCOPE(FogOfWar);
+		MultithreadedFogOfWarManager::Get().OnGameThreadTick(DeltaTime);
+	}
 #endif
 
+	BENCHMARK_SCOPE(GameState);
+
+	PathDistanceFields.Tick();
+
 	if (HasAuthority())
 	{
 		/* Code that increments TickCounter. This code will only do one increment per frame but 
@@ -133,6 +144,12 @@ void ARTSGameState::Tick(float DeltaTime)
 			}
 
 			Server_RegenSelectableResources();
+
+			NumGameTicksElapsed++;
+			if (GI->IsReplayingCommands())
+			{
+				GI->GetCommandReplayer().OnGameTick(NumGameTicksElapsed, this);
+			}
 		}
 	}
 }
@@ -150,6 +167,26 @@ void ARTSGameState::BeginPlay()
 
 		ResourceSpots.Emplace(ResourceType, FResourcesArray());
 	}
+
+	if (HasAuthority())
+	{
+		/* Ability events from this frame get sent once every actor has ticked */
+		AbilityEventFlushHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &ARTSGameState::OnWorldPostActorTick);
+	}
+}
+
+void ARTSGameState::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+#if MULTITHREADED_FOG_OF_WAR
+	/* Stop fog thread before the world it reads selectables from goes away */
+	MultithreadedFogOfWarManager::Get().Shutdown();
+#endif
+
+	CommandRecorder.End(NumGameTicksElapsed);
+
+	FWorldDelegates::OnWorldPostActorTick.Remove(AbilityEventFlushHandle);
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void ARTSGameState::PreReplication(IRepChangedPropertyTracker & ChangedPropertyTracker)
@@ -402,8 +439,22 @@ void ARTSGameState::SetupForMatch(AObjectPoolingManager * InPoolingManager, uint
 	SetupCommanderAbilityEffects();
 	SetupTeamTags();
 
+	/* Map should be loaded by now */
+	const FBoxSphereBounds & MapBounds = GI->GetMapInfo(*Statics::GetMapName(GetWorld())).GetMapBounds();
+	PlacementGrid.Build(GetWorld(), MapBounds);
+	PathDistanceFields.Build(GetWorld(), MapBounds);
+	CommandNetSerialization::SetMapBounds(MapBounds);
+
+#if TICKABLE_BUFF_AND_DEBUFF_ENABLED_GAME
+	BuffAndDebuffManager = GetWorld()->SpawnActor<ABuffAndDebuffManager>(Statics::INFO_ACTOR_SPAWN_LOCATION,
+		FRotator::ZeroRotator);
+#endif
+
 	if (HasAuthority())
 	{
+		InfantryControllerTickManager = GetWorld()->SpawnActor<AInfantryControllerTickManager>(
+			Statics::INFO_ACTOR_SPAWN_LOCATION, FRotator::ZeroRotator);
+
 		if (GetNetDriver() != nullptr)
 		{
 			URTSReplicationGraph * ReplicationGraph = GetNetDriver()->GetReplicationDriver<URTSReplicationGraph>();
@@ -594,7 +645,7 @@ void ARTSGameState::OnBuildingPlaced(ABuilding * Building, ETeam Team, bool bIsS
 			if (i != Statics::TeamToArrayIndex(Team))
 			{
 				FVisibilityInfo & TeamVisibilityInfo = VisibilityInfo[i];
-				TeamVisibilityInfo.AddToMap(Building);
+				TeamVisibilityInfo.AddSelectable(Building);
 			}
 		}
 	}
@@ -657,7 +708,7 @@ void ARTSGameState::OnInfantryBuilt(AInfantry * Infantry, ETeam Team, bool bIsSe
 			if (i != Statics::TeamToArrayIndex(Team))
 			{
 				FVisibilityInfo & TeamVisibilityInfo = VisibilityInfo[i];
-				TeamVisibilityInfo.AddToMap(Infantry);
+				TeamVisibilityInfo.AddSelectable(Infantry);
 			}
 		}
 
@@ -733,6 +784,7 @@ void ARTSGameState::OnInfantryZeroHealth(AInfantry * Infantry, bool bIsServer)
 
 		if (NumItemsDropped > 0)
 		{
+			FlushAbilityEvents();
 			/* Multicast death event to all clients */
 			Multicast_OnSelectableZeroHealth(Infantry, Loc.X, Loc.Y, Loc.Z, Infantry->GetActorRotation().Yaw);
 		}
@@ -781,13 +833,15 @@ void ARTSGameState::OnSelectableDestroyed(AActor * Selectable, ETeam Team, bool
 	
 	if (bIsServer)
 	{
-		/* Remove Selectable from every map that is not for Team */
+		const ISelectable * AsSelectable = CastChecked<ISelectable>(Selectable);
+		
+		/* Remove Selectable from every team's visibility info that is not for Team */
 		for (uint8 i = 0; i < NumTeams; ++i)
 		{
 			if (i != Statics::TeamToArrayIndex(Team))
 			{
 				FVisibilityInfo & TeamVisibilityInfo = VisibilityInfo[i];
-				TeamVisibilityInfo.RemoveFromMap(Selectable);
+				TeamVisibilityInfo.RemoveSelectable(AsSelectable);
 			}
 		}
 	}
@@ -895,6 +949,8 @@ EGameWarning ARTSGameState::Server_TryPutItemInInventory(ISelectable * Selectabl
 			PlayItemAquireParticles(SelectableGettingItem, LastItemsInfo->GetAquireParticles());
 		}
 
+		FlushAbilityEvents();
+
 		/* This function will need to put the item in inventory just like the other 2
 		multicast functions right above and below this and it will need to call
 		ISelectable::OnItemPurchasedFromHere on the shop to update HUD. */
@@ -959,11 +1015,13 @@ EGameWarning ARTSGameState::Server_TryPutItemInInventory(ISelectable * Selectabl
 			ItemOnGround->OnPickedUp(SelectableGettingItem, this, SelectableGettingItem->GetLocalPC());
 
 			// Tell clients what happened
+			FlushAbilityEvents();
 			Multicast_PutItemInInventoryFromGround(SelectableGettingItem, ItemOnGround->GetUniqueID());
 		}
 		else
 		{
 			// Tell clients what happened
+			FlushAbilityEvents();
 			Multicast_PutItemInInventory(SelectableGettingItem, ItemType, Quantity, ReasonForAquiringItem);
 		}
 	}
@@ -1439,6 +1497,12 @@ ARTSPlayerState * ARTSGameState::GetPlayerFromID(uint8 InRTSPlayerID) const
 	return PlayerIDMap[InRTSPlayerID];
 }
 
+ARTSPlayerState * ARTSGameState::FindPlayerFromID(uint8 InRTSPlayerID) const
+{
+	ARTSPlayerState * const * Player = PlayerIDMap.Find(InRTSPlayerID);
+	return (Player != nullptr) ? *Player : nullptr;
+}
+
 FVisibilityInfo & ARTSGameState::GetTeamVisibilityInfo(ETeam Team)
 {
 	const int32 Index = Statics::TeamToArrayIndex(Team);
@@ -1500,6 +1564,46 @@ const FCollisionResponseContainer & ARTSGameState::GetAllTeamsCollisionResponseC
 	return AllTeams_Overlap;
 }
 
+const FSelectableSpatialGrid & ARTSGameState::GetSelectableGrid()
+{
+	SelectableGrid.RebuildIfStale(this);
+	return SelectableGrid;
+}
+
+const FBuildingPlacementGrid & ARTSGameState::GetPlacementGrid() const
+{
+	return PlacementGrid;
+}
+
+FPathDistanceFields & ARTSGameState::GetPathDistanceFields()
+{
+	return PathDistanceFields;
+}
+
+const FPathDistanceFields & ARTSGameState::GetPathDistanceFields() const
+{
+	return PathDistanceFields;
+}
+
+uint32 ARTSGameState::GetTeamMask(ETeam Team) const
+{
+	return 1u << Statics::TeamToArrayIndex(Team);
+}
+
+uint32 ARTSGameState::GetEnemyTeamsMask(ETeam Team) const
+{
+	const uint32 AllTeamsMask = (1u << NumTeams) - 1;
+	return AllTeamsMask & ~GetTeamMask(Team);
+}
+
+void ARTSGameState::UpdateSelectableFlags(const ISelectable * Selectable)
+{
+	const FSelectableFlags Flags = Selectable->GetAttributesBase().GetSelectableFlags();
+	assert(Flags.IsInitialized());
+
+	SelectableFlagsTable[FVisibilityInfo::GetBitIndex(Flags.GetOwnerID(), Selectable->GetSelectableID())] = Flags;
+}
+
 ECollisionChannel ARTSGameState::GetTeamCollisionChannel(ETeam Team) const
 {
 	const int32 Index = Statics::TeamToArrayIndex(Team);
@@ -1540,6 +1644,16 @@ AFogOfWarManager * ARTSGameState::GetFogManager() const
 }
 #endif
 
+ABuffAndDebuffManager * ARTSGameState::GetBuffAndDebuffManager() const
+{
+	return BuffAndDebuffManager;
+}
+
+AInfantryControllerTickManager * ARTSGameState::GetInfantryControllerTickManager() const
+{
+	return InfantryControllerTickManager;
+}
+
 
 //==============================================================================================
 //	Lobby 
@@ -2528,6 +2642,8 @@ void ARTSGameState::StartMatch(const TMap < ARTSPlayerState *, FStartingSelectab
 	/* Start the match clock */
 	StartMatchTimer();
 
+	SetupCommandRecordingOrReplay();
+
 	/* Start CPU players behavior */
 	StartCPUPlayerBehavior(StartingSelectables);
 
@@ -2542,6 +2658,42 @@ void ARTSGameState::StartMatch(const TMap < ARTSPlayerState *, FStartingSelectab
 	I do it in GM when setting up for PIE */
 }
 
+void ARTSGameState::SetupCommandRecordingOrReplay()
+{
+	/* Seed the random streams so a replay of this match starts from the same place as 
+	the recording did */
+	if (GI->IsReplayingCommands())
+	{
+		const int32 RandomSeed = GI->GetCommandReplayer().GetHeader().RandomSeed;
+		FMath::RandInit(RandomSeed);
+		FMath::SRandInit(RandomSeed);
+
+		GI->GetCommandReplayer().OnMatchStarted(GI->GetMatchInfo(), GI->GetReplayOutputPath());
+		return;
+	}
+
+	FString RecordingPath;
+	if (!FParse::Value(FCommandLine::Get(), TEXT("RTSRecordCommands="), RecordingPath))
+	{
+		if (!FParse::Param(FCommandLine::Get(), TEXT("RTSRecordCommands")))
+		{
+			return;
+		}
+
+		RecordingPath = FPaths::ProjectSavedDir() / TEXT("CommandRecordings") 
+			/ FDateTime::Now().ToString() + TEXT(".rtsrec");
+	}
+
+	const int32 RandomSeed = static_cast<int32>(FPlatformTime::Cycles());
+	FMath::RandInit(RandomSeed);
+	FMath::SRandInit(RandomSeed);
+
+	FCommandRecordingHeader Header;
+	Header.SetFromMatchInfo(GI->GetMatchInfo());
+	Header.RandomSeed = RandomSeed;
+	CommandRecorder.Begin(RecordingPath, Header);
+}
+
 void ARTSGameState::Multicast_OnMatchStarted_Implementation()
 {
 	if (GetWorld()->IsServer())
@@ -9,6 +9,10 @@
 #include "Statics/Structs_2.h"
 #include "Statics/Structs_3.h"
 #include "Statics/Structs_4.h"
+#include "Managers/SelectableSpatialGrid.h"
+#include "Managers/BuildingPlacementGrid.h"
+#include "Managers/PathDistanceFields.h"
+#include "Managers/CommandRecording.h"
 #if MULTITHREADED_FOG_OF_WAR
 #include "Managers/MultithreadedFogOfWar.h"
 #endif
@@ -16,12 +20,15 @@
 
 class ARTSPlayerState;
 class AFogOfWarManager;
+class ABuffAndDebuffManager;
+class AInfantryControllerTickManager;
 class ARTSPlayerController;
 class AObjectPoolingManager;
 class AProjectileBase;
 class ACPUPlayerAIController;
 class URTSGameInstance;
 class FOnlineSessionSettings;
+class ISelectable;
 class ULobbySlot;
 struct FMapInfo;
 struct FMatchInfo;
@@ -110,6 +117,8 @@ private:
 
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	virtual void PreReplication(IRepChangedPropertyTracker & ChangedPropertyTracker) override;
 
 	virtual void GetLifetimeReplicatedProps(TArray< FLifetimeProperty > & OutLifetimeProps) const override;
@@ -123,6 +132,13 @@ private:
 	UPROPERTY(ReplicatedUsing = OnRep_TickCounter)
 	uint8 TickCounter;
 
+	/* [Server] How many times TickCounter has been incremented this match. Unlike TickCounter 
+	this does not overflow. Command recordings are timed with it */
+	uint32 NumGameTicksElapsed;
+
+	/* [Server] Writes the commands players issue to a file if launched with -RTSRecordCommands */
+	FCommandRecorder CommandRecorder;
+
 	/* [Server] Stores a pointer to selectables that have a selectable 
 	resource that thas a regen rate != 0 */
 	TArray < ISelectable * > Server_SelectableResourceUsersThatRegen;
@@ -190,6 +206,15 @@ private:
 	UPROPERTY()
 	AFogOfWarManager * FogManager;
 
+	/* Ticks every selectable's tickable buffs/debuffs. Spawned on all machines when a match 
+	is setup */
+	UPROPERTY()
+	ABuffAndDebuffManager * BuffAndDebuffManager;
+
+	/* Ticks every infantry AI controller. Server only */
+	UPROPERTY()
+	AInfantryControllerTickManager * InfantryControllerTickManager;
+
 	/* Modified on server only. Accessed by the fog of war manager
 	on the server. Holds all info about the visibiliy of all
 	selectables for all teams. Used to avoid sending updates over
@@ -240,6 +265,22 @@ private:
 	UPROPERTY()
 	TArray<FUint64Array> EnemyTraceChannels;
 
+	/* Positions of every team's units and buildings for range queries. Raw pointers but 
+	rebuilt every frame it is used */
+	FSelectableSpatialGrid SelectableGrid;
+
+	/* Ground heights for rejecting building locations without doing ground traces */
+	FBuildingPlacementGrid PlacementGrid;
+
+	/* Walking distances from resource depots. Raw pointers but depots are removed when they 
+	reach zero health */
+	FPathDistanceFields PathDistanceFields;
+
+	/* FSelectableFlags of every selectable owned by a player. 
+	Index = FVisibilityInfo::GetBitIndex(OwnerID, SelectableID). Each selectable writes its own 
+	entry through UpdateSelectableFlags whenever its flags change */
+	FSelectableFlags SelectableFlagsTable[ProjectSettings::MAX_NUM_PLAYERS * FVisibilityInfo::BITS_PER_PLAYER];
+
 	/* Maps team to all the trace channels for their enemies 
 	Key = Statics::TeamToArrayIndex(Team) */
 	TArray<FCollisionObjectQueryParams> EnemyQueryParams;
@@ -311,6 +352,12 @@ public:
 	to derive the total length of the match */
 	uint8 GetGameTickCounter() const;
 
+	/* [Server] Number of game ticks since the match started */
+	uint32 GetNumGameTicksElapsed() const { return NumGameTicksElapsed; }
+
+	/* [Server] Check IsRecording before using */
+	FCommandRecorder & GetCommandRecorder() { return CommandRecorder; }
+
 	AObjectPoolingManager * GetObjectPoolingManager() const;
 
 	/* Called when a selectable is built. Updates fog of war visiblity map
@@ -396,714 +443,44 @@ public:
 protected:
 
 	//===========================================================================================
-	//	A lot of RPCs for sending the event of the use of an ability to clients
+	//	Sending the use of abilities to clients
 	//===========================================================================================
-	//	Note to self: could go a step further and distinguish between whether the ability needs 
-	//	the result byte sent. If it only has one outcome then can avoid sending this
+	//	Every context menu ability and inventory item use on the server becomes an FAbilityEvent 
+	//	that only holds what that ability needs. They are queued up and sent in one reliable 
+	//	multicast at the end of the frame.
 	//
-	//	Also if replication graph allows then we can choose to make these unreliable for 
-	//	match observers
+	//	Anything else that is multicast and could change how an event is interpreted on clients 
+	//	(a selectable reaching zero health or levelling up, upgrades completing, inventory changes, 
+	//	commander and building targeting abilities) should call FlushAbilityEvents first so clients get everything in the order it 
+	//	happened on the server.
 	//-------------------------------------------------------------------------------------------
 
-	// First some helper functions for these RPCs
-	
 	/* Return true if we are executing code on the server */
 	bool IsServer() const;
-	
-	/* Checks if the instigator is valid or whatever: in a state that the ability can go through. 
-	If false then this func will add the function data to a container to have it executed later. 
-	See the first ability RPC for kind of how this should be done, but it probably needs changing 
-	quite a bit */
-	bool AbilityMulticasts_PassedInstigatorValidChecks(AActor * InInstigator);
-
-	/* Checks that both the instigator and target are both valid or whatever and the ability 
-	can go through. If false then this function will handle adding the RPC to whatever 
-	container or whatever that processes them later */
-	bool AbilityMulticasts_PassedInstigatorAndTargetValidChecks(AActor * InInstigator, AActor * InTarget);
-
-	//===========================================================================================
-	//	Context menu ability usage RPCs
-	//===========================================================================================
-
-	/* Except for the first one which I have already added to, the other 47 need the param
-	TickCounterOnServerAtTimeOfAbility added to them */
-
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoEMultipleHitOutcomesWithTargetWithLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits,
-		FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoESingleHitOutcomeWithTargetWithLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits,
-		FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoEMultipleHitOutcomesWithTargetWithLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget,
-		const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoESingleHitOutcomeWithTargetWithLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget,
-		const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoEMultipleHitOutcomesWithTargetNoLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget,
-		int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoESingleHitOutcomeWithTargetNoLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget,
-		int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoEMultipleHitOutcomesWithTargetNoLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoESingleHitOutcomeWithTargetNoLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoEMultipleHitOutcomesNoTargetWithLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, const FVector_NetQuantize & Location,
-		int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoESingleHitOutcomeNoTargetWithLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, const FVector_NetQuantize & Location,
-		int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoEMultipleHitOutcomesNoTargetWithLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoESingleHitOutcomeNoTargetWithLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoEMultipleHitOutcomesNoTargetNoLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoESingleHitOutcomeNoTargetNoLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoEMultipleHitOutcomesNoTargetNoLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoESingleHitOutcomeNoTargetNoLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeNotAoEWithTargetWithLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location,
-		int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeNotAoEWithTargetWithLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeNotAoEWithTargetNoLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, FSelectableIdentifier AbilityTarget, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeNotAoEWithTargetNoLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, FSelectableIdentifier AbilityTarget);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeNotAoENoTargetWithLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const FVector_NetQuantize & Location, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeNotAoENoTargetWithLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeNotAoENoTargetNoLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeNotAoENoTargetNoLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoEMultipleHitOutcomesWithTargetWithLocationRandom(EContextButton AbilityType, 
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits,
-		FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoESingleHitOutcomeWithTargetWithLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits,
-		FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoEMultipleHitOutcomesWithTargetWithLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget,
-		const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoESingleHitOutcomeWithTargetWithLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget,
-		const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoEMultipleHitOutcomesWithTargetNoLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget,
-		int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoESingleHitOutcomeWithTargetNoLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget,
-		int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoEMultipleHitOutcomesWithTargetNoLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoESingleHitOutcomeWithTargetNoLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoEMultipleHitOutcomesNoTargetWithLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, const FVector_NetQuantize & Location,
-		int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoESingleHitOutcomeNoTargetWithLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, const FVector_NetQuantize & Location,
-		int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoEMultipleHitOutcomesNoTargetWithLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoESingleHitOutcomeNoTargetWithLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoEMultipleHitOutcomesNoTargetNoLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoESingleHitOutcomeNoTargetNoLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoEMultipleHitOutcomesNoTargetNoLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoESingleHitOutcomeNoTargetNoLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeNotAoEWithTargetWithLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location,
-		int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeNotAoEWithTargetWithLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeNotAoEWithTargetNoLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, FSelectableIdentifier AbilityTarget, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeNotAoEWithTargetNoLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, FSelectableIdentifier AbilityTarget);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeNotAoENoTargetWithLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const FVector_NetQuantize & Location, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeNotAoENoTargetWithLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeNotAoENoTargetNoLocationRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeNotAoENoTargetNoLocationNotRandom(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator);
 
-	//===========================================================================================
-	//	RPCs for inventory slot usage. 
-	//-------------------------------------------------------------------------------------------
-	//	These are exactly the same except they just replace the EContextButton param with the 
-	//	slot index instead. Using that we can derive what ability type it is.
-	//===========================================================================================
+	/* Events waiting to be sent to clients */
+	TArray < FAbilityEvent > PendingAbilityEvents;
 
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoEMultipleHitOutcomesWithTargetWithLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits,
-		FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location, int16 RandomNumberSeed,
-		uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoESingleHitOutcomeWithTargetWithLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits,
-		FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoEMultipleHitOutcomesWithTargetWithLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget,
-		const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoESingleHitOutcomeWithTargetWithLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget,
-		const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoEMultipleHitOutcomesWithTargetNoLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget,
-		int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoESingleHitOutcomeWithTargetNoLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget,
-		int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoEMultipleHitOutcomesWithTargetNoLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoESingleHitOutcomeWithTargetNoLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoEMultipleHitOutcomesNoTargetWithLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, const FVector_NetQuantize & Location,
-		int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoESingleHitOutcomeNoTargetWithLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, const FVector_NetQuantize & Location,
-		int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoEMultipleHitOutcomesNoTargetWithLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoESingleHitOutcomeNoTargetWithLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoEMultipleHitOutcomesNoTargetNoLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoESingleHitOutcomeNoTargetNoLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoEMultipleHitOutcomesNoTargetNoLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoESingleHitOutcomeNoTargetNoLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeNotAoEWithTargetWithLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location,
-		int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeNotAoEWithTargetWithLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeNotAoEWithTargetNoLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, FSelectableIdentifier AbilityTarget, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeNotAoEWithTargetNoLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, FSelectableIdentifier AbilityTarget);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeNotAoENoTargetWithLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const FVector_NetQuantize & Location, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeNotAoENoTargetWithLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeNotAoENoTargetNoLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeNotAoENoTargetNoLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoEMultipleHitOutcomesWithTargetWithLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits,
-		FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoESingleHitOutcomeWithTargetWithLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits,
-		FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoEMultipleHitOutcomesWithTargetWithLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget,
-		const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoESingleHitOutcomeWithTargetWithLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget,
-		const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoEMultipleHitOutcomesWithTargetNoLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget,
-		int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoESingleHitOutcomeWithTargetNoLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget,
-		int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoEMultipleHitOutcomesWithTargetNoLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoESingleHitOutcomeWithTargetNoLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoEMultipleHitOutcomesNoTargetWithLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, const FVector_NetQuantize & Location,
-		int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoESingleHitOutcomeNoTargetWithLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, const FVector_NetQuantize & Location,
-		int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoEMultipleHitOutcomesNoTargetWithLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoESingleHitOutcomeNoTargetWithLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoEMultipleHitOutcomesNoTargetNoLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoESingleHitOutcomeNoTargetNoLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoEMultipleHitOutcomesNoTargetNoLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoESingleHitOutcomeNoTargetNoLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeNotAoEWithTargetWithLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location,
-		int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeNotAoEWithTargetWithLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeNotAoEWithTargetNoLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, FSelectableIdentifier AbilityTarget, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeNotAoEWithTargetNoLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, FSelectableIdentifier AbilityTarget);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeNotAoENoTargetWithLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, const FVector_NetQuantize & Location, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeNotAoENoTargetWithLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, const FVector_NetQuantize & Location);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeNotAoENoTargetNoLocationRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator, int16 RandomNumberSeed);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfInventorySlotUse_SingleOutcomeNotAoENoTargetNoLocationNotRandom(uint8 ServerInventorySlotIndex,
-		FSelectableIdentifier AbilityInstigator);
+	/* Handle for the end of frame flush. Server only */
+	FDelegateHandle AbilityEventFlushHandle;
 
+	/* Add an event to be sent at the end of the frame */
+	void QueueAbilityEvent(FAbilityEvent && Event);
 
-	//===========================================================================================
-	//	Another 96 multicast RPCs... these are all the 96 above except they also send the 
-	//	server's RTS tick counter.
-	//===========================================================================================
+	/* Bound to FWorldDelegates::OnWorldPostActorTick */
+	void OnWorldPostActorTick(UWorld * World, ELevelTick TickType, float DeltaSeconds);
 
 	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoEMultipleHitOutcomesWithTargetWithLocationRandomWithTickCount(EContextButton AbilityType,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits,
-			FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location, int16 RandomNumberSeed,
-			uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoESingleHitOutcomeWithTargetWithLocationRandomWithTickCount(EContextButton AbilityType,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits,
-			FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoEMultipleHitOutcomesWithTargetWithLocationNotRandomWithTickCount(EContextButton AbilityType,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget,
-			const FVector_NetQuantize & Location, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoESingleHitOutcomeWithTargetWithLocationNotRandomWithTickCount(EContextButton AbilityType,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget,
-			const FVector_NetQuantize & Location, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoEMultipleHitOutcomesWithTargetNoLocationRandomWithTickCount(EContextButton AbilityType,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget,
-			int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoESingleHitOutcomeWithTargetNoLocationRandomWithTickCount(EContextButton AbilityType,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget,
-			int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoEMultipleHitOutcomesWithTargetNoLocationNotRandomWithTickCount(EContextButton AbilityType,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget, 
-			uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoESingleHitOutcomeWithTargetNoLocationNotRandomWithTickCount(EContextButton AbilityType,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget, 
-			uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoEMultipleHitOutcomesNoTargetWithLocationRandomWithTickCount(EContextButton AbilityType,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, const FVector_NetQuantize & Location,
-			int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoESingleHitOutcomeNoTargetWithLocationRandomWithTickCount(EContextButton AbilityType,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, const FVector_NetQuantize & Location,
-			int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoEMultipleHitOutcomesNoTargetWithLocationNotRandomWithTickCount(EContextButton AbilityType,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, const FVector_NetQuantize & Location, 
-			uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoESingleHitOutcomeNoTargetWithLocationNotRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, const FVector_NetQuantize & Location, 
-		uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoEMultipleHitOutcomesNoTargetNoLocationRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoESingleHitOutcomeNoTargetNoLocationRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoEMultipleHitOutcomesNoTargetNoLocationNotRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeAoESingleHitOutcomeNoTargetNoLocationNotRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeNotAoEWithTargetWithLocationRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location,
-		int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeNotAoEWithTargetWithLocationNotRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeNotAoEWithTargetNoLocationRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, FSelectableIdentifier AbilityTarget, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeNotAoEWithTargetNoLocationNotRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, FSelectableIdentifier AbilityTarget, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeNotAoENoTargetWithLocationRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const FVector_NetQuantize & Location, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeNotAoENoTargetWithLocationNotRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const FVector_NetQuantize & Location, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeNotAoENoTargetNoLocationRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_MultipleOutcomeNotAoENoTargetNoLocationNotRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoEMultipleHitOutcomesWithTargetWithLocationRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits,
-		FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoESingleHitOutcomeWithTargetWithLocationRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits,
-		FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoEMultipleHitOutcomesWithTargetWithLocationNotRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget,
-		const FVector_NetQuantize & Location, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoESingleHitOutcomeWithTargetWithLocationNotRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget,
-		const FVector_NetQuantize & Location, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoEMultipleHitOutcomesWithTargetNoLocationRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget,
-		int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoESingleHitOutcomeWithTargetNoLocationRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget,
-		int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoEMultipleHitOutcomesWithTargetNoLocationNotRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoESingleHitOutcomeWithTargetNoLocationNotRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoEMultipleHitOutcomesNoTargetWithLocationRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, const FVector_NetQuantize & Location,
-		int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoESingleHitOutcomeNoTargetWithLocationRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, const FVector_NetQuantize & Location,
-		int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoEMultipleHitOutcomesNoTargetWithLocationNotRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, const FVector_NetQuantize & Location, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoESingleHitOutcomeNoTargetWithLocationNotRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, const FVector_NetQuantize & Location, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoEMultipleHitOutcomesNoTargetNoLocationRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoESingleHitOutcomeNoTargetNoLocationRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoEMultipleHitOutcomesNoTargetNoLocationNotRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeAoESingleHitOutcomeNoTargetNoLocationNotRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeNotAoEWithTargetWithLocationRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location,
-		int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeNotAoEWithTargetWithLocationNotRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeNotAoEWithTargetNoLocationRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, FSelectableIdentifier AbilityTarget, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeNotAoEWithTargetNoLocationNotRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, FSelectableIdentifier AbilityTarget, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeNotAoENoTargetWithLocationRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const FVector_NetQuantize & Location, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeNotAoENoTargetWithLocationNotRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, const FVector_NetQuantize & Location, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeNotAoENoTargetNoLocationRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_NotifyOfAbilityUse_SingleOutcomeNotAoENoTargetNoLocationNotRandomWithTickCount(EContextButton AbilityType,
-		FSelectableIdentifier AbilityInstigator, uint8 TickCounterOnServerAtTimeOfAbility);
-
-	// The inventory ones
+	void Multicast_OnAbilityEvents(const TArray < FAbilityEvent > & Events);
 
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoEMultipleHitOutcomesWithTargetWithLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits,
-			FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location, int16 RandomNumberSeed,
-			uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoESingleHitOutcomeWithTargetWithLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits,
-			FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoEMultipleHitOutcomesWithTargetWithLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget,
-			const FVector_NetQuantize & Location, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoESingleHitOutcomeWithTargetWithLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget,
-			const FVector_NetQuantize & Location, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoEMultipleHitOutcomesWithTargetNoLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget,
-			int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoESingleHitOutcomeWithTargetNoLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget,
-			int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoEMultipleHitOutcomesWithTargetNoLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoESingleHitOutcomeWithTargetNoLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoEMultipleHitOutcomesNoTargetWithLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, const FVector_NetQuantize & Location,
-			int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoESingleHitOutcomeNoTargetWithLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, const FVector_NetQuantize & Location,
-			int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoEMultipleHitOutcomesNoTargetWithLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, const FVector_NetQuantize & Location, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoESingleHitOutcomeNoTargetWithLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, const FVector_NetQuantize & Location, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoEMultipleHitOutcomesNoTargetNoLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoESingleHitOutcomeNoTargetNoLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoEMultipleHitOutcomesNoTargetNoLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FAbilityHitWithOutcome > & Hits, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeAoESingleHitOutcomeNoTargetNoLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const TArray < FSelectableIdentifier > & Hits, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeNotAoEWithTargetWithLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location,
-			int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeNotAoEWithTargetWithLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeNotAoEWithTargetNoLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, FSelectableIdentifier AbilityTarget, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeNotAoEWithTargetNoLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, FSelectableIdentifier AbilityTarget, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeNotAoENoTargetWithLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const FVector_NetQuantize & Location, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeNotAoENoTargetWithLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, const FVector_NetQuantize & Location, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeNotAoENoTargetNoLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_MultipleOutcomeNotAoENoTargetNoLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, EAbilityOutcome Outcome, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoEMultipleHitOutcomesWithTargetWithLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits,
-			FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoESingleHitOutcomeWithTargetWithLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits,
-			FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoEMultipleHitOutcomesWithTargetWithLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget,
-			const FVector_NetQuantize & Location, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoESingleHitOutcomeWithTargetWithLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget,
-			const FVector_NetQuantize & Location, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoEMultipleHitOutcomesWithTargetNoLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget,
-			int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoESingleHitOutcomeWithTargetNoLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget,
-			int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoEMultipleHitOutcomesWithTargetNoLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, FSelectableIdentifier AbilityTarget, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoESingleHitOutcomeWithTargetNoLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, FSelectableIdentifier AbilityTarget, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoEMultipleHitOutcomesNoTargetWithLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, const FVector_NetQuantize & Location,
-			int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoESingleHitOutcomeNoTargetWithLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, const FVector_NetQuantize & Location,
-			int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoEMultipleHitOutcomesNoTargetWithLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, const FVector_NetQuantize & Location, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoESingleHitOutcomeNoTargetWithLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, const FVector_NetQuantize & Location, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoEMultipleHitOutcomesNoTargetNoLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoESingleHitOutcomeNoTargetNoLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoEMultipleHitOutcomesNoTargetNoLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, const TArray < FAbilityHitWithOutcome > & Hits, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeAoESingleHitOutcomeNoTargetNoLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, const TArray < FSelectableIdentifier > & Hits, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeNotAoEWithTargetWithLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location,
-			int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeNotAoEWithTargetWithLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, FSelectableIdentifier AbilityTarget, const FVector_NetQuantize & Location, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeNotAoEWithTargetNoLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, FSelectableIdentifier AbilityTarget, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeNotAoEWithTargetNoLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, FSelectableIdentifier AbilityTarget, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeNotAoENoTargetWithLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, const FVector_NetQuantize & Location, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeNotAoENoTargetWithLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, const FVector_NetQuantize & Location, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeNotAoENoTargetNoLocationRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, int16 RandomNumberSeed, uint8 TickCounterOnServerAtTimeOfAbility);
-	UFUNCTION(NetMulticast, Reliable)
-		void Multicast_NotifyOfInventorySlotUse_SingleOutcomeNotAoENoTargetNoLocationNotRandomWithTickCount(uint8 ServerInventorySlotIndex,
-			FSelectableIdentifier AbilityInstigator, uint8 TickCounterOnServerAtTimeOfAbility);
+	/* Carry out an ability on a client */
+	void Client_OnAbilityEvent(const FAbilityEvent & Event);
 
 public:
 
+	/* [Server] Send any ability events that are waiting to clients now */
+	void FlushAbilityEvents();
+
 	//===========================================================================================
 	//	Commander Abilities
 	//===========================================================================================
@@ -1384,6 +761,10 @@ public:
 	/* Get the player state given a player's uint8 ID */
 	ARTSPlayerState * GetPlayerFromID(uint8 InRTSPlayerID) const;
 
+	/* Version of GetPlayerFromID that returns null if no player has the ID e.g. because it 
+	came from a client */
+	ARTSPlayerState * FindPlayerFromID(uint8 InRTSPlayerID) const;
+
 	/* Get reference to the visibility info of a team */
 	FVisibilityInfo & GetTeamVisibilityInfo(ETeam Team);
 	const FVisibilityInfo & GetTeamVisibilityInfo(ETeam Team) const;
@@ -1421,11 +802,42 @@ public:
 
 	ECollisionChannel GetNeutralTeamCollisionChannel() const;
 
+	/** 
+	 *	Get the grid of every team's selectables, rebuilding it first if it has not been built 
+	 *	yet this frame. Prefer this over sweeping against team collision channels
+	 */
+	const FSelectableSpatialGrid & GetSelectableGrid();
+
+	const FBuildingPlacementGrid & GetPlacementGrid() const;
+
+	FPathDistanceFields & GetPathDistanceFields();
+	const FPathDistanceFields & GetPathDistanceFields() const;
+
+	/* Masks to pass into FSelectableSpatialGrid::QueryRadius */
+	uint32 GetTeamMask(ETeam Team) const;
+	uint32 GetEnemyTeamsMask(ETeam Team) const;
+
+	/* Copy a player owned selectable's flags from its attributes into the flags table. Call 
+	after setting them up and whenever they change */
+	void UpdateSelectableFlags(const ISelectable * Selectable);
+
+	/* Flags of a player owned selectable. Cheaper than going through the selectable when the 
+	IDs are already known */
+	FORCEINLINE FSelectableFlags GetSelectableFlags(uint8 OwnerID, uint8 SelectableID) const
+	{
+		return SelectableFlagsTable[FVisibilityInfo::GetBitIndex(OwnerID, SelectableID)];
+	}
+
 #if !MULTITHREADED_FOG_OF_WAR
 	void SetFogManager(AFogOfWarManager * InFogManager);
 	AFogOfWarManager * GetFogManager() const;
 #endif
 
+	ABuffAndDebuffManager * GetBuffAndDebuffManager() const;
+
+	/* Only valid on server */
+	AInfantryControllerTickManager * GetInfantryControllerTickManager() const;
+
 
 	//==========================================================================================
 	//	Lobby 
@@ -1761,6 +1173,10 @@ protected:
 	/* Start the timer that says how long match has been going for */
 	void StartMatchTimer();
 
+	/* Seed random number generation and start recording commands, or start replaying them if 
+	the game was launched to replay a recording */
+	void SetupCommandRecordingOrReplay();
+
 	/* Start all CPU player behavior 
 	@param StartingSelectables - maps player state to the selectables they started match with */
 	void StartCPUPlayerBehavior(const TMap <ARTSPlayerState *, FStartingSelectables>& StartingSelectables);
@@ -58,6 +58,8 @@
 #include "UI/MainMenuAndInMatch/ControlSettingsMenu.h"
 #include "UI/MainMenuAndInMatch/SettingsMenu.h"
 #include "UI/MainMenuAndInMatch/VideoSettingsMenu.h"
+#include "Managers/CommandRecording.h"
+#include "Managers/GroupMovement.h"
 
 
 /* --------------------------------
@@ -5543,6 +5545,19 @@ void ARTSPlayerController::Server_PlaceBuilding_Implementation(EBuildingType Bui
 	const FBuildingInfo * const BuildingInfo = FactionInfo->GetBuildingInfo(BuildingType);
 	const EBuildingBuildMethod BuildMethod = BuildingInfo->GetBuildingBuildMethod();
 
+	/* For these build methods it is the worker that calls this once it reaches the site. 
+	Replaying the lay foundation command will get the worker to do that again */
+	if (IsRecordingCommands() && BuildMethod != EBuildingBuildMethod::LayFoundationsWhenAtLocation
+		&& BuildMethod != EBuildingBuildMethod::Protoss)
+	{
+		FRecordedCommand Record(ERecordedCommandType::PlaceBuilding);
+		Record.SubType = static_cast<uint8>(BuildingType);
+		Record.Location = Location;
+		Record.Rotation = Rotation;
+		Record.ExtraID = ConstructionInstigatorID;
+		RecordCommand(Record);
+	}
+
 	/* For BuildsInTab build method only. Actor that produced building */
 	ABuilding * BuildsInTabProducer_Building = nullptr;
 
@@ -6784,6 +6799,16 @@ void ARTSPlayerController::Server_GiveLayFoundationCommand_Implementation(EBuild
 	/* Check builder is still valid and if so give order to go lay foundations. No additional
 	checks are made - they will be made when selectable calls Server_PlaceBuilding when at
 	construction site */
+	if (IsRecordingCommands())
+	{
+		FRecordedCommand Record(ERecordedCommandType::LayFoundation);
+		Record.SubType = static_cast<uint8>(BuildingType);
+		Record.Location = Location;
+		Record.Rotation = Rotation;
+		Record.ExtraID = BuildersID;
+		RecordCommand(Record);
+	}
+
 	AActor * Builder = PS->GetSelectableFromID(BuildersID);
 	if (Statics::IsValid(Builder) && !Statics::HasZeroHealth(Builder))
 	{
@@ -6819,93 +6844,33 @@ void ARTSPlayerController::PrepareContextCommandRPC(EContextButton CommandType,
 	way too */
 
 	/* Check if we need to send the selectable IDs because the selectables we are
-	issuing orders to are different from the group of the last order */
-	bool bSendNewIDs = false;
-
-	if (SelectedIDs.Num() == CommandIDs.Num())
-	{
-		for (const auto & Elem : CommandIDs)
-		{
-			if (!SelectedIDs.Contains(Elem))
-			{
-				bSendNewIDs = true;
-				break;
-			}
-		}
-	}
-	else
-	{
-		bSendNewIDs = true;
-	}
+	issuing orders to are different from the group of the last order. If they are the 
+	server will use the selectables already in Selected server-side */
+	bool bIsDelta;
+	TArray < uint8 > GroupIDs;
+	const bool bSameGroup = GetCommandGroupToSend(GroupIDs, bIsDelta);
 
-	if (bSendNewIDs)
-	{
-		CommandIDs.Reset();
+	FContextCommandWithTarget Command = FContextCommandWithTarget(CommandType, bSameGroup, ClickLoc,
+		ClickTarget);
+	Command.bGroupIsDelta = bIsDelta;
+	Command.AffectedSelectables = MoveTemp(GroupIDs);
 
-		FContextCommandWithTarget Command = FContextCommandWithTarget(CommandType, false, ClickLoc,
-			ClickTarget);
-
-		/* Attach selectables affected by command to it and remember what we sent */
-		for (const auto & SelectableID : SelectedIDs)
-		{
-			Command.AddSelectable(SelectableID);
-			CommandIDs.Emplace(SelectableID);
-		}
-
-		Server_IssueContextCommand(Command);
-	}
-	else
-	{
-		/* Server will use the selectable already in Selected server-side */
-		const FContextCommandWithTarget Command = FContextCommandWithTarget(CommandType, true, 
-			ClickLoc, ClickTarget);
-		Server_IssueContextCommand(Command);
-	}
+	Server_IssueContextCommand(Command);
 }
 
 void ARTSPlayerController::PrepareContextCommandRPC(EContextButton CommandType, const FVector & ClickLoc)
 {
 	assert(!GetWorld()->IsServer());
-	assert(Selected.Num() == SelectedIDs.Num());
 
-	bool bSendNewIDs = false;
+	bool bIsDelta;
+	TArray < uint8 > GroupIDs;
+	const bool bSameGroup = GetCommandGroupToSend(GroupIDs, bIsDelta);
 
-	if (SelectedIDs.Num() == CommandIDs.Num())
-	{
-		for (const auto & Elem : CommandIDs)
-		{
-			if (!SelectedIDs.Contains(Elem))
-			{
-				bSendNewIDs = true;
-				break;
-			}
-		}
-	}
-	else
-	{
-		bSendNewIDs = true;
-	}
+	FContextCommandWithLocation Command = FContextCommandWithLocation(CommandType, bSameGroup, ClickLoc);
+	Command.bGroupIsDelta = bIsDelta;
+	Command.AffectedSelectables = MoveTemp(GroupIDs);
 
-	if (bSendNewIDs)
-	{
-		CommandIDs.Reset();
-		
-		FContextCommandWithLocation Command = FContextCommandWithLocation(CommandType, false, ClickLoc);
-
-		/* Attach selectables affected by command to it and remember what we sent */
-		for (const auto & SelectableID : SelectedIDs)
-		{
-			Command.AddSelectable(SelectableID);
-			CommandIDs.Emplace(SelectableID);
-		}
-
-		Server_IssueLocationTargetingContextCommand(Command);
-	}
-	else
-	{
-		/* Server will use the selectable already in Selected server-side */
-		Server_IssueLocationTargetingContextCommand(FContextCommandWithLocation(CommandType, true, ClickLoc));
-	}
+	Server_IssueLocationTargetingContextCommand(Command);
 }
 
 void ARTSPlayerController::Server_IssueContextCommand_Implementation(const FContextCommandWithTarget & Command)
@@ -6920,20 +6885,11 @@ void ARTSPlayerController::Server_IssueContextCommand_Implementation(const FCont
 	/* Construct button */
 	const FContextButton Button = FContextButton(Command);
 
-	if (!Command.bSameGroup)
-	{
-		Selected.Reset();
-
-		for (const auto & SelectableID : Command.AffectedSelectables)
-		{
-			AActor * Selectable = PS->GetSelectableFromID(SelectableID);
-			Selected.Emplace(Selectable);
-		}
-	}
+	SetSelectedFromCommandGroup(Command.bSameGroup, Command.bGroupIsDelta, Command.AffectedSelectables);
 
 	const FContextButtonInfo & CommandInfo = GI->GetContextInfo(Button.GetButtonType());
 
-	IssueContextCommand(CommandInfo, Command.ClickLocation, Command.Target);
+	IssueContextCommand(CommandInfo, Command.ClickLocation, Command.GetTarget(GS));
 }
 
 void ARTSPlayerController::Server_IssueLocationTargetingContextCommand_Implementation(const FContextCommandWithLocation & Command)
@@ -6944,16 +6900,7 @@ void ARTSPlayerController::Server_IssueLocationTargetingContextCommand_Implement
 	/* Construct button */
 	const FContextButton Button = FContextButton(Command);
 
-	if (!Command.bSameGroup)
-	{
-		Selected.Reset();
-
-		for (const auto & SelectableID : Command.AffectedSelectables)
-		{
-			AActor * Selectable = PS->GetSelectableFromID(SelectableID);
-			Selected.Emplace(Selectable);
-		}
-	}
+	SetSelectedFromCommandGroup(Command.bSameGroup, Command.bGroupIsDelta, Command.AffectedSelectables);
 
 	const FContextButtonInfo & CommandInfo = GI->GetContextInfo(Button.GetButtonType());
 
@@ -6972,16 +6919,7 @@ void ARTSPlayerController::Server_IssueInstantContextCommand_Implementation(cons
 	/* Construct button */
 	const FContextButton Button = FContextButton(Command);
 
-	if (!Command.bSameGroup)
-	{
-		Selected.Reset();
-
-		for (const auto & SelectableID : Command.AffectedSelectables)
-		{
-			AActor * Selectable = PS->GetSelectableFromID(SelectableID);
-			Selected.Emplace(Selectable);
-		}
-	}
+	SetSelectedFromCommandGroup(Command.bSameGroup, Command.bGroupIsDelta, Command.AffectedSelectables);
 
 	IssueInstantContextCommand(Button, false);
 }
@@ -7438,6 +7376,15 @@ void ARTSPlayerController::IssueTargetRequiredContextCommandChecked(const FConte
 
 #endif
 
+	if (IsRecordingCommands())
+	{
+		FRecordedCommand Record(ERecordedCommandType::Context_Targeting);
+		Record.SubType = static_cast<uint8>(AbilityInfo.GetButtonType());
+		Record.Location = ClickLoc;
+		Record.Target = FRecordedActorRef(ClickTarget);
+		RecordCommand(Record, ToIssueTo);
+	}
+
 	ISelectable * TargetAsSelectable = CastChecked<ISelectable>(ClickTarget);
 	const FSelectableAttributesBase & TargetInfo = TargetAsSelectable->GetAttributesBase();
 
@@ -7484,6 +7431,14 @@ void ARTSPlayerController::IssueLocationRequiredContextCommandChecked(const FCon
 
 #endif
 
+	if (IsRecordingCommands())
+	{
+		FRecordedCommand Record(ERecordedCommandType::Context_Location);
+		Record.SubType = static_cast<uint8>(AbilityInfo.GetButtonType());
+		Record.Location = Location;
+		RecordCommand(Record, ToIssueTo);
+	}
+
 	for (const auto & Elem : ToIssueTo)
 	{
 #if !UE_BUILD_SHIPPING
@@ -7574,8 +7529,8 @@ bool ARTSPlayerController::IssueContextCommand(const FContextButtonInfo & Abilit
 	const FVector & ClickLoc, AActor * Target)
 {
 	assert(GetWorld()->IsServer());
-	// Server player should not call this, or it would likely be inefficient to do so
-	assert(GetWorld()->GetFirstPlayerController() != this);
+	// Server player should not call this, or it would likely be inefficient to do so. Replays do though
+	assert(GetWorld()->GetFirstPlayerController() != this || GI->IsReplayingCommands());
 
 	if (!IsSelectionControlledByThis())
 	{
@@ -7588,6 +7543,15 @@ bool ARTSPlayerController::IssueContextCommand(const FContextButtonInfo & Abilit
 		return false;
 	}
 
+	if (IsRecordingCommands())
+	{
+		FRecordedCommand Record(ERecordedCommandType::Context_Targeting);
+		Record.SubType = static_cast<uint8>(AbilityInfo.GetButtonType());
+		Record.Location = ClickLoc;
+		Record.Target = FRecordedActorRef(Target);
+		RecordCommand(Record, Selected);
+	}
+
 	const EContextButton Command = AbilityInfo.GetButtonType();
 	const FContextButton Button = FContextButton(Command);
 	const bool bCheckIfTargetIsSelf = !AbilityInfo.CanTargetSelf() && AbilityInfo.CanTargetFriendlies();
@@ -7949,8 +7913,8 @@ bool ARTSPlayerController::IssueContextCommand(const FContextButtonInfo & Abilit
 bool ARTSPlayerController::IssueContextCommand(const FContextButtonInfo & AbilityInfo, const FVector & ClickLoc)
 {
 	assert(GetWorld()->IsServer());
-	// Server player should not call this, or it would likely be inefficient to do so
-	assert(GetWorld()->GetFirstPlayerController() != this);
+	// Server player should not call this, or it would likely be inefficient to do so. Replays do though
+	assert(GetWorld()->GetFirstPlayerController() != this || GI->IsReplayingCommands());
 
 	if (!IsSelectionControlledByThis())
 	{
@@ -7959,6 +7923,14 @@ bool ARTSPlayerController::IssueContextCommand(const FContextButtonInfo & Abilit
 		return false;
 	}
 
+	if (IsRecordingCommands())
+	{
+		FRecordedCommand Record(ERecordedCommandType::Context_Location);
+		Record.SubType = static_cast<uint8>(AbilityInfo.GetButtonType());
+		Record.Location = ClickLoc;
+		RecordCommand(Record, Selected);
+	}
+
 	/* Check this fast path first */
 	if (AbilityInfo.CanLocationBeInsideFog() == false)
 	{
@@ -8277,6 +8249,13 @@ bool ARTSPlayerController::IssueInstantContextCommand(const FContextButton & But
 		return false;
 	}
 
+	if (IsRecordingCommands())
+	{
+		FRecordedCommand Record(ERecordedCommandType::Context_Instant);
+		Record.SubType = static_cast<uint8>(Button.GetButtonType());
+		RecordCommand(Record, Selected);
+	}
+
 	const FContextButtonInfo & AbilityInfo = GI->GetContextInfo(Button.GetButtonType());
 	AAbilityBase * AbilityEffectInfoActor = AbilityInfo.GetEffectActor(GS);
 
@@ -8593,6 +8572,14 @@ void ARTSPlayerController::ExecuteCommanderAbility(FAquiredCommanderAbilityState
 
 void ARTSPlayerController::Server_RequestExecuteCommanderAbility_Implementation(ECommanderAbility AbilityType)
 {
+	if (IsRecordingCommands())
+	{
+		FRecordedCommand Record(ERecordedCommandType::CommanderAbility);
+		Record.SubType = static_cast<uint8>(AbilityType);
+		Record.TargetKind = static_cast<uint8>(ERecordedCommanderAbilityTarget::None);
+		RecordCommand(Record);
+	}
+
 	/* Check if ability is usable. Then execute it if it is */
 	
 	/* Kind of a long access chain here. 
@@ -8612,6 +8599,15 @@ void ARTSPlayerController::Server_RequestExecuteCommanderAbility_Implementation(
 
 void ARTSPlayerController::Server_RequestExecuteCommanderAbility_PlayerTargeting_Implementation(ECommanderAbility AbilityType, uint8 TargetsPlayerID)
 {
+	if (IsRecordingCommands())
+	{
+		FRecordedCommand Record(ERecordedCommandType::CommanderAbility);
+		Record.SubType = static_cast<uint8>(AbilityType);
+		Record.TargetKind = static_cast<uint8>(ERecordedCommanderAbilityTarget::Player);
+		Record.ExtraID = TargetsPlayerID;
+		RecordCommand(Record);
+	}
+
 	/* Check if ability is usable. Then execute it if it is */
 
 	const FCommanderAbilityInfo & AbilityInfo = GI->GetCommanderAbilityInfo(AbilityType);
@@ -8640,6 +8636,15 @@ void ARTSPlayerController::Server_RequestExecuteCommanderAbility_PlayerTargeting
 void ARTSPlayerController::Server_RequestExecuteCommanderAbility_SelectableTargeting_Implementation(ECommanderAbility AbilityType, 
 	AActor * SelectableTarget)
 {
+	if (IsRecordingCommands())
+	{
+		FRecordedCommand Record(ERecordedCommandType::CommanderAbility);
+		Record.SubType = static_cast<uint8>(AbilityType);
+		Record.TargetKind = static_cast<uint8>(ERecordedCommanderAbilityTarget::Selectable);
+		Record.Target = FRecordedActorRef(SelectableTarget);
+		RecordCommand(Record);
+	}
+
 	const FCommanderAbilityInfo & AbilityInfo = GI->GetCommanderAbilityInfo(AbilityType);
 	FAquiredCommanderAbilityState * AbilityState = PS->GetCommanderAbilityState(AbilityInfo);
 
@@ -8674,6 +8679,15 @@ void ARTSPlayerController::Server_RequestExecuteCommanderAbility_SelectableTarge
 void ARTSPlayerController::Server_RequestExecuteCommanderAbility_LocationTargeting_Implementation(ECommanderAbility AbilityType, 
 	const FVector_NetQuantize & AbilityLocation)
 {
+	if (IsRecordingCommands())
+	{
+		FRecordedCommand Record(ERecordedCommandType::CommanderAbility);
+		Record.SubType = static_cast<uint8>(AbilityType);
+		Record.TargetKind = static_cast<uint8>(ERecordedCommanderAbilityTarget::Location);
+		Record.Location = AbilityLocation;
+		RecordCommand(Record);
+	}
+
 	const FCommanderAbilityInfo & AbilityInfo = GI->GetCommanderAbilityInfo(AbilityType);
 	FAquiredCommanderAbilityState * AbilityState = PS->GetCommanderAbilityState(AbilityInfo);
 
@@ -8690,6 +8704,15 @@ void ARTSPlayerController::Server_RequestExecuteCommanderAbility_LocationTargeti
 
 void ARTSPlayerController::Server_RequestExecuteCommanderAbility_LocationOrSelectableTargeting_UsingSelectable_Implementation(ECommanderAbility AbilityType, AActor * SelectableTarget)
 {	
+	if (IsRecordingCommands())
+	{
+		FRecordedCommand Record(ERecordedCommandType::CommanderAbility);
+		Record.SubType = static_cast<uint8>(AbilityType);
+		Record.TargetKind = static_cast<uint8>(ERecordedCommanderAbilityTarget::LocationOrSelectable_UsingSelectable);
+		Record.Target = FRecordedActorRef(SelectableTarget);
+		RecordCommand(Record);
+	}
+
 	const FCommanderAbilityInfo & AbilityInfo = GI->GetCommanderAbilityInfo(AbilityType);
 	FAquiredCommanderAbilityState * AbilityState = PS->GetCommanderAbilityState(AbilityInfo);
 
@@ -8721,6 +8744,15 @@ void ARTSPlayerController::Server_RequestExecuteCommanderAbility_LocationOrSelec
 
 void ARTSPlayerController::Server_RequestExecuteCommanderAbility_LocationOrSelectableTargeting_UsingLocation_Implementation(ECommanderAbility AbilityType, const FVector_NetQuantize & AbilityLocation)
 {
+	if (IsRecordingCommands())
+	{
+		FRecordedCommand Record(ERecordedCommandType::CommanderAbility);
+		Record.SubType = static_cast<uint8>(AbilityType);
+		Record.TargetKind = static_cast<uint8>(ERecordedCommanderAbilityTarget::LocationOrSelectable_UsingLocation);
+		Record.Location = AbilityLocation;
+		RecordCommand(Record);
+	}
+
 	const FCommanderAbilityInfo & AbilityInfo = GI->GetCommanderAbilityInfo(AbilityType);
 	FAquiredCommanderAbilityState * AbilityState = PS->GetCommanderAbilityState(AbilityInfo);
 
@@ -8988,45 +9020,93 @@ void ARTSPlayerController::OnRightClickCommand(const FVector & ClickLoc, AActor
 void ARTSPlayerController::FillCommandWithIDs(FRightClickCommandBase & Command)
 {
 	CLIENT_CHECK;
-	assert(Selected.Num() == SelectedIDs.Num());
 
-	/* Check if we need to send the selectable IDs because the selectables we are
-	issuing orders to are different from the group of the last order */
-	bool bSendNewIDs = false;
+	bool bIsDelta;
+	TArray < uint8 > GroupIDs;
+	const bool bSameGroup = GetCommandGroupToSend(GroupIDs, bIsDelta);
 
-	if (SelectedIDs.Num() == CommandIDs.Num())
+	Command.SetUseSameGroup(bSameGroup);
+	Command.SetGroupIsDelta(bIsDelta);
+
+	/* Attach selectables affected by command to it */
+	Command.ReserveAffectedSelectables(GroupIDs.Num());
+	for (const auto & SelectableID : GroupIDs)
 	{
-		for (const auto & Elem : CommandIDs)
+		Command.AddSelectable(SelectableID);
+	}
+}
+
+bool ARTSPlayerController::GetCommandGroupToSend(TArray<uint8>& OutIDs, bool & bOutIsDelta)
+{
+	CLIENT_CHECK;
+	assert(Selected.Num() == SelectedIDs.Num());
+
+	/* Find the IDs that have been added or removed since the group of the last order */
+	TArray < uint8 > ChangedIDs;
+	for (const auto & SelectableID : CommandIDs)
+	{
+		if (!SelectedIDs.Contains(SelectableID))
 		{
-			if (!SelectedIDs.Contains(Elem))
-			{
-				bSendNewIDs = true;
-				break;
-			}
+			ChangedIDs.Emplace(SelectableID);
 		}
 	}
-	else
+	for (const auto & SelectableID : SelectedIDs)
 	{
-		bSendNewIDs = true;
+		if (!CommandIDs.Contains(SelectableID))
+		{
+			ChangedIDs.Emplace(SelectableID);
+		}
 	}
 
-	if (bSendNewIDs)
+	if (ChangedIDs.Num() == 0)
 	{
-		CommandIDs.Reset(SelectedIDs.Num());
+		OutIDs.Reset();
+		bOutIsDelta = false;
+		return true;
+	}
+
+	/* Send whichever has fewer IDs: the changes or the whole group */
+	bOutIsDelta = (ChangedIDs.Num() < SelectedIDs.Num());
+	OutIDs = bOutIsDelta ? MoveTemp(ChangedIDs) : SelectedIDs.Array();
+
+	/* Remember what we sent. Only ever used to check if an ID is in it so order does not 
+	matter */
+	CommandIDs = SelectedIDs.Array();
 
-		Command.SetUseSameGroup(false);
+	return false;
+}
+
+void ARTSPlayerController::SetSelectedFromCommandGroup(bool bSameGroup, bool bIsDelta, const TArray<uint8>& IDs)
+{
+	SERVER_CHECK;
 
-		/* Attach selectables affected by command to it and remember what we will send */
-		Command.ReserveAffectedSelectables(SelectedIDs.Num());
-		for (const auto & SelectableID : SelectedIDs)
+	if (bSameGroup)
+	{
+		return;
+	}
+
+	if (bIsDelta)
+	{
+		/* Each ID was either added to or removed from the group */
+		for (const auto & SelectableID : IDs)
 		{
-			Command.AddSelectable(SelectableID);
-			CommandIDs.Emplace(SelectableID);
+			if (CommandIDs.Remove(SelectableID) == 0)
+			{
+				CommandIDs.Emplace(SelectableID);
+			}
 		}
 	}
 	else
 	{
-		Command.SetUseSameGroup(true);
+		CommandIDs = IDs;
+	}
+
+	Selected.Reset(CommandIDs.Num());
+
+	for (const auto & SelectableID : CommandIDs)
+	{
+		AActor * const Selectable = PS->GetSelectableFromID(SelectableID);
+		Selected.Emplace(Selectable);
 	}
 }
 
@@ -9086,32 +9166,14 @@ void ARTSPlayerController::Server_IssueRightClickCommand_Implementation(const FR
 	to change both when I want to change right click functionality so this way will
 	work for now. TODO: condsider changing this */
 
-	if (!Command.UseSameGroup())
-	{
-		Selected.Reset();
-
-		for (const uint8 & ID : Command.GetAffectedSelectables())
-		{
-			AActor * const Selectable = PS->GetSelectableFromID(ID);
-			Selected.Emplace(Selectable);
-		}
-	}
+	SetSelectedFromCommandGroup(Command.UseSameGroup(), Command.IsGroupDelta(), Command.GetAffectedSelectables());
 
-	IssueRightClickCommand(Command.GetClickLocation(), Command.GetTarget());
+	IssueRightClickCommand(Command.GetClickLocation(), Command.GetTarget(GS));
 }
 
 void ARTSPlayerController::Server_IssueRightClickCommandOnInventoryItem_Implementation(const FRightClickCommandOnInventoryItem & Command)
 {
-	if (!Command.UseSameGroup())
-	{
-		Selected.Reset(Command.GetAffectedSelectables().Num());
-
-		for (const uint8 & ID : Command.GetAffectedSelectables())
-		{
-			AActor * const Selectable = PS->GetSelectableFromID(ID);
-			Selected.Emplace(Selectable);
-		}
-	}
+	SetSelectedFromCommandGroup(Command.UseSameGroup(), Command.IsGroupDelta(), Command.GetAffectedSelectables());
 
 	IssueRightClickCommand(Command.GetClickLocation(), Command.GetClickedInventoryItem(GS));
 }
@@ -9128,6 +9190,14 @@ EGameWarning ARTSPlayerController::IssueRightClickCommand(const FVector & Locati
 		return EGameWarning::SelectionNotUnderYourControl;
 	}
 
+	if (IsRecordingCommands())
+	{
+		FRecordedCommand Record(ERecordedCommandType::RightClick);
+		Record.Location = Location;
+		Record.Target = FRecordedActorRef(ClickedActor);
+		RecordCommand(Record, Selected);
+	}
+
 	/* Handle case where right click was on another selectable revealed by fog */
 	if (Statics::IsValid(ClickedActor))
 	{
@@ -9592,27 +9662,6 @@ EGameWarning ARTSPlayerController::IssueRightClickCommand(const FVector & Locati
 	I thought it would calculate */
 	const FRotator Rotation = UKismetMathLibrary::FindLookAtRotation(Middle->GetActorLocation(), Location) + FRotator(0.f, 90.f, 0.f);
 
-	/* Calculate distance squared from unit picked above to
-	click location */
-	const float DistanceSqr = (Middle->GetActorLocation() - Location).SizeSquared();
-
-	/* Move commands that make the unit picked above move
-	less than this distance will not change the rotation
-	of the selected units. When doing clicks that are close
-	and near the selected units the ones in the front have
-	to try and pass through the ones at the back and lots
-	of colliding takes place. This is a quick fix kinda. The
-	ideal solution would be that rotation always happens but
-	each unit takes the best spot which makes the least
-	collisions. */
-	const float RotationDistanceThresholdSqr = 500.f * 500.f;
-
-	/* TODO: Rotation resets back to the same formation when the
-	move is considered not far enough. The last rotation needs to
-	be saved and then that rotation is used again if the move is
-	considered too short. But it would have to be stored for each
-	unit for it to have a chance of working */
-
 	/* Distance between each units move location */
 	const float Spacing = 200.f;
 
@@ -9638,89 +9687,307 @@ EGameWarning ARTSPlayerController::IssueRightClickCommand(const FVector & Locati
 
 	float RankOffset = RankSize % 2 ? RankSize / 2 : RankSize / 2 - 0.5f;
 
+	/* Work out every spot in the formation first. Which unit goes to which spot is decided 
+	after */
+	TArray < FVector > SlotLocations;
+	SlotLocations.Reserve(NumSelected);
+
 	for (int32 i = 0; i < NumRanks; ++i)
 	{
+		int32 NumInRank = RankSize;
+
 		if (i == NumRanks - 1)
 		{
 			/* We are on the last rank which may not be a full rank.
 			Make sure to center them */
 
 			/* Ternary operator there in case last rank is full */
-			const int32 NumInLastRank = NumSelected % RankSize ? NumSelected % RankSize : RankSize;
-			const int32 NumMissing = RankSize - NumInLastRank;
+			NumInRank = NumSelected % RankSize ? NumSelected % RankSize : RankSize;
+			const int32 NumMissing = RankSize - NumInRank;
 
 			/* RankOffset is dependent on whether RankSize is odd or even. */
 			if (RankSize % 2 == 1)
 			{
-				RankOffset -= NumInLastRank % 2 ? (NumMissing / 2) : (NumMissing / 2.f);
+				RankOffset -= NumInRank % 2 ? (NumMissing / 2) : (NumMissing / 2.f);
 			}
 			else
 			{
-				RankOffset -= NumInLastRank % 2 ? (NumMissing / 2.f) : (NumMissing / 2);
+				RankOffset -= NumInRank % 2 ? (NumMissing / 2.f) : (NumMissing / 2);
 			}
+		}
 
-			for (int32 j = 0; j < NumInLastRank; ++j)
-			{
-				/* Because networking */
-				if (!Statics::IsValid(Selected[i * RankSize + j]))
-				{
-					continue;
-				}
+		for (int32 j = 0; j < NumInRank; ++j)
+		{
+			FVector MoveLocation = NewCorner + FVector((j - RankOffset) * Spacing, i * Spacing, 0.f);
+
+			/* Rotate about original click location */
+			MoveLocation -= Location;
+			MoveLocation = Rotation.RotateVector(MoveLocation);
+			MoveLocation += Location;
+
+			SlotLocations.Emplace(MoveLocation);
+		}
+	}
 
-				assert(Selected.IsValidIndex(i * RankSize + j));
-				ISelectable * const AsSelectable = CastChecked<ISelectable>(Selected[i * RankSize + j]);
+	TArray < ISelectable * > Units;
+	TArray < AActor * > UnitActors;
+	TArray < FVector > UnitLocations;
+	Units.Reserve(NumSelected);
+	UnitActors.Reserve(NumSelected);
+	UnitLocations.Reserve(NumSelected);
+	for (const auto & Elem : Selected)
+	{
+		/* Because networking */
+		if (Statics::IsValid(Elem))
+		{
+			Units.Emplace(CastChecked<ISelectable>(Elem));
+			UnitActors.Emplace(Elem);
+			UnitLocations.Emplace(Elem->GetActorLocation());
+		}
+	}
 
-				FVector MoveLocation = NewCorner + FVector((j - RankOffset) * Spacing, i * Spacing, 0.f);
+	/* Each unit takes the spot that keeps the total distance moved lowest. This means the 
+	formation can always be rotated: units at the front no longer have to try and pass 
+	through the ones at the back */
+	TArray < int32 > SlotIndices;
+	GroupMovement::AssignSlots(UnitLocations, SlotLocations, SlotIndices);
 
-				/* Figure out correct rotation by rotating about original
-				click location if move command is at least a certain distance */
-				if (DistanceSqr > RotationDistanceThresholdSqr)
-				{
-					MoveLocation -= Location;
-					MoveLocation = Rotation.RotateVector(MoveLocation);
-					MoveLocation += Location;
-				}
+	TArray < FVector > Destinations;
+	Destinations.Reserve(Units.Num());
+	for (const int32 SlotIndex : SlotIndices)
+	{
+		Destinations.Emplace(SlotLocations[SlotIndex]);
+	}
 
-				/* TODO: check if MoveLocation is valid. If not do something */
+	/* One path query for the whole group instead of one per unit. This also projects each 
+	spot onto the navmesh. Units that cannot use the group's path find their own */
+	TArray < FNavPathSharedPtr > Paths;
+	GroupMovement::BuildPaths(GetWorld(), UnitActors, UnitLocations, Destinations, Location, Paths);
 
-				/* Issue move command to unit */
-				AsSelectable->OnRightClickCommand(MoveLocation);
+	for (int32 i = 0; i < Units.Num(); ++i)
+	{
+		/* Issue move command to unit */
+		Units[i]->OnRightClickCommand(Destinations[i], Paths[i]);
+	}
+
+	// Return "None" which means success
+	return EGameWarning::None;
+}
+
+bool ARTSPlayerController::IsRecordingCommands() const
+{
+	return GS->GetCommandRecorder().IsRecording();
+}
+
+void ARTSPlayerController::RecordCommand(FRecordedCommand & Command, const TArray < AActor * > & IssuedTo)
+{
+	const uint8 OurID = PS->GetPlayerIDAsInt();
+
+	Command.Selectables.Reserve(IssuedTo.Num());
+	for (const auto & Elem : IssuedTo)
+	{
+		/* Valid check because networking */
+		if (Statics::IsValid(Elem))
+		{
+			const ISelectable * AsSelectable = CastChecked<ISelectable>(Elem);
+			if (AsSelectable->GetAttributesBase().GetSelectableFlags().IsOwned(OurID))
+			{
+				Command.Selectables.Emplace(AsSelectable->GetSelectableID());
 			}
 		}
-		else
+	}
+
+	RecordCommand(Command);
+}
+
+void ARTSPlayerController::RecordCommand(FRecordedCommand & Command, const TArray < ISelectable * > & IssuedTo)
+{
+	Command.Selectables.Reserve(IssuedTo.Num());
+	for (const auto & Elem : IssuedTo)
+	{
+		/* The checked context command functions only get passed our own selectables */
+		Command.Selectables.Emplace(Elem->GetSelectableID());
+	}
+
+	RecordCommand(Command);
+}
+
+void ARTSPlayerController::RecordCommand(FRecordedCommand & Command)
+{
+	assert(IsRecordingCommands());
+
+	Command.GameTick = GS->GetNumGameTicksElapsed();
+	Command.PlayerID = PS->GetPlayerIDAsInt();
+
+	GS->GetCommandRecorder().Record(Command);
+}
+
+void ARTSPlayerController::BeginIssuingAs(ARTSPlayerState * Issuer, FSavedIssuerState & OutSaved)
+{
+	OutSaved.PS = PS;
+	OutSaved.FactionInfo = FactionInfo;
+	OutSaved.PlayerID = PlayerID;
+	OutSaved.Team = Team;
+	OutSaved.TeamTag = TeamTag;
+	OutSaved.Selected = MoveTemp(Selected);
+	OutSaved.CurrentSelected = CurrentSelected;
+
+	PS = Issuer;
+	FactionInfo = Issuer->GetFI();
+	PlayerID = Issuer->GetPlayerID();
+	Team = Issuer->GetTeam();
+	TeamTag = Issuer->GetTeamTag();
+	Selected.Reset();
+	CurrentSelected = nullptr;
+}
+
+void ARTSPlayerController::EndIssuingAs(FSavedIssuerState & Saved)
+{
+	PS = Saved.PS;
+	FactionInfo = Saved.FactionInfo;
+	PlayerID = Saved.PlayerID;
+	Team = Saved.Team;
+	TeamTag = Saved.TeamTag;
+	Selected = MoveTemp(Saved.Selected);
+	CurrentSelected = Saved.CurrentSelected;
+}
+
+void ARTSPlayerController::ReplayCommand(const FRecordedCommand & Command, ARTSPlayerState * Issuer,
+	const TArray < ARTSPlayerState * > & RecordedIDToPlayerState)
+{
+	SERVER_CHECK;
+
+	FSavedIssuerState Saved;
+	BeginIssuingAs(Issuer, Saved);
+
+	/* Selectables that have since been destroyed or were never created this time around are 
+	left out */
+	for (const uint8 SelectableID : Command.Selectables)
+	{
+		AActor * Selectable = PS->GetSelectableFromID(SelectableID);
+		if (Statics::IsValid(Selectable))
 		{
-			for (int32 j = 0; j < RankSize; ++j)
-			{
-				/* Because networking */
-				if (!Statics::IsValid(Selected[i * RankSize + j]))
-				{
-					continue;
-				}
+			Selected.Emplace(Selectable);
+		}
+	}
+	if (Selected.Num() > 0)
+	{
+		CurrentSelected = TScriptInterface<ISelectable>(Selected[0]);
+	}
 
-				assert(Selected.IsValidIndex(i * RankSize + j));
-				ISelectable * const AsSelectable = CastChecked<ISelectable>(Selected[i * RankSize + j]);
+	AActor * Target = Command.Target.Resolve(GS, RecordedIDToPlayerState);
 
-				FVector MoveLocation = NewCorner + FVector((j - RankOffset) * Spacing, i * Spacing, 0.f);
+	switch (Command.Type)
+	{
+		case ERecordedCommandType::RightClick:
+		{
+			IssueRightClickCommand(Command.Location, Target);
+			break;
+		}
+		case ERecordedCommandType::Context_Targeting:
+		{
+			IssueContextCommand(GI->GetContextInfo(static_cast<EContextButton>(Command.SubType)), 
+				Command.Location, Target);
+			break;
+		}
+		case ERecordedCommandType::Context_Location:
+		{
+			IssueContextCommand(GI->GetContextInfo(static_cast<EContextButton>(Command.SubType)), 
+				Command.Location);
+			break;
+		}
+		case ERecordedCommandType::Context_Instant:
+		{
+			IssueInstantContextCommand(FContextButton(static_cast<EContextButton>(Command.SubType)), false);
+			break;
+		}
+		case ERecordedCommandType::PlaceBuilding:
+		{
+			Server_PlaceBuilding_Implementation(static_cast<EBuildingType>(Command.SubType), 
+				Command.Location, Command.Rotation, Command.ExtraID);
+			break;
+		}
+		case ERecordedCommandType::LayFoundation:
+		{
+			Server_GiveLayFoundationCommand_Implementation(static_cast<EBuildingType>(Command.SubType), 
+				Command.Location, Command.Rotation, Command.ExtraID);
+			break;
+		}
+		case ERecordedCommandType::CommanderAbility:
+		{
+			const ECommanderAbility AbilityType = static_cast<ECommanderAbility>(Command.SubType);
 
-				/* Figure out correct rotation by rotating about original
-				click location if move command is at least a certain distance */
-				if (DistanceSqr > RotationDistanceThresholdSqr)
+			switch (static_cast<ERecordedCommanderAbilityTarget>(Command.TargetKind))
+			{
+				case ERecordedCommanderAbilityTarget::None:
 				{
-					MoveLocation -= Location;
-					MoveLocation = Rotation.RotateVector(MoveLocation);
-					MoveLocation += Location;
+					Server_RequestExecuteCommanderAbility_Implementation(AbilityType);
+					break;
+				}
+				case ERecordedCommanderAbilityTarget::Player:
+				{
+					ARTSPlayerState * TargetPlayer = RecordedIDToPlayerState[Command.ExtraID];
+					if (TargetPlayer != nullptr)
+					{
+						Server_RequestExecuteCommanderAbility_PlayerTargeting_Implementation(AbilityType, 
+							TargetPlayer->GetPlayerIDAsInt());
+					}
+					break;
+				}
+				case ERecordedCommanderAbilityTarget::Selectable:
+				{
+					Server_RequestExecuteCommanderAbility_SelectableTargeting_Implementation(AbilityType, Target);
+					break;
+				}
+				case ERecordedCommanderAbilityTarget::Location:
+				{
+					Server_RequestExecuteCommanderAbility_LocationTargeting_Implementation(AbilityType, 
+						Command.Location);
+					break;
+				}
+				case ERecordedCommanderAbilityTarget::LocationOrSelectable_UsingSelectable:
+				{
+					Server_RequestExecuteCommanderAbility_LocationOrSelectableTargeting_UsingSelectable_Implementation(
+						AbilityType, Target);
+					break;
+				}
+				case ERecordedCommanderAbilityTarget::LocationOrSelectable_UsingLocation:
+				{
+					Server_RequestExecuteCommanderAbility_LocationOrSelectableTargeting_UsingLocation_Implementation(
+						AbilityType, Command.Location);
+					break;
+				}
+				default:
+				{
+					UE_LOG(RTSLOG, Fatal, TEXT("Unknown recorded commander ability target kind [%d]"), 
+						Command.TargetKind);
+					break;
 				}
-
-				/* TODO: check if MoveLocation is valid. If not do something */
-
-				/* Issue move command to unit */
-				AsSelectable->OnRightClickCommand(MoveLocation);
 			}
+			break;
+		}
+		default:
+		{
+			UE_LOG(RTSLOG, Fatal, TEXT("Unknown recorded command type [%d]"), 
+				static_cast<int32>(Command.Type));
+			break;
 		}
 	}
 
-	// Return "None" which means success
-	return EGameWarning::None;
+	EndIssuingAs(Saved);
+}
+
+void ARTSPlayerController::PlaceBuildingForReplayedPlayer(ARTSPlayerState * Issuer, EBuildingType BuildingType, 
+	const FVector & Location, const FRotator & Rotation, uint8 ConstructionInstigatorID)
+{
+	SERVER_CHECK;
+
+	FSavedIssuerState Saved;
+	BeginIssuingAs(Issuer, Saved);
+
+	Server_PlaceBuilding_Implementation(BuildingType, Location, Rotation, ConstructionInstigatorID);
+
+	EndIssuingAs(Saved);
 }
 
 void ARTSPlayerController::SetupFogOfWarManager(ARTSLevelVolume * MapFogVolume, uint8 InNumTeams, ETeam InTeam)
@@ -10768,49 +11035,17 @@ void ARTSPlayerController::OnContextButtonClick(const FContextButton & Button)
 					}
 				}
 				
-				assert(Selected.Num() == SelectedIDs.Num());
-				
 				/* Check if we need to send the selectable IDs because the selectables we are
 				issuing orders to may be from the group of the last order */
-				bool bSendNewIDs = false;
-
-				if (SelectedIDs.Num() == CommandIDs.Num())
-				{
-					for (const auto & SelectableID : CommandIDs)
-					{
-						if (!SelectedIDs.Contains(SelectableID))
-						{
-							bSendNewIDs = true;
-							break;
-						}
-					}
-				}
-				else
-				{
-					bSendNewIDs = true;
-				}
+				bool bIsDelta;
+				TArray < uint8 > GroupIDs;
+				const bool bSameGroup = GetCommandGroupToSend(GroupIDs, bIsDelta);
 
-				if (bSendNewIDs)
-				{
-					CommandIDs.Reset();
-
-					FContextCommand Command = FContextCommand(false, Button);
-
-					/* Attach selectables affected by command to it and remember what we sent */
-					for (const auto & SelectableID : SelectedIDs)
-					{
-						Command.AddSelectable(SelectableID);
-						CommandIDs.Emplace(SelectableID);
-					}
+				FContextCommand Command = FContextCommand(bSameGroup, Button);
+				Command.bGroupIsDelta = bIsDelta;
+				Command.AffectedSelectables = MoveTemp(GroupIDs);
 
-					Server_IssueInstantContextCommand(Command);
-				}
-				else
-				{
-					/* Server will use the selectables stored in CommandIDs */
-					const FContextCommand Command = FContextCommand(true, Button);
-					Server_IssueInstantContextCommand(Command);
-				}
+				Server_IssueInstantContextCommand(Command);
 			}
 			else
 			{
@@ -11928,6 +12163,7 @@ void ARTSPlayerController::Server_SellInventoryItem_Implementation(uint8 SellerI
 							*ItemsInfo, HUD);
 
 						// Broadcast event to each client
+						GS->FlushAbilityEvents();
 						GS->Multicast_OnInventoryItemSold(FSelectableIdentifier(TypedSelectable),
 							InventorySlotIndex);
 
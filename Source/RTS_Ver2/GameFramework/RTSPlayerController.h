@@ -62,6 +62,7 @@ class USingleVideoSettingWidget;
 class UAudioSettingsWidget;
 class UGarrisonInfo;
 class UGarrisonedUnitInfo;
+struct FRecordedCommand;
 
 
 //=============================================================================================
@@ -1472,7 +1473,9 @@ private:
 
 	/* Array of selectable IDs for selectables that were last given orders. Used to
 	reduce size of RPCs for commands by allowing a 'selection has not changed' signal
-	to be sent instead of sending all the selectables' IDs */
+	or only the changes to be sent instead of sending all the selectables' IDs. Client 
+	and server each keep their own copy which are kept the same by GetCommandGroupToSend 
+	and SetSelectedFromCommandGroup */
 	UPROPERTY()
 	TArray <uint8> CommandIDs;
 
@@ -1530,6 +1533,25 @@ private:
 	 */
 	void FillCommandWithIDs(FRightClickCommandBase & Command);
 
+	/** 
+	 *	[Client] Work out what selectable IDs to send with a command and update CommandIDs 
+	 *	
+	 *	@param OutIDs - IDs to send. Empty if group is the same as the last command's group
+	 *	@param bOutIsDelta - whether OutIDs are only the IDs that were added to or removed 
+	 *	from the last command's group. This is used when it is fewer IDs than the whole group
+	 *	@return - true if group is the same as the last command's group
+	 */
+	bool GetCommandGroupToSend(TArray < uint8 > & OutIDs, bool & bOutIsDelta);
+
+	/** 
+	 *	[Server] Update Selected from the group a client sent with a command 
+	 *	
+	 *	@param bSameGroup - whether the group is the same as the last command's group 
+	 *	@param bIsDelta - whether IDs are only the changes from the last command's group
+	 *	@param IDs - selectable IDs that were sent with command 
+	 */
+	void SetSelectedFromCommandGroup(bool bSameGroup, bool bIsDelta, const TArray < uint8 > & IDs);
+
 	/* @param InPrimarySelected - player's primary selected at the time the command was issued */
 	void PlayRightClickCommandParticlesAndSound(const TScriptInterface<ISelectable> InPrimarySelected, 
 		const FVector & ClickLoc, AActor * Target);
@@ -1554,6 +1576,56 @@ private:
 	@return - something not equal to "None" if a command was not issued */
 	EGameWarning IssueRightClickCommand(const FVector & Location, AActor * ClickedActor);
 
+	//----------------------------------------------------------
+	//	Command recording and replaying
+	//----------------------------------------------------------
+
+	/* [Server] Whether commands issued through this controller are being written to a command 
+	recording. Check this before building a FRecordedCommand */
+	bool IsRecordingCommands() const;
+
+	/* [Server] Fill in who issued the command and when, then write it to the recording 
+	@param IssuedTo - selectables command was given to. Only ones this player owns are written */
+	void RecordCommand(FRecordedCommand & Command, const TArray < AActor * > & IssuedTo);
+	void RecordCommand(FRecordedCommand & Command, const TArray < ISelectable * > & IssuedTo);
+	void RecordCommand(FRecordedCommand & Command);
+
+	/* Everything that gets swapped out while issuing a replayed command as another player */
+	struct FSavedIssuerState
+	{
+		ARTSPlayerState * PS;
+		AFactionInfo * FactionInfo;
+		FName PlayerID;
+		ETeam Team;
+		FName TeamTag;
+		TArray < AActor * > Selected;
+		TScriptInterface < ISelectable > CurrentSelected;
+	};
+
+	/* [Server] Have this controller issue commands as Issuer until EndIssuingAs is called */
+	void BeginIssuingAs(ARTSPlayerState * Issuer, FSavedIssuerState & OutSaved);
+	void EndIssuingAs(FSavedIssuerState & Saved);
+
+public:
+
+	/**
+	 *	[Server] Issue a command from a command recording. Goes through the same functions the 
+	 *	command was recorded in with this controller temporarily taking on the issuer's player 
+	 *	state and selection
+	 *
+	 *	@param Issuer - player in this match that the command was recorded for
+	 *	@param RecordedIDToPlayerState - maps player IDs in the recording to players in this match
+	 */
+	void ReplayCommand(const FRecordedCommand & Command, ARTSPlayerState * Issuer, 
+		const TArray < ARTSPlayerState * > & RecordedIDToPlayerState);
+
+	/* [Server] Server_PlaceBuilding for a player that has no player controller of their own, 
+	which happens to human players when replaying a command recording */
+	void PlaceBuildingForReplayedPlayer(ARTSPlayerState * Issuer, EBuildingType BuildingType, 
+		const FVector & Location, const FRotator & Rotation, uint8 ConstructionInstigatorID);
+
+private:
+
 	/* Reference to fog of war manager. On clients this only affects rendering.
 	On server it affects rendering and also calculates which buildings/units
 	can see what */
@@ -93,13 +93,10 @@ void ARTSPlayerState::UpdateClosestDepots(EResourceType ResourceType, ABuilding
 			}
 			else
 			{
-				/* Check if recently built building is now closest */
-				const float DistanceSqr = Statics::GetPathDistanceSqr(Spot, Depot);
-				const float CurrBestDistSqr = Statics::GetPathDistanceSqr(Spot, Spot->GetClosestDepot(this));
-				if (DistanceSqr < CurrBestDistSqr)
-				{
-					Spot->SetClosestDepot(this, Depot);
-				}
+				/* Check if recently built building is now closest. Its walking distances are 
+				still being worked out so it cannot just be compared against the current 
+				closest one */
+				Spot->SetClosestDepot(this, FindClosestDepot(Spot, ResourceType));
 			}
 		}
 	}
@@ -110,20 +107,71 @@ void ARTSPlayerState::UpdateClosestDepots(EResourceType ResourceType, ABuilding
 			/* If destroyed depot was the closest depot then find next closest */
 			if (Spot->GetClosestDepot(this) == Depot)
 			{
-				ABuilding * ClosestDepot = nullptr;
-				float BestDistanceSoFarSqr = FLT_MAX;
-				for (const auto & OtherDepot : ResourceDepots[ResourceType].GetSet())
-				{
-					const float DistanceSqr = Statics::GetPathDistanceSqr(Spot, OtherDepot);
-					if (DistanceSqr < BestDistanceSoFarSqr)
-					{
-						ClosestDepot = OtherDepot;
-						BestDistanceSoFarSqr = DistanceSqr;
-					}
-				}
+				Spot->SetClosestDepot(this, FindClosestDepot(Spot, ResourceType));
+			}
+		}
+	}
+}
 
-				Spot->SetClosestDepot(this, ClosestDepot);
+ABuilding * ARTSPlayerState::FindClosestDepot(AResourceSpot * Spot, EResourceType ResourceType) const
+{
+	/* Walking distances cannot be compared against straight line distances so they are only 
+	used if every depot has them. Depots that cannot be walked to are skipped either way 
+	unless every depot is like that */
+	ABuilding * ClosestByWalking = nullptr;
+	ABuilding * ClosestByStraightLine = nullptr;
+	ABuilding * ClosestUnreachable = nullptr;
+	float BestWalkingDistSqr = FLT_MAX;
+	float BestStraightLineDistSqr = FLT_MAX;
+	float BestUnreachableDistSqr = FLT_MAX;
+	bool bAllWalkingDistances = true;
+	for (const auto & OtherDepot : ResourceDepots[ResourceType].GetSet())
+	{
+		bool bIsWalkingDistance;
+		const float DistanceSqr = Statics::GetPathDistanceSqr(GS, Spot, OtherDepot, &bIsWalkingDistance);
+		const float StraightLineDistSqr = bIsWalkingDistance 
+			? (Spot->GetActorLocation() - OtherDepot->GetActorLocation()).SizeSquared() : DistanceSqr;
+
+		if (DistanceSqr == FLT_MAX)
+		{
+			if (StraightLineDistSqr < BestUnreachableDistSqr)
+			{
+				ClosestUnreachable = OtherDepot;
+				BestUnreachableDistSqr = StraightLineDistSqr;
 			}
+			continue;
+		}
+
+		bAllWalkingDistances &= bIsWalkingDistance;
+
+		if (DistanceSqr < BestWalkingDistSqr)
+		{
+			ClosestByWalking = OtherDepot;
+			BestWalkingDistSqr = DistanceSqr;
+		}
+
+		if (StraightLineDistSqr < BestStraightLineDistSqr)
+		{
+			ClosestByStraightLine = OtherDepot;
+			BestStraightLineDistSqr = StraightLineDistSqr;
+		}
+	}
+
+	if (ClosestByStraightLine == nullptr)
+	{
+		return ClosestUnreachable;
+	}
+
+	return bAllWalkingDistances ? ClosestByWalking : ClosestByStraightLine;
+}
+
+void ARTSPlayerState::OnDepotPathDistancesReady(ABuilding * Depot)
+{
+	for (const auto & ResourceType : Depot->GetBuildingAttributes()->GetResourceCollectionTypes())
+	{
+		for (const auto & Spot : GS->GetResourceSpots(ResourceType))
+		{
+			Spot->SetClosestDepot(this, FindClosestDepot(Spot, ResourceType));
 		}
 	}
 }
@@ -151,7 +199,7 @@ ABuilding * ARTSPlayerState::GetProductionBuilding(const FContextButton & Button
 
 	assert(Button.IsForTrainUnit() || Button.IsForResearchUpgrade());
 
-	const TArray < ABuilding * > & PotentialBuildings = ProductionCapableBuildings[Button].GetArray();
+	const TArray < ABuilding * > & PotentialBuildings = GetProductionCapableBuildingsEntry(Button).GetArray();
 
 	if (PotentialBuildings.Num() == 0)
 	{
@@ -441,6 +489,12 @@ bool ARTSPlayerState::CanShowGameWarning(EGameWarning MessageType)
 	from server before cooldown on client has finished. To change this we would need client to
 	notify server of warnings that happen but that just seems too inefficient */
 
+	/* No one to show it to. Happens for human players being replayed from a command recording */
+	if (PC == nullptr)
+	{
+		return false;
+	}
+
 	if (GetWorldTimerManager().IsTimerActive(TimerHandle_GameWarning))
 	{
 		return false;
@@ -454,6 +508,11 @@ bool ARTSPlayerState::CanShowGameWarning(EGameWarning MessageType)
 
 bool ARTSPlayerState::CanShowGameWarning(EAbilityRequirement ReasonForMessage)
 {
+	if (PC == nullptr)
+	{
+		return false;
+	}
+
 	if (GetWorldTimerManager().IsTimerActive(TimerHandle_GameWarning))
 	{
 		return false;
@@ -539,25 +598,11 @@ void ARTSPlayerState::OnItemAddedToAProductionQueue(const FTrainingInfo & Item)
 	if (Item.IsProductionForBuilding())
 	{
 		NumQueuedSelectables++;
-		
-		// Do this because we don't default initialize all possible entries to 0
-		if (InQueueBuildingTypeQuantities.Contains(Item.GetBuildingType()) == false)
-		{
-			InQueueBuildingTypeQuantities.Emplace(Item.GetBuildingType(), 0);
-		}
-
 		InQueueBuildingTypeQuantities[Item.GetBuildingType()] += 1;
 	}
 	else if (Item.IsForUnit())
 	{
 		NumQueuedSelectables++;
-		
-		// Do this because we don't default initialize all possible entries to 0
-		if (InQueueUnitTypeQuantities.Contains(Item.GetUnitType()) == false)
-		{
-			InQueueUnitTypeQuantities.Emplace(Item.GetUnitType(), 0);
-		}
-		
 		InQueueUnitTypeQuantities[Item.GetUnitType()] += 1;
 
 		const FUnitInfo * UnitInfo = FI->GetUnitInfo(Item.GetUnitType());
@@ -613,14 +658,7 @@ void ARTSPlayerState::OnBuildingPlaced(ABuilding * Building)
 		return;
 	}
 
-	if (PlacedBuildingTypeQuantities.Contains(Building->GetType()))
-	{
-		PlacedBuildingTypeQuantities[Building->GetType()] += 1;
-	}
-	else
-	{
-		PlacedBuildingTypeQuantities.Emplace(Building->GetType(), 1);
-	}
+	PlacedBuildingTypeQuantities[Building->GetType()] += 1;
 }
 
 void ARTSPlayerState::OnBuildingBuilt(ABuilding * Building, EBuildingType BuildingType, ESelectableCreationMethod CreationMethod)
@@ -656,6 +694,11 @@ void ARTSPlayerState::OnBuildingBuilt(ABuilding * Building, EBuildingType Buildi
 	AddHousingResourcesProvided(Building->GetBuildingAttributes()->GetHousingResourcesProvidedArray());
 
 	/* Update resource depot info */
+	if (Building->GetBuildingAttributes()->GetResourceCollectionTypes().Num() > 0)
+	{
+		/* Straight line distance gets used for it until this is done */
+		GS->GetPathDistanceFields().AddDepot(Building);
+	}
 	for (const auto & ResourceType : Building->GetBuildingAttributes()->GetResourceCollectionTypes())
 	{
 		/* Tell resource depot this building is a drop point for it */
@@ -665,22 +708,11 @@ void ARTSPlayerState::OnBuildingBuilt(ABuilding * Building, EBuildingType Buildi
 		UpdateClosestDepots(ResourceType, Building, true);
 	}
 
-	/* Whether this building is the first of its type or not */
-	bool bNewPrereqObtained;
+	/* Add to the "completed construction" container */
+	CompletedBuildingTypeQuantities[BuildingType] += 1;
 
-	/* Add entry to the "completed construction" container */
-	if (CompletedBuildingTypeQuantities.Contains(BuildingType) && CompletedBuildingTypeQuantities[BuildingType] > 0)
-	{
-		CompletedBuildingTypeQuantities.Add(BuildingType, CompletedBuildingTypeQuantities[BuildingType] + 1);
-
-		bNewPrereqObtained = false;
-	}
-	else
-	{
-		CompletedBuildingTypeQuantities.Add(BuildingType, 1);
-
-		bNewPrereqObtained = true;
-	}
+	/* Whether this building is the first of its type or not */
+	const bool bNewPrereqObtained = (CompletedBuildingTypeQuantities[BuildingType] == 1);
 
 	/* Remove from the "only placed" container */
 	PlacedBuildingTypeQuantities[BuildingType] -= 1;
@@ -698,11 +730,11 @@ void ARTSPlayerState::OnBuildingBuilt(ABuilding * Building, EBuildingType Buildi
 	for (const auto & Button : Building->GetAttributes()->GetContextMenu().GetButtonsArray())
 	{
 		/* The contains check is like asking "is tab type not None?" */
-		if (ProductionCapableBuildings.Contains(Button))
+		if (IsProductionCapableButton(Button))
 		{
 			/* Crashes here? Probably PostEdit not working correctly. Try adding then deleting a
 			button from selectables context menu */
-			ProductionCapableBuildings[Button].AddBuilding(Building);
+			GetProductionCapableBuildingsEntry(Button).AddBuilding(Building);
 		}
 	}
 
@@ -734,6 +766,7 @@ void ARTSPlayerState::OnBuildingZeroHealth(ABuilding * Building)
 	RemoveHousingResourcesProvided(Building->GetBuildingAttributes()->GetHousingResourcesProvidedArray());
 
 	/* Update resource depot info */
+	GS->GetPathDistanceFields().RemoveDepot(Building);
 	for (const auto & ResourceType : Building->GetBuildingAttributes()->GetResourceCollectionTypes())
 	{
 		ResourceDepots[ResourceType].RemoveBuilding(Building);
@@ -748,11 +781,10 @@ void ARTSPlayerState::OnBuildingZeroHealth(ABuilding * Building)
 	/* Remove from correct container depending on whether it has completed construction or not */
 	if (Building->IsConstructionComplete())
 	{
-		/* Can be false for when creating faction info */
-		if (CompletedBuildingTypeQuantities.Contains(BuildingType))
+		/* Can be 0 for when creating faction info */
+		if (CompletedBuildingTypeQuantities[BuildingType] > 0)
 		{
 			CompletedBuildingTypeQuantities[BuildingType] -= 1;
-			assert(CompletedBuildingTypeQuantities[BuildingType] >= 0);
 
 			if (CompletedBuildingTypeQuantities[BuildingType] == 0)
 			{
@@ -781,9 +813,9 @@ void ARTSPlayerState::OnBuildingZeroHealth(ABuilding * Building)
 	for (const auto & Button : Building->GetAttributes()->GetContextMenu().GetButtonsArray())
 	{
 		/* The contains check is like asking "is tab type not None?" */
-		if (ProductionCapableBuildings.Contains(Button))
+		if (IsProductionCapableButton(Button))
 		{
-			ProductionCapableBuildings[Button].RemoveBuilding(Building);
+			GetProductionCapableBuildingsEntry(Button).RemoveBuilding(Building);
 		}
 	}
 
@@ -818,18 +850,15 @@ void ARTSPlayerState::OnUnitBuilt(AInfantry * Unit, EUnitType UnitType, ESelecta
 
 	Units.Emplace(Unit);
 
+#if GAME_THREAD_FOG_OF_WAR
+	GS->GetFogManager()->OnUnitBuilt(Unit);
+#endif
+
 	// Only run if on server or this is our player state
 	if (GetWorld()->IsServer() || BelongsToLocalPlayer())
 	{
 		/* Increase quantity */
-		if (UnitTypeQuantities.Contains(UnitType))
-		{
-			UnitTypeQuantities[UnitType] += 1;
-		}
-		else
-		{
-			UnitTypeQuantities.Emplace(UnitType, 1);
-		}
+		UnitTypeQuantities[UnitType] += 1;
 	}
 	
 	// Decide if should play a 'unit just built' sound
@@ -849,6 +878,10 @@ void ARTSPlayerState::OnUnitDestroyed(AInfantry * Unit)
 	/* O(n) */
 	Units.RemoveSingleSwap(Unit);
 
+#if GAME_THREAD_FOG_OF_WAR
+	GS->GetFogManager()->OnUnitDestroyed(Unit);
+#endif
+
 	// Only run if on server or this is our player state
 	if (GetWorld()->IsServer() || BelongsToLocalPlayer())
 	{
@@ -869,6 +902,10 @@ void ARTSPlayerState::Setup_OnUnitDestroyed(AInfantry * Unit)
 
 	/* O(n) */
 	Units.Remove(Unit);
+
+#if GAME_THREAD_FOG_OF_WAR
+	GS->GetFogManager()->OnUnitDestroyed(Unit);
+#endif
 }
 
 void ARTSPlayerState::Server_SetInitialValues(uint8 InID, FName InPlayerIDAsFName, ETeam InTeam, 
@@ -954,15 +991,6 @@ void ARTSPlayerState::Multicast_SetInitialValues_Implementation(uint8 InID, FNam
 	/* Because upgrade manager relies on faction this must come after faction has been set */
 	SetupUpgradeManager();
 
-	// Default initialize 0 values for these TMaps. Maybe only server/owner need to do this
-	InQueueUnitTypeQuantities.Reserve(FI->GetUnitQuantityLimits().Num());
-	UnitTypeQuantities.Reserve(FI->GetUnitQuantityLimits().Num());
-	for (const auto & Elem : FI->GetUnitQuantityLimits())
-	{
-		InQueueUnitTypeQuantities.Emplace(Elem.Key, 0);
-		UnitTypeQuantities.Emplace(Elem.Key, 0);
-	}
-
 	/* That's those variables done, but upgrade manager needs to rep + have its owner (this) rep
 	too, so poll for that to complete. Yes OnRep funcs can be used and they are for setting up
 	upgrade manager but I prefer having all the requirements here in one function. */
@@ -1039,6 +1067,15 @@ void ARTSPlayerState::Client_FinalSetup_Implementation()
 		PC->GetFogOfWarManager()->SetActorTickEnabled(true);
 	}
 
+#elif MULTITHREADED_FOG_OF_WAR
+
+	/* Game state drives the multithreaded fog manager. Its tick is only enabled on the
+	server by default so enable it here for clients too */
+	if (!PC->IsObserver())
+	{
+		GS->SetActorTickEnabled(true);
+	}
+
 #endif
 
 	// Setup resource spots on map
@@ -1869,12 +1906,54 @@ int32 ARTSPlayerState::GetNumPersistentQueues() const
 
 int32 ARTSPlayerState::GetNumSupportedProducers(const FContextButton & InButton) const
 {
-	return ProductionCapableBuildings[InButton].GetArray().Num();
+	return GetProductionCapableBuildingsEntry(InButton).GetArray().Num();
 }
 
 const TArray<ABuilding*>& ARTSPlayerState::GetProductionCapableBuildings(const FContextButton & Button) const
 {
-	return ProductionCapableBuildings[Button].GetArray();
+	return GetProductionCapableBuildingsEntry(Button).GetArray();
+}
+
+bool ARTSPlayerState::IsProductionCapableButton(const FContextButton & Button) const
+{
+	if (Button.IsForTrainUnit())
+	{
+		return ProductionCapableUnitTypes.Contains(Button.GetUnitType());
+	}
+	else if (Button.IsForResearchUpgrade())
+	{
+		return ProductionCapableUpgradeTypes.Contains(Button.GetUpgradeType());
+	}
+	else
+	{
+		return false;
+	}
+}
+
+FBuildingArray & ARTSPlayerState::GetProductionCapableBuildingsEntry(const FContextButton & Button)
+{
+	if (Button.IsForTrainUnit())
+	{
+		return UnitProductionCapableBuildings[Button.GetUnitType()];
+	}
+	else
+	{
+		assert(Button.IsForResearchUpgrade());
+		return UpgradeProductionCapableBuildings[Button.GetUpgradeType()];
+	}
+}
+
+const FBuildingArray & ARTSPlayerState::GetProductionCapableBuildingsEntry(const FContextButton & Button) const
+{
+	if (Button.IsForTrainUnit())
+	{
+		return UnitProductionCapableBuildings[Button.GetUnitType()];
+	}
+	else
+	{
+		assert(Button.IsForResearchUpgrade());
+		return UpgradeProductionCapableBuildings[Button.GetUpgradeType()];
+	}
 }
 
 const TSet<ABuilding*>& ARTSPlayerState::GetPersistentQueueSupportingBuildings() const
@@ -1917,7 +1996,7 @@ bool ARTSPlayerState::ArePrerequisitesMet(EBuildingType BuildingType, bool bShow
 	// Check prerequisites that are buildings
 	for (const auto & Elem : BuildInfo->GetPrerequisites())
 	{
-		if (!CompletedBuildingTypeQuantities.Contains(Elem) || CompletedBuildingTypeQuantities[Elem] == 0)
+		if (CompletedBuildingTypeQuantities[Elem] == 0)
 		{
 			if (bShowHUDMessage)
 			{
@@ -1930,8 +2009,7 @@ bool ARTSPlayerState::ArePrerequisitesMet(EBuildingType BuildingType, bool bShow
 	}
 
 	// Check prerequisites that are upgrades
-	if (BuildingTypeToMissingUpgradePrereqs.Contains(BuildingType) 
-		&& BuildingTypeToMissingUpgradePrereqs[BuildingType].Array.Num() > 0)
+	if (!BuildingTypeToMissingUpgradePrereqs[BuildingType].IsEmpty())
 	{
 		if (bShowHUDMessage)
 		{
@@ -1951,7 +2029,7 @@ bool ARTSPlayerState::ArePrerequisitesMet(EUnitType UnitType, bool bShowHUDMessa
 	// Check prerequisites that are buildings
 	for (const auto & Elem : BuildInfo->GetPrerequisites())
 	{
-		if (!CompletedBuildingTypeQuantities.Contains(Elem) || CompletedBuildingTypeQuantities[Elem] == 0)
+		if (CompletedBuildingTypeQuantities[Elem] == 0)
 		{
 			if (bShowHUDMessage)
 			{
@@ -1964,8 +2042,7 @@ bool ARTSPlayerState::ArePrerequisitesMet(EUnitType UnitType, bool bShowHUDMessa
 	}
 
 	// Check prerequisites that are upgrades
-	if (UnitTypeToMissingUpgradePrereqs.Contains(UnitType) 
-		&& UnitTypeToMissingUpgradePrereqs[UnitType].Array.Num() > 0)
+	if (!UnitTypeToMissingUpgradePrereqs[UnitType].IsEmpty())
 	{
 		if (bShowHUDMessage)
 		{
@@ -1989,7 +2066,7 @@ bool ARTSPlayerState::ArePrerequisitesMet(const FUpgradeInfo & UpgradeInfo, EUpg
 	// Check prerequisites that are buildings
 	for (const auto & Elem : UpgradeInfo.GetPrerequisites())
 	{
-		if (!CompletedBuildingTypeQuantities.Contains(Elem) || CompletedBuildingTypeQuantities[Elem] == 0)
+		if (CompletedBuildingTypeQuantities[Elem] == 0)
 		{
 			if (bShowHUDMessage)
 			{
@@ -2002,8 +2079,7 @@ bool ARTSPlayerState::ArePrerequisitesMet(const FUpgradeInfo & UpgradeInfo, EUpg
 	}
 
 	// Check prerequisites that are upgrades
-	if (UpgradeTypeToMissingUpgradePrereqs.Contains(UpgradeType) 
-		&& UpgradeTypeToMissingUpgradePrereqs[UpgradeType].Array.Num() > 0)
+	if (!UpgradeTypeToMissingUpgradePrereqs[UpgradeType].IsEmpty())
 	{
 		if (bShowHUDMessage)
 		{
@@ -2041,7 +2117,7 @@ bool ARTSPlayerState::ArePrerequisitesMet(EBuildingType BuildingType, bool bShow
 	// Check prerequisites that are buildings
 	for (const auto & Elem : BuildInfo->GetPrerequisites())
 	{
-		if (!CompletedBuildingTypeQuantities.Contains(Elem) || CompletedBuildingTypeQuantities[Elem] == 0)
+		if (CompletedBuildingTypeQuantities[Elem] == 0)
 		{
 			if (bShowHUDMessage)
 			{
@@ -2056,8 +2132,7 @@ bool ARTSPlayerState::ArePrerequisitesMet(EBuildingType BuildingType, bool bShow
 	}
 
 	// Check prerequisites that are upgrades
-	if (BuildingTypeToMissingUpgradePrereqs.Contains(BuildingType) 
-		&& BuildingTypeToMissingUpgradePrereqs[BuildingType].Array.Num() > 0)
+	if (!BuildingTypeToMissingUpgradePrereqs[BuildingType].IsEmpty())
 	{
 		if (bShowHUDMessage)
 		{
@@ -2066,7 +2141,7 @@ bool ARTSPlayerState::ArePrerequisitesMet(EBuildingType BuildingType, bool bShow
 		
 		// Set this to NotBuilding so the caller knows it was an upgrade that was missing
 		OutFirstMissingPrereq_Building = EBuildingType::NotBuilding;
-		OutFirstMissingPrereq_Upgrade = BuildingTypeToMissingUpgradePrereqs[BuildingType].Array[0];
+		OutFirstMissingPrereq_Upgrade = BuildingTypeToMissingUpgradePrereqs[BuildingType].GetFirst();
 		return false;
 	}
 
@@ -2081,7 +2156,7 @@ bool ARTSPlayerState::ArePrerequisitesMet(EUnitType UnitType, bool bShowHUDMessa
 	// Check prerequisites that are buildings
 	for (const auto & Elem : BuildInfo->GetPrerequisites())
 	{
-		if (!CompletedBuildingTypeQuantities.Contains(Elem) || CompletedBuildingTypeQuantities[Elem] == 0)
+		if (CompletedBuildingTypeQuantities[Elem] == 0)
 		{
 			if (bShowHUDMessage)
 			{
@@ -2096,8 +2171,7 @@ bool ARTSPlayerState::ArePrerequisitesMet(EUnitType UnitType, bool bShowHUDMessa
 	}
 
 	// Check prerequisites that are upgrades
-	if (UnitTypeToMissingUpgradePrereqs.Contains(UnitType) 
-		&& UnitTypeToMissingUpgradePrereqs[UnitType].Array.Num() > 0)
+	if (!UnitTypeToMissingUpgradePrereqs[UnitType].IsEmpty())
 	{
 		if (bShowHUDMessage)
 		{
@@ -2106,7 +2180,7 @@ bool ARTSPlayerState::ArePrerequisitesMet(EUnitType UnitType, bool bShowHUDMessa
 		
 		// Set this to NotBuilding so the caller knows it was an upgrade that was missing
 		OutFirstMissingPrereq_Building = EBuildingType::NotBuilding;
-		OutFirstMissingPrereq_Upgrade = UnitTypeToMissingUpgradePrereqs[UnitType].Array[0];
+		OutFirstMissingPrereq_Upgrade = UnitTypeToMissingUpgradePrereqs[UnitType].GetFirst();
 		return false;
 	}
 
@@ -2121,7 +2195,7 @@ bool ARTSPlayerState::ArePrerequisitesMet(EUpgradeType UpgradeType, bool bShowHU
 	// Check prerequisites that are buildings
 	for (const auto & Elem : UpgradeInfo.GetPrerequisites())
 	{
-		if (!CompletedBuildingTypeQuantities.Contains(Elem) || CompletedBuildingTypeQuantities[Elem] == 0)
+		if (CompletedBuildingTypeQuantities[Elem] == 0)
 		{
 			if (bShowHUDMessage)
 			{
@@ -2136,8 +2210,7 @@ bool ARTSPlayerState::ArePrerequisitesMet(EUpgradeType UpgradeType, bool bShowHU
 	}
 
 	// Check prerequisites that are upgrades
-	if (UpgradeTypeToMissingUpgradePrereqs.Contains(UpgradeType)
-		&& UpgradeTypeToMissingUpgradePrereqs[UpgradeType].Array.Num() > 0)
+	if (!UpgradeTypeToMissingUpgradePrereqs[UpgradeType].IsEmpty())
 	{
 		if (bShowHUDMessage)
 		{
@@ -2146,7 +2219,7 @@ bool ARTSPlayerState::ArePrerequisitesMet(EUpgradeType UpgradeType, bool bShowHU
 		
 		// Set this to NotBuilding so the caller knows it was an upgrade that was missing
 		OutFirstMissingPrereq_Building = EBuildingType::NotBuilding;
-		OutFirstMissingPrereq_Upgrade = UpgradeTypeToMissingUpgradePrereqs[UpgradeType].Array[0];
+		OutFirstMissingPrereq_Upgrade = UpgradeTypeToMissingUpgradePrereqs[UpgradeType].GetFirst();
 		return false;
 	}
 
@@ -2242,21 +2315,6 @@ bool ARTSPlayerState::IsAtUniqueBuildingCap(EBuildingType BuildingType, bool bIn
 	 
 	if (FI->IsQuantityLimited(BuildingType))
 	{
-		/* Put entries in the TMaps if they're missing because we don't default initialize them 
-		with 0 */
-		if (InQueueBuildingTypeQuantities.Contains(BuildingType) == false)
-		{
-			InQueueBuildingTypeQuantities.Emplace(BuildingType, 0);
-		}
-		if (PlacedBuildingTypeQuantities.Contains(BuildingType) == false)
-		{
-			PlacedBuildingTypeQuantities.Emplace(BuildingType, 0);
-		}
-		if (CompletedBuildingTypeQuantities.Contains(BuildingType) == false)
-		{
-			CompletedBuildingTypeQuantities.Emplace(BuildingType, 0);
-		}
-
 		bool bAtCap;
 		if (bIncludeQueuedSelectables)
 		{
@@ -2297,10 +2355,6 @@ bool ARTSPlayerState::IsAtUniqueUnitCap(EUnitType UnitType, bool bIncludeQueuedS
 {
 	if (FI->IsQuantityLimited(UnitType))
 	{
-		UE_CLOG(InQueueUnitTypeQuantities.Contains(UnitType) == false, RTSLOG, Fatal,
-			TEXT("Missing TMap entry for unit type [%s] for faction [%s] "), 
-			TO_STRING(EUnitType, UnitType), TO_STRING(EFaction, FI->GetFaction()));
-		
 		const bool bAtCap = bIncludeQueuedSelectables
 			? InQueueUnitTypeQuantities[UnitType] + UnitTypeQuantities[UnitType] == FI->GetQuantityLimit(UnitType)
 			: UnitTypeQuantities[UnitType] == FI->GetQuantityLimit(UnitType);
@@ -2370,14 +2424,21 @@ FVector ARTSPlayerState::GetCommandLocation() const
 
 void ARTSPlayerState::SetupProductionCapableBuildingsMap()
 {
-	/* Default initialize hashmap */
+	/* Register every unit/upgrade that has a button on the HUD persistent panel */
 	for (const auto & Elem : FI->GetHUDPersistentTabButtons())
 	{
 		const TArray < FContextButton > & ButtonArray = Elem.Value.GetButtons();
 
 		for (const auto & Button : ButtonArray)
 		{
-			ProductionCapableBuildings.Emplace(Button, FBuildingArray());
+			if (Button.IsForTrainUnit())
+			{
+				ProductionCapableUnitTypes.Add(Button.GetUnitType());
+			}
+			else if (Button.IsForResearchUpgrade())
+			{
+				ProductionCapableUpgradeTypes.Add(Button.GetUpgradeType());
+			}
 		}
 	}
 }
@@ -2665,7 +2726,7 @@ const TArray <AInfantry *> & ARTSPlayerState::GetUnits() const
 	return Units;
 }
 
-TMap<EBuildingType, int32>& ARTSPlayerState::GetPrereqInfo()
+TEnumTable < EBuildingType, int32 > & ARTSPlayerState::GetPrereqInfo()
 {
 	return CompletedBuildingTypeQuantities;
 }
@@ -7,6 +7,7 @@
 
 #include "Statics/Structs_1.h"
 #include "Statics/Structs_3.h"
+#include "Statics/EnumTables.h"
 #include "RTSPlayerState.generated.h"
 
 class URTSGameInstance;
@@ -19,6 +20,7 @@ class AFactionInfo;
 class URTSHUD;
 class UAudioComponent;
 class ABuilding;
+class AResourceSpot;
 class ACPUPlayerAIController;
 class AInfantry;
 class UCommanderSkillTreeWidget;
@@ -29,26 +31,6 @@ class UCommanderSkillTreeNodeWidget;
 //	Structs
 //==============================================================================================
 
-/** 
- *	Array of EUpgradeType. 
- *	
- *	Where I use this we could replace with a TSet. The only reason it is an array is that the 
- *	ArePrerequisitesMet func that returns the type of missing prereq would require getting an 
- *	element from the TSet which I assume reqires iteration of it. 
- *	In fact I could even use an int32 instead of this struct if the ArePrerequisitesMet that 
- *	returns the missing upgrade type didn't exist.
- */
-struct FUpgradeTypeArray
-{
-	FUpgradeTypeArray(int32 ReserveAmount)
-	{
-		Array.Reserve(ReserveAmount);
-	}
-
-	TArray<EUpgradeType> Array;
-};
-
-
 /* A simple struct that holds a TSet as a workaround for non-2D TArrays */
 USTRUCT()
 struct FBuildingSet
@@ -273,8 +255,7 @@ private:
 	 *
 	 *	This was added for implementing unique buildings
 	 */
-	UPROPERTY()
-	TMap < EBuildingType, int32 > InQueueBuildingTypeQuantities;
+	TEnumTable < EBuildingType, int32 > InQueueBuildingTypeQuantities;
 
 	/**
 	 *	Maps building type to how many of that type this unit has placed but not fully
@@ -282,19 +263,16 @@ private:
 	 *
 	 *	This was added for implementing unique buildings
 	 */
-	UPROPERTY()
-	TMap <EBuildingType, int32> PlacedBuildingTypeQuantities;
+	TEnumTable < EBuildingType, int32 > PlacedBuildingTypeQuantities;
 
 	/**
 	 *	Maps building type to how many of that type this player has that are fully constructed.
-	 *	No entry means they have 0.
 	 *
 	 *	Useful to know what prerequisites are fulfilled
 	 *
 	 *	My notes: this was called PrerequisitesMet or similar for a long time
 	 */
-	UPROPERTY()
-	TMap < EBuildingType, int32 > CompletedBuildingTypeQuantities;
+	TEnumTable < EBuildingType, int32 > CompletedBuildingTypeQuantities;
 
 	/** 
 	 *	Maps unit type to the quantity that is in a production queue. Considers all production 
@@ -302,23 +280,20 @@ private:
 	 *	
 	 *	This was added to implement unique units 
 	 */
-	UPROPERTY()
-	TMap < EUnitType, int32 > InQueueUnitTypeQuantities;
+	TEnumTable < EUnitType, int32 > InQueueUnitTypeQuantities;
 
 	/* Holds all the infantry this player owns. */
 	UPROPERTY()
 	TArray < AInfantry * > Units;
 
 	/** 
-	 *	Maps unit type to the quantity of that unit the player has. No key/value pair means 
-	 *	the player has 0 of that type. 
+	 *	Maps unit type to the quantity of that unit the player has. 
 	 *
 	 *	This does not take into account units that are in production queues
 	 *
 	 *	This was added to implement unique units
 	 */
-	UPROPERTY()
-	TMap < EUnitType, int32 > UnitTypeQuantities;
+	TEnumTable < EUnitType, int32 > UnitTypeQuantities;
 
 	/** 
 	 *	Reference to player controller that owns this. Will be null for clients that do not own 
@@ -346,15 +321,13 @@ private:
 public:
 
 	/** 
-	 *	These containers map building/unit/upgrade type to an array of all the upgrades that 
-	 *	are prerequisites for it and that have not been researched yet. 
-	 *	
-	 *	If a building/unit/upgrade does not have any upgrade prerequisites then it might not get 
-	 *	any entry in the map. 
+	 *	These containers map building/unit/upgrade type to the set of all the upgrades that 
+	 *	are prerequisites for it and that have not been researched yet. Filled by the upgrade 
+	 *	manager. 
 	 */
-	TMap<EBuildingType, FUpgradeTypeArray> BuildingTypeToMissingUpgradePrereqs;
-	TMap<EUnitType, FUpgradeTypeArray> UnitTypeToMissingUpgradePrereqs;
-	TMap<EUpgradeType, FUpgradeTypeArray> UpgradeTypeToMissingUpgradePrereqs;
+	TEnumTable < EBuildingType, TEnumBitSet < EUpgradeType > > BuildingTypeToMissingUpgradePrereqs;
+	TEnumTable < EUnitType, TEnumBitSet < EUpgradeType > > UnitTypeToMissingUpgradePrereqs;
+	TEnumTable < EUpgradeType, TEnumBitSet < EUpgradeType > > UpgradeTypeToMissingUpgradePrereqs;
 
 private:
 
@@ -370,14 +343,35 @@ private:
 	@pararm bWasBuilt - true if building was just built, false if it was just destroyed */
 	void UpdateClosestDepots(EResourceType ResourceType, ABuilding * Depot, bool bWasBuilt);
 
+	/* Get which of our depots for a resource type is closest to a resource spot. Null if we 
+	have none */
+	ABuilding * FindClosestDepot(AResourceSpot * Spot, EResourceType ResourceType) const;
+
 	/* Buildings that have at least one persistent build slot, like construction yard type
 	buildings */
 	UPROPERTY()
 	TSet <ABuilding *> PersistentQueueSupportingBuildings;
 
-	/* Maps a button type to all the buildings that support producing what that button requests. */
-	UPROPERTY()
-	TMap <FContextButton, FBuildingArray> ProductionCapableBuildings;
+	/** 
+	 *	Maps unit/upgrade type to all the buildings that support producing it. Only types that 
+	 *	have a button on the HUD persistent panel get buildings added. Which types those are is 
+	 *	in ProductionCapableUnitTypes/ProductionCapableUpgradeTypes. 
+	 *
+	 *	Not UPROPERTY. The buildings are all in Buildings and get removed from here when they 
+	 *	reach zero health 
+	 */
+	TEnumTable < EUnitType, FBuildingArray > UnitProductionCapableBuildings;
+	TEnumTable < EUpgradeType, FBuildingArray > UpgradeProductionCapableBuildings;
+	TEnumBitSet < EUnitType > ProductionCapableUnitTypes;
+	TEnumBitSet < EUpgradeType > ProductionCapableUpgradeTypes;
+
+	/* Whether a button is one buildings get registered in ProductionCapableBuildings for */
+	bool IsProductionCapableButton(const FContextButton & Button) const;
+
+	/* Get the entry in UnitProductionCapableBuildings/UpgradeProductionCapableBuildings for a 
+	train unit or research upgrade button */
+	FBuildingArray & GetProductionCapableBuildingsEntry(const FContextButton & Button);
+	const FBuildingArray & GetProductionCapableBuildingsEntry(const FContextButton & Button) const;
 
 	/* Get building to build from when clicking a HUD persistent tab button like in C&C.
 	@param Button - button that was clicked on
@@ -533,6 +527,11 @@ public:
 	/* Call from building when it reaches zero health */
 	void OnBuildingZeroHealth(ABuilding * Building);
 
+	/* Called by FPathDistanceFields once walking distances from one of our depots have been 
+	worked out. Until then straight line distance was used for it so redo every resource 
+	spot's closest depot for its resource types */
+	void OnDepotPathDistancesReady(ABuilding * Depot);
+
 	/* Call when a building is considered destroyed */
 	void OnBuildingDestroyed(ABuilding * Building);
 
@@ -1112,7 +1111,7 @@ public:
 
 	const TArray < ABuilding * > & GetBuildings() const;
 	const TArray <AInfantry *> & GetUnits() const;
-	TMap <EBuildingType, int32> & GetPrereqInfo();
+	TEnumTable < EBuildingType, int32 > & GetPrereqInfo();
 
 	AUpgradeManager * GetUpgradeManager() const;
 
@@ -359,7 +359,7 @@ const FCursorInfo * ISelectable::GetSelectedMouseCursor_CanAttackFriendlyBuildin
 	return nullptr;
 }
 
-void ISelectable::OnRightClickCommand(const FVector & Location)
+void ISelectable::OnRightClickCommand(const FVector & Location, const FNavPathSharedPtr & GroupPath)
 {
 	NO_OVERRIDE_SO_FATAL_LOG;
 }
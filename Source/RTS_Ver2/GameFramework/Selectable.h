@@ -7,6 +7,7 @@
 #include "Statics/CommonEnums.h"
 #include "Statics/OtherEnums.h"
 #include "Statics/Structs_4.h"
+#include "AI/Navigation/NavigationTypes.h"
 #include "Selectable.generated.h"
 
 class AFactionInfo;
@@ -368,9 +369,12 @@ public:
 	/** 
 	 *	Called when player orders to move to location 
 	 *	
-	 *	@param Location - location player clicked at 
+	 *	@param Location - location to move to. Usually a formation slot around where the player 
+	 *	clicked 
+	 *	@param GroupPath - path to follow that was built for the whole group being moved 
+	 *	(see GroupMovement). Null if the selectable should find its own path 
 	 */
-	virtual void OnRightClickCommand(const FVector & Location);
+	virtual void OnRightClickCommand(const FVector & Location, const FNavPathSharedPtr & GroupPath);
 
 	/**
 	 *	Called when player right clicks an another selectable while this one is selected.
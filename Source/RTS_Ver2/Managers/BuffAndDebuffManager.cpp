@@ -7,96 +7,313 @@
 #include "Statics/Statics.h"
 #include "GameFramework/Selectable.h"
 #include "Statics/Structs_2.h"
+#include "Statics/DevelopmentStatics.h"
+#include "GameFramework/RTSPlayerController.h"
+#include "UI/RTSHUD.h"
+#include "Algo/Sort.h"
 
 
 ABuffAndDebuffManager::ABuffAndDebuffManager()
 {
 	PrimaryActorTick.bCanEverTick = true;
 	PrimaryActorTick.bStartWithTickEnabled = true;
+
+	PC = nullptr;
+}
+
+void ABuffAndDebuffManager::BeginPlay()
+{
+	Super::BeginPlay();
+
+	PC = Cast<ARTSPlayerController>(GetWorld()->GetFirstPlayerController());
 }
 
 void ABuffAndDebuffManager::Tick(float DeltaTime)
 {
-#if WITH_TICKING_BUFF_AND_DEBUFF_MANAGER
-	/* We could do all this ticking logic in AInfantry::Tick and ABuilding::Tick. There's no 
-	major problems with it. One minor "problem" is that if a buff/debuff is applied during 
-	a tick then there's a certain chance that it will tick that tick and a chance it will tick 
-	during the next tick instead. I don't know though, this doesn't really seem like much 
-	of a problem and may actually help with reducing the number of buff/debuffs that tick 
-	on certain frames */
-	
-	/* This only needs to tick on server. We replicate what happens to each client */
-	SERVER_CHECK;
-	
 	Super::Tick(DeltaTime);
 
 #if TICKABLE_BUFF_AND_DEBUFF_ENABLED_GAME
 
-	for (int32 i = TickableBuffsAndDebuffs.Num() - 1; i >= 0; --i)
+	/* Buff/debuff logic runs on every machine (abilities that apply them are multicast) so 
+	this ticks on clients too. 
+	
+	A buff/debuff applied during a frame may tick that frame or the next one depending on 
+	whether this manager ticks before or after whatever applied it. Doesn't really matter */
+
+	if (Holders.Num() == 0)
 	{
-		TickSingleBuffOrDebuff(TickableBuffsAndDebuffs[i], DeltaTime);
+		return;
 	}
-	
-#endif // TICKABLE_BUFF_AND_DEBUFF_ENABLED_GAME
 
-#endif // WITH_TICKING_BUFF_AND_DEBUFF_MANAGER
+	//-------------------------------------------------------------------
+	//	1. Advance timers. Only data is touched here
+	//-------------------------------------------------------------------
+
+	DueTicks.Reset();
+	for (int32 i = 0; i < Holders.Num(); ++i)
+	{
+		FTickableBuffHolder & Holder = Holders[i];
+		if (Holder.Actor.IsValid() == false)
+		{
+			continue;
+		}
+
+		AdvanceTimers(*Holder.Buffs, i, false, DeltaTime);
+		AdvanceTimers(*Holder.Debuffs, i, true, DeltaTime);
+	}
+
+	//-------------------------------------------------------------------
+	//	2. Run DoTick behaviors. Grouped by type so the same behavior runs back to back
+	//-------------------------------------------------------------------
+
+	Expirations.Reset();
+	if (DueTicks.Num() > 0)
+	{
+		Algo::SortBy(DueTicks, [](const FPendingBuffOrDebuffEvent & Event) { return static_cast<uint8>(Event.Type); });
+
+		for (const FPendingBuffOrDebuffEvent & Event : DueTicks)
+		{
+			for (uint8 k = 0; k < Event.NumTicks; ++k)
+			{
+				/* Look it up every time. The DoTick behavior can do pretty much anything 
+				including removing buffs/debuffs or killing the selectable */
+				FTickableBuffOrDebuffInstanceInfo * Instance = GetEventInstance(Event);
+				if (Instance == nullptr)
+				{
+					break;
+				}
+
+				const FTickableBuffOrDebuffInfo * Info = Instance->GetInfoStruct();
+				
+				Instance->IncrementTickCount();
+
+				/* Copy out of Holders. DoTick could apply a buff which adds to Holders */
+				ISelectable * Selectable = Holders[Event.HolderIndex].Selectable;
+
+				Info->ExecuteDoTickBehavior(Selectable, *Instance);
+
+				/* Check if buff/debuff has 'ticked out'. Cannot use Instance here - DoTick may 
+				have reallocated the array */
+				Instance = GetEventInstance(Event);
+				if (Instance != nullptr && Info->ExpiresOverTime() 
+					&& Instance->GetTickCount() == Info->GetNumberOfTicks())
+				{
+					Expirations.Emplace(Event);
+					break;
+				}
+			}
+		}
+	}
+
+	//-------------------------------------------------------------------
+	//	3. Remove what ticked out
+	//-------------------------------------------------------------------
+
+	if (Expirations.Num() > 0)
+	{
+		ProcessExpirations();
+	}
+
+	//-------------------------------------------------------------------
+	//	4. HUD
+	//-------------------------------------------------------------------
+
+	UpdateHUDDurations();
+
+	RemoveFinishedHolders();
+
+#endif // TICKABLE_BUFF_AND_DEBUFF_ENABLED_GAME
 }
 
-#if WITH_TICKING_BUFF_AND_DEBUFF_MANAGER
-void ABuffAndDebuffManager::TickSingleBuffOrDebuff(FTickableBuffOrDebuffInstanceInfo & InstanceInfo, float DeltaTime)
+#if TICKABLE_BUFF_AND_DEBUFF_ENABLED_GAME
+
+void ABuffAndDebuffManager::AdvanceTimers(TArray<FTickableBuffOrDebuffInstanceInfo>& Array, int32 HolderIndex, 
+	bool bIsDebuff, float DeltaTime)
 {
-	InstanceInfo.DecrementDeltaTime(DeltaTime);
+	for (int32 i = 0; i < Array.Num(); ++i)
+	{
+		FTickableBuffOrDebuffInstanceInfo & Elem = Array[i];
 
-	const FTickableBuffOrDebuffInfo * Info = InstanceInfo.GetInfoStruct();
-	const float TickInterval = Info->GetTickInterval();
+		Elem.DecrementDeltaTime(DeltaTime);
 
-	/* Going to while statement here instead of just if statement so we can do multiple ticks
-	for extremly fast tick rate buffs/debuffs */
-	uint8 NumTicksToExecute = 0;
-	while (InstanceInfo.GetTimeRemainingTillNextTick() <= 0.f)
+		if (Elem.GetTimeRemainingTillNextTick() <= 0.f)
+		{
+			const float TickInterval = Elem.GetInfoStruct()->GetTickInterval();
+
+			/* Going to while statement here instead of just if statement so we can do multiple 
+			ticks for extremly fast tick rate buffs/debuffs */
+			uint8 NumTicksToExecute = 0;
+			while (Elem.GetTimeRemainingTillNextTick() <= 0.f)
+			{
+				NumTicksToExecute++;
+				Elem.IncreaseTimeRemainingTillNextTick(TickInterval);
+			}
+
+			DueTicks.Emplace(FPendingBuffOrDebuffEvent(HolderIndex, i, Elem.GetSpecificType(), 
+				NumTicksToExecute, bIsDebuff));
+		}
+	}
+}
+
+FTickableBuffOrDebuffInstanceInfo * ABuffAndDebuffManager::GetEventInstance(const FPendingBuffOrDebuffEvent & Event) const
+{
+	const FTickableBuffHolder & Holder = Holders[Event.HolderIndex];
+	if (Holder.Actor.IsValid() == false)
 	{
-		NumTicksToExecute++;
-		InstanceInfo.IncreaseTimeRemainingTillNextTick(TickInterval);
+		return nullptr;
+	}
 
-		/* This break means we can only tick a buff/debuff a maximum of once during this function. 
-		Remove it to allow more ticks to happen, but then we also have to send 'how many ticks 
-		happened' to clients too in the RPC. As long as buffs/debuffs don't tick too fast then 
-		this shouldn't matter. */
-		break;
+	TArray < FTickableBuffOrDebuffInstanceInfo > & Array = Event.bIsDebuff ? *Holder.Debuffs : *Holder.Buffs;
+	
+	/* Index could have shifted if a DoTick removed something before it. Search for it then */
+	if (Array.IsValidIndex(Event.ArrayIndex) && Array[Event.ArrayIndex].GetSpecificType() == Event.Type)
+	{
+		return &Array[Event.ArrayIndex];
+	}
+	
+	for (FTickableBuffOrDebuffInstanceInfo & Elem : Array)
+	{
+		if (Elem.GetSpecificType() == Event.Type)
+		{
+			return &Elem;
+		}
 	}
 
-	const bool bExpiresOverTime = Info->ExpiresOverTime();
-	bool bUpdatedUI = false;
+	return nullptr;
+}
+
+void ABuffAndDebuffManager::ProcessExpirations()
+{
+	/* Remove higher indices first so the indices of the ones still to be removed stay 
+	correct. Also what the HUD expects */
+	Algo::Sort(Expirations, [](const FPendingBuffOrDebuffEvent & A, const FPendingBuffOrDebuffEvent & B)
+	{
+		if (A.HolderIndex != B.HolderIndex)
+		{
+			return A.HolderIndex < B.HolderIndex;
+		}
+		if (A.bIsDebuff != B.bIsDebuff)
+		{
+			return A.bIsDebuff < B.bIsDebuff;
+		}
+		return A.ArrayIndex > B.ArrayIndex;
+	});
+
+	for (const FPendingBuffOrDebuffEvent & Event : Expirations)
+	{
+		FTickableBuffOrDebuffInstanceInfo * Instance = GetEventInstance(Event);
+		if (Instance == nullptr)
+		{
+			continue;
+		}
+
+		/* Copy these out of Holders. OnRemoved could apply a buff which adds to Holders and 
+		could reallocate it */
+		const TWeakObjectPtr < AActor > Actor = Holders[Event.HolderIndex].Actor;
+		ISelectable * Selectable = Holders[Event.HolderIndex].Selectable;
+		TArray < FTickableBuffOrDebuffInstanceInfo > & Array = Event.bIsDebuff 
+			? *Holders[Event.HolderIndex].Debuffs : *Holders[Event.HolderIndex].Buffs;
+		const int32 ArrayIndex = static_cast<int32>(Instance - Array.GetData());
+
+		/* Copy it because OnRemoved wants the state after it has been removed from the array */
+		const FTickableBuffOrDebuffInstanceInfo Removed = *Instance;
+		const FTickableBuffOrDebuffInfo * Info = Removed.GetInfoStruct();
+
+		/* Will avoid RemoveAtSwap to preserve ordering since it will look strange
+		if buffs/debuffs are swapping location on HUD */
+		Array.RemoveAt(ArrayIndex, 1, false);
+
+		Info->ExecuteOnRemovedBehavior(Selectable, Removed, nullptr, nullptr,
+			EBuffAndDebuffRemovalReason::Expired);
+
+		/* Update HUD. For now will not update world widgets but can easily do that
+		by using similar logic to HUD. Check valid again because OnRemoved could have done 
+		something drastic */
+		if (Actor.IsValid() && Selectable->GetAttributesBase().IsSelected())
+		{
+			const bool bIsCurrentSelected = Selectable->GetAttributesBase().IsPrimarySelected();
+			
+			if (Event.bIsDebuff)
+			{
+				PC->GetHUDWidget()->Selected_OnTickableDebuffRemoved(Selectable, ArrayIndex,
+					EBuffAndDebuffRemovalReason::Expired, bIsCurrentSelected);
+			}
+			else
+			{
+				PC->GetHUDWidget()->Selected_OnTickableBuffRemoved(Selectable, ArrayIndex,
+					EBuffAndDebuffRemovalReason::Expired, bIsCurrentSelected);
+			}
+		}
+	}
+}
 
-	for (uint8 k = 0; k < NumTicksToExecute; ++k)
+void ABuffAndDebuffManager::UpdateHUDDurations()
+{
+	/* Only selected selectables show durations. Usually there's only a handful of those */
+	for (const FTickableBuffHolder & Holder : Holders)
 	{
-		InstanceInfo.IncrementTickCount();
+		if (Holder.Actor.IsValid() == false || Holder.Selectable->GetAttributesBase().IsSelected() == false)
+		{
+			continue;
+		}
 
-		const EBuffOrDebuffTickOutcome TickOutcome = Info->ExecuteDoTickBehavior(SomePtrToTheSelectableThisIsAppliedTo, Elem);
+		const bool bIsCurrentSelected = Holder.Selectable->GetAttributesBase().IsPrimarySelected();
+		URTSHUD * HUD = PC->GetHUDWidget();
 
-		/* Note down this tick happened so we can multicast it */
-		a;
+		for (int32 i = 0; i < Holder.Buffs->Num(); ++i)
+		{
+			const FTickableBuffOrDebuffInstanceInfo & Elem = (*Holder.Buffs)[i];
+			if (Elem.GetInfoStruct()->ExpiresOverTime())
+			{
+				HUD->Selected_UpdateTickableBuffDuration(Holder.Selectable, i,
+					Elem.CalculateDurationRemaining(), bIsCurrentSelected);
+			}
+		}
 
-		/* Check if buff/debuff has 'ticked out' */
-		if (bExpiresOverTime && Elem.GetTickCount() == Info->GetNumberOfTicks())
+		for (int32 i = 0; i < Holder.Debuffs->Num(); ++i)
 		{
-			/* Will avoid RemoveAtSwap to preserve ordering since it will look strange
-			if buffs/debuffs are swapping location on HUD */
-			SomePtrToTheSelectableThisIsAppliedTo.;
+			const FTickableBuffOrDebuffInstanceInfo & Elem = (*Holder.Debuffs)[i];
+			if (Elem.GetInfoStruct()->ExpiresOverTime())
+			{
+				HUD->Selected_UpdateTickableDebuffDuration(Holder.Selectable, i,
+					Elem.CalculateDurationRemaining(), bIsCurrentSelected);
+			}
+		}
+	}
+}
 
-			const EBuffOrDebuffRemovalOutcome RemovalOutcome = Info->ExecuteOnRemovedBehavior(SomePtrToTheSelectableThisIsAppliedTo,
-				Elem, nullptr, nullptr, EBuffAndDebuffRemovalReason::Expired);
+void ABuffAndDebuffManager::RemoveFinishedHolders()
+{
+	for (int32 i = Holders.Num() - 1; i >= 0; --i)
+	{
+		const FTickableBuffHolder & Holder = Holders[i];
+		if (Holder.Actor.IsValid() == false || (Holder.Buffs->Num() == 0 && Holder.Debuffs->Num() == 0))
+		{
+			Holders.RemoveAtSwap(i, 1, false);
+		}
+	}
+}
 
-			/* Note down removal happened so we can multicast it. We'll have to send 1 multicast 
-			for both ticks and removals to keep ordering intact */
-			a;
+void ABuffAndDebuffManager::RegisterTickableBuffHolder(AActor * Actor, ISelectable * Selectable,
+	TArray<FTickableBuffOrDebuffInstanceInfo>* Buffs, TArray<FTickableBuffOrDebuffInstanceInfo>* Debuffs)
+{
+	assert(Actor != nullptr && Selectable != nullptr);
+	assert(Buffs != nullptr && Debuffs != nullptr);
 
-			a;// TODO UI updating
+	/* May still be in here if it lost all its buffs/debuffs since our last tick. Registering 
+	doesn't happen often so linear search is fine */
+	for (const FTickableBuffHolder & Holder : Holders)
+	{
+		if (Holder.Selectable == Selectable)
+		{
+			return;
 		}
 	}
+
+	Holders.Emplace(FTickableBuffHolder(Actor, Selectable, Buffs, Debuffs));
 }
 
-#endif
+#endif // TICKABLE_BUFF_AND_DEBUFF_ENABLED_GAME
 
 
 //============================================================================================
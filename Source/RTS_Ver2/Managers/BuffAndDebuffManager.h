@@ -16,13 +16,10 @@ class AActor;
 struct FTickableBuffOrDebuffInfo;
 struct FTickableBuffOrDebuffInstanceInfo;
 enum class EBuffOrDebuffApplicationOutcome : uint8;
+enum class ETickableBuffAndDebuffType : uint8;
 struct FStaticBuffOrDebuffInfo;
 struct FStaticBuffOrDebuffInstanceInfo;
-
-
-// This is just to remove code that doesn't compile TODO remove this and deal with the errors
-// Will need to remove the ticking of buffs/debuffs in AInfantry::Tick and ABuilding::Tick 
-#define WITH_TICKING_BUFF_AND_DEBUFF_MANAGER 0
+class ARTSPlayerController;
 
 //===========================================================================================
 //	------------- File for defining buffs/debuffs ----------------
@@ -82,6 +79,15 @@ defined above */
  *	changed though in the buffs TryApplyTo function. If you want it to tick straight away then 
  *	just add its logic in there
  *
+ *	All tickable buffs/debuffs are ticked by this actor in one batched pass instead of by the 
+ *	selectables they are applied to, so selectables do not need to tick because of them. A 
+ *	selectable registers itself with RegisterTickableBuffHolder when it gets its first tickable 
+ *	buff/debuff and is dropped automatically once it has none left. Each tick:
+ *	1. every holder's timers are advanced and the ones due to tick are noted down
+ *	2. DoTick behaviors run grouped by ETickableBuffAndDebuffType
+ *	3. buffs/debuffs that ticked out are removed
+ *	4. the HUD is told the new durations for whatever is selected
+ *
  *	Stackable buffs/debuffs not implemented
  *
  *	Trying this with function pointers instead of virtuals but may switch to virtuals.
@@ -111,13 +117,100 @@ public:
 
 protected:
 
+	virtual void BeginPlay() override;
+
 	virtual void Tick(float DeltaTime) override;
 
-	/* Tick a single buff/debuff. More suited to be a member of FTickableBuffOrDebuffInstanceInfo */
-	void TickSingleBuffOrDebuff(FTickableBuffOrDebuffInstanceInfo & InstanceInfo, float DeltaTime);
+#if TICKABLE_BUFF_AND_DEBUFF_ENABLED_GAME
+
+	/* A selectable that has at least one tickable buff or debuff applied to it */
+	struct FTickableBuffHolder
+	{
+		TWeakObjectPtr < AActor > Actor;
+		ISelectable * Selectable;
+		
+		/* The selectable's tickable buff and debuff arrays from its attributes struct */
+		TArray < FTickableBuffOrDebuffInstanceInfo > * Buffs;
+		TArray < FTickableBuffOrDebuffInstanceInfo > * Debuffs;
+
+		FTickableBuffHolder(AActor * InActor, ISelectable * InSelectable, 
+			TArray < FTickableBuffOrDebuffInstanceInfo > * InBuffs, 
+			TArray < FTickableBuffOrDebuffInstanceInfo > * InDebuffs)
+			: Actor(InActor) 
+			, Selectable(InSelectable) 
+			, Buffs(InBuffs) 
+			, Debuffs(InDebuffs)
+		{
+		}
+	};
+
+	/* A buff/debuff that needs something done to it this tick */
+	struct FPendingBuffOrDebuffEvent
+	{
+		int32 HolderIndex;
+		int32 ArrayIndex;
+		ETickableBuffAndDebuffType Type;
+		uint8 NumTicks;
+		bool bIsDebuff;
+
+		FPendingBuffOrDebuffEvent(int32 InHolderIndex, int32 InArrayIndex, ETickableBuffAndDebuffType InType, 
+			uint8 InNumTicks, bool bInIsDebuff)
+			: HolderIndex(InHolderIndex) 
+			, ArrayIndex(InArrayIndex) 
+			, Type(InType) 
+			, NumTicks(InNumTicks) 
+			, bIsDebuff(bInIsDebuff)
+		{
+		}
+	};
+
+	/* Advance the timer of every buff/debuff in Array. Anything due to tick is added to DueTicks */
+	void AdvanceTimers(TArray < FTickableBuffOrDebuffInstanceInfo > & Array, int32 HolderIndex, 
+		bool bIsDebuff, float DeltaTime);
+
+	/* Get the instance an event is for. Returns null if it is no longer there e.g. because a
+	DoTick behavior removed it or destroyed the selectable */
+	FTickableBuffOrDebuffInstanceInfo * GetEventInstance(const FPendingBuffOrDebuffEvent & Event) const;
+
+	/* Remove the expired buffs/debuffs and run their OnRemoved behavior */
+	void ProcessExpirations();
+
+	/* Update the HUD durations of the buffs/debuffs on selected selectables */
+	void UpdateHUDDurations();
+
+	/* Remove holders that no longer have any buffs/debuffs or are no longer valid */
+	void RemoveFinishedHolders();
+
+	/* Every selectable with at least one tickable buff/debuff. Removals swap so order means nothing */
+	TArray < FTickableBuffHolder > Holders;
+
+	/* Buffs/debuffs whose DoTick behavior needs running this tick. Only a member to avoid 
+	allocating every tick */
+	TArray < FPendingBuffOrDebuffEvent > DueTicks;
+
+	/* Buffs/debuffs that ticked out this tick */
+	TArray < FPendingBuffOrDebuffEvent > Expirations;
+
+#endif // TICKABLE_BUFF_AND_DEBUFF_ENABLED_GAME
+
+	/* Local player controller. Used for updating the HUD. Null on dedicated servers */
+	ARTSPlayerController * PC;
 
 public:
 
+#if TICKABLE_BUFF_AND_DEBUFF_ENABLED_GAME
+	/**
+	 *	Have this manager tick a selectable's tickable buffs/debuffs. Call when it gets its first 
+	 *	one applied. Safe to call if it is already registered.
+	 *	
+	 *	@param Buffs - the selectable's tickable buff array. Must stay at the same address while 
+	 *	it is registered i.e. a member of the selectable 
+	 *	@param Debuffs - the selectable's tickable debuff array
+	 */
+	void RegisterTickableBuffHolder(AActor * Actor, ISelectable * Selectable,
+		TArray < FTickableBuffOrDebuffInstanceInfo > * Buffs, TArray < FTickableBuffOrDebuffInstanceInfo > * Debuffs);
+#endif
+
 	//==========================================================================================
 	//	Behavior functions for each different buff/debuff
 	//==========================================================================================
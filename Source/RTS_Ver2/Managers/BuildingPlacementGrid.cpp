@@ -0,0 +1,94 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BuildingPlacementGrid.h"
+#include "Engine/World.h"
+
+#include "Statics/Statics.h"
+#include "Statics/DevelopmentStatics.h"
+
+
+FBuildingPlacementGrid::FBuildingPlacementGrid()
+	: GridOrigin(FVector2D::ZeroVector)
+	, NumCells(FIntPoint::ZeroValue)
+	, GridBottomZ(0.f)
+	, GridTopZ(0.f)
+{
+}
+
+void FBuildingPlacementGrid::Build(const UWorld * World, const FBoxSphereBounds & MapBounds)
+{
+	GridOrigin = FVector2D(MapBounds.Origin.X - MapBounds.BoxExtent.X,
+		MapBounds.Origin.Y - MapBounds.BoxExtent.Y);
+	NumCells = FIntPoint(FMath::CeilToInt(MapBounds.BoxExtent.X * 2.f / CELL_SIZE),
+		FMath::CeilToInt(MapBounds.BoxExtent.Y * 2.f / CELL_SIZE));
+	GridBottomZ = MapBounds.Origin.Z - MapBounds.BoxExtent.Z;
+	GridTopZ = MapBounds.Origin.Z + MapBounds.BoxExtent.Z;
+
+	/* Sweep a flat box slightly bigger than a cell down through each cell. It stops on the
+	highest ground anywhere in the cell, which a line trace at the corners would not */
+	const float BoxHalfHeight = 1.f;
+	const FCollisionShape Box = FCollisionShape::MakeBox(
+		FVector(CELL_SIZE / 2 + 1.f, CELL_SIZE / 2 + 1.f, BoxHalfHeight));
+
+	CellGroundTops.Reset(NumCells.X * NumCells.Y);
+	for (int32 Y = 0; Y < NumCells.Y; ++Y)
+	{
+		for (int32 X = 0; X < NumCells.X; ++X)
+		{
+			const FVector2D CellCenter = GridOrigin + (FVector2D(X, Y) + FVector2D(0.5f, 0.5f)) * CELL_SIZE;
+
+			FHitResult Hit;
+			if (World->SweepSingleByChannel(Hit, FVector(CellCenter, GridTopZ + BoxHalfHeight),
+				FVector(CellCenter, GridBottomZ - BoxHalfHeight), FQuat::Identity, GROUND_CHANNEL, Box))
+			{
+				/* Started inside something so it never got to see the top of it */
+				if (Hit.bStartPenetrating)
+				{
+					CellGroundTops.Emplace(TNumericLimits<float>::Max());
+				}
+				else
+				{
+					CellGroundTops.Emplace(FMath::Max(Hit.Location.Z - BoxHalfHeight, Hit.ImpactPoint.Z));
+				}
+			}
+			else
+			{
+				CellGroundTops.Emplace(TNumericLimits<float>::Lowest());
+			}
+		}
+	}
+}
+
+bool FBuildingPlacementGrid::WillGroundTraceMiss(const FVector & Location) const
+{
+	const float TraceTop = Location.Z + FLATNESS_TRACE_DISTANCE / 2;
+	const float TraceBottom = Location.Z - FLATNESS_TRACE_DISTANCE / 2;
+
+	/* Parts of the trace the sweeps did not cover could hit anything */
+	if (TraceBottom < GridBottomZ || TraceTop > GridTopZ)
+	{
+		return false;
+	}
+
+	const int32 CellIndex = GetCellIndex(FVector2D(Location));
+	if (CellIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	/* Everything in the cell is below where the trace ends */
+	return CellGroundTops[CellIndex] + HEIGHT_SLACK < TraceBottom;
+}
+
+int32 FBuildingPlacementGrid::GetCellIndex(const FVector2D & Location) const
+{
+	const FVector2D Local = (Location - GridOrigin) / CELL_SIZE;
+	const int32 X = FMath::FloorToInt(Local.X);
+	const int32 Y = FMath::FloorToInt(Local.Y);
+	if (X < 0 || X >= NumCells.X || Y < 0 || Y >= NumCells.Y)
+	{
+		return INDEX_NONE;
+	}
+
+	return Y * NumCells.X + X;
+}
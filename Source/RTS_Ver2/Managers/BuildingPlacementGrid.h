@@ -0,0 +1,72 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/**
+ *	Cached data about the map's ground used to throw out building locations before
+ *	Statics::IsBuildableLocation does its ground traces.
+ *
+ *	Owned by ARTSGameState. For every cell it knows the highest point of anything blocking
+ *	GROUND_CHANNEL anywhere inside the cell, found with one box sweep per cell when the match
+ *	is setup. Assumes nothing that blocks GROUND_CHANNEL moves or is added after that.
+ *
+ *	Only ever says a trace will definitely miss. Anything it cannot prove is left to the
+ *	physics checks. Does not know about buildings or units since their team channel
+ *	collision is on animated meshes that move during construction, so the overlap test in
+ *	IsBuildableLocation always has to run.
+ */
+class RTS_VER2_API FBuildingPlacementGrid
+{
+public:
+
+	FBuildingPlacementGrid();
+
+	/* Sweep the ground of the whole map. Call once the map has loaded */
+	void Build(const UWorld * World, const FBoxSphereBounds & MapBounds);
+
+	/**
+	 *	Whether one of IsBuildableLocation's flatness traces is known to hit nothing
+	 *
+	 *	@param Location - point on the building's floor the trace is centered on. It goes from
+	 *	FLATNESS_TRACE_DISTANCE / 2 above this to FLATNESS_TRACE_DISTANCE / 2 below it
+	 *	@return - true if the trace will definitely not hit ground, false if it might
+	 */
+	bool WillGroundTraceMiss(const FVector & Location) const;
+
+	/* Width and length of a grid cell */
+	static constexpr float CELL_SIZE = 64.f;
+
+	/* Length of the ground traces IsBuildableLocation does at the center and corners of a
+	building's floor. They start half this above the floor */
+	static constexpr float FLATNESS_TRACE_DISTANCE = 64.f;
+
+	/* How much higher or lower a corner ground trace impact can be from the center ground
+	trace impact. Needs to be <= FLATNESS_TRACE_DISTANCE / 2 */
+	static constexpr float FLATNESS_HEIGHT_ALLOWANCE = 20.f;
+
+	/* Added to the swept ground heights to cover the collision skin and float error of the
+	sweeps */
+	static constexpr float HEIGHT_SLACK = 2.f;
+
+private:
+
+	/* Index of cell or INDEX_NONE if outside the grid */
+	int32 GetCellIndex(const FVector2D & Location) const;
+
+	/* Location of the corner of cell (0, 0) */
+	FVector2D GridOrigin;
+
+	/* Dimensions of grid in cells. Zero if not built */
+	FIntPoint NumCells;
+
+	/* Z range the sweeps covered. Nothing is known about ground outside it */
+	float GridBottomZ;
+	float GridTopZ;
+
+	/* No ground anywhere in a cell is higher than this. Lowest float if the cell has no
+	ground at all and max float if the sweep could not tell */
+	TArray < float > CellGroundTops;
+};
@@ -3,12 +3,14 @@
 #include "CPUControllerTickManager.h"
 
 #include "Miscellaneous/CPUPlayerAIController.h"
+#include "Managers/CommandRecording.h"
 
 
 ACPUControllerTickManager::ACPUControllerTickManager()
 {
 	PrimaryActorTick.bCanEverTick = true;
 	PrimaryActorTick.bStartWithTickEnabled = true;
+	PrimaryActorTick.TickGroup = TG_PostUpdateWork;
 
 	// Fill with nulls
 	AIControllers.Init(nullptr, NUM_CONTROLLER_ARRAY_ENTRIES);
@@ -18,6 +20,8 @@ void ACPUControllerTickManager::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	BENCHMARK_SCOPE(CPUPlayers);
+
 	ACPUPlayerAIController * AICon = AIControllers[Index++ % NUM_CONTROLLER_ARRAY_ENTRIES];
 
 	/* Null check because there will be nulls unless we are playing with the max allowed 
@@ -18,6 +18,12 @@ class ACPUPlayerAIController;
  *	can range from doing next to nothing to doing many sweeps and large amounts of iteration.
  *	By using the tick manager this guarantees at most one AI controller ticks each engine tick.
  *
+ *	Only carrying out decisions happens during the AI controller's tick. Deciding what to do 
+ *	next is then started on a worker thread, so each CPU player has until its next tick to 
+ *	think and the CPU players think in parallel with each other and with the game thread. 
+ *	Ticks late in the frame so the snapshots decisions are made from are as up to date as 
+ *	possible.
+ *
  *	CPU player tick rate is dependent on engine tick rate i.e. at 120fps twice as many AI controller 
  *	ticks will happen than if at 60fps. This can be easily changed but isn't that big of a deal. 
  *	A good thing to note though is that the number of CPU players in the match does not affect 
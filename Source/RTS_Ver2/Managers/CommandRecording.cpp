@@ -0,0 +1,671 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CommandRecording.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/App.h"
+#include "Misc/Paths.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "RenderCore.h" // For GGameThreadTime
+
+#include "GameFramework/RTSGameState.h"
+#include "GameFramework/RTSPlayerState.h"
+#include "GameFramework/RTSPlayerController.h"
+#include "GameFramework/Selectable.h"
+#include "Statics/Statics.h"
+#include "Statics/Structs_2.h"
+#include "Statics/Structs_4.h"
+#include "Statics/SelectableFlags.h"
+#include "Statics/DevelopmentStatics.h"
+
+
+/* Serialize a uint8 enum */
+template <typename TEnum>
+static FORCEINLINE void SerializeEnum(FArchive & Ar, TEnum & Value)
+{
+	static_assert(sizeof(TEnum) == 1, "Only uint8 enums supported");
+	uint8 AsByte = static_cast<uint8>(Value);
+	Ar << AsByte;
+	Value = static_cast<TEnum>(AsByte);
+}
+
+
+//==============================================================================================
+//	>FRecordedActorRef
+//==============================================================================================
+
+FRecordedActorRef::FRecordedActorRef()
+	: OwnerID(0)
+	, SelectableID(0)
+	, ActorName(NAME_None)
+{
+}
+
+FRecordedActorRef::FRecordedActorRef(const AActor * Actor)
+	: OwnerID(0)
+	, SelectableID(0)
+	, ActorName(NAME_None)
+{
+	if (!Statics::IsValid(Actor))
+	{
+		return;
+	}
+
+	const ISelectable * AsSelectable = Cast<ISelectable>(Actor);
+	const FSelectableFlags Flags = (AsSelectable != nullptr) 
+		? AsSelectable->GetAttributesBase().GetSelectableFlags() : FSelectableFlags();
+	/* Resource spots have the building flag but no owner so go by name */
+	if ((Flags.IsAUnit() || Flags.IsABuilding()) && Flags.GetOwnerID() != 0)
+	{
+		OwnerID = Flags.GetOwnerID();
+		SelectableID = AsSelectable->GetSelectableID();
+	}
+	else
+	{
+		ActorName = Actor->GetFName();
+	}
+}
+
+AActor * FRecordedActorRef::Resolve(const ARTSGameState * GameState, const TArray < ARTSPlayerState * > & RecordedIDToPlayerState) const
+{
+	if (OwnerID != 0)
+	{
+		ARTSPlayerState * Owner = RecordedIDToPlayerState[OwnerID];
+		return (Owner != nullptr && SelectableID != 0) ? Owner->GetSelectableFromID(SelectableID) : nullptr;
+	}
+
+	if (ActorName != NAME_None)
+	{
+		/* Map is streamed in so check every level */
+		const FString NameString = ActorName.ToString();
+		for (ULevel * Level : GameState->GetWorld()->GetLevels())
+		{
+			AActor * Actor = FindObject<AActor>(Level, *NameString);
+			if (Actor != nullptr)
+			{
+				return Actor;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+FArchive & operator<<(FArchive & Ar, FRecordedActorRef & Ref)
+{
+	Ar << Ref.OwnerID;
+	if (Ref.OwnerID != 0)
+	{
+		Ar << Ref.SelectableID;
+	}
+	else
+	{
+		Ar << Ref.ActorName;
+	}
+
+	return Ar;
+}
+
+
+//==============================================================================================
+//	>FRecordedCommand
+//==============================================================================================
+
+FRecordedCommand::FRecordedCommand()
+	: GameTick(0)
+	, PlayerID(0)
+	, Type(ERecordedCommandType::z_ALWAYS_LAST_IN_ENUM)
+	, SubType(0)
+	, TargetKind(0)
+	, Location(FVector::ZeroVector)
+	, Rotation(FRotator::ZeroRotator)
+	, ExtraID(0)
+{
+}
+
+FRecordedCommand::FRecordedCommand(ERecordedCommandType InType)
+	: FRecordedCommand()
+{
+	Type = InType;
+}
+
+/* Write selectable IDs with a 1 byte count. IDs are uint8 so there can never be more than 255 */
+static void SerializeSelectableIDs(FArchive & Ar, TArray < uint8 > & IDs)
+{
+	uint8 Num = static_cast<uint8>(IDs.Num());
+	assert(IDs.Num() <= UINT8_MAX);
+	Ar << Num;
+
+	if (Ar.IsLoading())
+	{
+		IDs.SetNumUninitialized(Num);
+	}
+
+	Ar.Serialize(IDs.GetData(), Num);
+}
+
+FArchive & operator<<(FArchive & Ar, FRecordedCommand & Command)
+{
+	Ar << Command.GameTick;
+	SerializeEnum(Ar, Command.Type);
+
+	/* End of recording marker */
+	if (Command.Type == ERecordedCommandType::z_ALWAYS_LAST_IN_ENUM)
+	{
+		return Ar;
+	}
+
+	Ar << Command.PlayerID;
+
+	/* Only write what each type uses */
+	switch (Command.Type)
+	{
+		case ERecordedCommandType::RightClick:
+		{
+			SerializeSelectableIDs(Ar, Command.Selectables);
+			Ar << Command.Location;
+			Ar << Command.Target;
+			break;
+		}
+		case ERecordedCommandType::Context_Targeting:
+		{
+			Ar << Command.SubType;
+			SerializeSelectableIDs(Ar, Command.Selectables);
+			Ar << Command.Location;
+			Ar << Command.Target;
+			break;
+		}
+		case ERecordedCommandType::Context_Location:
+		{
+			Ar << Command.SubType;
+			SerializeSelectableIDs(Ar, Command.Selectables);
+			Ar << Command.Location;
+			break;
+		}
+		case ERecordedCommandType::Context_Instant:
+		{
+			Ar << Command.SubType;
+			SerializeSelectableIDs(Ar, Command.Selectables);
+			break;
+		}
+		case ERecordedCommandType::PlaceBuilding:
+		case ERecordedCommandType::LayFoundation:
+		{
+			Ar << Command.SubType;
+			Ar << Command.Location;
+			Ar << Command.Rotation;
+			Ar << Command.ExtraID;
+			break;
+		}
+		case ERecordedCommandType::CommanderAbility:
+		{
+			Ar << Command.SubType;
+			Ar << Command.TargetKind;
+
+			switch (static_cast<ERecordedCommanderAbilityTarget>(Command.TargetKind))
+			{
+				case ERecordedCommanderAbilityTarget::Player:
+				{
+					Ar << Command.ExtraID;
+					break;
+				}
+				case ERecordedCommanderAbilityTarget::Selectable:
+				case ERecordedCommanderAbilityTarget::LocationOrSelectable_UsingSelectable:
+				{
+					Ar << Command.Target;
+					break;
+				}
+				case ERecordedCommanderAbilityTarget::Location:
+				case ERecordedCommanderAbilityTarget::LocationOrSelectable_UsingLocation:
+				{
+					Ar << Command.Location;
+					break;
+				}
+				default:
+				{
+					break;
+				}
+			}
+			break;
+		}
+		default:
+		{
+			UE_LOG(RTSLOG, Fatal, TEXT("Unknown recorded command type [%d]"),
+				static_cast<int32>(Command.Type));
+			break;
+		}
+	}
+
+	return Ar;
+}
+
+
+//==============================================================================================
+//	>FRecordedPlayer
+//==============================================================================================
+
+FArchive & operator<<(FArchive & Ar, FRecordedPlayer & Player)
+{
+	Ar << Player.PlayerID;
+	Ar << Player.bIsHuman;
+	SerializeEnum(Ar, Player.CPUDifficulty);
+	SerializeEnum(Ar, Player.Team);
+	SerializeEnum(Ar, Player.Faction);
+	Ar << Player.StartingSpot;
+
+	return Ar;
+}
+
+
+//==============================================================================================
+//	>FCommandRecordingHeader
+//==============================================================================================
+
+FCommandRecordingHeader::FCommandRecordingHeader()
+	: Magic(MAGIC)
+	, Version(VERSION)
+	, MapID(0)
+	, NumTeams(0)
+	, DefeatCondition(EDefeatCondition::None)
+	, StartingResources(EStartingResourceAmount::Default)
+	, RandomSeed(0)
+{
+}
+
+FArchive & operator<<(FArchive & Ar, FCommandRecordingHeader & Header)
+{
+	Ar << Header.Magic;
+	Ar << Header.Version;
+
+	/* Do not try read the rest of something that is not a recording */
+	if (Header.Magic != FCommandRecordingHeader::MAGIC || Header.Version != FCommandRecordingHeader::VERSION)
+	{
+		return Ar;
+	}
+
+	Ar << Header.MapID;
+	Ar << Header.NumTeams;
+	SerializeEnum(Ar, Header.DefeatCondition);
+	SerializeEnum(Ar, Header.StartingResources);
+	Ar << Header.RandomSeed;
+	Ar << Header.Players;
+
+	return Ar;
+}
+
+void FCommandRecordingHeader::SetFromMatchInfo(const FMatchInfo & MatchInfo)
+{
+	MapID = MatchInfo.GetMapUniqueID().ID;
+	NumTeams = static_cast<uint8>(MatchInfo.GetNumTeams());
+	DefeatCondition = MatchInfo.GetDefeatCondition();
+	StartingResources = MatchInfo.GetStartingResources();
+
+	Players.Reset(MatchInfo.GetPlayers().Num());
+	for (const FPlayerInfo & Elem : MatchInfo.GetPlayers())
+	{
+		FRecordedPlayer Player;
+		Player.bIsHuman = (Elem.PlayerType == ELobbySlotStatus::Human);
+		Player.PlayerID = (Player.bIsHuman ? Elem.PlayerState : Elem.CPUPlayerState)->GetPlayerIDAsInt();
+		Player.CPUDifficulty = Player.bIsHuman ? ECPUDifficulty::None : Elem.CPUDifficulty;
+		Player.Team = Elem.Team;
+		Player.Faction = Elem.Faction;
+		Player.StartingSpot = Elem.StartingSpotID;
+
+		Players.Emplace(Player);
+	}
+}
+
+
+//==============================================================================================
+//	>FCommandRecorder
+//==============================================================================================
+
+FCommandRecorder::FCommandRecorder()
+	: NumRecorded(0)
+{
+}
+
+FCommandRecorder::~FCommandRecorder()
+{
+	/* Match ended without End being called e.g. game was closed. Whatever was written is
+	still readable, it just has no end marker */
+	Writer.Reset();
+}
+
+void FCommandRecorder::Begin(const FString & InFilePath, FCommandRecordingHeader & Header)
+{
+	assert(!IsRecording());
+
+	Writer = TUniquePtr<FArchive>(IFileManager::Get().CreateFileWriter(*InFilePath));
+	if (!Writer.IsValid())
+	{
+		UE_LOG(RTSLOG, Warning, TEXT("Could not open [%s] to record commands to"), *InFilePath);
+		return;
+	}
+
+	FilePath = InFilePath;
+	NumRecorded = 0;
+
+	*Writer << Header;
+
+	UE_LOG(RTSLOG, Log, TEXT("Recording commands to [%s]"), *FilePath);
+}
+
+void FCommandRecorder::Record(FRecordedCommand & Command)
+{
+	assert(IsRecording());
+	assert(Command.Type != ERecordedCommandType::z_ALWAYS_LAST_IN_ENUM);
+
+	*Writer << Command;
+	NumRecorded++;
+}
+
+void FCommandRecorder::End(uint32 FinalGameTick)
+{
+	if (!IsRecording())
+	{
+		return;
+	}
+
+	FRecordedCommand EndMarker;
+	EndMarker.GameTick = FinalGameTick;
+	*Writer << EndMarker;
+
+	Writer->Close();
+	Writer.Reset();
+
+	UE_LOG(RTSLOG, Log, TEXT("Recorded %d commands over %u game ticks to [%s]"), NumRecorded,
+		FinalGameTick, *FilePath);
+}
+
+
+//==============================================================================================
+//	>FReplayBenchmark
+//==============================================================================================
+
+FReplayBenchmark * FReplayBenchmark::Active = nullptr;
+
+FReplayBenchmark::FReplayBenchmark()
+	: CurrentFrame()
+{
+}
+
+FReplayBenchmark::~FReplayBenchmark()
+{
+	if (Active == this)
+	{
+		FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+		Active = nullptr;
+	}
+}
+
+void FReplayBenchmark::Begin()
+{
+	assert(Active == nullptr);
+
+	Active = this;
+	Frames.Reset();
+	FMemory::Memzero(CurrentFrame);
+
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FReplayBenchmark::OnEndFrame);
+}
+
+void FReplayBenchmark::OnEndFrame()
+{
+	const int32 Index = Frames.AddUninitialized();
+	FFrameSample & Sample = Frames[Index];
+	Sample.FrameMilliseconds = static_cast<float>(FApp::GetDeltaTime() * 1000.0);
+	Sample.GameThreadMilliseconds = FPlatformTime::ToMilliseconds(GGameThreadTime);
+	for (int32 i = 0; i < NUM_SUBSYSTEMS; ++i)
+	{
+		Sample.SubsystemMilliseconds[i] = static_cast<float>(FPlatformTime::ToMilliseconds64(CurrentFrame[i]));
+	}
+
+	FMemory::Memzero(CurrentFrame);
+}
+
+void FReplayBenchmark::End(const FString & OutputPath)
+{
+	assert(Active == this);
+
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	Active = nullptr;
+
+	const int32 NumColumns = 2 + NUM_SUBSYSTEMS;
+
+	/* Every frame */
+	FString FramesCSV = TEXT("Frame,FrameMs,GameThreadMs");
+	for (int32 i = 0; i < NUM_SUBSYSTEMS; ++i)
+	{
+		FramesCSV += FString::Printf(TEXT(",%sMs"), GetSubsystemName(static_cast<EBenchmarkSubsystem>(i)));
+	}
+	FramesCSV += LINE_TERMINATOR;
+
+	TArray < TArray < float > > Columns;
+	Columns.SetNum(NumColumns);
+	for (TArray < float > & Column : Columns)
+	{
+		Column.Reserve(Frames.Num());
+	}
+
+	for (int32 FrameIndex = 0; FrameIndex < Frames.Num(); ++FrameIndex)
+	{
+		const FFrameSample & Sample = Frames[FrameIndex];
+
+		FramesCSV += FString::Printf(TEXT("%d,%.3f,%.3f"), FrameIndex, Sample.FrameMilliseconds,
+			Sample.GameThreadMilliseconds);
+		Columns[0].Emplace(Sample.FrameMilliseconds);
+		Columns[1].Emplace(Sample.GameThreadMilliseconds);
+
+		for (int32 i = 0; i < NUM_SUBSYSTEMS; ++i)
+		{
+			FramesCSV += FString::Printf(TEXT(",%.3f"), Sample.SubsystemMilliseconds[i]);
+			Columns[2 + i].Emplace(Sample.SubsystemMilliseconds[i]);
+		}
+		FramesCSV += LINE_TERMINATOR;
+	}
+
+	/* Summary. One row per column above */
+	FString SummaryCSV = TEXT("Name,MeanMs,P50Ms,P95Ms,MaxMs") LINE_TERMINATOR;
+	for (int32 i = 0; i < NumColumns; ++i)
+	{
+		TArray < float > & Column = Columns[i];
+		const FString Name = (i == 0) ? TEXT("Frame") : (i == 1) ? TEXT("GameThread")
+			: GetSubsystemName(static_cast<EBenchmarkSubsystem>(i - 2));
+
+		if (Column.Num() == 0)
+		{
+			SummaryCSV += FString::Printf(TEXT("%s,0,0,0,0") LINE_TERMINATOR, *Name);
+			continue;
+		}
+
+		double Total = 0.0;
+		for (const float Value : Column)
+		{
+			Total += Value;
+		}
+
+		Column.Sort();
+		const float P50 = Column[(Column.Num() - 1) / 2];
+		const float P95 = Column[FMath::Min(Column.Num() - 1, (Column.Num() * 95) / 100)];
+
+		SummaryCSV += FString::Printf(TEXT("%s,%.3f,%.3f,%.3f,%.3f") LINE_TERMINATOR, *Name,
+			Total / Column.Num(), P50, P95, Column.Last());
+	}
+
+	const FString SummaryPath = GetSummaryPath(OutputPath);
+
+	FFileHelper::SaveStringToFile(FramesCSV, *OutputPath);
+	FFileHelper::SaveStringToFile(SummaryCSV, *SummaryPath);
+
+	UE_LOG(RTSLOG, Log, TEXT("Replay benchmark: %d frames. Timings written to [%s] and [%s]"),
+		Frames.Num(), *OutputPath, *SummaryPath);
+}
+
+FString FReplayBenchmark::GetSummaryPath(const FString & OutputPath)
+{
+	return FPaths::GetPath(OutputPath) / FPaths::GetBaseFilename(OutputPath) + TEXT("_Summary.csv");
+}
+
+const TCHAR * FReplayBenchmark::GetSubsystemName(EBenchmarkSubsystem Subsystem)
+{
+	switch (Subsystem)
+	{
+		case EBenchmarkSubsystem::GameState: return TEXT("GameState");
+		case EBenchmarkSubsystem::InfantryControllers: return TEXT("InfantryControllers");
+		case EBenchmarkSubsystem::CPUPlayers: return TEXT("CPUPlayers");
+		case EBenchmarkSubsystem::FogOfWar: return TEXT("FogOfWar");
+		case EBenchmarkSubsystem::HeavyTasks: return TEXT("HeavyTasks");
+		case EBenchmarkSubsystem::SelectableGrid: return TEXT("SelectableGrid");
+		default: assert(0); return TEXT("Unknown");
+	}
+}
+
+
+//==============================================================================================
+//	>FCommandReplayer
+//==============================================================================================
+
+FCommandReplayer::FCommandReplayer()
+	: NextCommandIndex(0)
+	, FinalGameTick(0)
+	, bIsLoaded(false)
+	, bHasFinished(false)
+{
+}
+
+bool FCommandReplayer::Load(const FString & FilePath)
+{
+	TUniquePtr < FArchive > Reader = TUniquePtr<FArchive>(IFileManager::Get().CreateFileReader(*FilePath));
+	if (!Reader.IsValid())
+	{
+		UE_LOG(RTSLOG, Warning, TEXT("Could not open command recording [%s]"), *FilePath);
+		return false;
+	}
+
+	*Reader << Header;
+	if (Header.Magic != FCommandRecordingHeader::MAGIC || Header.Version != FCommandRecordingHeader::VERSION)
+	{
+		UE_LOG(RTSLOG, Warning, TEXT("[%s] is not a command recording or was recorded with a "
+			"different version. Expected version %u"), *FilePath, FCommandRecordingHeader::VERSION);
+		return false;
+	}
+
+	Commands.Reset();
+	FinalGameTick = 0;
+	while (!Reader->AtEnd())
+	{
+		FRecordedCommand Command;
+		*Reader << Command;
+
+		if (Reader->IsError())
+		{
+			break;
+		}
+
+		FinalGameTick = Command.GameTick;
+
+		if (Command.Type == ERecordedCommandType::z_ALWAYS_LAST_IN_ENUM)
+		{
+			break;
+		}
+
+		Commands.Emplace(MoveTemp(Command));
+	}
+
+	NextCommandIndex = 0;
+	bIsLoaded = true;
+	bHasFinished = false;
+
+	UE_LOG(RTSLOG, Log, TEXT("Loaded %d commands over %u game ticks from [%s]"), Commands.Num(),
+		FinalGameTick, *FilePath);
+
+	return true;
+}
+
+void FCommandReplayer::SetupMatchInfo(FMatchInfo & MatchInfo, ARTSPlayerState * LocalPlayerState,
+	const FName & MapFName, const FText & MapDisplayName) const
+{
+	assert(bIsLoaded);
+
+	MatchInfo.SetNumTeams(Header.NumTeams);
+	MatchInfo.SetMatchType(EMatchType::Offline);
+	MatchInfo.SetMap(MapFName, FMapID(Header.MapID), MapDisplayName);
+	MatchInfo.SetDefeatCondition(Header.DefeatCondition);
+	MatchInfo.SetStartingResources(Header.StartingResources);
+
+	MatchInfo.GetPlayers().Reset();
+
+	bool bHasUsedLocalPlayer = false;
+	for (const FRecordedPlayer & Player : Header.Players)
+	{
+		if (Player.bIsHuman && !bHasUsedLocalPlayer)
+		{
+			bHasUsedLocalPlayer = true;
+			MatchInfo.AddPlayer(FPlayerInfo(LocalPlayerState, Player.Team, Player.Faction, Player.StartingSpot));
+		}
+		else
+		{
+			/* Humans that were connected over the network have no one to control them so their
+			commands come from the recording instead */
+			const ECPUDifficulty Difficulty = Player.bIsHuman ? ECPUDifficulty::DoesNothing : Player.CPUDifficulty;
+			MatchInfo.AddPlayer(FPlayerInfo(Difficulty, Player.Team, Player.Faction, Player.StartingSpot));
+		}
+	}
+
+	/* Recordings are made by the server which always has a human player */
+	UE_CLOG(!bHasUsedLocalPlayer, RTSLOG, Fatal, TEXT("Command recording has no human players"));
+}
+
+void FCommandReplayer::OnMatchStarted(const FMatchInfo & MatchInfo, const FString & InOutputPath)
+{
+	assert(bIsLoaded);
+
+	RecordedIDToPlayerState.Init(nullptr, UINT8_MAX + 1);
+	for (int32 i = 0; i < Header.Players.Num(); ++i)
+	{
+		const FPlayerInfo & PlayerInfo = MatchInfo.GetPlayers()[i];
+		RecordedIDToPlayerState[Header.Players[i].PlayerID] = (PlayerInfo.PlayerType == ELobbySlotStatus::Human)
+			? PlayerInfo.PlayerState : PlayerInfo.CPUPlayerState;
+	}
+
+	OutputPath = InOutputPath;
+	Benchmark.Begin();
+}
+
+void FCommandReplayer::OnGameTick(uint32 GameTick, ARTSGameState * GameState)
+{
+	if (!bIsLoaded || bHasFinished)
+	{
+		return;
+	}
+
+	ARTSPlayerController * PlayCon = CastChecked<ARTSPlayerController>(GameState->GetWorld()->GetFirstPlayerController());
+
+	while (NextCommandIndex < Commands.Num() && Commands[NextCommandIndex].GameTick <= GameTick)
+	{
+		const FRecordedCommand & Command = Commands[NextCommandIndex++];
+
+		ARTSPlayerState * Issuer = RecordedIDToPlayerState[Command.PlayerID];
+		if (!Statics::IsValid(Issuer))
+		{
+			UE_LOG(RTSLOG, Warning, TEXT("Replay: no player for recorded player ID [%d], skipping command"),
+				Command.PlayerID);
+			continue;
+		}
+
+		PlayCon->ReplayCommand(Command, Issuer, RecordedIDToPlayerState);
+	}
+
+	if (GameTick >= FinalGameTick)
+	{
+		bHasFinished = true;
+
+		Benchmark.End(OutputPath);
+
+		UE_LOG(RTSLOG, Log, TEXT("Replay finished on game tick %u"), GameTick);
+		FPlatformMisc::RequestExit(false);
+	}
+}
@@ -0,0 +1,372 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Statics/CommonEnums.h"
+#include "Statics/OtherEnums.h"
+
+class ARTSGameState;
+class ARTSPlayerState;
+struct FMatchInfo;
+
+
+/**--------------------------------------------------------------------------------------------
+ *	Recording and replaying the commands players issue during a match, for benchmarking.
+ *
+ *	Recording: launch the server with -RTSRecordCommands[=Path]. Every command a player issues
+ *	is written to a binary file along with the match setup, the random seed and which game
+ *	tick (ProjectSettings::GAME_TICK_RATE) it happened on.
+ *
+ *	Replaying: launch with -game -nullrhi -benchmark -fps=N -RTSReplay=Path. The game skips
+ *	the main menu, sets up the recorded match (every human except the first becomes a
+ *	DoesNothing CPU player) and issues each recorded command on the same game tick it was
+ *	recorded on. Per frame timings of the subsystems in EBenchmarkSubsystem are written to a
+ *	CSV when the recording runs out. UReplayBenchmarkCommandlet wraps all this up.
+ *
+ *	Replays are repeatable, not bit exact. CPU players still make their own decisions and
+ *	physics/pathfinding depend on frame times, so a recorded selectable ID can end up referring
+ *	to nothing. Those commands are still issued, just without that selectable.
+ ----------------------------------------------------------------------------------------------*/
+
+
+/* The different kinds of commands that get recorded */
+enum class ERecordedCommandType : uint8
+{
+	RightClick,
+
+	/* Context command that targets a selectable */
+	Context_Targeting,
+
+	/* Context command that targets a location */
+	Context_Location,
+
+	/* Context command that needs no target */
+	Context_Instant,
+
+	PlaceBuilding,
+
+	/* Order a worker to go and lay the foundations for a building */
+	LayFoundation,
+
+	CommanderAbility,
+
+	z_ALWAYS_LAST_IN_ENUM
+};
+
+
+/* The different Server_RequestExecuteCommanderAbility RPCs */
+enum class ERecordedCommanderAbilityTarget : uint8
+{
+	None,
+	Player,
+	Selectable,
+	Location,
+	LocationOrSelectable_UsingSelectable,
+	LocationOrSelectable_UsingLocation
+};
+
+
+/**
+ *	Reference to an actor that holds up across runs. Player owned selectables are stored as
+ *	(owner ID, selectable ID). Anything else is stored by actor name which only holds up for
+ *	actors placed on the map e.g. resource spots
+ */
+struct FRecordedActorRef
+{
+	FRecordedActorRef();
+	explicit FRecordedActorRef(const AActor * Actor);
+
+	/* Find the actor this refers to. Can return null */
+	AActor * Resolve(const ARTSGameState * GameState, const TArray < ARTSPlayerState * > & RecordedIDToPlayerState) const;
+
+	friend FArchive & operator<<(FArchive & Ar, FRecordedActorRef & Ref);
+
+	/* 0 = not owned by a player */
+	uint8 OwnerID;
+	uint8 SelectableID;
+
+	/* Only used when OwnerID is 0. NAME_None = no actor */
+	FName ActorName;
+};
+
+
+/* A single command issued by a player */
+struct FRecordedCommand
+{
+	FRecordedCommand();
+	explicit FRecordedCommand(ERecordedCommandType InType);
+
+	friend FArchive & operator<<(FArchive & Ar, FRecordedCommand & Command);
+
+	/* Game tick the command was issued on */
+	uint32 GameTick;
+
+	/* ID of player that issued the command */
+	uint8 PlayerID;
+
+	ERecordedCommandType Type;
+
+	/* Depends on Type: context button type, building type or commander ability type, cast
+	to uint8 */
+	uint8 SubType;
+
+	/* Commander abilities only: which RPC it came through. Cast from
+	ERecordedCommanderAbilityTarget */
+	uint8 TargetKind;
+
+	/* Selectable IDs of the issuing player's selectables the command was given to */
+	TArray < uint8 > Selectables;
+
+	FVector Location;
+
+	/* Place building and lay foundation only */
+	FRotator Rotation;
+
+	FRecordedActorRef Target;
+
+	/* Depends on Type: construction instigator ID, builder ID or targeted player ID */
+	uint8 ExtraID;
+};
+
+
+/* A player in the recorded match */
+struct FRecordedPlayer
+{
+	friend FArchive & operator<<(FArchive & Ar, FRecordedPlayer & Player);
+
+	/* The ID the player had when the match was recorded */
+	uint8 PlayerID;
+
+	bool bIsHuman;
+
+	ECPUDifficulty CPUDifficulty;
+
+	ETeam Team;
+
+	EFaction Faction;
+
+	int16 StartingSpot;
+};
+
+
+/* Everything needed to set the recorded match up again */
+struct FCommandRecordingHeader
+{
+	FCommandRecordingHeader();
+
+	friend FArchive & operator<<(FArchive & Ar, FCommandRecordingHeader & Header);
+
+	/* Fill in everything except the random seed from the match that is about to start */
+	void SetFromMatchInfo(const FMatchInfo & MatchInfo);
+
+	uint32 Magic;
+	uint32 Version;
+
+	/* FMapID::ID */
+	uint8 MapID;
+
+	uint8 NumTeams;
+
+	EDefeatCondition DefeatCondition;
+
+	EStartingResourceAmount StartingResources;
+
+	/* What FMath::RandInit/SRandInit were called with when the match started */
+	int32 RandomSeed;
+
+	/* In the same order as FMatchInfo::GetPlayers */
+	TArray < FRecordedPlayer > Players;
+
+	static constexpr uint32 MAGIC = 0x52545343; // "RTSC"
+
+	/* Bump whenever the file layout changes */
+	static constexpr uint32 VERSION = 1;
+};
+
+
+/**
+ *	Writes commands to a file as they happen. Owned by ARTSGameState. Server only.
+ */
+class RTS_VER2_API FCommandRecorder
+{
+public:
+
+	FCommandRecorder();
+	~FCommandRecorder();
+
+	/* Open the file and write the header. Logs and does nothing if the file cannot be opened */
+	void Begin(const FString & FilePath, FCommandRecordingHeader & Header);
+
+	bool IsRecording() const { return Writer.IsValid(); }
+
+	/* Write a command. GameTick and PlayerID should already be set */
+	void Record(FRecordedCommand & Command);
+
+	/* Write the end marker and close the file */
+	void End(uint32 FinalGameTick);
+
+private:
+
+	TUniquePtr < FArchive > Writer;
+
+	FString FilePath;
+
+	int32 NumRecorded;
+};
+
+
+/* Subsystems the replay benchmark times separately */
+enum class EBenchmarkSubsystem : uint8
+{
+	GameState,
+	InfantryControllers,
+	CPUPlayers,
+	FogOfWar,
+	HeavyTasks,
+	SelectableGrid,
+
+	z_ALWAYS_LAST_IN_ENUM
+};
+
+
+/**
+ *	Per frame timings gathered while replaying. Subsystems report time with
+ *	BENCHMARK_SCOPE which costs a single null check when no replay is running.
+ *	Times can overlap e.g. the selectable grid is usually rebuilt from inside the infantry
+ *	controller tick
+ */
+class RTS_VER2_API FReplayBenchmark
+{
+public:
+
+	FReplayBenchmark();
+	~FReplayBenchmark();
+
+	/* Start collecting timings. Only one can be active at a time */
+	void Begin();
+
+	/* Stop collecting and write every frame's timings plus a summary to a CSV */
+	void End(const FString & OutputPath);
+
+	/* The benchmark currently collecting timings, or null */
+	static FReplayBenchmark * Active;
+
+	FORCEINLINE void AddCycles(EBenchmarkSubsystem Subsystem, uint64 Cycles)
+	{
+		CurrentFrame[static_cast<uint8>(Subsystem)] += Cycles;
+	}
+
+	static const TCHAR * GetSubsystemName(EBenchmarkSubsystem Subsystem);
+
+	/* Where End writes the summary (mean, median, 95th percentile and max of each column) */
+	static FString GetSummaryPath(const FString & OutputPath);
+
+	static constexpr int32 NUM_SUBSYSTEMS = static_cast<int32>(EBenchmarkSubsystem::z_ALWAYS_LAST_IN_ENUM);
+
+private:
+
+	/* Bound to FCoreDelegates::OnEndFrame */
+	void OnEndFrame();
+
+	struct FFrameSample
+	{
+		float FrameMilliseconds;
+		float GameThreadMilliseconds;
+		float SubsystemMilliseconds[NUM_SUBSYSTEMS];
+	};
+
+	TArray < FFrameSample > Frames;
+
+	uint64 CurrentFrame[NUM_SUBSYSTEMS];
+
+	FDelegateHandle EndFrameHandle;
+};
+
+
+/* Adds the time until the end of the scope to a subsystem's time for this frame */
+struct FBenchmarkScope
+{
+	explicit FBenchmarkScope(EBenchmarkSubsystem InSubsystem)
+		: Subsystem(InSubsystem)
+		, StartCycles(FReplayBenchmark::Active != nullptr ? FPlatformTime::Cycles64() : 0)
+	{
+	}
+
+	~FBenchmarkScope()
+	{
+		if (FReplayBenchmark::Active != nullptr && StartCycles != 0)
+		{
+			FReplayBenchmark::Active->AddCycles(Subsystem, FPlatformTime::Cycles64() - StartCycles);
+		}
+	}
+
+	EBenchmarkSubsystem Subsystem;
+	uint64 StartCycles;
+};
+
+#define BENCHMARK_SCOPE(Subsystem) FBenchmarkScope PREPROCESSOR_JOIN(BenchmarkScope_, __LINE__)(EBenchmarkSubsystem::Subsystem)
+
+
+/**
+ *	Reads a recording and issues its commands. Owned by URTSGameInstance. Server only.
+ */
+class RTS_VER2_API FCommandReplayer
+{
+public:
+
+	FCommandReplayer();
+
+	/**
+	 *	Read a whole recording into memory
+	 *
+	 *	@return - true if the file was a valid recording
+	 */
+	bool Load(const FString & FilePath);
+
+	bool IsLoaded() const { return bIsLoaded; }
+
+	const FCommandRecordingHeader & GetHeader() const { return Header; }
+
+	/**
+	 *	Call when the match starts so recorded player IDs can be mapped to this match's players
+	 *
+	 *	@param MatchInfo - match info that was setup with SetupMatchInfo
+	 *	@param OutputPath - where to write timings once the recording has been replayed
+	 */
+	void OnMatchStarted(const FMatchInfo & MatchInfo, const FString & OutputPath);
+
+	/* Issue every command recorded on or before GameTick. Once past the end of the recording
+	writes out timings and quits */
+	void OnGameTick(uint32 GameTick, ARTSGameState * GameState);
+
+	/* Put the recorded match setup into MatchInfo. The local player's player state takes the
+	first human slot */
+	void SetupMatchInfo(FMatchInfo & MatchInfo, ARTSPlayerState * LocalPlayerState,
+		const FName & MapFName, const FText & MapDisplayName) const;
+
+	const TArray < ARTSPlayerState * > & GetRecordedIDToPlayerState() const { return RecordedIDToPlayerState; }
+
+private:
+
+	FCommandRecordingHeader Header;
+
+	TArray < FRecordedCommand > Commands;
+
+	/* Index in Commands of next command to issue */
+	int32 NextCommandIndex;
+
+	/* Game tick the recording ended on */
+	uint32 FinalGameTick;
+
+	/* Key = player ID when recorded, value = player in this match */
+	TArray < ARTSPlayerState * > RecordedIDToPlayerState;
+
+	FReplayBenchmark Benchmark;
+
+	FString OutputPath;
+
+	bool bIsLoaded;
+	bool bHasFinished;
+};
@@ -19,6 +19,8 @@
 #include "MapElements/Infantry.h"
 #include "Audio/FogObeyingAudioComponent.h"
 #include "MapElements/InventoryItem.h"
+#include "Managers/FogOfWarStamps.h"
+#include "Managers/CommandRecording.h"
 
 // TODO something that would help fog managers out: when units enter a garrison move them 
 // to their own container that way fog manager won't even iterate over them. I might 
@@ -32,6 +34,11 @@ AFogOfWarManager::AFogOfWarManager()
 	PrimaryActorTick.bStartWithTickEnabled = false;
 
 	bReplicates = bAlwaysRelevant = false;
+
+	RevealPassNumber = 0;
+	bHasFilledTextureBuffer = false;
+	SimulationPassAccumulatedTime = 0.f;
+	NextTeamToSimulate = UINT8_MAX;
 }
 
 void AFogOfWarManager::Initialize(ARTSLevelVolume * FogVolume,  uint8 InNumTeams, ETeam InLocalPlayersTeam, 
@@ -88,14 +95,13 @@ void AFogOfWarManager::SetupTileInfo(uint8 InNumTeams)
 
 	/* Only server really needs to init all arrays - clients just update their own teams array */
 
-	for (uint8 i = 0; i < InNumTeams; ++i)
-	{
-		TeamTiles.Emplace(FTileArray());
-	}
+	TeamTiles.SetNum(InNumTeams);
+	TeamAppliedReveals.SetNum(InNumTeams);
+	TeamTimeSinceLastComputed.Init(0.f, InNumTeams);
 
-	for (auto & Array : TeamTiles)
+	for (auto & Planes : TeamTiles)
 	{
-		Array.GetTiles().Init(EFogStatus::Hidden, NumTiles);
+		Planes.Init(NumTiles);
 	}
 }
 
@@ -114,13 +120,11 @@ void AFogOfWarManager::SetupRenderingReferences(UMaterialInterface * FogOfWarMat
 	UE_CLOG(PostProcessVolume == nullptr, RTSLOG, Fatal, TEXT("Fog of war is enabled for project "
 		"but no post process volume is found on map, need to add a post process volume to map"));
 
-	FogTexture = UTexture2D::CreateTransient(MapTileDimensions.X, MapTileDimensions.Y);
+	FogTexture = UTexture2D::CreateTransient(MapTileDimensions.X, MapTileDimensions.Y, PF_G8);
 	FogTexture->UpdateResource();
 	/* Crashes on the line above could mean fog of war volume is glitched and doesn't have any
 	dimensions. Need to remove it and add another */
 
-	TextureRegions = new FUpdateTextureRegion2D(0, 0, 0, 0, MapTileDimensions.X, MapTileDimensions.Y);
-
 	FogOfWarMaterialInstance = UMaterialInstanceDynamic::Create(FogOfWarMaterial, nullptr);
 	assert(FogOfWarMaterialInstance != nullptr);
 	FogOfWarMaterialInstance->SetTextureParameterValue(FName("VisibilityMask"), FogTexture);
@@ -131,7 +135,7 @@ void AFogOfWarManager::SetupRenderingReferences(UMaterialInterface * FogOfWarMat
 
 	PostProcessVolume->AddOrUpdateBlendable(FogOfWarMaterialInstance);
 
-	TextureBuffer = new uint8[MapTileDimensions.X * MapTileDimensions.Y * 4];
+	TextureBuffer = new uint8[MapTileDimensions.X * MapTileDimensions.Y];
 }
 
 void AFogOfWarManager::SetupTeamTempRevealEffects()
@@ -143,36 +147,54 @@ void AFogOfWarManager::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	BENCHMARK_SCOPE(FogOfWar);
+
 	assert(GS != nullptr);
 
 	/* Since these are spawned by clients HasAuthority() will not distinguish
 	between server and client */
 	if (GetWorld()->IsServer())
 	{
-		/* For each team... */
-		for (uint8 i = 0; i < NumTeams; ++i)
+		const ETeam LocalTeam = PS->GetTeam();
+
+		/* Local team gets rendered so is done every frame */
+		ComputeTeamVisibility(LocalTeam, DeltaTime);
+		/* Also does StoreTeamVisibility */
+		Server_HideAndRevealSelectables(LocalTeam);
+		Server_StoreResourceSpotVisInfo(LocalTeam);
+		HideAndRevealTemporaries(LocalTeam);
+		Server_HideAndRevealInventoryItems(LocalTeam);
+		MuteAndUnmuteAudio(LocalTeam);
+		RenderFogOfWar(LocalTeam);	// TODO do before HideAndRevealSelectables for performance?
+		TeamTimeSinceLastComputed[Statics::TeamToArrayIndex(LocalTeam)] = 0.f;
+
+		/* Every other team is done at SERVER_FOG_SIMULATION_RATE, at most one team per frame */
+		for (float & Elem : TeamTimeSinceLastComputed)
 		{
-			const ETeam Team = Statics::ArrayIndexToTeam(i);
+			Elem += DeltaTime;
+		}
 
-			ComputeTeamVisibility(Team, DeltaTime);
+		SimulationPassAccumulatedTime += DeltaTime;
+		if (NextTeamToSimulate >= NumTeams 
+			&& SimulationPassAccumulatedTime >= FogOfWarOptions::SERVER_FOG_SIMULATION_RATE)
+		{
+			SimulationPassAccumulatedTime = 0.f;
+			NextTeamToSimulate = 0;
+		}
 
-			/* Render fog + hide/reveal enemy selectables if it is our own team */
-			if (Team == PS->GetTeam())
-			{
-				/* Also does StoreTeamVisibility */
-				Server_HideAndRevealSelectables(Team);
-				Server_StoreResourceSpotVisInfo(Team);
-				HideAndRevealTemporaries(Team);
-				Server_HideAndRevealInventoryItems(Team);
-				MuteAndUnmuteAudio(Team);
-				RenderFogOfWar(Team);	// TODO do before HideAndRevealSelectables for performance?
-			}
-			else
-			{
-				StoreTeamVisibility(Team);
-				Server_StoreResourceSpotVisInfo(Team);
-				Server_StoreNonLocalTeamsInventoryItemVisInfo(Team);
-			}
+		if (NextTeamToSimulate < NumTeams && Statics::ArrayIndexToTeam(NextTeamToSimulate) == LocalTeam)
+		{
+			NextTeamToSimulate++;
+		}
+
+		if (NextTeamToSimulate < NumTeams)
+		{
+			const ETeam Team = Statics::ArrayIndexToTeam(NextTeamToSimulate);
+			
+			Server_SimulateNonLocalTeam(Team, TeamTimeSinceLastComputed[NextTeamToSimulate]);
+			TeamTimeSinceLastComputed[NextTeamToSimulate] = 0.f;
+			
+			NextTeamToSimulate++;
 		}
 	}
 	else
@@ -188,10 +210,17 @@ void AFogOfWarManager::Tick(float DeltaTime)
 	}
 }
 
+void AFogOfWarManager::Server_SimulateNonLocalTeam(ETeam Team, float DeltaTime)
+{
+	ComputeTeamVisibility(Team, DeltaTime);
+	StoreTeamVisibility(Team);
+	Server_StoreResourceSpotVisInfo(Team);
+	Server_StoreNonLocalTeamsInventoryItemVisInfo(Team);
+}
+
 void AFogOfWarManager::BeginDestroy()
 {
-	delete TextureBuffer;
-	delete TextureRegions;
+	delete[] TextureBuffer;
 
 	Super::BeginDestroy();
 }
@@ -219,26 +248,26 @@ FIntPoint AFogOfWarManager::GetGridCoords(const FVector2D & World2DCoords) const
 	return TileCoords;
 }
 
-EFogStatus AFogOfWarManager::GetFogStatusForLocation(const AActor * Actor, const TArray <EFogStatus> & TilesArray) const
+EFogStatus AFogOfWarManager::GetFogStatusForLocation(const AActor * Actor, const FFogTileBitplanes & Tiles) const
 {
 	assert(Statics::IsValid(Actor));
-	return GetFogStatusForLocation(Actor->GetActorLocation(), TilesArray);
+	return GetFogStatusForLocation(Actor->GetActorLocation(), Tiles);
 }
 
-EFogStatus AFogOfWarManager::GetFogStatusForLocation(const FVector & WorldCoords, const TArray <EFogStatus> & TilesArray) const
+EFogStatus AFogOfWarManager::GetFogStatusForLocation(const FVector & WorldCoords, const FFogTileBitplanes & Tiles) const
 {
-	return GetFogStatusForLocation(FVector2D(WorldCoords.X, WorldCoords.Y), TilesArray);
+	return GetFogStatusForLocation(FVector2D(WorldCoords.X, WorldCoords.Y), Tiles);
 }
 
-EFogStatus AFogOfWarManager::GetFogStatusForLocation(const FVector2D & World2DCoords, const TArray <EFogStatus> & TilesArray) const
+EFogStatus AFogOfWarManager::GetFogStatusForLocation(const FVector2D & World2DCoords, const FFogTileBitplanes & Tiles) const
 {
-	const FVector2D GridCoords = GetGridCoords(World2DCoords);
+	const FIntPoint GridCoords = GetGridCoords(World2DCoords);
 	const int32 Index = GetTileIndex(GridCoords.X, GridCoords.Y);
 
-	UE_CLOG(!TilesArray.IsValidIndex(Index), RTSLOG, Fatal, TEXT("Fog manager: Tiles index %d not valid. "
-		"World coords were: %s"), Index, *World2DCoords.ToString());
+	UE_CLOG(!IsValidTileIndex(Index), RTSLOG, Fatal, 
+		TEXT("Fog manager: Tiles index %d not valid. World coords were: %s"), Index, *World2DCoords.ToString());
 
-	return TilesArray[Index];
+	return Tiles.GetTileStatus(Index);
 }
 
 int32 AFogOfWarManager::GetTileIndex(int32 X, int32 Y) const
@@ -246,14 +275,9 @@ int32 AFogOfWarManager::GetTileIndex(int32 X, int32 Y) const
 	return X + Y * MapTileDimensions.X;
 }
 
-void AFogOfWarManager::ResetTeamVisibility(ETeam Team)
+bool AFogOfWarManager::IsValidTileIndex(int32 TileIndex) const
 {
-	const uint8 Index = Statics::TeamToArrayIndex(Team);
-
-	for (auto & Elem : TeamTiles[Index].GetTiles())
-	{
-		Elem = EFogStatus::Hidden;
-	}
+	return TileIndex >= 0 && TileIndex < MapTileDimensions.X * MapTileDimensions.Y;
 }
 
 void AFogOfWarManager::ComputeTeamVisibility(ETeam Team, float DeltaTime)
@@ -262,14 +286,14 @@ void AFogOfWarManager::ComputeTeamVisibility(ETeam Team, float DeltaTime)
 
 	assert(GS != nullptr);
 
-	ResetTeamVisibility(Team);
-
 	const uint8 Index = Statics::TeamToArrayIndex(Team);
-	TArray<EFogStatus> & Tiles = TeamTiles[Index].GetTiles();
+	FTeamAppliedFogReveals & AppliedReveals = TeamAppliedReveals[Index];
+
+	RevealPassNumber++;
 
 	// For each player state of team
 	//		For each building and unit of team
-	//			Set visible for every tile within range
+	//			Move its reveal if it has changed tile or vision radius
 	for (ARTSPlayerState * PlayerState : GS->GetTeamPlayerStates(Team))
 	{
 		/* TODO: check if possibly only related to the issue of player
@@ -292,7 +316,8 @@ void AFogOfWarManager::ComputeTeamVisibility(ETeam Team, float DeltaTime)
 			}
 
 			/* Skip if inside garrison. Units update the building's sight/stealth radius 
-			when they enter it if it can be seen out of */
+			when they enter it if it can be seen out of. Not marking it as seen means its 
+			reveal will be removed below */
 			if (Unit->IsInsideGarrison())
 			{
 				continue;
@@ -302,12 +327,13 @@ void AFogOfWarManager::ComputeTeamVisibility(ETeam Team, float DeltaTime)
 			float ActorStealthRevealRadius;
 			Unit->GetVisionInfo(ActorSightRadius, ActorStealthRevealRadius);
 
-			RevealFogAroundLocation(FVector2D(Unit->GetActorLocation()), ActorSightRadius,
-				ActorStealthRevealRadius, Tiles);
+			UpdateSelectableReveal(Index, Unit, MakeReveal(FVector2D(Unit->GetActorLocation()), 
+				ActorSightRadius, ActorStealthRevealRadius));
 		}
 		
 		//-----------------------------------------------------------
-		//	Buildings - same deal as units
+		//	Buildings - same deal as units. They cannot move so their reveal only changes 
+		//	when their vision radius does
 		//-----------------------------------------------------------
 
 		for (ABuilding * Building : PlayerState->GetBuildings())
@@ -321,8 +347,19 @@ void AFogOfWarManager::ComputeTeamVisibility(ETeam Team, float DeltaTime)
 			float ActorStealthRevealRadius;
 			Building->GetVisionInfo(ActorSightRadius, ActorStealthRevealRadius);
 
-			RevealFogAroundLocation(FVector2D(Building->GetActorLocation()), ActorSightRadius,
-				ActorStealthRevealRadius, Tiles);
+			UpdateSelectableReveal(Index, Building, MakeReveal(FVector2D(Building->GetActorLocation()), 
+				ActorSightRadius, ActorStealthRevealRadius));
+		}
+	}
+
+	/* Remove reveals of anything that was not seen this pass i.e. it was destroyed or 
+	entered a garrison */
+	for (auto It = AppliedReveals.Selectables.CreateIterator(); It; ++It)
+	{
+		if (It.Value().LastSeenPass != RevealPassNumber)
+		{
+			RemoveReveal(Index, It.Value());
+			It.RemoveCurrent();
 		}
 	}
 
@@ -330,6 +367,13 @@ void AFogOfWarManager::ComputeTeamVisibility(ETeam Team, float DeltaTime)
 	//	Team's Temporary Effects
 	//------------------------------------------------------------
 
+	/* These change radius every tick so just remove last pass's and add them all again */
+	for (const FAppliedFogReveal & Elem : AppliedReveals.TemporaryEffects)
+	{
+		RemoveReveal(Index, Elem);
+	}
+	AppliedReveals.TemporaryEffects.Reset();
+
 	TArray <FTemporaryFogRevealEffectInfo> & TempEffectArray = TeamTempRevealEffects[Index].Array;
 	for (int32 i = TempEffectArray.Num() - 1; i >= 0; --i)
 	{
@@ -338,7 +382,9 @@ void AFogOfWarManager::ComputeTeamVisibility(ETeam Team, float DeltaTime)
 		float FogRevealRadius, StealthRevealRadius;
 		Elem.Tick(DeltaTime, FogRevealRadius, StealthRevealRadius);
 
-		RevealFogAroundLocation(Elem.GetLocation(), FogRevealRadius, StealthRevealRadius, Tiles);
+		const FAppliedFogReveal Reveal = MakeReveal(Elem.GetLocation(), FogRevealRadius, StealthRevealRadius);
+		AddReveal(Index, Reveal);
+		AppliedReveals.TemporaryEffects.Emplace(Reveal);
 
 		if (Elem.HasCompleted())
 		{
@@ -349,62 +395,75 @@ void AFogOfWarManager::ComputeTeamVisibility(ETeam Team, float DeltaTime)
 
 void AFogOfWarManager::Client_HideAndRevealSelectables(ETeam Team)
 {
-	const uint8 IndexToAvoid = Statics::TeamToArrayIndex(Team);
+	/* Only selectables on tiles whose status has changed or that a selectable has moved onto 
+	can need hiding/revealing. Units that move are handled in Client_OnUnitMoved. Must be 
+	called before RenderFogOfWar since that resets LocalTeamFlippedTiles */
+	assert(Team == LocalPlayersTeam);
 
-	for (int32 i = 0; i < NumTeams; ++i)
+	const FFogTileBitplanes & Tiles = TeamTiles[Statics::TeamToArrayIndex(Team)];
+
+	/* Both arrays can contain duplicates and tiles that flipped back but UpdateFogStatus 
+	only acts if the status has changed so that's fine */
+	for (const int32 TileIndex : LocalTeamFlippedTiles)
 	{
-		/* Avoid trying to hide/reveal selectables from our own team - they
-		are always revealed */
-		if (i != IndexToAvoid)
+		Client_HideAndRevealSelectablesOnTile(TileIndex, Tiles);
+	}
+
+	/* Indexed because hiding/revealing can destroy selectables and move others */
+	for (int32 i = 0; i < ClientDirtySelectableTiles.Num(); ++i)
+	{
+		Client_HideAndRevealSelectablesOnTile(ClientDirtySelectableTiles[i], Tiles);
+	}
+	ClientDirtySelectableTiles.Reset();
+}
+
+void AFogOfWarManager::Client_HideAndRevealSelectablesOnTile(int32 TileIndex, const FFogTileBitplanes & Tiles)
+{
+	/* Buckets are looked up again each iteration and their size checked because hiding/revealing 
+	can remove more than the current selectable from them e.g. a building that was destroyed 
+	while in fog gets cleaned up when revealed */
+
+	const EFogStatus TileStatus = Tiles.GetTileStatus(TileIndex);
+
+	/* Check units */
+	if (const TArray < AInfantry * > * Bucket = ClientUnitTileBuckets.Find(TileIndex))
+	{
+		for (int32 i = Bucket->Num() - 1; i >= 0; --i)
 		{
-			const uint8 Index = Statics::TeamToArrayIndex(Team);
-			const TArray <EFogStatus> & Tiles = TeamTiles[Index].GetTiles();
+			Bucket = ClientUnitTileBuckets.Find(TileIndex);
+			if (i >= Bucket->Num())
+			{
+				continue;
+			}
+			
+			AInfantry * Unit = (*Bucket)[i];
 
-			for (ARTSPlayerState * PlayerState : GS->GetTeams()[i].GetPlayerStates())
+			if (Unit->IsInsideGarrison())
 			{
-#if WITH_EDITOR
-				// Null sometimes in 2+ player PIE
-				if (!Statics::IsValid(PlayerState))
-				{
-					continue;
-				}
-#endif
+				/* Skip trying to hide/reveal units inside garrisons */
+				continue;
+			}
 
-				/* Check units */
-				for (AInfantry * Unit : PlayerState->GetUnits())
-				{
-					if (Unit->IsInsideGarrison())
-					{
-						/* Skip trying to hide/reveal units inside garrisons */
-						continue;
-					}
+			Unit->UpdateFogStatus(TileStatus);
+		}
+	}
 
-					Unit->UpdateFogStatus(GetFogStatusForLocation(Unit, Tiles));
-				}
-				const TArray<ABuilding*> & BuildingsArray = PlayerState->GetBuildings();
-				/* Do same for buildings but only pass in Hidden or Revealed. 
-				Iterate backwards because removals can happen along the way */
-				for (int32 j = BuildingsArray.Num() - 1; j >= 0; --j)
-				{
-					ABuilding * Building = BuildingsArray[j];
-					
-					bool bCanBeSeen = false;
+	/* Do same for buildings but only pass in Hidden or Revealed */
+	if (const TArray < ABuilding * > * Bucket = ClientBuildingTileBuckets.Find(TileIndex))
+	{
+		for (int32 i = Bucket->Num() - 1; i >= 0; --i)
+		{
+			Bucket = ClientBuildingTileBuckets.Find(TileIndex);
+			if (i >= Bucket->Num())
+			{
+				continue;
+			}
 
-					for (const auto & TilesIndex : BuildingTileIndices[Building].GetArray())
-					{
-						if (Tiles[TilesIndex] == EFogStatus::Revealed
-							|| Tiles[TilesIndex] == EFogStatus::StealthRevealed)
-						{
-							/* As long as one point can be seen then whole building is considered
-							revealed */
-							bCanBeSeen = true;
-							break;
-						}
-					}
+			ABuilding * Building = (*Bucket)[i];
 
-					Building->UpdateFogStatus(bCanBeSeen ? EFogStatus::Revealed : EFogStatus::Hidden);
-				}
-			}
+			const bool bCanBeSeen = IsBuildingVisible(Building, Tiles);
+
+			Building->UpdateFogStatus(bCanBeSeen ? EFogStatus::Revealed : EFogStatus::Hidden);
 		}
 	}
 }
@@ -420,12 +479,14 @@ void AFogOfWarManager::Server_HideAndRevealSelectables(ETeam Team)
 		if (i != IndexToAvoid)
 		{
 			const uint8 Index = Statics::TeamToArrayIndex(Team);
-			const TArray <EFogStatus> & Tiles = TeamTiles[Index].GetTiles();
+			const FFogTileBitplanes & Tiles = TeamTiles[Index];
 
 			FVisibilityInfo & TeamVisibilityInfo = GS->GetTeamVisibilityInfo(Team);
 
 			for (ARTSPlayerState * PlayerState : GS->GetTeams()[i].GetPlayerStates())
 			{
+				const uint8 OwnerID = PlayerState->GetPlayerIDAsInt();
+
 				/* Check units */
 				for (AInfantry * Unit : PlayerState->GetUnits())
 				{
@@ -438,8 +499,8 @@ void AFogOfWarManager::Server_HideAndRevealSelectables(ETeam Team)
 					const FIntPoint GridCoords = GetGridCoords(Unit);
 					const int32 TilesIndex = GetTileIndex(GridCoords.X, GridCoords.Y);
 
-					const bool bCanBeAttacked = Unit->UpdateFogStatus(Tiles[TilesIndex]);
-					TeamVisibilityInfo.SetVisibility(Unit, bCanBeAttacked);
+					const bool bCanBeAttacked = Unit->UpdateFogStatus(Tiles.GetTileStatus(TilesIndex));
+					TeamVisibilityInfo.SetSelectableVisibility(OwnerID, Unit->GetSelectableID(), bCanBeAttacked);
 				}
 				/* Do same for buildings but only pass in Hidden or Revealed */
 				for (ABuilding * Building : PlayerState->GetBuildings())
@@ -450,22 +511,10 @@ void AFogOfWarManager::Server_HideAndRevealSelectables(ETeam Team)
 						continue;
 					}
 					
-					bool bCanBeSeen = false;
-
-					for (const auto & TilesIndex : BuildingTileIndices[Building].GetArray())
-					{
-						if (Tiles[TilesIndex] == EFogStatus::Revealed
-							|| Tiles[TilesIndex] == EFogStatus::StealthRevealed)
-						{
-							/* As long as one point can be seen then whole building is considered
-							revealed */
-							bCanBeSeen = true;
-							break;
-						}
-					}
+					const bool bCanBeSeen = IsBuildingVisible(Building, Tiles);
 
 					// Get crashes here when building destroys
-					TeamVisibilityInfo.SetVisibility(Building, bCanBeSeen);
+					TeamVisibilityInfo.SetSelectableVisibility(OwnerID, Building->GetSelectableID(), bCanBeSeen);
 					Building->UpdateFogStatus(bCanBeSeen ? EFogStatus::Revealed : EFogStatus::Hidden);
 				}
 			}
@@ -589,133 +638,248 @@ void AFogOfWarManager::Client_HideAndRevealInventoryItems(ETeam Team)
 
 void AFogOfWarManager::MuteAndUnmuteAudio(ETeam Team)
 {
-	// Alternative that might be faster: have two containers: one for muted and one for unmuted
-	for (const auto & AudioComp : GS->FogSoundsContainer_Dynamic.GetArray())
+	/* Only sounds on tiles that have flipped can need muting/unmuting. Sounds that move to 
+	another tile are handled in OnFogAudioMoved. Must be called before RenderFogOfWar since 
+	that resets LocalTeamFlippedTiles */
+	assert(Team == LocalPlayersTeam);
+
+	if (AudioTileBuckets.Num() == 0)
+	{
+		return;
+	}
+
+	const FFogTileBitplanes & Tiles = TeamTiles[Statics::TeamToArrayIndex(Team)];
+
+	/* LocalTeamFlippedTiles can contain duplicates and tiles that flipped back but 
+	UpdateFogAudio only acts if mute state and visibility disagree so that's fine */
+	for (const int32 TileIndex : LocalTeamFlippedTiles)
+	{
+		TArray < UFogObeyingAudioComponent * > * Bucket = AudioTileBuckets.Find(TileIndex);
+		if (Bucket == nullptr)
+		{
+			continue;
+		}
+
+		const bool bIsTileVisible = (Tiles.IsTileVisible(TileIndex) != 0);
+
+		/* Backwards because UpdateFogAudio can remove the current sound from the bucket */
+		for (int32 i = Bucket->Num() - 1; i >= 0; --i)
+		{
+			UFogObeyingAudioComponent * AudioComp = (*Bucket)[i];
+			
+			// Hmmm... getting crashes here. Not 100% sure why.
+			assert(AudioComp != nullptr);
+			assert(AudioComp->IsPendingKill() == false);
+			
+			UpdateFogAudio(AudioComp, bIsTileVisible);
+		}
+	}
+}
+
+void AFogOfWarManager::UpdateFogAudio(UFogObeyingAudioComponent * AudioComp, bool bIsOnVisibleTile)
+{
+	if (AudioComp->FogObeyingRule == ESoundFogRules::Dynamic)
 	{
-		// Hmmm... getting crashes here. Not 100% sure why.
-		assert(AudioComp != nullptr);
-		assert(AudioComp->IsPendingKill() == false);
-		
 		if (AudioComp->IsMuted())
 		{
-			if (IsLocationVisibleNotChecked(AudioComp->GetComponentLocation(), Team))
+			if (bIsOnVisibleTile)
 			{
 				AudioComp->OnExitFogOfWar_Dynamic(GS);
 			}
 		}
-		else
+		else if (!bIsOnVisibleTile)
 		{
-			if (!IsLocationVisibleNotChecked(AudioComp->GetComponentLocation(), Team))
+			AudioComp->OnEnterFogOfWar_Dynamic(GS);
+		}
+	}
+	else if (AudioComp->FogObeyingRule == ESoundFogRules::DynamicExceptForInstigatorsTeam)
+	{
+		if (AudioComp->IsMuted())
+		{
+			if (bIsOnVisibleTile)
 			{
-				AudioComp->OnEnterFogOfWar_Dynamic(GS);
+				AudioComp->OnExitFogOfWar_DynamicExceptForInstigatorsTeam(GS);
 			}
 		}
+		else if (!bIsOnVisibleTile)
+		{
+			AudioComp->OnEnterFogOfWar_DynamicExceptForInstigatorsTeam(GS);
+		}
 	}
-
-	for (int32 i = GS->FogSoundsContainer_AlwaysKnownOnceHeard.Num() - 1; i >= 0; --i)
+	else // Assumed AlwaysKnownOnceHeard
 	{
-		UFogObeyingAudioComponent * AudioComp = GS->FogSoundsContainer_AlwaysKnownOnceHeard.GetArray()[i];
+		assert(AudioComp->FogObeyingRule == ESoundFogRules::AlwaysKnownOnceHeard);
 
-		if (IsLocationVisibleNotChecked(AudioComp->GetComponentLocation(), Team))
+		/* This will remove it from its container and unregister it */
+		if (bIsOnVisibleTile)
 		{
 			AudioComp->OnExitFogOfWar_AlwaysKnownOnceHeard(GS);
 		}
 	}
+}
 
-	// These types of sounds can actually use the Dynamic container instead
-	for (const auto & AudioComp : GS->FogSoundsContainer_DynamicExceptForInstigatorsTeam.GetArray())
+int32 AFogOfWarManager::GetTileIndexNotChecked(const FVector & Location) const
+{
+	const FIntPoint GridCoords = GetGridCoords(Location);
+	
+	if (GridCoords.X < 0 || GridCoords.X >= MapTileDimensions.X 
+		|| GridCoords.Y < 0 || GridCoords.Y >= MapTileDimensions.Y)
 	{
-		// For debugging. May possibly have to just check for them and remove as iterating
-		assert(AudioComp);
+		return INDEX_NONE;
+	}
 
-		if (AudioComp->IsMuted())
-		{
-			if (IsLocationVisibleNotChecked(AudioComp->GetComponentLocation(), Team))
-			{
-				AudioComp->OnExitFogOfWar_DynamicExceptForInstigatorsTeam(GS);
-			}
-		}
-		else
-		{
-			if (!IsLocationVisibleNotChecked(AudioComp->GetComponentLocation(), Team))
-			{
-				AudioComp->OnEnterFogOfWar_DynamicExceptForInstigatorsTeam(GS);
-			}
-		}
+	return GetTileIndex(GridCoords.X, GridCoords.Y);
+}
+
+void AFogOfWarManager::RegisterFogAudio(UFogObeyingAudioComponent * AudioComp)
+{
+	assert(AudioComp->FogManager == nullptr);
+
+	AudioComp->FogManager = this;
+	AudioComp->FogTileIndex = GetTileIndexNotChecked(AudioComp->GetComponentLocation());
+	
+	if (AudioComp->FogTileIndex != INDEX_NONE)
+	{
+		AudioTileBuckets.FindOrAdd(AudioComp->FogTileIndex).Emplace(AudioComp);
 	}
 }
 
-void AFogOfWarManager::RevealFogAroundLocation(FVector2D Location, float FogRevealRadius, 
-	float StealthRevealRadius, TArray <EFogStatus> & Tiles)
+void AFogOfWarManager::UnregisterFogAudio(UFogObeyingAudioComponent * AudioComp)
 {
-	const int32 SightRadiusInTiles = FMath::FloorToInt(FogRevealRadius / FogOfWarOptions::FOG_TILE_SIZE);
-	const int32 StealthSightRadiusInTiles = FMath::FloorToInt(StealthRevealRadius / FogOfWarOptions::FOG_TILE_SIZE);
-	const int32 HighestRadiusInTiles = SightRadiusInTiles > StealthSightRadiusInTiles ? SightRadiusInTiles : StealthSightRadiusInTiles;
+	assert(AudioComp->FogManager == this);
 
-	const FIntPoint TileLocation = GetGridCoords(Location);
+	if (AudioComp->FogTileIndex != INDEX_NONE)
+	{
+		AudioTileBuckets.FindChecked(AudioComp->FogTileIndex).RemoveSingleSwap(AudioComp, false);
+	}
 
-	/* Hoisting this out now in case compiler does not do it */
-	if (StealthRevealRadius <= 0.f)
+	AudioComp->FogManager = nullptr;
+	AudioComp->FogTileIndex = INDEX_NONE;
+}
+
+void AFogOfWarManager::OnFogAudioMoved(UFogObeyingAudioComponent * AudioComp)
+{
+	const int32 NewTileIndex = GetTileIndexNotChecked(AudioComp->GetComponentLocation());
+	if (NewTileIndex == AudioComp->FogTileIndex)
 	{
-		for (int32 Radius_Y = -HighestRadiusInTiles; Radius_Y <= HighestRadiusInTiles; ++Radius_Y)
-		{
-			for (int32 Radius_X = -HighestRadiusInTiles; Radius_X <= HighestRadiusInTiles; ++Radius_X)
-			{
-				const int32 Tile_X = TileLocation.X + Radius_X;
-				const int32 Tile_Y = TileLocation.Y + Radius_Y;
+		return;
+	}
 
-				/* Check if tile is within range */
-				if (Tile_X >= 0 && Tile_Y >= 0 && Tile_X < MapTileDimensions.X
-					&& Tile_Y < MapTileDimensions.Y
-					&& FMath::Square(Radius_X) + FMath::Square(Radius_Y) < FMath::Square(SightRadiusInTiles))
-				{
-					const int32 TileIndex = GetTileIndex(Tile_X, Tile_Y);
+	if (AudioComp->FogTileIndex != INDEX_NONE)
+	{
+		AudioTileBuckets.FindChecked(AudioComp->FogTileIndex).RemoveSingleSwap(AudioComp, false);
+	}
+	if (NewTileIndex != INDEX_NONE)
+	{
+		AudioTileBuckets.FindOrAdd(NewTileIndex).Emplace(AudioComp);
+	}
+	AudioComp->FogTileIndex = NewTileIndex;
 
-					/* Reveal tile using bitwise or operator */
-					Tiles[TileIndex] = BitwiseOrOperator(Tiles[TileIndex], EFogStatus::Revealed);
-					/* Get rid of this case now. It's the same as Hidden */
-					if (Tiles[TileIndex] == EFogStatus::StealthDetected)
-					{
-						Tiles[TileIndex] = EFogStatus::Hidden;
-					}
-				}
-			}
-		}
+	/* New tile may have different visibility */
+	const bool bIsTileVisible = (NewTileIndex != INDEX_NONE) 
+		&& (TeamTiles[Statics::TeamToArrayIndex(LocalPlayersTeam)].IsTileVisible(NewTileIndex) != 0);
+	UpdateFogAudio(AudioComp, bIsTileVisible);
+}
+
+FAppliedFogReveal AFogOfWarManager::MakeReveal(const FVector2D & Location, float FogRevealRadius, 
+	float StealthRevealRadius) const
+{
+	const int32 SightRadiusInTiles = FMath::FloorToInt(FogRevealRadius / FogOfWarOptions::FOG_TILE_SIZE);
+	/* Stealth reveal only counts on tiles that are also revealed so clamp it to sight radius. 
+	This keeps the stealth plane a subset of the revealed plane */
+	const int32 StealthRadiusInTiles = FMath::Min(SightRadiusInTiles, 
+		FMath::FloorToInt(StealthRevealRadius / FogOfWarOptions::FOG_TILE_SIZE));
+
+	return FAppliedFogReveal(GetGridCoords(Location), SightRadiusInTiles, StealthRadiusInTiles);
+}
+
+void AFogOfWarManager::UpdateSelectableReveal(uint8 TeamIndex, const AActor * Revealer, const FAppliedFogReveal & NewReveal)
+{
+	FAppliedFogReveal * Applied = TeamAppliedReveals[TeamIndex].Selectables.Find(Revealer);
+	if (Applied == nullptr)
+	{
+		Applied = &TeamAppliedReveals[TeamIndex].Selectables.Emplace(Revealer, NewReveal);
+		AddReveal(TeamIndex, NewReveal);
 	}
-	else
+	else if (!Applied->HasSameStamp(NewReveal))
 	{
-		for (int32 Radius_Y = -HighestRadiusInTiles; Radius_Y <= HighestRadiusInTiles; ++Radius_Y)
-		{
-			for (int32 Radius_X = -HighestRadiusInTiles; Radius_X <= HighestRadiusInTiles; ++Radius_X)
-			{
-				const int32 Tile_X = TileLocation.X + Radius_X;
-				const int32 Tile_Y = TileLocation.Y + Radius_Y;
+		/* Add before remove so tiles both stamps cover never flip */
+		AddReveal(TeamIndex, NewReveal);
+		RemoveReveal(TeamIndex, *Applied);
+		*Applied = NewReveal;
+	}
 
-				/* Check if tile is within range */
-				if (Tile_X >= 0 && Tile_Y >= 0 && Tile_X < MapTileDimensions.X
-					&& Tile_Y < MapTileDimensions.Y)
-				{
-					/* Assuming static_cast<uint8>(SomeBool) assigns 0x01 for true and 0x00 for false */
-					const uint8 bInSightRange = FMath::Square(Radius_X) + FMath::Square(Radius_Y) < FMath::Square(SightRadiusInTiles);
-					const uint8 bInStealthRevealRange = FMath::Square(Radius_X) + FMath::Square(Radius_Y) < FMath::Square(StealthSightRadiusInTiles);
-					/* Least significant bit = revealed
-					2nd least sginificant bit = reveals stealth.
-					Both have to be true to actually reveal stealth selectables */
-					const uint8 FinalTileStatus = bInSightRange | (bInStealthRevealRange << 1);
-
-					const int32 TileIndex = GetTileIndex(Tile_X, Tile_Y);
-
-					/* Reveal tile using bitwise or operator */
-					Tiles[TileIndex] = BitwiseOrOperator(Tiles[TileIndex], FinalTileStatus);
-					/* Get rid of this case now. It's the same as Hidden */
-					if (Tiles[TileIndex] == EFogStatus::StealthDetected)
-					{
-						Tiles[TileIndex] = EFogStatus::Hidden;
-					}
-				}
-			}
+	Applied->LastSeenPass = RevealPassNumber;
+}
+
+void AFogOfWarManager::AddReveal(uint8 TeamIndex, const FAppliedFogReveal & Reveal)
+{
+	FFogTileBitplanes & Tiles = TeamTiles[TeamIndex];
+	TArray <int32> * FlippedTiles = GetFlippedTilesArray(TeamIndex);
+	TArray <int32> * StealthFlippedTiles = GetStealthFlippedTilesArray(TeamIndex);
+	const FFogCircleStampCache & Stamps = FFogCircleStampCache::Get();
+
+	Stamps.ForEachSpan(Reveal.TileLocation, Reveal.SightRadiusInTiles, MapTileDimensions, [&Tiles, FlippedTiles](int32 First, int32 Last)
+	{
+		Tiles.AddRevealSpan(First, Last, FlippedTiles);
+	});
+
+	Stamps.ForEachSpan(Reveal.TileLocation, Reveal.StealthRadiusInTiles, MapTileDimensions, [&Tiles, StealthFlippedTiles](int32 First, int32 Last)
+	{
+		Tiles.AddStealthRevealSpan(First, Last, StealthFlippedTiles);
+	});
+}
+
+void AFogOfWarManager::RemoveReveal(uint8 TeamIndex, const FAppliedFogReveal & Reveal)
+{
+	FFogTileBitplanes & Tiles = TeamTiles[TeamIndex];
+	TArray <int32> * FlippedTiles = GetFlippedTilesArray(TeamIndex);
+	TArray <int32> * StealthFlippedTiles = GetStealthFlippedTilesArray(TeamIndex);
+	const FFogCircleStampCache & Stamps = FFogCircleStampCache::Get();
+
+	Stamps.ForEachSpan(Reveal.TileLocation, Reveal.SightRadiusInTiles, MapTileDimensions, [&Tiles, FlippedTiles](int32 First, int32 Last)
+	{
+		Tiles.RemoveRevealSpan(First, Last, FlippedTiles);
+	});
+
+	Stamps.ForEachSpan(Reveal.TileLocation, Reveal.StealthRadiusInTiles, MapTileDimensions, [&Tiles, StealthFlippedTiles](int32 First, int32 Last)
+	{
+		Tiles.RemoveStealthRevealSpan(First, Last, StealthFlippedTiles);
+	});
+}
+
+TArray<int32> * AFogOfWarManager::GetFlippedTilesArray(uint8 TeamIndex)
+{
+	/* Only the local team's tiles are drawn on the fog texture */
+	return (TeamIndex == Statics::TeamToArrayIndex(LocalPlayersTeam)) ? &LocalTeamFlippedTiles : nullptr;
+}
+
+TArray<int32> * AFogOfWarManager::GetStealthFlippedTilesArray(uint8 TeamIndex)
+{
+	/* Only needed for hiding/revealing units on clients. Server visits every selectable */
+	return (TeamIndex == Statics::TeamToArrayIndex(LocalPlayersTeam) && !GetWorld()->IsServer()) 
+		? &ClientDirtySelectableTiles : nullptr;
+}
+
+bool AFogOfWarManager::Client_ShouldBucketSelectable(ETeam SelectablesTeam) const
+{
+	/* Server_HideAndRevealSelectables visits every selectable so server does not need 
+	buckets. Our own team's selectables are always revealed */
+	return !GetWorld()->IsServer() && SelectablesTeam != LocalPlayersTeam;
+}
+
+bool AFogOfWarManager::IsBuildingVisible(ABuilding * Building, const FFogTileBitplanes & Tiles) const
+{
+	for (const auto & TilesIndex : BuildingTileIndices[Building].GetArray())
+	{
+		/* As long as one point can be seen then whole building is considered revealed */
+		if (Tiles.IsTileVisible(TilesIndex))
+		{
+			return true;
 		}
 	}
+
+	return false;
 }
 
 void AFogOfWarManager::StoreTeamVisibility(ETeam Team)
@@ -728,51 +892,42 @@ void AFogOfWarManager::StoreTeamVisibility(ETeam Team)
 		if (i != IndexToAvoid)
 		{
 			const uint8 Index = Statics::TeamToArrayIndex(Team);
-			const TArray <EFogStatus> & Tiles = TeamTiles[Index].GetTiles();
+			const FFogTileBitplanes & Tiles = TeamTiles[Index];
 
 			FVisibilityInfo & TeamVisibilityInfo = GS->GetTeamVisibilityInfo(Team);
 
 			for (ARTSPlayerState * PlayerState : GS->GetTeams()[i].GetPlayerStates())
 			{
+				const uint8 OwnerID = PlayerState->GetPlayerIDAsInt();
+
 				/* Check units */
 				for (AInfantry * Unit : PlayerState->GetUnits())
 				{
 					const FIntPoint GridCoords = GetGridCoords(Unit);
 					const int32 TilesIndex = GetTileIndex(GridCoords.X, GridCoords.Y);
 
-					if (Tiles[TilesIndex] == EFogStatus::StealthRevealed)
+					const EFogStatus TileStatus = Tiles.GetTileStatus(TilesIndex);
+					if (TileStatus == EFogStatus::StealthRevealed)
 					{
-						TeamVisibilityInfo.SetVisibility(Unit, true);
+						TeamVisibilityInfo.SetSelectableVisibility(OwnerID, Unit->GetSelectableID(), true);
 					}
-					else if (Tiles[TilesIndex] == EFogStatus::Revealed)
+					else if (TileStatus == EFogStatus::Revealed)
 					{
 						const bool bCanBeSeen = !Unit->IsInStealthMode();
-						TeamVisibilityInfo.SetVisibility(Unit, bCanBeSeen);
+						TeamVisibilityInfo.SetSelectableVisibility(OwnerID, Unit->GetSelectableID(), bCanBeSeen);
 					}
 					else
 					{
-						TeamVisibilityInfo.SetVisibility(Unit, false);
+						TeamVisibilityInfo.SetSelectableVisibility(OwnerID, Unit->GetSelectableID(), false);
 					}
 				}
 				/* Do same for buildings. For now buildings cannot be stealth so don't bother
 				checking if they are */
 				for (ABuilding * Building : PlayerState->GetBuildings())
 				{
-					bool bCanBeSeen = false;
-
-					for (const auto & TilesIndex : BuildingTileIndices[Building].GetArray())
-					{
-						if (Tiles[TilesIndex] == EFogStatus::Revealed
-							|| Tiles[TilesIndex] == EFogStatus::StealthRevealed)
-						{
-							/* As long as one point can be seen then whole building is considered
-							revealed */
-							bCanBeSeen = true;
-							break;
-						}
-					}
+					const bool bCanBeSeen = IsBuildingVisible(Building, Tiles);
 
-					TeamVisibilityInfo.SetVisibility(Building, bCanBeSeen);
+					TeamVisibilityInfo.SetSelectableVisibility(OwnerID, Building->GetSelectableID(), bCanBeSeen);
 				}
 			}
 		}
@@ -781,13 +936,51 @@ void AFogOfWarManager::StoreTeamVisibility(ETeam Team)
 
 void AFogOfWarManager::RenderFogOfWar(ETeam Team)
 {
-	FillTextureBuffer(Team);
+	/* The part of the texture that needs uploading */
+	FUpdateTextureRegion2D Region;
+
+	if (!bHasFilledTextureBuffer)
+	{
+		FillTextureBuffer(Team);
+		bHasFilledTextureBuffer = true;
+
+		Region = FUpdateTextureRegion2D(0, 0, 0, 0, MapTileDimensions.X, MapTileDimensions.Y);
+	}
+	else if (LocalTeamFlippedTiles.Num() > 0)
+	{
+		/* Only the tiles that have changed need writing and only the box around them 
+		needs uploading */
+		const FFogTileBitplanes & Tiles = TeamTiles[Statics::TeamToArrayIndex(Team)];
+		
+		int32 MinX = MapTileDimensions.X, MinY = MapTileDimensions.Y;
+		int32 MaxX = -1, MaxY = -1;
+		for (const int32 TileIndex : LocalTeamFlippedTiles)
+		{
+			FillTextureBufferTile(TileIndex, Tiles);
+
+			const int32 X = TileIndex % MapTileDimensions.X;
+			const int32 Y = TileIndex / MapTileDimensions.X;
+			MinX = FMath::Min(MinX, X);
+			MaxX = FMath::Max(MaxX, X);
+			MinY = FMath::Min(MinY, Y);
+			MaxY = FMath::Max(MaxY, Y);
+		}
+
+		Region = FUpdateTextureRegion2D(MinX, MinY, MinX, MinY, MaxX - MinX + 1, MaxY - MinY + 1);
+	}
+	else
+	{
+		/* Nothing has changed since last upload */
+		return;
+	}
+
+	LocalTeamFlippedTiles.Reset();
 
 	/* Currently fog of war volume needs have equal width and length (or at least have the same
 	amount of tiles for width and length) */
 	assert(MapTileDimensions.X == MapTileDimensions.Y);
 
-	UpdateTextureRegions(FogTexture, 0, 1, TextureRegions, /*Proportional to TileSize (512 previous hardcoded value)*/ MapTileDimensions.X * 4, (uint32)4, TextureBuffer, false);
+	UpdateTextureRegions(FogTexture, 0, 1, &Region, /*Proportional to TileSize (512 previous hardcoded value)*/ MapTileDimensions.X, (uint32)1, TextureBuffer, false);
 
 	/* TODO: make sure this and all other FNames are defined at statics
 	in the headers or something  */
@@ -797,32 +990,22 @@ void AFogOfWarManager::RenderFogOfWar(ETeam Team)
 void AFogOfWarManager::FillTextureBuffer(ETeam Team)
 {
 	const uint8 TeamIndex = Statics::TeamToArrayIndex(Team);
-	const TArray <EFogStatus> & Tiles = TeamTiles[TeamIndex].GetTiles();
+	const FFogTileBitplanes & Tiles = TeamTiles[TeamIndex];
 
 	for (int32 Y = 0; Y < MapTileDimensions.Y; ++Y)
 	{
 		for (int32 X = 0; X < MapTileDimensions.X; ++X)
 		{
-			const int32 Index = GetTileIndex(X, Y);
-
-			if (static_cast<uint8>(Tiles[Index]) & 0x01) /* Translation: if tile revealed */
-			{
-				TextureBuffer[Index * 4] = 0;
-				TextureBuffer[Index * 4 + 1] = 0;
-				TextureBuffer[Index * 4 + 2] = 255;
-				TextureBuffer[Index * 4 + 3] = 0;
-			}
-			else
-			{
-				TextureBuffer[Index * 4] = 0;
-				TextureBuffer[Index * 4 + 1] = 255;
-				TextureBuffer[Index * 4 + 2] = 0;
-				TextureBuffer[Index * 4 + 3] = 0;
-			}
+			FillTextureBufferTile(GetTileIndex(X, Y), Tiles);
 		}
 	}
 }
 
+void AFogOfWarManager::FillTextureBufferTile(int32 TileIndex, const FFogTileBitplanes & Tiles)
+{
+	TextureBuffer[TileIndex] = Tiles.IsTileVisible(TileIndex) ? 255 : 0;
+}
+
 /* Taken from wiki.unrealengine.com/Dynamic_Textures */
 void AFogOfWarManager::UpdateTextureRegions(UTexture2D * Texture, int32 MipIndex, uint32 NumRegions, FUpdateTextureRegion2D * Regions, uint32 SrcPitch, uint32 SrcBpp, uint8 * SrcData, bool bFreeData)
 {
@@ -834,7 +1017,7 @@ void AFogOfWarManager::UpdateTextureRegions(UTexture2D * Texture, int32 MipIndex
 		FTexture2DResource * Texture2DResource;
 		int32 MipIndex;
 		uint32 NumRegions;
-		FUpdateTextureRegion2D * Regions;
+		TArray < FUpdateTextureRegion2D, TInlineAllocator<1> > Regions;
 		uint32 SrcPitch;
 		uint32 SrcBpp;
 		uint8* SrcData;
@@ -845,7 +1028,7 @@ void AFogOfWarManager::UpdateTextureRegions(UTexture2D * Texture, int32 MipIndex
 	RegionData->Texture2DResource = (FTexture2DResource*)Texture->Resource;
 	RegionData->MipIndex = MipIndex;
 	RegionData->NumRegions = NumRegions;
-	RegionData->Regions = Regions;
+	RegionData->Regions.Append(Regions, NumRegions);
 	RegionData->SrcPitch = SrcPitch;
 	RegionData->SrcBpp = SrcBpp;
 	RegionData->SrcData = SrcData;
@@ -872,7 +1055,6 @@ void AFogOfWarManager::UpdateTextureRegions(UTexture2D * Texture, int32 MipIndex
 			}
 	if (bFreeData)
 	{
-		FMemory::Free(RegionData->Regions);
 		FMemory::Free(RegionData->SrcData);
 	}
 	delete RegionData;
@@ -883,25 +1065,14 @@ uint8 AFogOfWarManager::IsTileVisible(int32 TileIndex, ETeam Team) const
 {
 	const uint8 Index = Statics::TeamToArrayIndex(Team);
 
-	return static_cast<uint8>(TeamTiles[Index].GetTiles()[TileIndex]) & 0x01;
+	return TeamTiles[Index].IsTileVisible(TileIndex);
 }
 
 uint8 AFogOfWarManager::IsTileVisibleNotChecked(int32 TileIndex, ETeam Team) const
 {
 	const uint8 Index = Statics::TeamToArrayIndex(Team);
 
-	const TArray<EFogStatus> & Array = TeamTiles[Index].GetTiles();
-	return Array.IsValidIndex(TileIndex) ? static_cast<uint8>(Array[TileIndex]) & 0x01 : 0; // Return 0 for EFogStatus::Hidden
-}
-
-EFogStatus AFogOfWarManager::BitwiseOrOperator(const EFogStatus & Enum1, const EFogStatus & Enum2) const
-{
-	return static_cast<EFogStatus>(static_cast<uint8>(Enum1) | static_cast<uint8>(Enum2));
-}
-
-EFogStatus AFogOfWarManager::BitwiseOrOperator(const EFogStatus & Enum1, const uint8 & Enum2AsInt) const
-{
-	return static_cast<EFogStatus>(static_cast<uint8>(Enum1) | Enum2AsInt);
+	return IsValidTileIndex(TileIndex) ? TeamTiles[Index].IsTileVisible(TileIndex) : 0; // Return 0 for EFogStatus::Hidden
 }
 
 bool AFogOfWarManager::IsLocationVisible(const FVector & Location, ETeam Team) const
@@ -916,11 +1087,10 @@ bool AFogOfWarManager::IsLocationVisibleNotChecked(const FVector & Location, ETe
 	const FIntPoint GridCoords = GetGridCoords(Location);
 
 	const uint8 Index = Statics::TeamToArrayIndex(Team);
-	const TArray<EFogStatus> & TeamsArray = TeamTiles[Index].GetTiles();
 	const int32 ArrayIndex = GetTileIndex(GridCoords.X, GridCoords.Y);
-	if (TeamsArray.IsValidIndex(ArrayIndex))
+	if (IsValidTileIndex(ArrayIndex))
 	{
-		return static_cast<uint8>(TeamsArray[ArrayIndex]) & 0x01;
+		return TeamTiles[Index].IsTileVisible(ArrayIndex);
 	}
 	else
 	{
@@ -943,7 +1113,7 @@ EFogStatus AFogOfWarManager::GetLocationVisibilityStatus(const FVector & Locatio
 	const FIntPoint GridCoords = GetGridCoords(Location);
 	const int32 TileIndex = GetTileIndex(GridCoords.X, GridCoords.Y);
 	const uint8 TeamIndex = Statics::TeamToArrayIndex(Team);
-	return TeamTiles[TeamIndex].GetTiles()[TileIndex];
+	return TeamTiles[TeamIndex].GetTileStatus(TileIndex);
 }
 
 EFogStatus AFogOfWarManager::GetLocationVisibilityStatusLocally(const FVector & Location) const
@@ -956,10 +1126,9 @@ EFogStatus AFogOfWarManager::GetLocationVisibilityStatusNotChecked(const FVector
 	const FIntPoint GridCoords = GetGridCoords(Location);
 	const int32 TileIndex = GetTileIndex(GridCoords.X, GridCoords.Y);
 	const uint8 TeamIndex = Statics::TeamToArrayIndex(Team);
-	const TArray<EFogStatus> & TilesArray = TeamTiles[TeamIndex].GetTiles();
-	if (TilesArray.IsValidIndex(TileIndex))
+	if (IsValidTileIndex(TileIndex))
 	{
-		return TilesArray[TileIndex];
+		return TeamTiles[TeamIndex].GetTileStatus(TileIndex);
 	}
 	else
 	{
@@ -1014,14 +1183,96 @@ void AFogOfWarManager::OnBuildingPlaced(ABuilding * InBuilding, const FVector &
 
 		BuildingTileIndices[InBuilding].Emplace(TilesIndex);
 	}
+
+	if (Client_ShouldBucketSelectable(InBuilding->GetTeam()))
+	{
+		for (const int32 TilesIndex : BuildingTileIndices[InBuilding].GetArray())
+		{
+			if (IsValidTileIndex(TilesIndex))
+			{
+				ClientBuildingTileBuckets.FindOrAdd(TilesIndex).Emplace(InBuilding);
+				ClientDirtySelectableTiles.Emplace(TilesIndex);
+			}
+		}
+	}
 }
 
 void AFogOfWarManager::OnBuildingDestroyed(ABuilding * InBuilding)
 {
+	if (Client_ShouldBucketSelectable(InBuilding->GetTeam()))
+	{
+		for (const int32 TilesIndex : BuildingTileIndices[InBuilding].GetArray())
+		{
+			if (IsValidTileIndex(TilesIndex))
+			{
+				ClientBuildingTileBuckets.FindChecked(TilesIndex).RemoveSingleSwap(InBuilding, false);
+			}
+		}
+	}
+
 	// Remove entry from building fog locations. This frees TMap value memory right?
 	BuildingTileIndices.Remove(InBuilding);
 }
 
+void AFogOfWarManager::OnUnitBuilt(AInfantry * InUnit)
+{
+	if (!Client_ShouldBucketSelectable(InUnit->GetTeam()))
+	{
+		return;
+	}
+
+	const int32 TileIndex = GetTileIndexNotChecked(InUnit->GetActorLocation());
+	ClientUnitTileIndices.Emplace(InUnit, TileIndex);
+
+	if (TileIndex != INDEX_NONE)
+	{
+		ClientUnitTileBuckets.FindOrAdd(TileIndex).Emplace(InUnit);
+		ClientDirtySelectableTiles.Emplace(TileIndex);
+	}
+
+	InUnit->GetRootComponent()->TransformUpdated.AddUObject(this, &AFogOfWarManager::Client_OnUnitMoved);
+}
+
+void AFogOfWarManager::OnUnitDestroyed(AInfantry * InUnit)
+{
+	int32 TileIndex;
+	if (ClientUnitTileIndices.RemoveAndCopyValue(InUnit, TileIndex))
+	{
+		if (TileIndex != INDEX_NONE)
+		{
+			ClientUnitTileBuckets.FindChecked(TileIndex).RemoveSingleSwap(InUnit, false);
+		}
+
+		InUnit->GetRootComponent()->TransformUpdated.RemoveAll(this);
+	}
+}
+
+void AFogOfWarManager::Client_OnUnitMoved(USceneComponent * UnitRoot, EUpdateTransformFlags UpdateTransformFlags, 
+	ETeleportType Teleport)
+{
+	AInfantry * Unit = CastChecked<AInfantry>(UnitRoot->GetOwner());
+	
+	int32 & TileIndex = ClientUnitTileIndices.FindChecked(Unit);
+	const int32 NewTileIndex = GetTileIndexNotChecked(UnitRoot->GetComponentLocation());
+	if (NewTileIndex == TileIndex)
+	{
+		return;
+	}
+
+	if (TileIndex != INDEX_NONE)
+	{
+		ClientUnitTileBuckets.FindChecked(TileIndex).RemoveSingleSwap(Unit, false);
+	}
+	if (NewTileIndex != INDEX_NONE)
+	{
+		ClientUnitTileBuckets.FindOrAdd(NewTileIndex).Emplace(Unit);
+		
+		/* New tile may have different visibility. Done on the next Client_HideAndRevealSelectables */
+		ClientDirtySelectableTiles.Emplace(NewTileIndex);
+	}
+	TileIndex = NewTileIndex;
+}
+
 void AFogOfWarManager::CreateTeamTemporaryRevealEffect(const FTemporaryFogRevealEffectInfo & RevealEffect, FVector2D Location, ETeam Team)
 {
 	const int32 Index = Statics::TeamToArrayIndex(Team);
@@ -16,21 +16,192 @@ class APostProcessVolume;
 struct FUpdateTextureRegion2D;
 class ARTSLevelVolume;
 class ABuilding;
+class AInfantry;
 class AProjectileBase;
+class UFogObeyingAudioComponent;
 
 
-/* Workaround for non-multidimension TArrays */
+/**
+ *	A team's visibility of every tile.
+ *
+ *	Each tile has a count of how many things are revealing it. Revealers add themselves when 
+ *	they appear or move to a new tile and remove themselves from where they were, so the cost 
+ *	of updating fog is proportional to how much things move rather than how many there are.
+ *
+ *	The result is packed into two bitplanes with 64 tiles per word for queries. Bit N of the 
+ *	planes corresponds to tile index N as returned by AFogOfWarManager::GetTileIndex.
+ *
+ *	The stealth plane is always a subset of the revealed plane (reveal sources clamp their 
+ *	stealth reveal radius to their sight radius) so EFogStatus::StealthDetected never appears.
+ */
 USTRUCT()
-struct FTileArray
+struct FFogTileBitplanes
 {
 	GENERATED_BODY()
 
+protected:
+
+	/* Bit set = tile is revealed */
+	UPROPERTY()
+	TArray < uint64 > RevealedBits;
+
+	/* Bit set = tile is revealed and stealth selectables on it can be seen */
+	UPROPERTY()
+	TArray < uint64 > StealthRevealedBits;
+
+	/* How many things are revealing each tile */
+	UPROPERTY()
+	TArray < uint16 > RevealCounts;
+
+	/* How many things are stealth revealing each tile */
 	UPROPERTY()
-	TArray < EFogStatus > Tiles;
+	TArray < uint16 > StealthRevealCounts;
+
+	static constexpr int32 BITS_PER_WORD_LOG2 = 6;
+	static constexpr int32 BITS_PER_WORD_MASK = 63;
+
+	FORCEINLINE static bool IsBitSet(const TArray < uint64 > & Words, int32 Bit)
+	{
+		return (Words.GetData()[Bit >> BITS_PER_WORD_LOG2] >> (Bit & BITS_PER_WORD_MASK)) & 1ULL;
+	}
+
+	FORCEINLINE static void FlipBit(TArray < uint64 > & Words, int32 Bit)
+	{
+		Words.GetData()[Bit >> BITS_PER_WORD_LOG2] ^= 1ULL << (Bit & BITS_PER_WORD_MASK);
+	}
+
+	/* Increment the count of tiles [FirstTileIndex, LastTileIndex] and set the bit of any 
+	that go from 0 to 1 */
+	static void AddToSpan(TArray < uint16 > & Counts, TArray < uint64 > & Bits, int32 FirstTileIndex, 
+		int32 LastTileIndex, TArray < int32 > * OutFlippedTiles)
+	{
+		uint16 * CountsData = Counts.GetData();
+		for (int32 i = FirstTileIndex; i <= LastTileIndex; ++i)
+		{
+			if (CountsData[i]++ == 0)
+			{
+				FlipBit(Bits, i);
+				if (OutFlippedTiles != nullptr)
+				{
+					OutFlippedTiles->Emplace(i);
+				}
+			}
+		}
+	}
+
+	/* Decrement the count of tiles [FirstTileIndex, LastTileIndex] and clear the bit of any 
+	that go from 1 to 0 */
+	static void RemoveFromSpan(TArray < uint16 > & Counts, TArray < uint64 > & Bits, int32 FirstTileIndex,
+		int32 LastTileIndex, TArray < int32 > * OutFlippedTiles)
+	{
+		uint16 * CountsData = Counts.GetData();
+		for (int32 i = FirstTileIndex; i <= LastTileIndex; ++i)
+		{
+			assert(CountsData[i] > 0);
+			if (--CountsData[i] == 0)
+			{
+				FlipBit(Bits, i);
+				if (OutFlippedTiles != nullptr)
+				{
+					OutFlippedTiles->Emplace(i);
+				}
+			}
+		}
+	}
+
+public:
+
+	void Init(int32 NumTiles)
+	{
+		const int32 NumWords = (NumTiles + BITS_PER_WORD_MASK) >> BITS_PER_WORD_LOG2;
+		RevealedBits.Init(0, NumWords);
+		StealthRevealedBits.Init(0, NumWords);
+		RevealCounts.Init(0, NumTiles);
+		StealthRevealCounts.Init(0, NumTiles);
+	}
+
+	/**
+	 *	Add/remove a revealer from tiles [FirstTileIndex, LastTileIndex] 
+	 *
+	 *	@param OutFlippedTiles - if not null, every tile that changed between hidden and 
+	 *	revealed is added to this
+	 */
+	void AddRevealSpan(int32 FirstTileIndex, int32 LastTileIndex, TArray < int32 > * OutFlippedTiles)
+	{
+		AddToSpan(RevealCounts, RevealedBits, FirstTileIndex, LastTileIndex, OutFlippedTiles);
+	}
+	void RemoveRevealSpan(int32 FirstTileIndex, int32 LastTileIndex, TArray < int32 > * OutFlippedTiles)
+	{
+		RemoveFromSpan(RevealCounts, RevealedBits, FirstTileIndex, LastTileIndex, OutFlippedTiles);
+	}
+
+	/* Stealth versions. Stealth does not show on the fog texture so these flips are recorded 
+	separately */
+	void AddStealthRevealSpan(int32 FirstTileIndex, int32 LastTileIndex, TArray < int32 > * OutFlippedTiles)
+	{
+		AddToSpan(StealthRevealCounts, StealthRevealedBits, FirstTileIndex, LastTileIndex, OutFlippedTiles);
+	}
+	void RemoveStealthRevealSpan(int32 FirstTileIndex, int32 LastTileIndex, TArray < int32 > * OutFlippedTiles)
+	{
+		RemoveFromSpan(StealthRevealCounts, StealthRevealedBits, FirstTileIndex, LastTileIndex, OutFlippedTiles);
+	}
+
+	/* Non-zero if tile is either Revealed or StealthRevealed */
+	FORCEINLINE uint8 IsTileVisible(int32 TileIndex) const
+	{
+		return IsBitSet(RevealedBits, TileIndex);
+	}
+
+	FORCEINLINE EFogStatus GetTileStatus(int32 TileIndex) const
+	{
+		return static_cast<EFogStatus>(IsBitSet(RevealedBits, TileIndex) | (IsBitSet(StealthRevealedBits, TileIndex) << 1));
+	}
+};
+
+
+/* A reveal that has been added to a team's tiles. Holds enough to remove it again */
+struct FAppliedFogReveal
+{
+	/* Tile coords of center of reveal */
+	FIntPoint TileLocation;
+
+	int32 SightRadiusInTiles;
+	int32 StealthRadiusInTiles;
+
+	/* Value of AFogOfWarManager::RevealPassNumber the last time the revealer was seen. Used 
+	to find revealers that have been destroyed or entered a garrison */
+	uint32 LastSeenPass;
+
+	FAppliedFogReveal() 
+	{ 
+	}
+
+	FAppliedFogReveal(const FIntPoint & InTileLocation, int32 InSightRadiusInTiles, int32 InStealthRadiusInTiles)
+		: TileLocation(InTileLocation)
+		, SightRadiusInTiles(InSightRadiusInTiles)
+		, StealthRadiusInTiles(InStealthRadiusInTiles)
+		, LastSeenPass(0)
+	{
+	}
 
-	FORCEINLINE const TArray < EFogStatus > & GetTiles() const { return Tiles; }
-	FORCEINLINE TArray < EFogStatus > & GetTiles() { return Tiles; }
-	FORCEINLINE void SetTileVisibility(EFogStatus NewVisibility, int32 Index) { Tiles[Index] = NewVisibility; }
+	bool HasSameStamp(const FAppliedFogReveal & Other) const
+	{
+		return TileLocation == Other.TileLocation
+			&& SightRadiusInTiles == Other.SightRadiusInTiles
+			&& StealthRadiusInTiles == Other.StealthRadiusInTiles;
+	}
+};
+
+
+/* All the reveals applied to one team's tiles */
+struct FTeamAppliedFogReveals
+{
+	/* Units and buildings. Key is never dereferenced so it is fine if the actor has been 
+	destroyed */
+	TMap < const AActor *, FAppliedFogReveal > Selectables;
+
+	/* Temporary effects change radius every tick so these are removed and added again each pass */
+	TArray < FAppliedFogReveal > TemporaryEffects;
 };
 
 
@@ -140,19 +311,37 @@ protected:
 	FIntPoint GetGridCoords(const AActor * Actor) const;
 	FIntPoint GetGridCoords(const FVector & WorldCoords) const;
 	FIntPoint GetGridCoords(const FVector2D & World2DCoords) const;
-	EFogStatus GetFogStatusForLocation(const AActor * Actor, const TArray <EFogStatus> & TilesArray) const;
-	EFogStatus GetFogStatusForLocation(const FVector & WorldCoords, const TArray <EFogStatus> & TilesArray) const;
-	EFogStatus GetFogStatusForLocation(const FVector2D & World2DCoords, const TArray <EFogStatus> & TilesArray) const;
+	EFogStatus GetFogStatusForLocation(const AActor * Actor, const FFogTileBitplanes & Tiles) const;
+	EFogStatus GetFogStatusForLocation(const FVector & WorldCoords, const FFogTileBitplanes & Tiles) const;
+	EFogStatus GetFogStatusForLocation(const FVector2D & World2DCoords, const FFogTileBitplanes & Tiles) const;
 
 	FORCEINLINE int32 GetTileIndex(int32 X, int32 Y) const;
 
-	void ResetTeamVisibility(ETeam Team);
+	/* Whether a tile index is on the fog grid */
+	FORCEINLINE bool IsValidTileIndex(int32 TileIndex) const;
 
 	void ComputeTeamVisibility(ETeam Team, float DeltaTime);
 
-	/* Check what selectables a team can see */
+	/* Server only. Compute and store visibility for a team that isn't the local player's team */
+	void Server_SimulateNonLocalTeam(ETeam Team, float DeltaTime);
+
+	/* Server only. Time accumulated towards starting the next pass over non-local teams */
+	float SimulationPassAccumulatedTime;
+
+	/* Server only. Team index to compute on the next frame of the current simulation pass. 
+	NumTeams or more means no pass is in progress */
+	uint8 NextTeamToSimulate;
+
+	/* Server only. Time since each team was last computed. Key = Statics::TeamToArrayIndex */
+	TArray < float > TeamTimeSinceLastComputed;
+
+	/* Check what selectables a team can see. Only looks at the selectables on tiles in 
+	LocalTeamFlippedTiles and ClientDirtySelectableTiles */
 	void Client_HideAndRevealSelectables(ETeam Team);
 
+	/* Hide/reveal the enemy selectables in a tile's buckets */
+	void Client_HideAndRevealSelectablesOnTile(int32 TileIndex, const FFogTileBitplanes & Tiles);
+
 	/* Server version that does what client version does but also stores all
 	visibility info in GS for AI purposes (and eventually to pause replication
 	on a pre connection basis) */
@@ -172,12 +361,36 @@ protected:
 
 	void MuteAndUnmuteAudio(ETeam Team);
 
-	/* Utility function which calculates which tiles should be visible for a location and 
-	stores them in the team's visibility array 
-	
-	@param Tiles - team's visibility array */
-	void RevealFogAroundLocation(FVector2D Location, float FogRevealRadius, float StealthRevealRadius, 
-		TArray <EFogStatus> & Tiles);
+	/* Work out the stamp something with these vision radii at this location would reveal */
+	FAppliedFogReveal MakeReveal(const FVector2D & Location, float FogRevealRadius, float StealthRevealRadius) const;
+
+	/**
+	 *	Make sure a unit/building's reveal on a team's tiles is up to date. Does nothing if it 
+	 *	has not moved to a different tile and its vision radius has not changed
+	 *
+	 *	@param TeamIndex - Statics::TeamToArrayIndex
+	 */
+	void UpdateSelectableReveal(uint8 TeamIndex, const AActor * Revealer, const FAppliedFogReveal & NewReveal);
+
+	/* Add/remove a reveal to/from a team's tiles using the circle stamp cache */
+	void AddReveal(uint8 TeamIndex, const FAppliedFogReveal & Reveal);
+	void RemoveReveal(uint8 TeamIndex, const FAppliedFogReveal & Reveal);
+
+	/* Get the array that tiles flipping for a team should be recorded in, or null if not needed */
+	TArray < int32 > * GetFlippedTilesArray(uint8 TeamIndex);
+
+	/* Same as GetFlippedTilesArray but for the stealth revealed plane */
+	TArray < int32 > * GetStealthFlippedTilesArray(uint8 TeamIndex);
+
+	/* Whether a selectable should be put in the client tile buckets */
+	bool Client_ShouldBucketSelectable(ETeam SelectablesTeam) const;
+
+	/* Bound to the root component of every bucketed unit */
+	void Client_OnUnitMoved(USceneComponent * UnitRoot, EUpdateTransformFlags UpdateTransformFlags, 
+		ETeleportType Teleport);
+
+	/* Whether any of a building's fog locations are visible */
+	bool IsBuildingVisible(ABuilding * Building, const FFogTileBitplanes & Tiles) const;
 
 	void StoreTeamVisibility(ETeam Team);
 
@@ -185,22 +398,65 @@ protected:
 
 	void FillTextureBuffer(ETeam Team);
 
-	/* Helper function. Actually gives command to render fog */
+	/* Write a single tile's value into the texture buffer */
+	FORCEINLINE void FillTextureBufferTile(int32 TileIndex, const FFogTileBitplanes & Tiles);
+
+	/* Helper function. Actually gives command to render fog. Regions is copied so does not 
+	need to outlive this call. SrcData does */
 	void UpdateTextureRegions(UTexture2D * Texture, int32 MipIndex, uint32 NumRegions, FUpdateTextureRegion2D * Regions, uint32 SrcPitch, uint32 SrcBpp, uint8 * SrcData, bool bFreeData);
 
 	/* Temporary reveal effects for teams. Key = Statics::TeamToArrayIndex 
 	e.g. command center scans, patch revealed by using nuke at it */
 	TArray <FTemporaryFogRevealEffectsArray> TeamTempRevealEffects;
 
-	/* Each teams visibility of each tile. On clients only their own teams array will be updated.
-	On server every teams array will be updated */
+	/* Each teams visibility of each tile. On clients only their own teams tiles will be updated.
+	On server every teams tiles will be updated */
 	UPROPERTY()
-	TArray < FTileArray > TeamTiles;
+	TArray < FFogTileBitplanes > TeamTiles;
 
 	/* Maps building to all the indices in Tiles that their visibility should be checked against */
 	UPROPERTY()
 	TMap < ABuilding *, FIntegerArray > BuildingTileIndices;
 
+	/* Reveals that have been added to each team's tiles. Key = Statics::TeamToArrayIndex */
+	TArray < FTeamAppliedFogReveals > TeamAppliedReveals;
+
+	/* Incremented every time a team's visibility is computed */
+	uint32 RevealPassNumber;
+
+	/* Tiles whose revealed status has changed for the local team since the fog texture was 
+	last updated. Can contain duplicates */
+	TArray < int32 > LocalTeamFlippedTiles;
+
+	/* Client only. Units and buildings of other teams keyed by the tile index they are on. 
+	Buildings are in the bucket of every tile in their BuildingTileIndices entry. Selectables 
+	outside the fog grid are not in here. Empty arrays are left in */
+	TMap < int32, TArray < AInfantry * > > ClientUnitTileBuckets;
+	TMap < int32, TArray < ABuilding * > > ClientBuildingTileBuckets;
+
+	/* Client only. Tile index each bucketed unit is on, or INDEX_NONE if outside the fog grid */
+	TMap < AInfantry *, int32 > ClientUnitTileIndices;
+
+	/* Client only. Tiles besides LocalTeamFlippedTiles whose selectables need hiding/revealing: 
+	tiles whose stealth revealed status has changed and tiles a selectable has been added to 
+	or moved onto. Can contain duplicates */
+	TArray < int32 > ClientDirtySelectableTiles;
+
+	/* Fog obeying audio components that are in one of the game state's fog sound containers, 
+	keyed by the tile index they are on. Sounds outside the fog grid are not in here. Empty 
+	arrays are left in so pointers to them stay valid while iterating */
+	TMap < int32, TArray < UFogObeyingAudioComponent * > > AudioTileBuckets;
+
+	/* Index of tile a location is on or INDEX_NONE if it is outside the fog grid */
+	int32 GetTileIndexNotChecked(const FVector & Location) const;
+
+	/* Mute or unmute a fog obeying audio component based on whether it is on a visible tile. 
+	May remove it from its game state container */
+	void UpdateFogAudio(UFogObeyingAudioComponent * AudioComp, bool bIsOnVisibleTile);
+
+	/* Whether the whole texture buffer has been filled at least once */
+	bool bHasFilledTextureBuffer;
+
 	/* Map center ignoring Z axis */
 	FVector2D MapCenter;
 
@@ -218,18 +474,15 @@ protected:
 	UPROPERTY()
 	APostProcessVolume * PostProcessVolume;
 
-	/* Fog of war buffer for rendering. Array. TODO: try and just use
-	Tiles array instead */
+	/* Fog of war buffer for rendering. Array. One byte per tile: 255 if visible, 0 if not. 
+	TODO: try and just use Tiles array instead */
 	uint8 * TextureBuffer;
 
 	// TODO: these are not UPROPERTY but seems to work ok
 
-	/* Fog of war texture */
+	/* Fog of war texture. Single channel (PF_G8) so material should sample its R channel */
 	UTexture2D * FogTexture;
 
-	/* For rendering fog of war */
-	FUpdateTextureRegion2D * TextureRegions;
-
 
 	/* To speed up calculations */
 
@@ -249,8 +502,6 @@ protected:
 	 */
 	FORCEINLINE uint8 IsTileVisibleNotChecked(int32 TileIndex, ETeam Team) const;
 
-	FORCEINLINE EFogStatus BitwiseOrOperator(const EFogStatus & Enum1, const EFogStatus & Enum2) const;
-	FORCEINLINE EFogStatus BitwiseOrOperator(const EFogStatus & Enum1, const uint8 & Enum2AsInt) const;
 
 public:
 
@@ -291,6 +542,18 @@ public:
 	// Called by player state when a building is destroyed
 	void OnBuildingDestroyed(ABuilding * InBuilding);
 
+	// Called by player state when a unit is built/destroyed
+	void OnUnitBuilt(AInfantry * InUnit);
+	void OnUnitDestroyed(AInfantry * InUnit);
+
 	void CreateTeamTemporaryRevealEffect(const FTemporaryFogRevealEffectInfo & RevealEffect,
 		FVector2D Location, ETeam Team);
+
+	/* Called when a fog obeying audio component is added to/removed from one of the game 
+	state's fog sound containers */
+	void RegisterFogAudio(UFogObeyingAudioComponent * AudioComp);
+	void UnregisterFogAudio(UFogObeyingAudioComponent * AudioComp);
+
+	/* Called by a registered fog obeying audio component when it moves */
+	void OnFogAudioMoved(UFogObeyingAudioComponent * AudioComp);
 };
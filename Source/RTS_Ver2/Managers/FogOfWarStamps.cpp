@@ -0,0 +1,45 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "FogOfWarStamps.h"
+
+
+const FFogCircleStampCache & FFogCircleStampCache::Get()
+{
+	/* Function local static so it is built exactly once even if the fog thread gets here first */
+	static const FFogCircleStampCache Cache;
+	return Cache;
+}
+
+FFogCircleStampCache::FFogCircleStampCache()
+{
+	/* Radius R has R rows (0 to R - 1) so sum of 1..MAX_CACHED_RADIUS */
+	HalfWidthsForAllRadii.Reserve((MAX_CACHED_RADIUS * (MAX_CACHED_RADIUS + 1)) / 2);
+	RadiusOffsets.Reserve(MAX_CACHED_RADIUS + 1);
+
+	for (int32 Radius = 0; Radius <= MAX_CACHED_RADIUS; ++Radius)
+	{
+		RadiusOffsets.Emplace(HalfWidthsForAllRadii.Num());
+
+		for (int32 Row = 0; Row < Radius; ++Row)
+		{
+			HalfWidthsForAllRadii.Emplace(static_cast<int16>(CalculateRowHalfWidth(Radius, Row)));
+		}
+	}
+}
+
+int32 FFogCircleStampCache::CalculateRowHalfWidth(int32 RadiusInTiles, int32 RowOffset)
+{
+	/* Largest X where X^2 < Radius^2 - Y^2 */
+	const int32 Remaining = FMath::Square(RadiusInTiles) - FMath::Square(RowOffset);
+	int32 HalfWidth = FMath::FloorToInt(FMath::Sqrt(static_cast<float>(Remaining)));
+	/* Correct for float error and for the less-than (not less-than-or-equal) test */
+	while (HalfWidth > 0 && FMath::Square(HalfWidth) >= Remaining)
+	{
+		--HalfWidth;
+	}
+	while (FMath::Square(HalfWidth + 1) < Remaining)
+	{
+		++HalfWidth;
+	}
+	return HalfWidth;
+}
@@ -0,0 +1,93 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/**
+ *	Precomputed circles used by the fog managers to reveal tiles around a location. 
+ *
+ *	A circle of radius R (in tiles) is stored as the half width of each of its rows, where 
+ *	row N is N tiles above/below the center. A tile at offset (X, Y) is inside the circle if 
+ *	|X| <= HalfWidth[|Y|], which matches the X^2 + Y^2 < R^2 test the fog managers have 
+ *	always used. Revealing then becomes one clipped span fill per row instead of a distance 
+ *	test per tile.
+ *
+ *	Stamps are built once for every radius up to MAX_CACHED_RADIUS. Most selectables share a 
+ *	handful of sight radii that all fall well below it. Larger radii are worked out on the fly.
+ *
+ *	Immutable after construction so it is safe to use from the fog thread.
+ */
+class RTS_VER2_API FFogCircleStampCache
+{
+public:
+
+	static const FFogCircleStampCache & Get();
+
+	/**
+	 *	Call Func(FirstTileIndex, LastTileIndex) for every row of a circle clipped to the 
+	 *	grid. Both indices are inclusive and on the same row. 
+	 *
+	 *	@param Center - tile coords of the center of the circle. Can be off the grid
+	 *	@param RadiusInTiles - radius of circle
+	 *	@param GridDimensions - width and height of grid in tiles
+	 */
+	template <typename TFunc>
+	void ForEachSpan(const FIntPoint & Center, int32 RadiusInTiles, const FIntPoint & GridDimensions, TFunc && Func) const
+	{
+		if (RadiusInTiles <= 0)
+		{
+			return;
+		}
+
+		const int32 MinY = FMath::Max(Center.Y - RadiusInTiles + 1, 0);
+		const int32 MaxY = FMath::Min(Center.Y + RadiusInTiles - 1, GridDimensions.Y - 1);
+
+		if (RadiusInTiles <= MAX_CACHED_RADIUS)
+		{
+			const int16 * HalfWidths = &HalfWidthsForAllRadii[RadiusOffsets[RadiusInTiles]];
+
+			for (int32 Y = MinY; Y <= MaxY; ++Y)
+			{
+				EmitSpan(Center, Y, HalfWidths[FMath::Abs(Y - Center.Y)], GridDimensions, Func);
+			}
+		}
+		else
+		{
+			for (int32 Y = MinY; Y <= MaxY; ++Y)
+			{
+				EmitSpan(Center, Y, CalculateRowHalfWidth(RadiusInTiles, Y - Center.Y), GridDimensions, Func);
+			}
+		}
+	}
+
+	/* For a circle centered on tile (0, 0), get the largest X for row RowOffset that is inside it */
+	static int32 CalculateRowHalfWidth(int32 RadiusInTiles, int32 RowOffset);
+
+	/* Largest radius in tiles that has a precomputed stamp. 128 tiles is 8192uu with the 
+	default FOG_TILE_SIZE */
+	static constexpr int32 MAX_CACHED_RADIUS = 128;
+
+private:
+
+	FFogCircleStampCache();
+
+	template <typename TFunc>
+	FORCEINLINE static void EmitSpan(const FIntPoint & Center, int32 Y, int32 HalfWidth, const FIntPoint & GridDimensions, TFunc & Func)
+	{
+		const int32 MinX = FMath::Max(Center.X - HalfWidth, 0);
+		const int32 MaxX = FMath::Min(Center.X + HalfWidth, GridDimensions.X - 1);
+		if (MinX <= MaxX)
+		{
+			const int32 RowStart = Y * GridDimensions.X;
+			Func(RowStart + MinX, RowStart + MaxX);
+		}
+	}
+
+	/* Every stamp's half widths one after another */
+	TArray < int16 > HalfWidthsForAllRadii;
+
+	/* Index in HalfWidthsForAllRadii where each radius's stamp starts. Key = radius in tiles */
+	TArray < int32 > RadiusOffsets;
+};
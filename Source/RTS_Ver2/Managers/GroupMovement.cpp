@@ -0,0 +1,281 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GroupMovement.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+#include "NavMesh/NavMeshPath.h"
+#include "Engine/World.h"
+
+#include "Statics/DevelopmentStatics.h"
+#include "Settings/ProjectSettings.h"
+
+
+namespace GroupMovement
+{
+	void AssignSlots(const TArray < FVector > & UnitLocations, const TArray < FVector > & SlotLocations,
+		TArray < int32 > & OutSlotIndices)
+	{
+		const int32 NumUnits = UnitLocations.Num();
+		const int32 NumSlots = SlotLocations.Num();
+		assert(NumUnits <= NumSlots);
+
+		/* Cost of unit i moving to slot j is at [i * NumSlots + j] */
+		TArray < float > Costs;
+		Costs.SetNumUninitialized(NumUnits * NumSlots);
+		for (int32 i = 0; i < NumUnits; ++i)
+		{
+			for (int32 j = 0; j < NumSlots; ++j)
+			{
+				Costs[i * NumSlots + j] = FVector::Dist2D(UnitLocations[i], SlotLocations[j]);
+			}
+		}
+
+		/* Rows are units, columns are slots. Both 1 based with row/column 0 being a dummy that
+		the algorithm uses to grow the matching from */
+		TArray < float > RowPotentials;
+		TArray < float > ColumnPotentials;
+		TArray < float > MinSlack;
+		TArray < int32 > ColumnsRow;
+		TArray < int32 > Way;
+		TArray < bool > bColumnUsed;
+		RowPotentials.Init(0.f, NumUnits + 1);
+		ColumnPotentials.Init(0.f, NumSlots + 1);
+		ColumnsRow.Init(0, NumSlots + 1);
+		Way.Init(0, NumSlots + 1);
+
+		for (int32 Row = 1; Row <= NumUnits; ++Row)
+		{
+			ColumnsRow[0] = Row;
+			int32 Column = 0;
+			MinSlack.Init(FLT_MAX, NumSlots + 1);
+			bColumnUsed.Init(false, NumSlots + 1);
+
+			/* Find an augmenting path for this row */
+			do
+			{
+				bColumnUsed[Column] = true;
+				const int32 PathRow = ColumnsRow[Column];
+				float Delta = FLT_MAX;
+				int32 NextColumn = 0;
+
+				for (int32 j = 1; j <= NumSlots; ++j)
+				{
+					if (!bColumnUsed[j])
+					{
+						const float Slack = Costs[(PathRow - 1) * NumSlots + (j - 1)] - RowPotentials[PathRow] - ColumnPotentials[j];
+						if (Slack < MinSlack[j])
+						{
+							MinSlack[j] = Slack;
+							Way[j] = Column;
+						}
+						if (MinSlack[j] < Delta)
+						{
+							Delta = MinSlack[j];
+							NextColumn = j;
+						}
+					}
+				}
+
+				for (int32 j = 0; j <= NumSlots; ++j)
+				{
+					if (bColumnUsed[j])
+					{
+						RowPotentials[ColumnsRow[j]] += Delta;
+						ColumnPotentials[j] -= Delta;
+					}
+					else
+					{
+						MinSlack[j] -= Delta;
+					}
+				}
+
+				Column = NextColumn;
+			}
+			while (ColumnsRow[Column] != 0);
+
+			/* Flip the matching along the path */
+			do
+			{
+				const int32 PrevColumn = Way[Column];
+				ColumnsRow[Column] = ColumnsRow[PrevColumn];
+				Column = PrevColumn;
+			}
+			while (Column != 0);
+		}
+
+		OutSlotIndices.Init(INDEX_NONE, NumUnits);
+		for (int32 j = 1; j <= NumSlots; ++j)
+		{
+			if (ColumnsRow[j] != 0)
+			{
+				OutSlotIndices[ColumnsRow[j] - 1] = j - 1;
+			}
+		}
+	}
+
+	void BuildPaths(UWorld * World, const TArray < AActor * > & Units, const TArray < FVector > & UnitLocations,
+		const TArray < FVector > & Destinations, const FVector & GroupDestination,
+		TArray < FNavPathSharedPtr > & OutPaths)
+	{
+		const int32 NumUnits = UnitLocations.Num();
+		assert(Units.Num() == NumUnits);
+		assert(Destinations.Num() == NumUnits);
+
+		OutPaths.Init(nullptr, NumUnits);
+
+		/* Not worth it for a single unit. It will do the same query anyway */
+		if (NumUnits < 2)
+		{
+			return;
+		}
+
+		UNavigationSystemV1 * NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+		if (NavSys == nullptr)
+		{
+			return;
+		}
+
+		const ANavigationData * NavData = NavSys->GetDefaultNavDataInstance(FNavigationSystem::DontCreate);
+		if (NavData == nullptr)
+		{
+			return;
+		}
+
+		const FSharedConstNavQueryFilter QueryFilter = NavData->GetDefaultQueryFilter();
+
+		/* Find the corridor from the middle of the group to the middle of the formation */
+		FVector GroupCentre = FVector::ZeroVector;
+		for (const FVector & Elem : UnitLocations)
+		{
+			GroupCentre += Elem;
+		}
+		GroupCentre /= NumUnits;
+
+		FNavLocation CorridorStart;
+		FNavLocation CorridorEnd;
+		if (!NavSys->ProjectPointToNavigation(GroupCentre, CorridorStart, INVALID_NAVEXTENT, NavData)
+			|| !NavSys->ProjectPointToNavigation(GroupDestination, CorridorEnd, INVALID_NAVEXTENT, NavData))
+		{
+			return;
+		}
+
+		const FPathFindingQuery Query(nullptr, *NavData, CorridorStart.Location, CorridorEnd.Location, QueryFilter);
+		const FPathFindingResult Result = NavSys->FindPathSync(Query);
+		if (!Result.IsSuccessful() || Result.IsPartial())
+		{
+			return;
+		}
+
+		/* Units' paths get its polys so the navmesh knows to recalculate them when it changes */
+		const FNavMeshPath * CorridorNavMeshPath = Result.Path->CastPath<FNavMeshPath>();
+		if (CorridorNavMeshPath == nullptr)
+		{
+			return;
+		}
+
+		const TArray < FNavPathPoint > & Corridor = Result.Path->GetPathPoints();
+
+		/* The first and last corridor points are replaced by each unit's own location and
+		destination so only the ones in between are shared */
+		const int32 FirstShared = 1;
+		const int32 LastShared = Corridor.Num() - 2;
+
+		const float MaxSpreadSqr = FMath::Square(CommandIssuingOptions::GROUP_MOVE_MAX_SPREAD);
+
+		/* Returns true if there is nothing on the navmesh in the way of moving in a straight line */
+		auto CanWalkStraight = [NavData, &QueryFilter](const FVector & From, const FVector & To)
+		{
+			FVector HitLocation;
+			return !NavData->Raycast(From, To, HitLocation, QueryFilter);
+		};
+
+		TArray < FVector > Points;
+		for (int32 i = 0; i < NumUnits; ++i)
+		{
+			if (FVector::DistSquared2D(UnitLocations[i], GroupCentre) > MaxSpreadSqr)
+			{
+				continue;
+			}
+
+			FNavLocation Start;
+			FNavLocation Destination;
+			if (!NavSys->ProjectPointToNavigation(UnitLocations[i], Start, INVALID_NAVEXTENT, NavData)
+				|| !NavSys->ProjectPointToNavigation(Destinations[i], Destination, INVALID_NAVEXTENT, NavData))
+			{
+				continue;
+			}
+
+			Points.Reset();
+			Points.Emplace(Start.Location);
+
+			if (LastShared >= FirstShared)
+			{
+				/* Join the corridor at the first point we can walk straight to */
+				int32 Entry = INDEX_NONE;
+				for (int32 k = FirstShared; k <= LastShared; ++k)
+				{
+					if (CanWalkStraight(Start.Location, Corridor[k].Location))
+					{
+						Entry = k;
+						break;
+					}
+				}
+
+				if (Entry == INDEX_NONE)
+				{
+					continue;
+				}
+
+				/* Leave it at the last point we can walk straight to the destination from */
+				int32 Exit = INDEX_NONE;
+				for (int32 k = LastShared; k >= Entry; --k)
+				{
+					if (CanWalkStraight(Corridor[k].Location, Destination.Location))
+					{
+						Exit = k;
+						break;
+					}
+				}
+
+				if (Exit == INDEX_NONE)
+				{
+					continue;
+				}
+
+				for (int32 k = Entry; k <= Exit; ++k)
+				{
+					Points.Emplace(Corridor[k].Location);
+				}
+			}
+			else if (!CanWalkStraight(Start.Location, Destination.Location))
+			{
+				continue;
+			}
+
+			Points.Emplace(Destination.Location);
+
+			/* Created by the nav data so it is registered as an active path for the unit, same 
+			as a path from a query of its own. If the corridor gets invalidated then the unit 
+			gets a path of its own from wherever it is */
+			FNavPathSharedPtr Path = NavData->CreatePathInstance<FNavMeshPath>(FPathFindingQueryData(
+				Units[i], Start.Location, Destination.Location, QueryFilter));
+			Path->SetFilter(QueryFilter);
+
+			FNavMeshPath * NavMeshPath = Path->CastPath<FNavMeshPath>();
+			NavMeshPath->PathCorridor = CorridorNavMeshPath->PathCorridor;
+			NavMeshPath->PathCorridorCost = CorridorNavMeshPath->PathCorridorCost;
+
+			TArray < FNavPathPoint > & PathPoints = Path->GetPathPoints();
+			PathPoints.Reserve(Points.Num());
+			for (const FVector & Point : Points)
+			{
+				PathPoints.Emplace(FNavPathPoint(Point));
+			}
+
+			Path->MarkReady();
+			Path->EnableRecalculationOnInvalidation(true);
+
+			OutPaths[i] = Path;
+		}
+	}
+}
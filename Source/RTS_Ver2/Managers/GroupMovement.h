@@ -0,0 +1,51 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AI/Navigation/NavigationTypes.h"
+
+class UWorld;
+class AActor;
+
+
+/**
+ *	Helpers for moving a group of units to a formation around a location with one right click.
+ *
+ *	Instead of every unit doing its own navmesh path query to almost the same place, one path
+ *	(the corridor) is found from the middle of the group to the middle of the formation. Each
+ *	unit then gets a path that walks straight onto the corridor, follows it and walks straight
+ *	off it to its formation slot. Getting on and off the corridor is checked with navmesh
+ *	raycasts which are a lot cheaper than path queries.
+ */
+namespace GroupMovement
+{
+	/**
+	 *	Give each unit a formation slot so that the total distance the units have to move is as
+	 *	small as possible. Minimising the total distance also means no two units' straight line
+	 *	moves cross so they collide with each other less. Hungarian algorithm, O(units^2 * slots).
+	 *
+	 *	@param UnitLocations - where each unit is
+	 *	@param SlotLocations - formation slots. Must be at least as many as units
+	 *	@param OutSlotIndices - for each unit the index in SlotLocations it should move to
+	 */
+	void AssignSlots(const TArray < FVector > & UnitLocations, const TArray < FVector > & SlotLocations,
+		TArray < int32 > & OutSlotIndices);
+
+	/**
+	 *	Build paths for a group of units all moving to around the same place using a single
+	 *	navmesh path query.
+	 *
+	 *	@param Units - each unit. Its path is recalculated for it if the navmesh changes 
+	 *	under the shared part
+	 *	@param UnitLocations - where each unit is
+	 *	@param Destinations - where each unit is moving to
+	 *	@param GroupDestination - middle of Destinations e.g. the location the player clicked
+	 *	@param OutPaths - one entry per unit. Null for units that could not be put on the shared
+	 *	path e.g. they are far from the rest of the group or something is in the way of them
+	 *	getting to it. Those units should find their own path
+	 */
+	void BuildPaths(UWorld * World, const TArray < AActor * > & Units, const TArray < FVector > & UnitLocations,
+		const TArray < FVector > & Destinations, const FVector & GroupDestination,
+		TArray < FNavPathSharedPtr > & OutPaths);
+}
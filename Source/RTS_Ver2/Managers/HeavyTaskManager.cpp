@@ -7,22 +7,159 @@
 #include "MapElements/BuildingComponents/BuildingAttackComp_Turret.h"
 #include "Statics/Statics.h"
 #include "Statics/DevelopmentStatics.h"
+#include "Settings/ProjectSettings.h"
+#include "Managers/CommandRecording.h"
 
 
+UHeavyTaskManager::UHeavyTaskManager()
+	: NextSerialNumber(1)
+	, NumRecurringJobsAdded(0)
+	, bIsRunningJobs(false)
+	, NumOverBudgetFramesSinceReport(0)
+	, WorstOverBudgetMicroseconds(0.f)
+	, LastOverBudgetReportTime(0.0)
+{
+}
+
 void UHeavyTaskManager::Tick(float DeltaTime)
 {
-	UWorld * World = GetWorld();
+	BENCHMARK_SCOPE(HeavyTasks);
 
-	//---------------------------------------------------------------
-	//	Building attack components
-	//---------------------------------------------------------------
+	/* Advance every job's timer first so jobs that get deferred still accumulate time */
+	for (FHeavyTaskQueue & Queue : Queues)
+	{
+		for (const TUniquePtr < FHeavyTask > & Task : Queue.Tasks)
+		{
+			Task->TimeSinceLastRun += DeltaTime;
+		}
+	}
+
+	FrameStats.NumRun = 0;
+	FrameStats.NumDeferred = 0;
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	const uint64 BudgetCycles = static_cast<uint64>(ProjectSettings::HEAVY_TASK_FRAME_BUDGET_MICROSECONDS
+		/ (FPlatformTime::GetSecondsPerCycle64() * 1000000.0));
 
-	// Advance bucket index
-	CurrentBuildingAttackCompBucketForTick = (CurrentBuildingAttackCompBucketForTick + 1) % NUM_BUILDING_ATTACK_COMP_BUCKETS;
-	
-	for (const BuildingAttackComp_TurretData & CompData : BuildingAttackComps[CurrentBuildingAttackCompBucketForTick].Array)
-	{ 
-		AsyncCapsuleOverlapTest(World, CompData.GetLocation(), CompData.GetQueryParams(), CompData.GetSweepRadius(), CompData.GetTraceDelegate());
+	/* Highest priority first */
+	bIsRunningJobs = true;
+	for (FHeavyTaskQueue & Queue : Queues)
+	{
+		RunDueJobs(Queue, StartCycles, BudgetCycles);
+	}
+	bIsRunningJobs = false;
+
+	for (FHeavyTaskHandle & Handle : PendingRemovals)
+	{
+		RemoveJob(Handle);
+	}
+	PendingRemovals.Reset();
+
+	const uint64 ElapsedCycles = FPlatformTime::Cycles64() - StartCycles;
+	FrameStats.Microseconds = static_cast<float>(FPlatformTime::ToMilliseconds64(ElapsedCycles) * 1000.0);
+
+	if (ElapsedCycles > BudgetCycles)
+	{
+		FrameStats.NumOverBudgetFrames++;
+		ReportOverBudget(FrameStats.Microseconds);
+	}
+}
+
+void UHeavyTaskManager::RunDueJobs(FHeavyTaskQueue & Queue, uint64 StartCycles, uint64 BudgetCycles)
+{
+	TSparseArray < TUniquePtr < FHeavyTask > > & Tasks = Queue.Tasks;
+
+	const int32 MaxIndex = Tasks.GetMaxIndex();
+	if (MaxIndex == 0)
+	{
+		return;
+	}
+
+	bool bHasRunAJob = false;
+	bool bOutOfBudget = false;
+
+	/* Round robin starting from where we got up to last frame */
+	int32 Index = Queue.Cursor % MaxIndex;
+	for (int32 NumVisited = 0; NumVisited < MaxIndex; ++NumVisited, Index = (Index + 1) % MaxIndex)
+	{
+		if (!Tasks.IsAllocated(Index))
+		{
+			continue;
+		}
+
+		/* Heap allocated so this stays valid even if the job adds more jobs */
+		FHeavyTask & Task = *Tasks[Index];
+		if (Task.bPendingRemoval || !Task.IsDue())
+		{
+			continue;
+		}
+
+		if (bOutOfBudget)
+		{
+			FrameStats.NumDeferred++;
+			continue;
+		}
+
+		/* Always let each priority run at least one job so nothing starves */
+		const uint64 ElapsedCycles = FPlatformTime::Cycles64() - StartCycles;
+		if (bHasRunAJob && ElapsedCycles + static_cast<uint64>(Task.AverageCycles) > BudgetCycles)
+		{
+			/* This job gets first go next frame */
+			Queue.Cursor = Index;
+			bOutOfBudget = true;
+			FrameStats.NumDeferred++;
+			continue;
+		}
+
+		const float TimeSinceLastRun = Task.TimeSinceLastRun;
+		Task.TimeSinceLastRun = 0.f;
+
+		const uint64 JobStartCycles = FPlatformTime::Cycles64();
+
+		Task.Function(TimeSinceLastRun);
+
+		const float JobCycles = static_cast<float>(FPlatformTime::Cycles64() - JobStartCycles);
+
+		bHasRunAJob = true;
+		FrameStats.NumRun++;
+
+		if (Task.IsOneShot())
+		{
+			if (!Task.bPendingRemoval)
+			{
+				Task.bPendingRemoval = true;
+				PendingRemovals.Emplace(FHeavyTaskHandle(Index, Task.SerialNumber,
+					static_cast<EHeavyTaskPriority>(&Queue - Queues)));
+			}
+		}
+		else
+		{
+			Task.AverageCycles = FMath::Lerp(Task.AverageCycles, JobCycles, AVERAGE_CYCLES_SMOOTHING);
+		}
+	}
+
+	if (!bOutOfBudget)
+	{
+		Queue.Cursor = Index;
+	}
+}
+
+void UHeavyTaskManager::ReportOverBudget(float Microseconds)
+{
+	NumOverBudgetFramesSinceReport++;
+	WorstOverBudgetMicroseconds = FMath::Max(WorstOverBudgetMicroseconds, Microseconds);
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now - LastOverBudgetReportTime >= OVER_BUDGET_REPORT_INTERVAL)
+	{
+		UE_LOG(RTSLOG, Log, TEXT("Heavy task manager went over its budget of %.0fus on %d frames "
+			"in the last %.1f seconds. Worst frame took %.0fus"),
+			ProjectSettings::HEAVY_TASK_FRAME_BUDGET_MICROSECONDS, NumOverBudgetFramesSinceReport,
+			Now - LastOverBudgetReportTime, WorstOverBudgetMicroseconds);
+
+		LastOverBudgetReportTime = Now;
+		NumOverBudgetFramesSinceReport = 0;
+		WorstOverBudgetMicroseconds = 0.f;
 	}
 }
 
@@ -44,61 +181,104 @@ FTraceHandle UHeavyTaskManager::AsyncCapsuleOverlapTest(UWorld * World, const FV
 	return World->AsyncOverlapByObjectType(Location, FQuat::Identity, QueryParams, FCollisionShape::MakeCapsule(Radius, Statics::SWEEP_HEIGHT), FCollisionQueryParams::DefaultQueryParam, InDelegate);
 }
 
-void UHeavyTaskManager::RegisterBuildingAttackComponent(IBuildingAttackComp_Turret * InComponent)
+FHeavyTaskHandle UHeavyTaskManager::AddRecurringJob(FHeavyTaskFunction && Function, float Interval,
+	EHeavyTaskPriority Priority)
 {
-	const uint8 BucketIndex = GetOptimalBucket_BuildingAttackComponent();
-	const int16 ArrayIndex = BuildingAttackComps[BucketIndex].Array.Emplace(BuildingAttackComp_TurretData(InComponent));
-	InComponent->SetTaskManagerBucketIndices(BucketIndex, ArrayIndex);
+	assert(Interval >= 0.f);
+
+	/* Spread first runs across the interval using the golden ratio so no matter how many
+	jobs get added they stay roughly evenly spaced */
+	const float Stagger = FMath::Frac(NumRecurringJobsAdded++ * 0.618034f);
+
+	return AddJob(MoveTemp(Function), Interval, Interval * Stagger, Priority);
 }
 
-void UHeavyTaskManager::UnregisterBuildingAttackComponent(IBuildingAttackComp_Turret * InComponent)
+FHeavyTaskHandle UHeavyTaskManager::AddOneShotJob(FHeavyTaskFunction && Function, EHeavyTaskPriority Priority)
+{
+	return AddJob(MoveTemp(Function), -1.f, 0.f, Priority);
+}
+
+FHeavyTaskHandle UHeavyTaskManager::AddJob(FHeavyTaskFunction && Function, float Interval,
+	float InitialTimeSinceLastRun, EHeavyTaskPriority Priority)
+{
+	assert(Function);
+	assert(Priority != EHeavyTaskPriority::z_ALWAYS_LAST_IN_ENUM);
+
+	TUniquePtr < FHeavyTask > Task = MakeUnique<FHeavyTask>();
+	Task->Function = MoveTemp(Function);
+	Task->Interval = Interval;
+	Task->TimeSinceLastRun = InitialTimeSinceLastRun;
+	Task->AverageCycles = 0.f;
+	Task->SerialNumber = NextSerialNumber++;
+	Task->bPendingRemoval = false;
+
+	const uint32 SerialNumber = Task->SerialNumber;
+	const int32 Index = Queues[static_cast<uint8>(Priority)].Tasks.Emplace(MoveTemp(Task));
+
+	return FHeavyTaskHandle(Index, SerialNumber, Priority);
+}
+
+FHeavyTask * UHeavyTaskManager::FindJob(const FHeavyTaskHandle & Handle) const
 {
-	uint8 BucketIndex;
-	int16 ArrayIndex;
-	InComponent->GrabTaskManagerBucketIndices(BucketIndex, ArrayIndex);
+	const TSparseArray < TUniquePtr < FHeavyTask > > & Tasks = Queues[static_cast<uint8>(Handle.Priority)].Tasks;
 
-	TArray<BuildingAttackComp_TurretData> & BucketArray = BuildingAttackComps[BucketIndex].Array;
-	
-	assert(BucketArray[ArrayIndex].GetAttackComponent() == InComponent);
+	if (Handle.Index < Tasks.GetMaxIndex() && Tasks.IsAllocated(Handle.Index)
+		&& Tasks[Handle.Index]->SerialNumber == Handle.SerialNumber)
+	{
+		return Tasks[Handle.Index].Get();
+	}
+
+	return nullptr;
+}
+
+void UHeavyTaskManager::RemoveJob(FHeavyTaskHandle & Handle)
+{
+	if (!Handle.IsValid())
+	{
+		return;
+	}
 
-	/* Remove swap the element, making sure to update the index for the swapped element */
-	if (BucketArray.Num() > 1)
+	FHeavyTask * Task = FindJob(Handle);
+	if (Task != nullptr)
 	{
-		if (ArrayIndex == BucketArray.Num() - 1)
+		if (bIsRunningJobs)
 		{
-			// If it's the last element just remove it. Done
-			BucketArray.RemoveAt(ArrayIndex, 1, false);
+			/* Job could be the one running right now so cannot free it yet */
+			if (!Task->bPendingRemoval)
+			{
+				Task->bPendingRemoval = true;
+				PendingRemovals.Emplace(Handle);
+			}
 		}
 		else
 		{
-			BucketArray.RemoveAtSwap(ArrayIndex, 1, false);
-
-			// Update the array index for the swapped element
-			BucketArray[ArrayIndex].GetAttackComponent()->SetTaskManagerArrayIndex(ArrayIndex);
+			Queues[static_cast<uint8>(Handle.Priority)].Tasks.RemoveAt(Handle.Index);
 		}
 	}
-	else
-	{
-		assert(ArrayIndex == 0);
-		BucketArray.RemoveAt(ArrayIndex, 1, false);
-	}
+
+	Handle.Invalidate();
 }
 
-uint8 UHeavyTaskManager::GetOptimalBucket_BuildingAttackComponent()
+void UHeavyTaskManager::RegisterBuildingAttackComponent(IBuildingAttackComp_Turret * InComponent)
 {
-	uint8 BestIndex = 0;
-	int32 SmallestBucketSize = INT32_MAX;
-	uint8 Index = 0;
-	/* O(n) where n is number of buckets */
-	for (const auto & Bucket : BuildingAttackComps)
+	const BuildingAttackComp_TurretData CompData = BuildingAttackComp_TurretData(InComponent);
+	UWorld * World = GetWorld();
+
+	const FHeavyTaskHandle Handle = AddRecurringJob([CompData, World](float)
 	{
-		if (Bucket.Array.Num() < SmallestBucketSize)
-		{
-			SmallestBucketSize = Bucket.Array.Num();
-			BestIndex = Index;
-		}
-		Index++;
-	}
+		AsyncCapsuleOverlapTest(World, CompData.GetLocation(), CompData.GetQueryParams(),
+			CompData.GetSweepRadius(), CompData.GetTraceDelegate());
+	}, BUILDING_ATTACK_COMP_SWEEP_INTERVAL, EHeavyTaskPriority::High);
+
+	InComponent->SetHeavyTaskHandle(Handle);
+}
+
+void UHeavyTaskManager::UnregisterBuildingAttackComponent(IBuildingAttackComp_Turret * InComponent)
+{
+	FHeavyTaskHandle Handle = InComponent->GetHeavyTaskHandle();
+
+	assert(Handle.IsValid());
+	RemoveJob(Handle);
 
-	return BestIndex;
+	InComponent->SetHeavyTaskHandle(Handle);
 }
@@ -14,16 +14,26 @@ struct FTraceDatum;
 
 
 /**
- *	Heavy task manager is ment to carry out computer resource intense tasks as 'spread out' 
- *	as possible to avoid any hitching. e.g. every so often a capsule sweep is required to see what units are in range 
- *	of other units. Well this manager is ment to make it so each frame does approx the same number 
+ *	Heavy task manager is ment to carry out computer resource intense tasks as 'spread out'
+ *	as possible to avoid any hitching. e.g. every so often a capsule sweep is required to see what units are in range
+ *	of other units. Well this manager is ment to make it so each frame does approx the same number
  *	of sweeps as the last frame.
+ *
+ *	Any system can submit jobs to it. Jobs are either recurring (run roughly every Interval
+ *	seconds) or one-shot. Each frame due jobs are run highest priority first until
+ *	ProjectSettings::HEAVY_TASK_FRAME_BUDGET_MICROSECONDS is used up. Jobs that do not fit are
+ *	deferred to the next frame and get first go then, so when there is a lot of work jobs
+ *	just run a little less often instead of the frame taking longer.
  */
 UCLASS(NotBlueprintable)
 class RTS_VER2_API UHeavyTaskManager : public UObject, public FTickableGameObject
 {
 	GENERATED_BODY()
-	
+
+public:
+
+	UHeavyTaskManager();
+
 protected:
 
 	//~ Begin overrides for FTickableGameObject
@@ -39,31 +49,92 @@ protected:
 public:
 
 	/**
-	 *	Have a building attack component start doing sweeps for targets  
+	 *	Submit a job that runs roughly every Interval seconds until it is removed. The first
+	 *	run is staggered somewhere within the first Interval so jobs submitted together do not
+	 *	all run on the same frame.
+	 *
+	 *	@param Function - function to run
+	 *	@param Interval - how often to run the job in seconds. 0 = every frame if budget allows
+	 *	@param Priority - priority of job
+	 *	@return - handle to pass into RemoveJob
+	 */
+	FHeavyTaskHandle AddRecurringJob(FHeavyTaskFunction && Function, float Interval,
+		EHeavyTaskPriority Priority = EHeavyTaskPriority::Normal);
+
+	/* Submit a job that runs once, as soon as the budget allows */
+	FHeavyTaskHandle AddOneShotJob(FHeavyTaskFunction && Function,
+		EHeavyTaskPriority Priority = EHeavyTaskPriority::Normal);
+
+	/**
+	 *	Remove a job. Safe to call from inside a job, including the job being removed. Does
+	 *	nothing if the job has already been removed (e.g. a one-shot that has run)
+	 */
+	void RemoveJob(FHeavyTaskHandle & Handle);
+
+	const FHeavyTaskFrameStats & GetFrameStats() const { return FrameStats; }
+
+	/**
+	 *	Have a building attack component start doing sweeps for targets
 	 */
 	void RegisterBuildingAttackComponent(IBuildingAttackComp_Turret * InComponent);
-	
-	/** 
-	 *	Stop a building attack component from having its sweep done. If the building has 
-	 *	reached zero health then that might be a time when you want to call this 
+
+	/**
+	 *	Stop a building attack component from having its sweep done. If the building has
+	 *	reached zero health then that might be a time when you want to call this
 	 */
 	void UnregisterBuildingAttackComponent(IBuildingAttackComp_Turret * InComponent);
 
 protected:
 
-	/* Return the which bucket a defense component should be placed into */
-	uint8 GetOptimalBucket_BuildingAttackComponent();
+	FHeavyTaskHandle AddJob(FHeavyTaskFunction && Function, float Interval, float InitialTimeSinceLastRun,
+		EHeavyTaskPriority Priority);
+
+	/**
+	 *	Run the due jobs of one priority
+	 *
+	 *	@param Queue - queue to run jobs from
+	 *	@param StartCycles - cycle count when frame's jobs started
+	 *	@param BudgetCycles - budget for the whole frame in cycles
+	 */
+	void RunDueJobs(FHeavyTaskQueue & Queue, uint64 StartCycles, uint64 BudgetCycles);
+
+	/* Get job if handle still refers to it */
+	FHeavyTask * FindJob(const FHeavyTaskHandle & Handle) const;
+
+	/* Log that frames are going over budget. Throttled */
+	void ReportOverBudget(float Microseconds);
 
 	//----------------------------------------------------------------
 	//	Data
 	//----------------------------------------------------------------
 
-	static constexpr uint8 NUM_BUILDING_ATTACK_COMP_BUCKETS = 16;
+	/* How often each building turret sweeps for targets in seconds */
+	static constexpr float BUILDING_ATTACK_COMP_SWEEP_INTERVAL = 0.25f;
 
-	uint8 CurrentBuildingAttackCompBucketForTick;
+	/* How much weight a new measurement gets in FHeavyTask::AverageCycles */
+	static constexpr float AVERAGE_CYCLES_SMOOTHING = 0.2f;
 
-	/** 
-	 *	Each building attack comp that wants to find targets.
-	 */
-	Array_BuildingAttackComp_TurretData BuildingAttackComps[NUM_BUILDING_ATTACK_COMP_BUCKETS];
+	/* Minimum time between over budget log messages */
+	static constexpr double OVER_BUDGET_REPORT_INTERVAL = 5.0;
+
+	/* Jobs for each priority. Key = static_cast<uint8>(EHeavyTaskPriority) */
+	FHeavyTaskQueue Queues[static_cast<uint8>(EHeavyTaskPriority::z_ALWAYS_LAST_IN_ENUM)];
+
+	uint32 NextSerialNumber;
+
+	/* Used to stagger the first run of recurring jobs */
+	uint32 NumRecurringJobsAdded;
+
+	FHeavyTaskFrameStats FrameStats;
+
+	/* True while inside Tick. Removals are deferred while this is true */
+	bool bIsRunningJobs;
+
+	/* Jobs removed while bIsRunningJobs was true */
+	TArray < FHeavyTaskHandle > PendingRemovals;
+
+	/* Over budget frames since the last report, and the worst of them */
+	int32 NumOverBudgetFramesSinceReport;
+	float WorstOverBudgetMicroseconds;
+	double LastOverBudgetReportTime;
 };
@@ -13,7 +13,7 @@ struct BuildingAttackComp_TurretData
 public:
 
 	/**
-	 *	Constructor for a IBuildingAttackComp_Turret to call 
+	 *	Constructor for a IBuildingAttackComp_Turret to call
 	 */
 	explicit BuildingAttackComp_TurretData(IBuildingAttackComp_Turret * InComponent);
 
@@ -39,30 +39,106 @@ protected:
 };
 
 
-struct Array_BuildingAttackComp_TurretData
+/**
+ *	Priority of a job submitted to the heavy task manager. Higher priorities get first go at
+ *	the frame budget, but every priority is guaranteed at least one job per frame so lower
+ *	ones cannot be starved completely
+ */
+enum class EHeavyTaskPriority : uint8
 {
-	TArray<BuildingAttackComp_TurretData> Array;
+	High,
+	Normal,
+	Low,
+
+	z_ALWAYS_LAST_IN_ENUM
 };
 
 
-/* All the data required for an object to find itself in O(1) */
-struct FTaskManagerBucketInfo
+/* Function a job runs. Param is how long it has been since the job last ran (or since it
+was submitted if it has not run yet) */
+typedef TFunction<void(float)> FHeavyTaskFunction;
+
+
+/* Identifies a job submitted to the heavy task manager. Default constructed = no job */
+struct FHeavyTaskHandle
 {
 public:
 
-	FTaskManagerBucketInfo()
-		: BucketIndex(UINT8_MAX)
-		, ArrayIndex(-1)
+	FHeavyTaskHandle()
+		: Index(INDEX_NONE)
+		, SerialNumber(0)
+		, Priority(EHeavyTaskPriority::Normal)
 	{}
 
-	explicit FTaskManagerBucketInfo(uint8 InBucketIndex, int16 InArrayIndex)
-		: BucketIndex(InBucketIndex)
-		, ArrayIndex(InArrayIndex)
+	explicit FHeavyTaskHandle(int32 InIndex, uint32 InSerialNumber, EHeavyTaskPriority InPriority)
+		: Index(InIndex)
+		, SerialNumber(InSerialNumber)
+		, Priority(InPriority)
 	{}
 
-	/* The bucket the object is in */
-	uint8 BucketIndex;
+	bool IsValid() const { return Index != INDEX_NONE; }
+
+	void Invalidate() { Index = INDEX_NONE; }
+
+	/* Index in the priority's TSparseArray of jobs */
+	int32 Index;
+
+	/* Slots in the sparse array get reused. This makes sure a stale handle does not remove
+	whatever job reused its slot */
+	uint32 SerialNumber;
+
+	EHeavyTaskPriority Priority;
+};
+
+
+/* A job in the heavy task manager */
+struct FHeavyTask
+{
+	FHeavyTaskFunction Function;
+
+	/* How often the job wants to run in seconds. Negative = run once then remove */
+	float Interval;
+
+	float TimeSinceLastRun;
+
+	/* Moving average of how long the job takes to run in cycles. Used to decide whether it
+	will fit in what is left of the frame's budget */
+	float AverageCycles;
+
+	uint32 SerialNumber;
+
+	/* Removed while jobs were running. Will actually be removed once they are done */
+	bool bPendingRemoval;
+
+	bool IsOneShot() const { return Interval < 0.f; }
+	bool IsDue() const { return TimeSinceLastRun >= Interval; }
+};
+
+
+/* All jobs of a certain priority */
+struct FHeavyTaskQueue
+{
+	/* Heap allocated so jobs can add jobs while running without the running job moving */
+	TSparseArray < TUniquePtr < FHeavyTask > > Tasks;
+
+	/* Index in Tasks to start looking for due jobs from next frame. Jobs that did not fit
+	in the budget get first go next frame */
+	int32 Cursor = 0;
+};
+
+
+/* What happened during the last heavy task manager tick */
+struct FHeavyTaskFrameStats
+{
+	/* How long all jobs took */
+	float Microseconds = 0.f;
+
+	/* How many jobs ran */
+	int32 NumRun = 0;
+
+	/* How many jobs were due but did not fit in the budget */
+	int32 NumDeferred = 0;
 
-	/* Index in bucket the object is in */
-	int16 ArrayIndex;
+	/* How many frames in total have gone over budget */
+	int32 NumOverBudgetFrames = 0;
 };
@@ -0,0 +1,129 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "InfantryControllerTickManager.h"
+
+#include "MapElements/AIControllers/InfantryController.h"
+#include "Settings/ProjectSettings.h"
+#include "Statics/DevelopmentStatics.h"
+#include "Managers/CommandRecording.h"
+
+
+AInfantryControllerTickManager::AInfantryControllerTickManager()
+{
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = true;
+
+	Buckets.SetNum(AInfantryController::NUM_UNIT_STATES);
+
+	FrameCount = 0;
+	NumRegistered = 0;
+}
+
+void AInfantryControllerTickManager::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	BENCHMARK_SCOPE(InfantryControllers);
+
+	const uint8 IdleFrameSlot = FrameCount++ % ProjectSettings::IDLE_INFANTRY_BEHAVIOR_FRAME_INTERVAL;
+
+	//-------------------------------------------------------------------
+	//	1. Timers and bucketing
+	//-------------------------------------------------------------------
+
+	for (int32 i = Controllers.Num() - 1; i >= 0; --i)
+	{
+		AInfantryController * Controller = Controllers[i];
+
+		if (Controller == nullptr || Controller->IsPendingKill() 
+			|| Controller->UnitState == EUnitState::PossessedUnitDestroyed)
+		{
+			Controllers.RemoveAtSwap(i, 1, false);
+			continue;
+		}
+
+		if (Controller->TickTimers(DeltaTime))
+		{
+			/* Idle units without a target wait for their time slice. They stay due so will 
+			behavior tick on their next one */
+			if (Controller->UnitState == EUnitState::Idle_WithoutTarget 
+				&& Controller->IdleBehaviorFrameSlot != IdleFrameSlot)
+			{
+				continue;
+			}
+
+			Controller->AccumulatedTickBehaviorTime = 0.f;
+
+			Buckets[static_cast<uint8>(Controller->UnitState)].Emplace(Controller);
+		}
+	}
+
+	//-------------------------------------------------------------------
+	//	2. Behavior ticks, one state at a time
+	//-------------------------------------------------------------------
+
+	for (uint8 i = 0; i < AInfantryController::NUM_UNIT_STATES; ++i)
+	{
+		TArray < AInfantryController * > & Bucket = Buckets[i];
+		if (Bucket.Num() == 0)
+		{
+			continue;
+		}
+
+		for (AInfantryController * Controller : Bucket)
+		{
+			/* A behavior tick earlier on this frame (e.g. an attack killing a target) could 
+			have changed its state since it was bucketed. Do the tick for the state it is in 
+			now. States without a function (e.g. unit destroyed) are skipped */
+			const AInfantryController::FunctionPtrType Function 
+				= AInfantryController::TickFunctions.Functions[static_cast<uint8>(Controller->UnitState)];
+			if (Function != nullptr)
+			{
+				(Controller->* Function)();
+			}
+		}
+
+		Bucket.Reset();
+	}
+
+	//-------------------------------------------------------------------
+	//	3. Attacks and rotation
+	//-------------------------------------------------------------------
+
+	for (AInfantryController * Controller : Controllers)
+	{
+		if (Controller->UnitState != EUnitState::PossessedUnitDestroyed)
+		{
+			Controller->TickAttackAndRotation(DeltaTime);
+		}
+	}
+
+	//-------------------------------------------------------------------
+	//	4. Path queries. Done last so requests made this frame get started this frame
+	//-------------------------------------------------------------------
+
+	PathRequests.StartQueries(GetWorld(), 
+		FNavPathQueryDelegate::CreateUObject(this, &AInfantryControllerTickManager::OnPathQueryFinished));
+}
+
+void AInfantryControllerTickManager::RegisterInfantryController(AInfantryController * InController)
+{
+	assert(InController != nullptr);
+	assert(!Controllers.Contains(InController));
+
+	InController->IdleBehaviorFrameSlot = NumRegistered++ % ProjectSettings::IDLE_INFANTRY_BEHAVIOR_FRAME_INTERVAL;
+
+	Controllers.Emplace(InController);
+}
+
+uint32 AInfantryControllerTickManager::RequestPath(AInfantryController * Requester, 
+	const FVector & Start, const FVector & Goal)
+{
+	return PathRequests.Request(Requester, Start, Goal);
+}
+
+void AInfantryControllerTickManager::OnPathQueryFinished(uint32 QueryID, 
+	ENavigationQueryResult::Type Result, FNavPathSharedPtr Path)
+{
+	PathRequests.OnQueryFinished(QueryID, Result, Path);
+}
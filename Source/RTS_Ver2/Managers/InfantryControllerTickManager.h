@@ -0,0 +1,76 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Info.h"
+
+#include "Managers/PathRequestQueue.h"
+
+#include "InfantryControllerTickManager.generated.h"
+
+class AInfantryController;
+
+
+/**
+ *	Tick manager responsible for ticking every infantry AI controller. Only spawned on the 
+ *	server since that is the only place AI controllers exist.
+ *
+ *	Infantry controllers do not tick themselves. Instead each tick this does:
+ *	1. Count down every controller's attack cooldown and behavior timer. Controllers due a 
+ *	behavior tick get put in a bucket for their EUnitState
+ *	2. Go through the buckets one EUnitState at a time and run each controller's TickAI_ 
+ *	function. If a controller's state changed earlier in the frame the function for its 
+ *	current state is run
+ *	3. Let every controller start attacks and update rotation
+ *	4. Start the path queries controllers have asked for (see FPathRequestQueue)
+ *
+ *	Controllers that are Idle_WithoutTarget are time sliced: they only get put in their bucket 
+ *	on one frame out of every ProjectSettings::IDLE_INFANTRY_BEHAVIOR_FRAME_INTERVAL. 
+ *	Otherwise they stay due and wait for their frame.
+ */
+UCLASS(NotBlueprintable)
+class RTS_VER2_API AInfantryControllerTickManager : public AInfo
+{
+	GENERATED_BODY()
+
+public:
+
+	AInfantryControllerTickManager();
+
+	virtual void Tick(float DeltaTime) override;
+
+	/* Start ticking a controller. Call once it has started its behavior */
+	void RegisterInfantryController(AInfantryController * InController);
+
+	/**
+	 *	Ask for a path. Result is handed to the controller's OnPathRequestFinished a frame or 
+	 *	so later.
+	 *
+	 *	@return - ID the result will be handed back with. Never 0
+	 */
+	uint32 RequestPath(AInfantryController * Requester, const FVector & Start, const FVector & Goal);
+
+protected:
+
+	/* Every controller this manager is in charge of ticking. Order means nothing. Controllers 
+	whose unit has been destroyed are removed during Tick */
+	UPROPERTY()
+	TArray < AInfantryController * > Controllers;
+
+	/* Controllers due a behavior tick this frame. Key = EUnitState as uint8. Only a member to 
+	avoid allocating every tick */
+	TArray < TArray < AInfantryController * > > Buckets;
+
+	/* Path requests from controllers */
+	FPathRequestQueue PathRequests;
+
+	/* Passes results from the navigation system on to PathRequests */
+	void OnPathQueryFinished(uint32 QueryID, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path);
+
+	/* Frame counter for time slicing */
+	uint32 FrameCount;
+
+	/* Number of controllers ever registered. Used to spread controllers across time slices */
+	uint32 NumRegistered;
+};
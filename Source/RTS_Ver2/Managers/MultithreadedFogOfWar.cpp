@@ -4,29 +4,56 @@
 
 #include "MultithreadedFogOfWar.h"
 #include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "Async/ParallelFor.h"
+#include "Engine/PostProcessVolume.h"
+#include "Engine/Texture2D.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "Public/EngineUtils.h"
+
+#include "Statics/DevelopmentStatics.h"
+#include "Statics/Statics.h"
+#include "MapElements/Invisible/RTSLevelVolume.h"
+#include "GameFramework/RTSGameState.h"
+#include "GameFramework/RTSPlayerState.h"
+#include "MapElements/Infantry.h"
+#include "MapElements/Building.h"
+#include "MapElements/Projectiles/ProjectileBase.h"
+#include "MapElements/InventoryItem.h"
+#include "Audio/FogObeyingAudioComponent.h"
+#include "Managers/FogOfWarStamps.h"
 
 
-// TODO garrisoned infantry should not reveal any tiles. Remember they update the 
-// building when they enter it. Possibly do nothing in this class and instead in the 
-// OnGameThreadTick func do not add units to the containers if they are inside a garrison
-
-// TODO the fog manager should not try to hide/reveal enemy units inside garrisons
-
 //--------------------------------------------------------------------------------------------
 //============================================================================================
 //	------- Fog Manager Class -------
 //============================================================================================
 //--------------------------------------------------------------------------------------------
 
-// Is this ok?
 MultithreadedFogOfWarManager MultithreadedFogOfWarManager::FogManager;
 
-void MultithreadedFogOfWarManager::Setup(UWorld * World, ARTSLevelVolume * FogVolume,  uint8 InNumTeams,
+MultithreadedFogOfWarManager::MultithreadedFogOfWarManager()
+	: GS(nullptr)
+	, WorkerThread(nullptr)
+	, bIsServer(false)
+	, bHasSetup(false)
+	, LocalPlayersTeamIndex(0)
+	, NumTeams(0)
+	, FogTexture(nullptr)
+	, FogOfWarMaterialInstance(nullptr)
+{
+}
+
+void MultithreadedFogOfWarManager::Setup(UWorld * World, ARTSLevelVolume * FogVolume, uint8 InNumTeams,
 	uint8 InLocalPlayersTeamIndex, UMaterialInterface * FogOfWarMaterial)
 {
+	assert(!bHasSetup);
+
 	bIsServer = World->IsServer();
 	LocalPlayersTeamIndex = InLocalPlayersTeamIndex;
 	NumTeams = InNumTeams;
+	GS = CastChecked<ARTSGameState>(World->GetGameState());
 
 	//-----------------------------------------------------------
 	//	Set map info using fog volume
@@ -51,6 +78,10 @@ void MultithreadedFogOfWarManager::Setup(UWorld * World, ARTSLevelVolume * FogVo
 
 	const int32 NumTiles = NumTilesX * NumTilesY;
 
+	//-----------------------------------------------------------
+	//	Rendering
+	//-----------------------------------------------------------
+
 	UE_CLOG(FogOfWarMaterial == nullptr, RTSLOG, Fatal, TEXT("Fog of war is enabled for project "
 		"but no fog of war material set in game instance, need to set fog material"));
 
@@ -69,8 +100,6 @@ void MultithreadedFogOfWarManager::Setup(UWorld * World, ARTSLevelVolume * FogVo
 	/* Crashes on the line above could mean fog of war volume is glitched and doesn't have any
 	dimensions. Need to remove it and add another */
 
-	TextureRegions = new FUpdateTextureRegion2D(0, 0, 0, 0, MapTileDimensions.X, MapTileDimensions.Y);
-
 	FogOfWarMaterialInstance = UMaterialInstanceDynamic::Create(FogOfWarMaterial, nullptr);
 	assert(FogOfWarMaterialInstance != nullptr);
 	FogOfWarMaterialInstance->SetTextureParameterValue(FName("VisibilityMask"), FogTexture);
@@ -81,1091 +110,768 @@ void MultithreadedFogOfWarManager::Setup(UWorld * World, ARTSLevelVolume * FogVo
 
 	PostProcessVolume->AddOrUpdateBlendable(FogOfWarMaterialInstance);
 
-	TextureBuffer = new uint8[MapTileDimensions.X * MapTileDimensions.Y * 4];
+	/* Nothing holds a UPROPERTY reference to these since this class is not a UObject */
+	FogTexture->AddToRoot();
+	FogOfWarMaterialInstance->AddToRoot();
 
 	//---------------------------------------------------------
 	//	Filling Containers
 	//---------------------------------------------------------
 
-	if (bIsServer)
+	/* Only server needs every team's tiles. Clients just need their own team's. No other
+	threads exist yet so it is ok to touch every buffer */
+	for (int32 BufferIndex = 0; BufferIndex < TFogTripleBuffer<FogFrameResult>::NUM_BUFFERS; ++BufferIndex)
 	{
-		// Fill TilesArrays
+		FogFrameResult & Result = Results.GetBufferByIndex(BufferIndex);
 		for (int32 i = 0; i < NumTeams; ++i)
 		{
-			TilesArrays[i].Array.Init(EFogStatus::Hidden, NumTiles);
+			if (bIsServer || i == LocalPlayersTeamIndex)
+			{
+				Result.TeamTiles[i].Init(EFogStatus::Hidden, NumTiles);
+			}
 		}
+		Result.TextureData.SetNumUninitialized(NumTiles * 4);
+		Result.ComputedTeams = 0;
+	}
 
-		// Fill TeamTilesShared
+	for (int32 BufferIndex = 0; BufferIndex < TFogTripleBuffer<FogFrameSnapshot>::NUM_BUFFERS; ++BufferIndex)
+	{
+		FogFrameSnapshot & Snapshot = Snapshots.GetBufferByIndex(BufferIndex);
 		for (int32 i = 0; i < NumTeams; ++i)
 		{
-			TeamTilesShared[i].Array.Init(EFogStatus::Hidden, NumTiles);
+			Snapshot.RevealSources[i].Reserve(ProjectSettings::MAX_NUM_SELECTABLES_PER_PLAYER);
 		}
+		Snapshot.LocalPlayersTeamIndex = LocalPlayersTeamIndex;
 	}
-	else
-	{
-		// Fill TilesArrays
-		TilesArrays[LocalPlayersTeamIndex].Array.Init(EFogStatus::Hidden, NumTiles);
 
-		// Fill TeamTilesShared
-		TeamTilesShared[LocalPlayersTeamIndex].Array.Init(EFogStatus::Hidden, NumTiles);
+	for (int32 i = 0; i < NumTeams; ++i)
+	{
+		TeamTempRevealEffects[i].Reserve(16);
 	}
 
+	FMemory::Memzero(SelectableVisibility, sizeof(SelectableVisibility));
+
 	//-----------------------------------------------------
-	//	Creating threads
+	//	Creating thread
 	//-----------------------------------------------------
 
-	const int32 NumThreads = GetNumFogOfWarThreadsToCreate();
-	if (bIsServer && false)// Using && false to force server to actually use client threads at the moment just for testing
+	WorkerThread = new FogOfWarThread();
+
+	bHasSetup = true;
+}
+
+void MultithreadedFogOfWarManager::Shutdown()
+{
+	if (!bHasSetup)
 	{
-		//ServerIdleThreads.Array.Reserve(NumThreads);
-		//for (int32 i = 0; i < NumThreads; ++i)
-		//{
-		//	ServerIdleThreads.Array.Emplace(new ServerFogOfWarThread());
-		//}
+		return;
 	}
-	else
+
+	/* Must happen first. After this returns nothing else is touching the buffers */
+	WorkerThread->StopAndWait();
+	delete WorkerThread;
+	WorkerThread = nullptr;
+
+	for (int32 BufferIndex = 0; BufferIndex < TFogTripleBuffer<FogFrameResult>::NUM_BUFFERS; ++BufferIndex)
 	{
-		ClientIdleThreads.Array.Reserve(NumThreads);
-		for (int32 i = 0; i < NumThreads; ++i)
+		FogFrameResult & Result = Results.GetBufferByIndex(BufferIndex);
+		for (int32 i = 0; i < ProjectSettings::MAX_NUM_TEAMS; ++i)
 		{
-			ClientIdleThreads.Array.Emplace(new ClientFogOfWarThread());
+			Result.TeamTiles[i].Empty();
 		}
+		Result.TextureData.Empty();
 	}
 
-	//-------------------------------------------------------
-	//	Done
-	//-------------------------------------------------------
-
-	assert(!bHasSetup);
-	bHasSetup = true;
-}
-
-int32 MultithreadedFogOfWarManager::GetNumFogOfWarThreadsToCreate() const
-{
-	/* Might wanna factor these in at some point */
-	//const int32 NumCores = FPlatformMisc::NumberOfCores();
-	//const int32 NumLogicalCores = FPlatformMisc::NumberOfCoresIncludingHyperthreads();
-	
-	// Both 1 for testing
-	if (bIsServer)
+	for (int32 BufferIndex = 0; BufferIndex < TFogTripleBuffer<FogFrameSnapshot>::NUM_BUFFERS; ++BufferIndex)
 	{
-		return 1;
-		//return FMath::Max(NumTeams / 2, 2);
+		Snapshots.GetBufferByIndex(BufferIndex).Reset();
 	}
-	else
+
+	for (int32 i = 0; i < ProjectSettings::MAX_NUM_TEAMS; ++i)
 	{
-		return 1;
+		TeamTempRevealEffects[i].Reset();
 	}
+
+	BuildingTileIndices.Reset();
+	GS = nullptr;
+
+	FogTexture->RemoveFromRoot();
+	FogTexture = nullptr;
+	FogOfWarMaterialInstance->RemoveFromRoot();
+	FogOfWarMaterialInstance = nullptr;
+
+	bHasSetup = false;
 }
 
-void MultithreadedFogOfWarManager::OnGameThreadTick(float InDeltaTime)
+void MultithreadedFogOfWarManager::OnGameThreadTick(float DeltaTime)
 {
 	if (!bHasSetup)
 	{
 		return;
 	}
 
-	if (bIsServer && false) // && false added so server does client logic, just for testing
-	{
-		// TODO
-	}
-	else
-	{
-		// If choosing to hide/reveal selectables in a batch then do that now. Or 
-		// can do it anywhere really.
-		
-		bool bIssuedTask = false;
-		
-		ClientIdleThreads.Lock.Lock();
-		if (ClientIdleThreads.Array.Num() > 0)
-		{
-			ClientIdleThreads.Lock.Unlock();
+	ApplyLatestResult();
 
-			CalculationProgress & Progress = TeamProgress[LocalPlayersTeamIndex];
+	PublishSnapshot(DeltaTime);
+}
 
-			Progress.Lock.Lock();
+void MultithreadedFogOfWarManager::ApplyLatestResult()
+{
+	if (!Results.Acquire())
+	{
+		/* Fog thread has not finished anything new since last time. The selectables etc
+		already reflect the result we have */
+		return;
+	}
 
-			//----------------------------------------------
-			//	Begin critical section
-			//----------------------------------------------
+	const FogFrameResult & Result = Results.GetConsumerBuffer();
 
-			/* We do a lot of work here, but there are actually no other threads contending for 
-			this lock right now so it's ok */
-			if (Progress.NextTask == EMulthreadedFogTask::Finished)
+	if (bIsServer)
+	{
+		for (uint8 i = 0; i < NumTeams; ++i)
+		{
+			if ((Result.ComputedTeams & (1 << i)) == 0)
 			{
-				bIssuedTask = true;
-				
-				/* Tell a thread to reset the tiles array. While it does this we will fill the 
-				infantry/buildings arrays */
-				ClientIdleThreads.Array.Last()->ResetTileInfo(LocalPlayersTeamIndex);
-
-				Progress.NextTask = EMulthreadedFogTask::RevealTilesFromBuildings;
-
-				//--------------------------------------------------------------
-				//	Begin critical section
-				//--------------------------------------------------------------
-				BuildingStatesShared[LocalPlayersTeamIndex].ArrayLock.Lock();
-
-				// Copy array from game state into fog manager
-				TArray<BuildingFogInfo> & NewlyCreatedBuildings = RecentlyCreatedBuildings[LocalPlayersTeamIndex].Array;
-				TArray<BuildingFogInfo> & BuildingsArray = BuildingStatesShared[LocalPlayersTeamIndex].Array;
-				BuildingsArray.Reserve(BuildingsArray.Num() + NewlyCreatedBuildings.Num());
-				for (const auto & Elem : NewlyCreatedBuildings)
-				{
-					BuildingsArray.Emplace(Elem);
-				}
-
-				// Copy array from game state into fog manager
-				TArray<BuildingFogInfo> & BuildingsUpdated = RecentlyModifiedBuildings[LocalPlayersTeamIndex].Array;
-				for (auto & Elem : BuildingsUpdated)
-				{
-					for (const auto & Entry : BuildingsArray)
-					{
-						if (Elem.SelectableID == Entry.SelectableID)
-						{
-							// We're assuming it's either one of sight radius or stealth detection radius by just copying those two values
-							Elem.SightRadius = Entry.SightRadius;
-							Elem.StealthRevealRadius = Entry.StealthRevealRadius;
-							break;
-						}
-					}
-				}
-
-				// Copy array from game state into fog manager
-				TArray<uint8> & DestroyedBuildingsArray = RecentlyDestroyedBuildings[LocalPlayersTeamIndex].Array;
-				DestroyedBuildingArray & DestroyedBuildingsStruct = DestroyedBuildingsShared[LocalPlayersTeamIndex];
-				for (const auto & Elem : DestroyedBuildingsArray)
-				{
-					DestroyedBuildingsStruct.SetBitToRecentlyDestroyed(Elem);
-				}
-
-				InfantryStatesShared[LocalPlayersTeamIndex].ArrayLock.Lock();
-				BuildingStatesShared[LocalPlayersTeamIndex].ArrayLock.Unlock();
-				//--------------------------------------------------------------
-				//	End critical section and begin new one
-				//--------------------------------------------------------------
-
-				TArray <InfantryFogInfo> & InfantryArray = InfantryStatesShared[LocalPlayersTeamIndex].Array;
-				TArray <AInfantry*> & OtherArray = TeamsInfantry[LocalPlayersTeamIndex].Array;
-				threadAssert(InfantryArray.Num() == 0);
-				InfantryArray.Reserve(OtherArray.Num());
-				for (const auto & Infantry : OtherArray)
-				{
-					InfantryArray.Emplace(InfantryFogInfo(Infantry));
-				}
-
-				TemporaryRevealEffectsShared[LocalPlayersTeamIndex].ArrayLock.Lock();
-				InfantryStatesShared[LocalPlayersTeamIndex].ArrayLock.Unlock();
-				//--------------------------------------------------------------
-				//	End critical section and begin new one
-				//--------------------------------------------------------------
-
-				TArray<FTemporaryFogRevealEffectInfo> & TempEffectsArray = RecentlyCreatedTemporaryRevealEffects[LocalPlayersTeamIndex].Array;
-				TArray<FTemporaryFogRevealEffectInfo> & SharedTempEffectArray = TemporaryRevealEffectsShared[LocalPlayersTeamIndex].Array;
-				SharedTempEffectArray.Append(TempEffectsArray);
-
-				DeltaTime = DeltaTimeNotThreadSafe + InDeltaTime; 
-
-				TemporaryRevealEffectsShared[LocalPlayersTeamIndex].ArrayLock.Unlock();
-
-				/* Reset these arrays outside the critical sections so fog threads do not have to wait
-				on us doing it. But it might be slightly slower this way for the game thread.
-				It's kind of a trade off: do we want to improve fog thread performance or game thread
-				performance? Maybe framerates will be better with these instead the critical sections.
-				Will have to test. But only the infantry array will really be big */
-				TempEffectsArray.Reset();
-				DestroyedBuildingsArray.Reset();
-				BuildingsUpdated.Reset();
-				NewlyCreatedBuildings.Reset();
+				continue;
 			}
 
-			//----------------------------------------------
-			//	End critical section
-			//----------------------------------------------
-
-			// Maybe this can be released earlier... it may be the locks like the building/infantry etc that threads will wait on
-			Progress.Lock.Unlock();
+			const TArray<EFogStatus> & Tiles = Result.TeamTiles[i];
 
-			if (bIssuedTask)
+			/* Render fog + hide/reveal enemy selectables if it is our own team */
+			if (i == LocalPlayersTeamIndex)
 			{
-				DeltaTimeNotThreadSafe = 0.f;
-
-				/* Now while threads are doing the infantry, building and temp effects revealing, 
-				we begin filling the hostile team arrays. */
-
-				for (int32 i = 0; i < NumTeams; ++i)
-				{
-					// Skip our own team; already did them above
-					if (i == LocalPlayersTeamIndex)
-					{
-						continue;
-					}
-
-					InfantryFogInfoBasicArray & InfantryArrayStruct = InfantryStatesBasicShared[i];
-
-					// Infantry lock is the only lock we'll use here. Whoever has it has 
-					// access to both the infantry array and building array
-					InfantryArrayStruct.ArrayLock.Lock();
-
-					//----------------------------------------------
-					//	Begin critical section
-					//----------------------------------------------
-					TArray<InfantryFogInfoBasic> & InfantryArray = InfantryArrayStruct.Array;
-					threadAssert(InfantryArray.Num() == 0);
-					TArray<AInfantry*> & OtherArray = TeamsInfantry[i].Array;
-					InfantryArray.Reserve(OtherArray.Num());
-					for (const auto & Infantry : OtherArray)
-					{
-						InfantryArray.Emplace(InfantryFogInfoBasic(Infantry));
-					}
-
-					TArray<BuildingFogInfo> & BuildingsArray = BuildingStatesShared[i].Array;
-					TArray<BuildingFogInfo> & NewBuildings = RecentlyCreatedBuildings[i].Array;
-					BuildingsArray.Reserve(BuildingsArray.Num() + NewBuildings.Num());
-					for (const auto & Elem : NewBuildings)
-					{
-						BuildingsArray.Emplace(Elem);
-					}
-
-					DestroyedBuildingArray & DestroyedBuildingsStruct = DestroyedBuildingsShared[i];
-					threadAssert(DestroyedBuildingsStruct.AreAllFlagsReset());
-					TArray<uint8> & AnotherArray = RecentlyDestroyedBuildings[i].Array;
-					for (const auto & Elem : AnotherArray)
-					{
-						DestroyedBuildingsStruct.SetBitToRecentlyDestroyed(Elem);
-					}
-
-					//----------------------------------------------
-					//	End critical section
-					//----------------------------------------------
-
-					InfantryArrayStruct.ArrayLock.Unlock();
-				}
+				UpdateSelectableVisibility(i, Tiles, true);
+				HideAndRevealTemporaries(Tiles);
+				UpdateInventoryItemVisibility(i, Tiles, true);
+				MuteAndUnmuteAudio(Tiles);
+				RenderFogOfWar(Result);
 			}
 			else
 			{
-				DeltaTimeNotThreadSafe += InDeltaTime;
+				UpdateSelectableVisibility(i, Tiles, false);
+				UpdateInventoryItemVisibility(i, Tiles, false);
 			}
 		}
-		else
-		{
-			ClientIdleThreads.Lock.Unlock();
-			DeltaTimeNotThreadSafe += InDeltaTime;
-		}
 	}
-}
-
-void MultithreadedFogOfWarManager::OnBuildingDestroyed(ABuilding * Building)
-{
-	RecentlyDestroyedBuildings[Building->GetTeamIndex()].Array.Emplace(Building->GetSelectableID());
-}
+	else
+	{
+		const TArray<EFogStatus> & Tiles = Result.TeamTiles[LocalPlayersTeamIndex];
 
-void MultithreadedFogOfWarManager::RegisterTeamTemporaryRevealEffect(const FTemporaryFogRevealEffectInfo & Effect, FVector2D WorldLocation, ETeam Team)
-{
-	const int32 Index = Statics::TeamToArrayIndex(Team);
-	RecentlyCreatedTemporaryRevealEffects[Index].Array.Emplace(FTemporaryFogRevealEffectInfo(Effect, WorldLocation));
+		UpdateSelectableVisibility(LocalPlayersTeamIndex, Tiles, true);
+		HideAndRevealTemporaries(Tiles);
+		UpdateInventoryItemVisibility(LocalPlayersTeamIndex, Tiles, true);
+		MuteAndUnmuteAudio(Tiles);
+		RenderFogOfWar(Result);
+	}
 }
 
-void MultithreadedFogOfWarManager::RevealTilesAroundLocation(const FVector2D & Location, float SightRadius, float StealthRevealRadius, TArray<EFogStatus>& Tiles)
+void MultithreadedFogOfWarManager::PublishSnapshot(float DeltaTime)
 {
-	const int32 SightRadiusInTiles = FMath::FloorToInt(SightRadius / FogOfWarOptions::FOG_TILE_SIZE);
-	const int32 StealthSightRadiusInTiles = FMath::FloorToInt(StealthRevealRadius / FogOfWarOptions::FOG_TILE_SIZE);
-	const int32 HighestRadiusInTiles = SightRadiusInTiles > StealthSightRadiusInTiles ? SightRadiusInTiles : StealthSightRadiusInTiles;
+	FogFrameSnapshot & Snapshot = Snapshots.GetProducerBuffer();
+	Snapshot.Reset();
 
-	const FIntPoint TileLocation = GetFogGridCoords(Location);
-
-	/* Hoisting this out now in case compiler does not do it */
-	if (StealthRevealRadius <= 0.f)
+	for (uint8 TeamIndex = 0; TeamIndex < NumTeams; ++TeamIndex)
 	{
-		for (int32 Radius_Y = -HighestRadiusInTiles; Radius_Y <= HighestRadiusInTiles; ++Radius_Y)
+		/* Clients only calculate their own team's visibility */
+		if (!bIsServer && TeamIndex != LocalPlayersTeamIndex)
 		{
-			for (int32 Radius_X = -HighestRadiusInTiles; Radius_X <= HighestRadiusInTiles; ++Radius_X)
-			{
-				const int32 Tile_X = TileLocation.X + Radius_X;
-				const int32 Tile_Y = TileLocation.Y + Radius_Y;
+			continue;
+		}
 
-				/* Check if tile is within range */
-				if (Tile_X >= 0 && Tile_Y >= 0 && Tile_X < MapTileDimensions.X
-					&& Tile_Y < MapTileDimensions.Y
-					&& FMath::Square(Radius_X) + FMath::Square(Radius_Y) < FMath::Square(SightRadiusInTiles))
-				{
-					const int32 TileIndex = GetTileIndex(Tile_X, Tile_Y);
+		Snapshot.TeamsToCompute |= (1 << TeamIndex);
 
-					/* Reveal tile using bitwise or operator */
-					Tiles[TileIndex] = BitwiseOrOperator(Tiles[TileIndex], EFogStatus::Revealed);
-					/* Get rid of this case now. It's the same as Hidden */
-					if (Tiles[TileIndex] == EFogStatus::StealthDetected)
-					{
-						Tiles[TileIndex] = EFogStatus::Hidden;
-					}
-				}
-			}
-		}
-	}
-	else
-	{
-		for (int32 Radius_Y = -HighestRadiusInTiles; Radius_Y <= HighestRadiusInTiles; ++Radius_Y)
+		TArray<FogRevealSource> & Sources = Snapshot.RevealSources[TeamIndex];
+
+		for (ARTSPlayerState * PlayerState : GS->GetTeamPlayerStates(Statics::ArrayIndexToTeam(TeamIndex)))
 		{
-			for (int32 Radius_X = -HighestRadiusInTiles; Radius_X <= HighestRadiusInTiles; ++Radius_X)
+			/* Null sometimes in 2+ player PIE */
+			if (!Statics::IsValid(PlayerState))
 			{
-				const int32 Tile_X = TileLocation.X + Radius_X;
-				const int32 Tile_Y = TileLocation.Y + Radius_Y;
+				continue;
+			}
 
-				/* Check if tile is within range */
-				if (Tile_X >= 0 && Tile_Y >= 0 && Tile_X < MapTileDimensions.X
-					&& Tile_Y < MapTileDimensions.Y)
+			for (AInfantry * Unit : PlayerState->GetUnits())
+			{
+				/* Skip if inside garrison. Units update the building's sight/stealth radius
+				when they enter it if it can be seen out of */
+				if (!Statics::IsValid(Unit) || Unit->IsInsideGarrison())
 				{
-					/* Assuming static_cast<uint8>(SomeBool) assigns 0x01 for true and 0x00 for false */
-					const uint8 bInSightRange = FMath::Square(Radius_X) + FMath::Square(Radius_Y) < FMath::Square(SightRadiusInTiles);
-					const uint8 bInStealthRevealRange = FMath::Square(Radius_X) + FMath::Square(Radius_Y) < FMath::Square(StealthSightRadiusInTiles);
-					/* Least significant bit = revealed
-					2nd least sginificant bit = reveals stealth.
-					Both have to be true to actually reveal stealth selectables */
-					const uint8 FinalTileStatus = bInSightRange | (bInStealthRevealRange << 1);
-
-					const int32 TileIndex = GetTileIndex(Tile_X, Tile_Y);
-
-					/* Reveal tile using bitwise or operator */
-					Tiles[TileIndex] = BitwiseOrOperator(Tiles[TileIndex], FinalTileStatus);
-					/* Get rid of this case now. It's the same as Hidden */
-					if (Tiles[TileIndex] == EFogStatus::StealthDetected)
-					{
-						Tiles[TileIndex] = EFogStatus::Hidden;
-					}
+					continue;
 				}
-			}
-		}
-	}
-}
-
-EFogStatus MultithreadedFogOfWarManager::GetLocationFogStatus(const FVector2D & Location, const TArray<EFogStatus>& Tiles) const
-{
-	return Tiles[WorldLocationToTilesIndex(Location)];
-}
-
-void MultithreadedFogOfWarManager::OnAllTasksComplete(uint8 TeamIndex)
-{
-	TeamProgress[TeamIndex].NextTeamIndexForStoringSelectableVisibilityInfo = 0;
-}
-
-void MultithreadedFogOfWarManager::AddRecentlyCreatedBuilding(ABuilding * Building)
-{
-	RecentlyCreatedBuildings[Building->GetTeamIndex()].Array.Emplace(BuildingFogInfo(Building));
-}
 
-int32 MultithreadedFogOfWarManager::WorldLocationToTilesIndex(const FVector2D & WorldLocation) const
-{
-	FIntPoint Loc = GetFogGridCoords(WorldLocation);
-	return GetTileIndex(Loc.X, Loc.Y);
-}
+				float SightRadius, StealthRevealRadius;
+				Unit->GetVisionInfo(SightRadius, StealthRevealRadius);
 
-FIntPoint MultithreadedFogOfWarManager::GetFogGridCoords(const FVector & WorldLocation) const
-{
-	return GetFogGridCoords(FVector2D(WorldLocation));
-}
-
-FIntPoint MultithreadedFogOfWarManager::GetFogGridCoords(const FVector2D & WorldLocation) const
-{
-	FVector2D Vector = WorldLocation - MapCenter;
-	Vector *= MapDimensionsInverse;
-	Vector += FVector2D(0.5f, 0.5f);
-	Vector *= MapTileDimensions;
+				Sources.Emplace(FogRevealSource(FVector2D(Unit->GetActorLocation()), SightRadius, StealthRevealRadius));
+			}
 
-	const FIntPoint TileCoords = FIntPoint(FMath::FloorToInt(Vector.X),
-		FMath::FloorToInt(Vector.Y));
+			for (ABuilding * Building : PlayerState->GetBuildings())
+			{
+				if (!Statics::IsValid(Building))
+				{
+					continue;
+				}
 
-	return TileCoords;
-}
+				float SightRadius, StealthRevealRadius;
+				Building->GetVisionInfo(SightRadius, StealthRevealRadius);
 
-EFogStatus MultithreadedFogOfWarManager::BitwiseOrOperator(const EFogStatus & Enum1, const EFogStatus & Enum2)
-{
-	return static_cast<EFogStatus>(static_cast<uint8>(Enum1) | static_cast<uint8>(Enum2));
-}
+				Sources.Emplace(FogRevealSource(FVector2D(Building->GetActorLocation()), SightRadius, StealthRevealRadius));
+			}
+		}
 
-EFogStatus MultithreadedFogOfWarManager::BitwiseOrOperator(const EFogStatus & Enum1, const uint8 & Enum2AsInt)
-{
-	return static_cast<EFogStatus>(static_cast<uint8>(Enum1) | Enum2AsInt);
-}
+		/* Tick temporary effects here. They are tiny and may use curve assets which the fog
+		thread should not touch */
+		TArray<FTemporaryFogRevealEffectInfo> & TempEffects = TeamTempRevealEffects[TeamIndex];
+		for (int32 i = TempEffects.Num() - 1; i >= 0; --i)
+		{
+			FTemporaryFogRevealEffectInfo & Elem = TempEffects[i];
 
-bool MultithreadedFogOfWarManager::IsLocationLocallyVisible(const FVector & Location) const
-{
-	const FIntPoint Loc = GetFogGridCoords(FVector2D(Location));
-	const int32 TilesIndex = GetTileIndex(Loc.X, Loc.Y);
-	const EFogStatus TileStatus = TilesArrays[LocalPlayersTeamIndex].Array[TilesIndex];
-	return TileStatus == EFogStatus::Revealed || TileStatus == EFogStatus::StealthRevealed;
-}
+			float FogRevealRadius, StealthRevealRadius;
+			Elem.Tick(DeltaTime, FogRevealRadius, StealthRevealRadius);
 
-bool MultithreadedFogOfWarManager::IsLocationVisibleNotChecked(const FVector & Location, ETeam Team) const
-{
-	const FIntPoint GridCoords = GetFogGridCoords(Location);
+			Sources.Emplace(FogRevealSource(Elem.GetLocation(), FogRevealRadius, StealthRevealRadius));
 
-	const int32 Index = Statics::TeamToArrayIndex(Team);
-	const TArray<EFogStatus> & TeamsArray = TilesArrays[Index].Array;
-	const int32 ArrayIndex = GetTileIndex(GridCoords.X, GridCoords.Y);
-	if (TeamsArray.IsValidIndex(ArrayIndex))
-	{
-		return static_cast<uint8>(TeamsArray[ArrayIndex]) & 0x01;
-	}
-	else
-	{
-		return false;
+			if (Elem.HasCompleted())
+			{
+				TempEffects.RemoveAtSwap(i, 1, false);
+			}
+		}
 	}
-}
 
-bool MultithreadedFogOfWarManager::IsSelectableOutsideFog(const ISelectable * Selectable, ETeam Team) const
-{
-	const int32 CheckingTeamIndex = Statics::TeamToArrayIndex(Team);
-	const EFogStatus Status = TeamVisibilityInfo[CheckingTeamIndex][Selectable->GetTeamIndex()].Array[Selectable->GetSelectableID()];
-	return Status == EFogStatus::Revealed || Status == EFogStatus::StealthRevealed;
-}
+	Snapshots.Publish();
 
-int32 MultithreadedFogOfWarManager::GetTileIndex(int32 X, int32 Y) const
-{
-	// Ummm I think this is the wrong way round for good cache locality. 
-	// Regular AFogOfWarManager has it round the wrong way too I think
-	return X + Y * MapTileDimensions.X; 
+	WorkerThread->WakeUp();
 }
 
-
-//--------------------------------------------------------------------------------------------
-//============================================================================================
-//	------- Client Thread Class -------
-//============================================================================================
-//--------------------------------------------------------------------------------------------
-
-ClientFogOfWarThread::ClientFogOfWarThread()
+void MultithreadedFogOfWarManager::ProcessSnapshot(const FogFrameSnapshot & Snapshot, FogFrameResult & OutResult) const
 {
-	FRunnableThread::Create(this, TEXT("Fog of war thread"), 0, TPri_BelowNormal);
-}
+	const uint32 TeamsToCompute = Snapshot.TeamsToCompute;
 
-ClientFogOfWarThread::~ClientFogOfWarThread()
-{
-	// Possibly want some stuff here
-}
+	/* Each team writes only to its own tiles array so they can all be done in parallel */
+	ParallelFor(NumTeams, [&](int32 TeamIndex)
+	{
+		if ((TeamsToCompute & (1 << TeamIndex)) == 0)
+		{
+			return;
+		}
 
-bool ClientFogOfWarThread::Init()
-{
-	return true;
-}
+		TArray<EFogStatus> & Tiles = OutResult.TeamTiles[TeamIndex];
+		threadAssert(Tiles.Num() == MapTileDimensions.X * MapTileDimensions.Y);
 
-uint32 ClientFogOfWarThread::Run()
-{	
-	return 0;
-}
+		/* Relies on EFogStatus::Hidden being 0 */
+		FMemory::Memzero(Tiles.GetData(), Tiles.Num() * sizeof(EFogStatus));
 
-void ClientFogOfWarThread::Stop()
-{
-}
+		for (const FogRevealSource & Source : Snapshot.RevealSources[TeamIndex])
+		{
+			RevealTilesAroundLocation(Source.WorldLocation, Source.SightRadius, Source.StealthRevealRadius, Tiles);
+		}
+	}, NumTeams <= 1);
 
-void ClientFogOfWarThread::Exit()
-{
-}
+	OutResult.ComputedTeams = TeamsToCompute;
 
-void ClientFogOfWarThread::ResetTileInfo(uint8 TeamIndex)
-{
-	TArray<EFogStatus> & Tiles = MultithreadedFogOfWarManager::Get().TeamTilesShared[TeamIndex].Array;
-	for (auto & Elem : Tiles)
+	if (TeamsToCompute & (1 << Snapshot.LocalPlayersTeamIndex))
 	{
-		Elem = EFogStatus::Hidden;
+		FillTextureData(OutResult.TeamTiles[Snapshot.LocalPlayersTeamIndex], OutResult);
 	}
-
-	//-----------------------------------------------------------
-	//	Move on to next task
-	//-----------------------------------------------------------
-
-	CalculateTeamVisibilityFromBuildings(TeamIndex, Tiles);
 }
 
-void ClientFogOfWarThread::CalculateTeamVisibilityFromBuildings(uint8 TeamIndex, TArray<EFogStatus> & Tiles)
+void MultithreadedFogOfWarManager::UpdateSelectableVisibility(uint8 TeamIndex, const TArray<EFogStatus> & Tiles, bool bHideAndReveal)
 {
-	MultithreadedFogOfWarManager & FogManager = MultithreadedFogOfWarManager::Get();
-	
-	BuildingFogInfoArray & BuildingsStruct = FogManager.BuildingStatesShared[TeamIndex];
-
-	BuildingsStruct.ArrayLock.Lock();
-
-	/* Buildings are a little more complicated than infantry. Because buildings do not move the 
-	game thread did not have to send the location of the building - we already have it stored 
-	in non-game thread land. For the hell of it we also store the sight radius and stealth reveal 
-	radius on. */
-
-	/* Start off by adding any recently created buildings to the array. Actually the 
-	game thread should do this for us. Actually same with sight/stealth radius too */
-
-	TArray<BuildingFogInfo> & BuildingsArray = BuildingsStruct.Array;
-	DestroyedBuildingArray & RecentlyDestroyedBuildingsStruct = FogManager.DestroyedBuildingsShared[TeamIndex];
+	const ETeam Team = Statics::ArrayIndexToTeam(TeamIndex);
+	FVisibilityInfo & TeamVisibilityInfo = GS->GetTeamVisibilityInfo(Team);
 
-	/* Loop through array and reveal tiles */
-	for (int32 i = BuildingsArray.Num() - 1; i >= 0; --i)
+	for (uint8 i = 0; i < NumTeams; ++i)
 	{
-		BuildingFogInfo & Elem = BuildingsArray[i];
-		
-		if (RecentlyDestroyedBuildingsStruct.WasRecentlyDestroyed(Elem))
+		/* Avoid updating selectables from our own team - they are always revealed */
+		if (i == TeamIndex)
 		{
-			RecentlyDestroyedBuildingsStruct.SetBitToNotRecentlyDestroyed(Elem);
-			
-			/* If it was recently destroyed then remove it from array */
-			BuildingsArray.RemoveAtSwap(i, 1, false);
+			continue;
 		}
-		else
+
+		for (ARTSPlayerState * PlayerState : GS->GetTeams()[i].GetPlayerStates())
 		{
-			FogManager.RevealTilesAroundLocation(Elem.WorldLocation, Elem.SightRadius,
-				Elem.StealthRevealRadius, Tiles);
-		}
-	}
+			if (!Statics::IsValid(PlayerState))
+			{
+				continue;
+			}
 
-	BuildingsStruct.ArrayLock.Unlock();
+			const uint8 OwnerID = PlayerState->GetPlayerIDAsInt();
+			bool * OwnersVisibility = SelectableVisibility[TeamIndex][OwnerID];
 
-	//-----------------------------------------------------------
-	//	Move on to next task
-	//-----------------------------------------------------------
+			for (AInfantry * Unit : PlayerState->GetUnits())
+			{
+				if (Unit->IsInsideGarrison())
+				{
+					/* Skip trying to hide/reveal units inside garrisons */
+					continue;
+				}
 
-	CalculateTeamVisibilityFromInfantry(TeamIndex, Tiles);
-}
+				const EFogStatus TileStatus = GetLocationFogStatus(FVector2D(Unit->GetActorLocation()), Tiles);
 
-void ClientFogOfWarThread::CalculateTeamVisibilityFromInfantry(uint8 TeamIndex, TArray<EFogStatus> & Tiles)
-{
-	InfantryFogInfoArray & InfantryArray = MultithreadedFogOfWarManager::Get().InfantryStatesShared[TeamIndex];
+				bool bCanBeSeen;
+				if (bHideAndReveal)
+				{
+					bCanBeSeen = Unit->UpdateFogStatus(TileStatus);
+				}
+				else
+				{
+					bCanBeSeen = (TileStatus == EFogStatus::StealthRevealed)
+						|| (TileStatus == EFogStatus::Revealed && !Unit->IsInStealthMode());
+				}
 
-	InfantryArray.ArrayLock.Lock();
+				OwnersVisibility[Unit->GetSelectableID()] = bCanBeSeen;
+				if (bIsServer)
+				{
+					TeamVisibilityInfo.SetSelectableVisibility(OwnerID, Unit->GetSelectableID(), bCanBeSeen);
+				}
+			}
 
-	for (const auto & Elem : InfantryArray.Array)
-	{
-		MultithreadedFogOfWarManager::Get().RevealTilesAroundLocation(Elem.WorldLocation, Elem.SightRadius,
-			Elem.StealthRevealRadius, Tiles);
-	}
+			/* Do same for buildings but only pass in Hidden or Revealed.
+			Iterate backwards because removals can happen along the way */
+			const TArray<ABuilding*> & BuildingsArray = PlayerState->GetBuildings();
+			for (int32 j = BuildingsArray.Num() - 1; j >= 0; --j)
+			{
+				ABuilding * Building = BuildingsArray[j];
 
-	/* Do this now otherwise game thread has to do it. */
-	InfantryArray.Array.Reset();
+				if (!Statics::IsValid(Building))
+				{
+					continue;
+				}
 
-	/* This could actually be moved to right under the ArrayLock() call. We just wait on the message
-	from game thread that it has populated array then we can go. The game thread will never
-	try and contend for the lock again until the whole fog process has finished so yeah whatever
-	we'll unlock here though */
-	InfantryArray.ArrayLock.Unlock();
+				bool bCanBeSeen = false;
 
-	//-----------------------------------------------------------
-	//	Move on to next task
-	//-----------------------------------------------------------
+				const TArray<int32> * TileIndices = BuildingTileIndices.Find(Building);
+				if (TileIndices != nullptr)
+				{
+					for (const int32 TilesIndex : *TileIndices)
+					{
+						/* As long as one point can be seen then whole building is considered
+						revealed */
+						if (IsTileVisibleNotChecked(TilesIndex, Tiles))
+						{
+							bCanBeSeen = true;
+							break;
+						}
+					}
+				}
 
-	TickAndCalculateTeamVisibilityFromTemporaryRevealEffects(TeamIndex, Tiles);
+				OwnersVisibility[Building->GetSelectableID()] = bCanBeSeen;
+				if (bIsServer)
+				{
+					TeamVisibilityInfo.SetSelectableVisibility(OwnerID, Building->GetSelectableID(), bCanBeSeen);
+				}
+				if (bHideAndReveal)
+				{
+					Building->UpdateFogStatus(bCanBeSeen ? EFogStatus::Revealed : EFogStatus::Hidden);
+				}
+			}
+		}
+	}
 }
 
-void ClientFogOfWarThread::TickAndCalculateTeamVisibilityFromTemporaryRevealEffects(uint8 TeamIndex, TArray<EFogStatus>& Tiles)
+void MultithreadedFogOfWarManager::HideAndRevealTemporaries(const TArray<EFogStatus> & Tiles)
 {
-	MultithreadedFogOfWarManager & FogManager = MultithreadedFogOfWarManager::Get();
-	TempRevealEffectArray & Struct = FogManager.TemporaryRevealEffectsShared[TeamIndex];
-	
-	Struct.ArrayLock.Lock();
+	/* Here we iterate backwards and remove nulls since they don't remove themselves
+	when they are destroyed */
 
-	const float DeltaTime = FogManager.DeltaTime;
-
-	for (int32 i = Struct.Array.Num() - 1; i >= 0; --i)
+	TArray <AProjectileBase *> & TempFogProjectiles = GS->GetTemporaryFogProjectiles();
+	for (int32 i = TempFogProjectiles.Num() - 1; i >= 0; --i)
 	{
-		FTemporaryFogRevealEffectInfo & Elem = Struct.Array[i];
-
-		float FogRevealRadius, StealthRevealRadius;
-		Elem.Tick(DeltaTime, FogRevealRadius, StealthRevealRadius);
+		AProjectileBase * const Projectile = TempFogProjectiles[i];
 
-		FogManager.RevealTilesAroundLocation(Elem.GetLocation(), FogRevealRadius,
-			StealthRevealRadius, Tiles);
-
-		if (Elem.HasCompleted())
+		if (!Statics::IsValid(Projectile))
 		{
-			Struct.Array.RemoveAtSwap(i, 1, false);
+			TempFogProjectiles.RemoveAtSwap(i, 1, false);
+			continue;
 		}
-	}
-
-	Struct.ArrayLock.Unlock();
 
-	//-----------------------------------------------------------
-	//	Move on to next task
-	//-----------------------------------------------------------
-
-	// Should ALWAYS aquire this lock first time: there should be no other threads running
-	FogManager.ClientIdleThreads.Lock.Lock();
-
-	TArray<ClientFogOfWarThread*> & IdleThreadArray = FogManager.ClientIdleThreads.Array;
-	CalculationProgress & Progress = FogManager.TeamProgress[TeamIndex];
-
-	/* Get a thread to queue render command */
-	if (IdleThreadArray.Num() > 0)
-	{
-		IdleThreadArray.Pop()->QueueRenderFogCommand(TeamIndex, Tiles);
-	}
-
-	/* Tell any other threads (they will all be idle) to start working on storing the 
-	selectable visibility info. */
-	while (IdleThreadArray.Num() > 0 && Progress.NextTeamIndexForStoringSelectableVisibilityInfo < FogManager.NumTeams)
-	{
-		// Skip our own team: they are always visible to us
-		if (Progress.NextTeamIndexForStoringSelectableVisibilityInfo == TeamIndex)
+		/* If any location is revealed we will reveal the projectile just like buildings */
+		TArray <FVector, TInlineAllocator<AProjectileBase::NUM_FOG_LOCATIONS>> Locations;
+		Projectile->GetFogLocations(Locations);
+		bool bCanBeSeen = false;
+		for (const auto & Loc : Locations)
 		{
-			Progress.NextTeamIndexForStoringSelectableVisibilityInfo++;
+			if (IsTileVisibleNotChecked(WorldLocationToTilesIndex(FVector2D(Loc)), Tiles))
+			{
+				bCanBeSeen = true;
+				break;
+			}
 		}
 
-		IdleThreadArray.Pop()->CalculateAndStoreSelectableVisibilityInfo(TeamIndex, Progress.GetNextTeamIndexForStoringSelectableVisibilityInfo(), Tiles);
-	}
-
-	// If there's still idle threads assign one to projectiles
-	if (IdleThreadArray.Num() > 0)
-	{
-		IdleThreadArray.Pop()->CalculateAndStoreProjectileVisibilityInfo(TeamIndex, Tiles);
+		Projectile->SetActorHiddenInGame(!bCanBeSeen);
 	}
 
-	// If there's still idle threads assign one to particle systems
-	if (IdleThreadArray.Num() > 0)
+	TArray <UParticleSystemComponent *> & TempFogParticles = GS->GetTemporaryFogParticles();
+	for (int32 i = TempFogParticles.Num() - 1; i >= 0; --i)
 	{
-		IdleThreadArray.Pop()->CalculateAndStoreParticleSystemVisibilityInfo(TeamIndex, Tiles);
-	}
+		UParticleSystemComponent * const Comp = TempFogParticles[i];
 
-	// If there's still idle threads assign one to inventory items
-	if (IdleThreadArray.Num() > 0)
-	{
-		IdleThreadArray.Pop()->CalculateAndStoreInventoryItemVisibilityInfo(TeamIndex, Tiles);
-	}
+		if (!Statics::IsValid(Comp))
+		{
+			TempFogParticles.RemoveAtSwap(i, 1, false);
+			continue;
+		}
 
-	FogManager.ClientIdleThreads.Lock.Unlock();
+		const bool bCanBeSeen = IsTileVisibleNotChecked(WorldLocationToTilesIndex(FVector2D(Comp->GetComponentLocation())), Tiles);
 
-	// Now this thread will store tile visibility info
-	StoreTileVisibilityInfo(TeamIndex, Tiles);
+		Comp->SetHiddenInGame(!bCanBeSeen);
+	}
 }
 
-// Perhaps do this right before/after the enqueue render command because cache will be 
-// fresh with tiles array
-void ClientFogOfWarThread::StoreTileVisibilityInfo(uint8 TeamIndex, const TArray<EFogStatus> & Tiles)
+void MultithreadedFogOfWarManager::UpdateInventoryItemVisibility(uint8 TeamIndex, const TArray<EFogStatus> & Tiles, bool bHideAndReveal)
 {
-	MultithreadedFogOfWarManager & FogManager = MultithreadedFogOfWarManager::Get();
-
-	// Copy tiles array from here into
-	FogManager.TilesArrays[TeamIndex].Lock.Lock();
-	
-	// Just a thought: could we perhaps get away with using the same array for all teams by 
-	// like packing the bits into certain places hmmm... we need at least 2 bits for each 
-	// tile per team so the array could store uint16, this would allow for up to 8 teams. 
-	// Don't need to do it for clients though - just something server can consider
-
-	// Game thread could be waiting on us - be quick
-	// Some examples of when gamethread might we wanting to access the tiles array: 
-	// - an ability wants to know whether a location is inside fog
-	FMemory::Memcpy(&FogManager.TilesArrays[TeamIndex].Array, &FogManager.TeamTilesShared[TeamIndex].Array, FogManager.TilesArrays[TeamIndex].Array.Num());
-
-	FogManager.TilesArrays[TeamIndex].Lock.Unlock();
-
-	//-----------------------------------------------------------
-	//	Move on to next task
-	//-----------------------------------------------------------
-
-	FogManager.ClientIdleThreads.Lock.Lock(); 
-
-	/* Make sure this function automatically skips over our own team and checks whether 
-	all teams have been done */
-	const EMulthreadedFogTask NextTask = FogManager.TeamProgress[TeamIndex].GetNextTask();
+	FVisibilityInfo & TeamVisibilityInfo = GS->GetTeamVisibilityInfo(Statics::ArrayIndexToTeam(TeamIndex));
 
-	switch (NextTask)
+	for (const auto & ItemActor : GS->GetInventoryItemsInWorld())
 	{
-		// Finished is code for 'all done'
-		case EMulthreadedFogTask::Finished:
-		{
-			// Go idle
-			FogManager.ClientIdleThreads.Array.Emplace(this);
-			FogManager.ClientIdleThreads.Lock.Unlock();
-			break;
-		}
-	
-		case EMulthreadedFogTask::QueueUpRenderingFogOfWar:
-		{
-			FogManager.TeamProgress[TeamIndex].AdvanceNextTask(TeamIndex, FogManager);
-			FogManager.ClientIdleThreads.Lock.Unlock();
-
-			QueueRenderFogCommand(TeamIndex, Tiles);
-			break;
-		}
+		const bool bCanBeSeen = IsTileVisibleNotChecked(WorldLocationToTilesIndex(FVector2D(ItemActor->GetActorLocation())), Tiles);
 
-		case EMulthreadedFogTask::StoreHostileTeamSelectableVisibility:
+		if (bIsServer)
 		{
-			const uint8 EnemyTeamIndex = FogManager.TeamProgress[TeamIndex].GetNextTeamIndexForStoringSelectableVisibilityInfo();
-			
-			FogManager.TeamProgress[TeamIndex].AdvanceNextTask(TeamIndex, FogManager);
-			FogManager.ClientIdleThreads.Lock.Unlock();
-
-			CalculateAndStoreSelectableVisibilityInfo(TeamIndex, EnemyTeamIndex, Tiles);
-			break;
+			TeamVisibilityInfo.SetVisibility(ItemActor, bCanBeSeen);
 		}
-
-		case EMulthreadedFogTask::StoreProjectilesVisibility:
+		if (bHideAndReveal)
 		{
-			FogManager.TeamProgress[TeamIndex].AdvanceNextTask(TeamIndex, FogManager);
-			FogManager.ClientIdleThreads.Lock.Unlock();
-			
-			CalculateAndStoreProjectileVisibilityInfo(TeamIndex, Tiles);
-			break;
+			ItemActor->SetVisibilityFromFogManager(bCanBeSeen);
 		}
+	}
+}
 
-		case EMulthreadedFogTask::StoreParticleSystemsVisibility:
-		{
-			FogManager.TeamProgress[TeamIndex].AdvanceNextTask(TeamIndex, FogManager);
-			FogManager.ClientIdleThreads.Lock.Unlock();
-			
-			CalculateAndStoreParticleSystemVisibilityInfo(TeamIndex, Tiles);
-			break;
-		}
+void MultithreadedFogOfWarManager::MuteAndUnmuteAudio(const TArray<EFogStatus> & Tiles)
+{
+	for (const auto & AudioComp : GS->FogSoundsContainer_Dynamic.GetArray())
+	{
+		const bool bOutsideFog = IsTileVisibleNotChecked(WorldLocationToTilesIndex(FVector2D(AudioComp->GetComponentLocation())), Tiles);
 
-		case EMulthreadedFogTask::StoreInventoryItemVisibility:
+		if (AudioComp->IsMuted() == bOutsideFog)
 		{
-			FogManager.TeamProgress[TeamIndex].AdvanceNextTask(TeamIndex, FogManager);
-			FogManager.ClientIdleThreads.Lock.Unlock();
-			
-			CalculateAndStoreInventoryItemVisibilityInfo(TeamIndex, Tiles);
-			break;
+			if (bOutsideFog)
+			{
+				AudioComp->OnExitFogOfWar_Dynamic(GS);
+			}
+			else
+			{
+				AudioComp->OnEnterFogOfWar_Dynamic(GS);
+			}
 		}
+	}
 
-		default:
+	for (int32 i = GS->FogSoundsContainer_AlwaysKnownOnceHeard.Num() - 1; i >= 0; --i)
+	{
+		UFogObeyingAudioComponent * AudioComp = GS->FogSoundsContainer_AlwaysKnownOnceHeard.GetArray()[i];
+
+		if (IsTileVisibleNotChecked(WorldLocationToTilesIndex(FVector2D(AudioComp->GetComponentLocation())), Tiles))
 		{
-			// Should not have got here
-			threadAssert(0);
-#if !UE_BUILD_SHIPPING
-			FogManager.ClientIdleThreads.Lock.Unlock();
-#endif
-			break;
+			AudioComp->OnExitFogOfWar_AlwaysKnownOnceHeard(GS);
 		}
 	}
-}
 
-void ClientFogOfWarThread::QueueRenderFogCommand(uint8 TeamIndex, const TArray<EFogStatus> & Tiles)
-{
-	//--------------------------------------------------------
-	//	Fill texture buffer
-	//--------------------------------------------------------
-
-	MultithreadedFogOfWarManager & FogManager = MultithreadedFogOfWarManager::Get();
-
-	uint8 * TextureBuffer = FogManager.TextureBuffer;
-	const int32 TileDimensions_X = FogManager.MapTileDimensions.X;
-	const int32 TileDimensions_Y = FogManager.MapTileDimensions.Y;
-	
-	for (int32 Y = 0; Y < TileDimensions_Y; ++Y)
+	for (const auto & AudioComp : GS->FogSoundsContainer_DynamicExceptForInstigatorsTeam.GetArray())
 	{
-		for (int32 X = 0; X < TileDimensions_X; ++X)
-		{
-			const int32 Index = FogManager.GetTileIndex(X, Y);
+		const bool bOutsideFog = IsTileVisibleNotChecked(WorldLocationToTilesIndex(FVector2D(AudioComp->GetComponentLocation())), Tiles);
 
-			if (static_cast<uint8>(Tiles[Index]) & 0x01) /* Translation: if tile revealed */
+		if (AudioComp->IsMuted() == bOutsideFog)
+		{
+			if (bOutsideFog)
 			{
-				TextureBuffer[Index * 4] = 0;
-				TextureBuffer[Index * 4 + 1] = 0;
-				TextureBuffer[Index * 4 + 2] = 255;
-				TextureBuffer[Index * 4 + 3] = 0;
+				AudioComp->OnExitFogOfWar_DynamicExceptForInstigatorsTeam(GS);
 			}
 			else
 			{
-				TextureBuffer[Index * 4] = 0;
-				TextureBuffer[Index * 4 + 1] = 255;
-				TextureBuffer[Index * 4 + 2] = 0;
-				TextureBuffer[Index * 4 + 3] = 0;
+				AudioComp->OnEnterFogOfWar_DynamicExceptForInstigatorsTeam(GS);
 			}
 		}
 	}
+}
 
-	//------------------------------------------------------
-	//	Queue render command
-	//------------------------------------------------------
-
-	/* This *may* need to be queued from the game thread instead of a fog thread. Commenting 
-	it out for now because I get crashes with it (which may possibly be because of what I 
-	just stated) */
-
-	//struct FUpdateTextureRegionsData
-	//{
-	//	FTexture2DResource * Texture2DResource;
-	//	int32 MipIndex;
-	//	uint32 NumRegions;
-	//	FUpdateTextureRegion2D * Regions;
-	//	uint32 SrcPitch;
-	//	uint32 SrcBpp;
-	//	uint8 * SrcData;
-	//};
-	//
-	//FUpdateTextureRegionsData * RegionData = new FUpdateTextureRegionsData;
-	//
-	//RegionData->Texture2DResource = (FTexture2DResource*)FogManager->FogTexture->Resource;
-	//RegionData->MipIndex = 0;
-	//RegionData->NumRegions = 1;
-	//RegionData->Regions = FogManager->TextureRegions;
-	//RegionData->SrcPitch = FogManager->MapTileDimensions.X * 4;
-	//RegionData->SrcBpp = (uint32)4;
-	//RegionData->SrcData = TextureBuffer;
-	//const bool bFreeData = false;
-	//
-	//ENQUEUE_UNIQUE_RENDER_COMMAND_TWOPARAMETER(
-	//	UpdateTextureRegionsData,
-	//	FUpdateTextureRegionsData*, RegionData, RegionData,
-	//	bool, bFreeData, bFreeData,
-	//	{
-	//		for (uint32 RegionIndex = 0; RegionIndex < RegionData->NumRegions; ++RegionIndex)
-	//		{
-	//			int32 CurrentFirstMip = RegionData->Texture2DResource->GetCurrentFirstMip();
-	//			if (RegionData->MipIndex >= CurrentFirstMip)
-	//			{
-	//				RHIUpdateTexture2D(
-	//					RegionData->Texture2DResource->GetTexture2DRHI(),
-	//					RegionData->MipIndex - CurrentFirstMip,
-	//					RegionData->Regions[RegionIndex],
-	//					RegionData->SrcPitch,
-	//					RegionData->SrcData
-	//					+ RegionData->Regions[RegionIndex].SrcY * RegionData->SrcPitch
-	//					+ RegionData->Regions[RegionIndex].SrcX * RegionData->SrcBpp
-	//				);
-	//			}
-	//		}
-	//if (bFreeData)
-	//{
-	//	FMemory::Free(RegionData->Regions);
-	//	FMemory::Free(RegionData->SrcData);
-	//}
-	//delete RegionData;
-	//	});
-	//
-	// Does this need to happen every frame or just once? Try it out
-	//static const FName VisMaskFName = FName("VisibilityMask");
-	//FogManager->FogOfWarMaterialInstance->SetTextureParameterValue(VisMaskFName, FogManager->FogTexture);
-
-	//-----------------------------------------------------------
-	//	Move on to next task
-	//-----------------------------------------------------------
+void MultithreadedFogOfWarManager::RenderFogOfWar(const FogFrameResult & Result)
+{
+	/* Currently fog of war volume needs have equal width and length (or at least have the same
+	amount of tiles for width and length) */
+	assert(MapTileDimensions.X == MapTileDimensions.Y);
+	assert(FogTexture != nullptr && FogTexture->Resource != nullptr);
 
-	/* Help with storing selectable visibility info */
-	// Check if any teams are not being done
+	/* Copy the data. The result buffer will go back to the fog thread once we acquire a newer
+	one which could be before the render thread gets around to using it */
+	const int32 NumBytes = Result.TextureData.Num();
+	uint8 * SrcData = static_cast<uint8*>(FMemory::Malloc(NumBytes));
+	FMemory::Memcpy(SrcData, Result.TextureData.GetData(), NumBytes);
 
-	// If all teams are already being done then we can go idle
+	FTexture2DResource * Texture2DResource = static_cast<FTexture2DResource*>(FogTexture->Resource);
+	const FUpdateTextureRegion2D Region = FUpdateTextureRegion2D(0, 0, 0, 0, MapTileDimensions.X, MapTileDimensions.Y);
+	const uint32 SrcPitch = MapTileDimensions.X * 4;
 
-	FogManager.ClientIdleThreads.Lock.Lock();
+	ENQUEUE_RENDER_COMMAND(UpdateFogTextureRegion)(
+		[Texture2DResource, Region, SrcPitch, SrcData](FRHICommandListImmediate & RHICmdList)
+		{
+			const int32 MipIndex = 0;
+			const int32 CurrentFirstMip = Texture2DResource->GetCurrentFirstMip();
+			if (MipIndex >= CurrentFirstMip)
+			{
+				RHIUpdateTexture2D(Texture2DResource->GetTexture2DRHI(), MipIndex - CurrentFirstMip,
+					Region, SrcPitch, SrcData);
+			}
+			FMemory::Free(SrcData);
+		});
+}
 
-	// Should I aquire another lock here?
-	const EMulthreadedFogTask NextTask = FogManager.TeamProgress[TeamIndex].GetNextTask();
+void MultithreadedFogOfWarManager::FillTextureData(const TArray<EFogStatus> & Tiles, FogFrameResult & Result) const
+{
+	uint8 * TextureBuffer = Result.TextureData.GetData();
+	const int32 NumTiles = Tiles.Num();
 
-	switch (NextTask)
+	for (int32 Index = 0; Index < NumTiles; ++Index)
 	{
-		// Finished is code for 'all done'
-		case EMulthreadedFogTask::Finished:
-		{
-			// Go idle
-			FogManager.ClientIdleThreads.Array.Emplace(this);
-			FogManager.ClientIdleThreads.Lock.Unlock();
-			break;
-		}
+		const uint8 bRevealed = static_cast<uint8>(Tiles[Index]) & 0x01;
 
-		case EMulthreadedFogTask::StoreHostileTeamSelectableVisibility:
-		{
-			const uint8 EnemyTeamIndex = FogManager.TeamProgress[TeamIndex].GetNextTeamIndexForStoringSelectableVisibilityInfo();
+		TextureBuffer[Index * 4] = 0;
+		TextureBuffer[Index * 4 + 1] = bRevealed ? 0 : 255;
+		TextureBuffer[Index * 4 + 2] = bRevealed ? 255 : 0;
+		TextureBuffer[Index * 4 + 3] = 0;
+	}
+}
 
-			FogManager.TeamProgress[TeamIndex].AdvanceNextTask(TeamIndex, FogManager);
-			FogManager.ClientIdleThreads.Lock.Unlock();
+void MultithreadedFogOfWarManager::AddRecentlyCreatedBuilding(ABuilding * Building)
+{
+	TArray<int32> & TileIndices = BuildingTileIndices.Emplace(Building);
+	TileIndices.Reserve(Building->GetFogLocations().Num());
 
-			CalculateAndStoreSelectableVisibilityInfo(TeamIndex, EnemyTeamIndex, Tiles);
-			break;
-		}
+	const FVector BuildingLocation = Building->GetActorLocation();
+	const FRotator BuildingRotation = Building->GetActorRotation();
 
-		case EMulthreadedFogTask::StoreProjectilesVisibility:
-		{
-			FogManager.TeamProgress[TeamIndex].AdvanceNextTask(TeamIndex, FogManager);
-			FogManager.ClientIdleThreads.Lock.Unlock();
+	// Calculate and store each grid location building occupies
+	for (const FVector2D & Elem : Building->GetFogLocations())
+	{
+		// Apply buildings rotation and location
+		FVector2D Loc = Elem.GetRotated(BuildingRotation.Yaw);
+		Loc += FVector2D(BuildingLocation.X, BuildingLocation.Y);
 
-			CalculateAndStoreProjectileVisibilityInfo(TeamIndex, Tiles);
-			break;
-		}
+		TileIndices.Emplace(WorldLocationToTilesIndex(Loc));
+	}
+}
 
-		case EMulthreadedFogTask::StoreParticleSystemsVisibility:
-		{
-			FogManager.TeamProgress[TeamIndex].AdvanceNextTask(TeamIndex, FogManager);
-			FogManager.ClientIdleThreads.Lock.Unlock();
+void MultithreadedFogOfWarManager::OnBuildingDestroyed(ABuilding * Building)
+{
+	BuildingTileIndices.Remove(Building);
+}
 
-			CalculateAndStoreParticleSystemVisibilityInfo(TeamIndex, Tiles);
-			break;
-		}
+void MultithreadedFogOfWarManager::RegisterTeamTemporaryRevealEffect(const FTemporaryFogRevealEffectInfo & Effect, FVector2D WorldLocation, ETeam Team)
+{
+	const int32 Index = Statics::TeamToArrayIndex(Team);
+	TeamTempRevealEffects[Index].Emplace(FTemporaryFogRevealEffectInfo(Effect, WorldLocation));
+}
 
-		case EMulthreadedFogTask::StoreInventoryItemVisibility:
-		{
-			FogManager.TeamProgress[TeamIndex].AdvanceNextTask(TeamIndex, FogManager);
-			FogManager.ClientIdleThreads.Lock.Unlock();
+void MultithreadedFogOfWarManager::RevealTilesAroundLocation(const FVector2D & Location, float SightRadius, float StealthRevealRadius, TArray<EFogStatus>& Tiles) const
+{
+	const int32 SightRadiusInTiles = FMath::FloorToInt(SightRadius / FogOfWarOptions::FOG_TILE_SIZE);
+	/* Stealth reveal only counts on revealed tiles so clamping it to sight radius means 
+	EFogStatus::StealthDetected never gets written */
+	const int32 StealthSightRadiusInTiles = FMath::Min(SightRadiusInTiles, 
+		FMath::FloorToInt(StealthRevealRadius / FogOfWarOptions::FOG_TILE_SIZE));
+
+	const FIntPoint TileLocation = GetFogGridCoords(Location);
+	const FFogCircleStampCache & Stamps = FFogCircleStampCache::Get();
+	EFogStatus * TilesData = Tiles.GetData();
 
-			CalculateAndStoreInventoryItemVisibilityInfo(TeamIndex, Tiles);
-			break;
+	Stamps.ForEachSpan(TileLocation, SightRadiusInTiles, MapTileDimensions, [TilesData](int32 First, int32 Last)
+	{
+		for (int32 i = First; i <= Last; ++i)
+		{
+			TilesData[i] = BitwiseOrOperator(TilesData[i], EFogStatus::Revealed);
 		}
+	});
 
-		default:
+	Stamps.ForEachSpan(TileLocation, StealthSightRadiusInTiles, MapTileDimensions, [TilesData](int32 First, int32 Last)
+	{
+		for (int32 i = First; i <= Last; ++i)
 		{
-			// Should not have got here
-			threadAssert(0);
-#if !UE_BUILD_SHIPPING
-			FogManager.ClientIdleThreads.Lock.Unlock();
-#endif
-			break;
+			TilesData[i] = EFogStatus::StealthRevealed;
 		}
-	}
+	});
 }
 
-void ClientFogOfWarThread::CalculateAndStoreSelectableVisibilityInfo(uint8 TeamWithVisionIndex, uint8 OtherTeamIndex, const TArray<EFogStatus> & Tiles)
+EFogStatus MultithreadedFogOfWarManager::GetLocationFogStatus(const FVector2D & Location, const TArray<EFogStatus>& Tiles) const
 {
-	MultithreadedFogOfWarManager & FogManager = MultithreadedFogOfWarManager::Get();
-	
-	TArray<InfantryFogInfoBasic> & InfantryArray = FogManager.InfantryStatesBasicShared[OtherTeamIndex].Array;
-	
-	for (auto & Elem : InfantryArray)
-	{
-		Elem.FogStatus = FogManager.GetLocationFogStatus(Elem.WorldLocation, Tiles);
-	}
+	const int32 TileIndex = WorldLocationToTilesIndex(Location);
+	return Tiles.IsValidIndex(TileIndex) ? Tiles[TileIndex] : EFogStatus::Hidden;
+}
+
+int32 MultithreadedFogOfWarManager::WorldLocationToTilesIndex(const FVector2D & WorldLocation) const
+{
+	const FIntPoint Loc = GetFogGridCoords(WorldLocation);
 
-	// Now transfer the data to a container the game thread will access
-	FogManager.TeamVisibilityInfo[TeamWithVisionIndex][OtherTeamIndex].ArrayLock.Lock();
-	for (const auto & Elem : InfantryArray)
+	/* Return an invalid index for anything off the grid. Without this a location just off the
+	left/right edge would wrap around to the row above/below */
+	if (Loc.X < 0 || Loc.Y < 0 || Loc.X >= MapTileDimensions.X || Loc.Y >= MapTileDimensions.Y)
 	{
-		FogManager.TeamVisibilityInfo[TeamWithVisionIndex][OtherTeamIndex].Array[Elem.SelectableID] = Elem.FogStatus;
+		return INDEX_NONE;
 	}
-	FogManager.TeamVisibilityInfo[TeamWithVisionIndex][OtherTeamIndex].ArrayLock.Unlock();
 
-	InfantryArray.Reset();
+	return GetTileIndex(Loc.X, Loc.Y);
+}
 
-	// Now do buildings too
-	
-	// We might need to process the building updates such as new/destroyed and sight radius changes first
+FIntPoint MultithreadedFogOfWarManager::GetFogGridCoords(const FVector & WorldLocation) const
+{
+	return GetFogGridCoords(FVector2D(WorldLocation));
+}
 
-	TArray<BuildingFogInfo> & HostileBuildings = FogManager.BuildingStatesShared[OtherTeamIndex].Array;
+FIntPoint MultithreadedFogOfWarManager::GetFogGridCoords(const FVector2D & WorldLocation) const
+{
+	FVector2D Vector = WorldLocation - MapCenter;
+	Vector *= MapDimensionsInverse;
+	Vector += FVector2D(0.5f, 0.5f);
+	Vector *= MapTileDimensions;
 
-	for (auto & Elem : HostileBuildings)
-	{
-		const TArray<int32> & BuildingLocations = Elem.FogLocationsIndices;
-		bool bFoundVisibleTile = false;
+	const FIntPoint TileCoords = FIntPoint(FMath::FloorToInt(Vector.X),
+		FMath::FloorToInt(Vector.Y));
 
-		/* Buildings can be present at multiple locations. Have to check each one. If at least 
-		one tile is visible we'll say that the building is visible */
-		for (int32 i = 0; i < BuildingLocations.Num(); ++i)
-		{
-			const EFogStatus TileStatus = Tiles[BuildingLocations[i]];
-			/* We treat Revealed and StealthRevealed as the same thing since buildings cannot 
-			go stealth */
-			if (TileStatus == EFogStatus::Revealed || TileStatus == EFogStatus::StealthRevealed)
-			{
-				Elem.FogStatus = EFogStatus::Revealed;
-				bFoundVisibleTile = true;
-				break;
-			}
-		}
+	return TileCoords;
+}
 
-		if (!bFoundVisibleTile)
-		{
-			Elem.FogStatus = EFogStatus::Hidden;
-		}
-	}
+bool MultithreadedFogOfWarManager::IsTileVisibleNotChecked(int32 TileIndex, const TArray<EFogStatus> & Tiles)
+{
+	return Tiles.IsValidIndex(TileIndex) && (static_cast<uint8>(Tiles[TileIndex]) & 0x01);
+}
 
-	// Now transfer the data to a container the game thread will access
-	FogManager.TeamVisibilityInfo[TeamWithVisionIndex][OtherTeamIndex].ArrayLock.Lock();
-	for (const auto & Elem : HostileBuildings)
-	{
-		FogManager.TeamVisibilityInfo[TeamWithVisionIndex][OtherTeamIndex].Array[Elem.SelectableID] = Elem.FogStatus;
-	}
-	FogManager.TeamVisibilityInfo[TeamWithVisionIndex][OtherTeamIndex].ArrayLock.Unlock();
+EFogStatus MultithreadedFogOfWarManager::BitwiseOrOperator(const EFogStatus & Enum1, const EFogStatus & Enum2)
+{
+	return static_cast<EFogStatus>(static_cast<uint8>(Enum1) | static_cast<uint8>(Enum2));
+}
 
-	//-----------------------------------------------------------
-	//	Move on to next task
-	//-----------------------------------------------------------
+EFogStatus MultithreadedFogOfWarManager::BitwiseOrOperator(const EFogStatus & Enum1, const uint8 & Enum2AsInt)
+{
+	return static_cast<EFogStatus>(static_cast<uint8>(Enum1) | Enum2AsInt);
+}
+
+const TArray<EFogStatus> & MultithreadedFogOfWarManager::GetTeamTiles(uint8 TeamIndex) const
+{
+	/* The consumer buffer only ever changes inside Results.Acquire() which happens on the
+	game thread, so this is safe to read without locking */
+	return Results.GetConsumerBuffer().TeamTiles[TeamIndex];
+}
+
+bool MultithreadedFogOfWarManager::IsLocationLocallyVisible(const FVector & Location) const
+{
+	const TArray<EFogStatus> & Tiles = GetTeamTiles(LocalPlayersTeamIndex);
+	const int32 TilesIndex = WorldLocationToTilesIndex(FVector2D(Location));
+	assert(Tiles.IsValidIndex(TilesIndex));
+	return static_cast<uint8>(Tiles[TilesIndex]) & 0x01;
+}
+
+bool MultithreadedFogOfWarManager::IsLocationLocallyVisibleNotChecked(const FVector & Location) const
+{
+	return IsTileVisibleNotChecked(WorldLocationToTilesIndex(FVector2D(Location)), GetTeamTiles(LocalPlayersTeamIndex));
+}
 
-	FogManager.ClientIdleThreads.Lock.Lock();
+bool MultithreadedFogOfWarManager::IsLocationVisibleNotChecked(const FVector & Location, ETeam Team) const
+{
+	const uint8 TeamIndex = Statics::TeamToArrayIndex(Team);
+	return IsTileVisibleNotChecked(WorldLocationToTilesIndex(FVector2D(Location)), GetTeamTiles(TeamIndex));
+}
+
+EFogStatus MultithreadedFogOfWarManager::GetLocationVisibilityStatusLocally(const FVector & Location) const
+{
+	const TArray<EFogStatus> & Tiles = GetTeamTiles(LocalPlayersTeamIndex);
+	const int32 TilesIndex = WorldLocationToTilesIndex(FVector2D(Location));
+	assert(Tiles.IsValidIndex(TilesIndex));
+	return Tiles[TilesIndex];
+}
+
+EFogStatus MultithreadedFogOfWarManager::GetLocationVisibilityStatusLocallyNotChecked(const FVector & Location) const
+{
+	return GetLocationFogStatus(FVector2D(Location), GetTeamTiles(LocalPlayersTeamIndex));
+}
 
-	// Should I aquire another lock here?
-	const EMulthreadedFogTask NextTask = FogManager.TeamProgress[TeamWithVisionIndex].GetNextTask();
+bool MultithreadedFogOfWarManager::IsSelectableOutsideFog(const ISelectable * Selectable, ETeam Team) const
+{
+	const int32 CheckingTeamIndex = Statics::TeamToArrayIndex(Team);
 
-	switch (NextTask)
+	// Selectables on our own team are always outside fog
+	if (Selectable->GetTeamIndex() == CheckingTeamIndex)
 	{
-		// Finished is code for 'all done'
-		case EMulthreadedFogTask::Finished:
-		{
-			// Go idle
-			FogManager.ClientIdleThreads.Array.Emplace(this);
-			FogManager.ClientIdleThreads.Lock.Unlock();
-			break;
-		}
+		return true;
+	}
 
-		case EMulthreadedFogTask::StoreHostileTeamSelectableVisibility:
-		{
-			const uint8 EnemyTeamIndex = FogManager.TeamProgress[TeamWithVisionIndex].GetNextTeamIndexForStoringSelectableVisibilityInfo();
+	return SelectableVisibility[CheckingTeamIndex][Selectable->GetOwnersID()][Selectable->GetSelectableID()];
+}
 
-			FogManager.TeamProgress[TeamWithVisionIndex].AdvanceNextTask(TeamWithVisionIndex, FogManager);
-			FogManager.ClientIdleThreads.Lock.Unlock();
+int32 MultithreadedFogOfWarManager::GetTileIndex(int32 X, int32 Y) const
+{
+	return X + Y * MapTileDimensions.X;
+}
 
-			CalculateAndStoreSelectableVisibilityInfo(TeamWithVisionIndex, EnemyTeamIndex, Tiles);
-			break;
-		}
 
-		case EMulthreadedFogTask::StoreProjectilesVisibility:
-		{
-			FogManager.TeamProgress[TeamWithVisionIndex].AdvanceNextTask(TeamWithVisionIndex, FogManager);
-			FogManager.ClientIdleThreads.Lock.Unlock();
+//--------------------------------------------------------------------------------------------
+//============================================================================================
+//	------- Thread Class -------
+//============================================================================================
+//--------------------------------------------------------------------------------------------
 
-			CalculateAndStoreProjectileVisibilityInfo(TeamWithVisionIndex, Tiles);
-			break;
-		}
+FogOfWarThread::FogOfWarThread()
+	: Thread(nullptr)
+	, WorkAvailableEvent(FPlatformProcess::GetSynchEventFromPool(false))
+	, bStopRequested(false)
+{
+	Thread = FRunnableThread::Create(this, TEXT("Fog of war thread"), 0, TPri_BelowNormal);
+}
 
-		case EMulthreadedFogTask::StoreParticleSystemsVisibility:
-		{
-			FogManager.TeamProgress[TeamWithVisionIndex].AdvanceNextTask(TeamWithVisionIndex, FogManager);
-			FogManager.ClientIdleThreads.Lock.Unlock();
+FogOfWarThread::~FogOfWarThread()
+{
+	/* StopAndWait should have been called before deleting */
+	assert(Thread == nullptr);
 
-			CalculateAndStoreParticleSystemVisibilityInfo(TeamWithVisionIndex, Tiles);
-			break;
-		}
+	FPlatformProcess::ReturnSynchEventToPool(WorkAvailableEvent);
+	WorkAvailableEvent = nullptr;
+}
 
-		case EMulthreadedFogTask::StoreInventoryItemVisibility:
-		{
-			FogManager.TeamProgress[TeamWithVisionIndex].AdvanceNextTask(TeamWithVisionIndex, FogManager);
-			FogManager.ClientIdleThreads.Lock.Unlock();
+bool FogOfWarThread::Init()
+{
+	return true;
+}
 
-			CalculateAndStoreInventoryItemVisibilityInfo(TeamWithVisionIndex, Tiles);
-			break;
-		}
+uint32 FogOfWarThread::Run()
+{
+	MultithreadedFogOfWarManager & FogManager = MultithreadedFogOfWarManager::Get();
+
+	while (!bStopRequested)
+	{
+		WorkAvailableEvent->Wait();
 
-		default:
+		/* Keep going while the game thread has published snapshots we have not seen. If the
+		game thread published several while we were busy then Acquire just gives us the newest */
+		while (!bStopRequested && FogManager.Snapshots.Acquire())
 		{
-		// Should not have got here
-		threadAssert(0);
-		break;
+			FogManager.ProcessSnapshot(FogManager.Snapshots.GetConsumerBuffer(), FogManager.Results.GetProducerBuffer());
+			FogManager.Results.Publish();
 		}
 	}
+
+	return 0;
 }
 
-void ClientFogOfWarThread::CalculateAndStoreProjectileVisibilityInfo(uint8 TeamIndex, const TArray<EFogStatus>& Tiles)
+void FogOfWarThread::Stop()
 {
+	bStopRequested = true;
+	WorkAvailableEvent->Trigger();
 }
 
-void ClientFogOfWarThread::CalculateAndStoreParticleSystemVisibilityInfo(uint8 TeamIndex, const TArray<EFogStatus>& Tiles)
+void FogOfWarThread::Exit()
 {
 }
 
-void ClientFogOfWarThread::CalculateAndStoreInventoryItemVisibilityInfo(uint8 TeamIndex, const TArray<EFogStatus>& Tiles)
+void FogOfWarThread::WakeUp()
 {
+	WorkAvailableEvent->Trigger();
 }
 
-void CalculationProgress::AdvanceNextTask(uint8 TeamIndex, MultithreadedFogOfWarManager & FogManager)
+void FogOfWarThread::StopAndWait()
 {
-	if (NextTask == EMulthreadedFogTask::StoreHostileTeamSelectableVisibility)
-	{
-		NextTeamIndexForStoringSelectableVisibilityInfo++;
-		if (NextTeamIndexForStoringSelectableVisibilityInfo == FogManager.NumTeams)
-		{
-			NextTask = EMulthreadedFogTask::StoreProjectilesVisibility;
-		}
-		else if (NextTeamIndexForStoringSelectableVisibilityInfo == TeamIndex)
-		{
-			NextTeamIndexForStoringSelectableVisibilityInfo++;
-			if (NextTeamIndexForStoringSelectableVisibilityInfo == FogManager.NumTeams)
-			{
-				NextTask = EMulthreadedFogTask::StoreProjectilesVisibility;
-			}
-		}
-	}
-	else
+	if (Thread != nullptr)
 	{
-		NextTask = static_cast<EMulthreadedFogTask>(static_cast<uint8>(NextTask) << 1);
+		/* Kill calls Stop() for us */
+		Thread->Kill(true);
+		delete Thread;
+		Thread = nullptr;
 	}
 }
 
@@ -4,15 +4,14 @@
 
 #if MULTITHREADED_FOG_OF_WAR
 
-#include "CoreMinimal.h" 
+#include "CoreMinimal.h"
+#include "Templates/Atomic.h"
 
 #include "Statics/Structs/Structs_6.h"
 
 class AInfantry;
 class ABuilding;
-class MultithreadedFogOfWarManager;
-class ServerFogOfWarThread;
-class ClientFogOfWarThread;
+enum class EFogStatus : uint8;
 
 //--------------------------------------------------------------------------------------------
 //============================================================================================
@@ -20,241 +19,150 @@ class ClientFogOfWarThread;
 //============================================================================================
 //--------------------------------------------------------------------------------------------
 
-enum class EMulthreadedFogTask : uint32
-{
-	ResetTiles										= 1 << 0,
-	RevealTilesFromBuildings						= 1 << 1,
-	RevealTilesFromInfantry							= 1 << 2,
-	TickAndRevealTilesFromTemporaryRevealEffects	= 1 << 3,
-	StoreTileVisibility								= 1 << 4,
-	QueueUpRenderingFogOfWar						= 1 << 5,
-	StoreHostileTeamSelectableVisibility			= 1 << 6,
-	StoreProjectilesVisibility						= 1 << 7,
-	StoreParticleSystemsVisibility					= 1 << 8,
-	StoreInventoryItemVisibility					= 1 << 9,
-	Finished										= 1 << 10
-};
-
-
-/* Wrapper for what I will use as a lock for critical sections */
-struct FogLock
-{
-	FCriticalSection LockObject;
-
-	void Lock() { LockObject.Lock(); }
-	bool TryLock() { return LockObject.TryLock(); }
-	void Unlock() { LockObject.Unlock(); }
-};
-
-
-struct CalculationProgress
-{
-	/* Lock to access the data in this struct */
-	FogLock Lock;
-
-	/* What the next thread to finish its task should work on next */
-	EMulthreadedFogTask NextTask;
-
-	uint8 NextTeamIndexForStoringSelectableVisibilityInfo;
-
-	CalculationProgress()
-		: NextTask(EMulthreadedFogTask::Finished) 
-		, NextTeamIndexForStoringSelectableVisibilityInfo(0)
+/**
+ *	Lock free single producer single consumer triple buffer.
+ *
+ *	The producer always has a buffer it can write to and the consumer always has a buffer
+ *	it can read from. Neither ever waits on the other. When the producer publishes, its
+ *	buffer is swapped with the 'ready' slot. When the consumer acquires, its buffer is
+ *	swapped with the ready slot if the ready slot holds something newer than what it has.
+ *	If the producer publishes more than once before the consumer acquires then the older
+ *	data is simply overwritten i.e. the newest entry always wins, which is what we want for
+ *	fog since nobody cares about a stale frame.
+ *
+ *	It is essentially a ring buffer with 3 slots.
+ */
+template <typename T>
+class TFogTripleBuffer
+{
+public:
+
+	TFogTripleBuffer()
+		: ProducerIndex(0)
+		, ConsumerIndex(1)
+		, ReadyIndexAndFlag(2)
 	{
 	}
 
-	/* @param TeamIndex - team index this task struct belongs to
-	@param NumTeams - number of teams in the match */
-	void AdvanceNextTask(uint8 TeamIndex, MultithreadedFogOfWarManager & FogManager);
+	/* Only call these two on the producer thread */
+	T & GetProducerBuffer() { return Buffers[ProducerIndex]; }
 
-	uint8 GetNextTeamIndexForStoringSelectableVisibilityInfo()
+	/* Make what was written to the producer buffer available to the consumer */
+	void Publish()
 	{
-		return NextTeamIndexForStoringSelectableVisibilityInfo++;
+		const int32 Previous = ReadyIndexAndFlag.Exchange(ProducerIndex | NEW_DATA_FLAG);
+		ProducerIndex = Previous & INDEX_MASK;
 	}
 
-	EMulthreadedFogTask GetNextTask() const { return NextTask; }
-};
-
+	/* Only call these two on the consumer thread */
+	const T & GetConsumerBuffer() const { return Buffers[ConsumerIndex]; }
+	T & GetConsumerBuffer() { return Buffers[ConsumerIndex]; }
 
-struct JobQueue
-{
-	// A 1 means that job is in the queue
-	EMulthreadedFogTask BitField;
-
-	// Will return "Finished" if no job in queue
-	EMulthreadedFogTask GetJob()
+	/**
+	 *	Swap the consumer buffer for the most recently published buffer
+	 *
+	 *	@return - true if there was something new to take
+	 */
+	bool Acquire()
 	{
-
+		if ((ReadyIndexAndFlag.Load() & NEW_DATA_FLAG) == 0)
+		{
+			return false;
+		}
+
+		const int32 Previous = ReadyIndexAndFlag.Exchange(ConsumerIndex);
+		ConsumerIndex = Previous & INDEX_MASK;
+		return true;
 	}
-};
 
+	/* Not thread safe. Only call this when no other threads are using this */
+	T & GetBufferByIndex(int32 Index) { return Buffers[Index]; }
 
-struct TilesArray_NoLock
-{
-	TArray<EFogStatus> Array;
-};
+	static constexpr int32 NUM_BUFFERS = 3;
 
+protected:
 
-struct ServerThreadArray
-{
-	TArray<ServerFogOfWarThread*> Array;
+	static constexpr int32 NEW_DATA_FLAG = 1 << 2;
+	static constexpr int32 INDEX_MASK = NEW_DATA_FLAG - 1;
 
-	FogLock Lock;
-};
+	T Buffers[NUM_BUFFERS];
 
+	/* Index into Buffers the producer owns */
+	int32 ProducerIndex;
 
-struct ClientThreadArray
-{
-	TArray<ClientFogOfWarThread*> Array;
+	/* Index into Buffers the consumer owns */
+	int32 ConsumerIndex;
 
-	FogLock Lock;
+	/* Index of the buffer in the 'ready' slot. Has NEW_DATA_FLAG set if the producer has
+	published into it since the consumer last acquired */
+	TAtomic<int32> ReadyIndexAndFlag;
 };
 
 
-struct InfantryFogInfo
+/* Everything the fog thread needs to know about something that reveals fog */
+struct FogRevealSource
 {
-	/* The world location of the infantry in 2D coords (fog of war does not care about Z axis) */
+	/* The world location in 2D coords (fog of war does not care about Z axis) */
 	FVector2D WorldLocation;
 
 	float SightRadius;
 	float StealthRevealRadius;
 
-	explicit InfantryFogInfo(AInfantry * Infantry);
-};
-
-
-struct BuildingFogInfo
-{
-	FVector2D WorldLocation;
-
-	float SightRadius;
-	float StealthRevealRadius;
-
-	uint8 SelectableID;
-	EFogStatus FogStatus;
-
-	/* Indices into tiles array that this building is occupying */
-	TArray<int32> FogLocationsIndices;
-
-	explicit BuildingFogInfo(ABuilding *  Building);
-};
-
-
-struct InfantryFogInfoArray
-{
-	TArray<InfantryFogInfo> Array;
-
-	/* Lock for accessing Array. Do not read/write to array without first holding this */
-	FogLock ArrayLock;
-};
-
-
-struct InfantryFogInfoBasic
-{
-	FVector2D WorldLocation;
-
-	/* Selectable ID of the infantry */
-	uint8 SelectableID;
-
-	/* Fog status of the tile the infantry is standing on */
-	EFogStatus FogStatus;
-
-	explicit InfantryFogInfoBasic(AInfantry * Infantry);
-};
-
-
-struct InfantryFogInfoFinal
-{
-	/* Fog status of the tile the infantry is standing on */
-	EFogStatus TilesFogStatus;
-};
-
-
-struct InfantryArray
-{
-	TArray<AInfantry*> Array;
-};
-
-
-struct InfantryFogInfoBasicArray
-{
-	TArray<InfantryFogInfoBasic> Array;
-
-	FogLock ArrayLock;
-};
-
-
-struct BuildingFogInfoArray
-{
-	TArray<BuildingFogInfo> Array;
-
-	/* Lock for accessing Array. Do not read/write to array without first holding this */
-	FogLock ArrayLock;
-};
-
-
-struct BuildingFogInfoArrayBasic
-{
-	TArray<BuildingFogInfo> Array;
-};
-
-
-/* This container will likely be used for checking if a building has been marked as recently
-destroyed */
-struct SelectableIDArray
-{
-	// Array of selectable IDs
-	TArray<uint8> Array;
+	FogRevealSource(const FVector2D & InWorldLocation, float InSightRadius, float InStealthRevealRadius)
+		: WorldLocation(InWorldLocation)
+		, SightRadius(InSightRadius)
+		, StealthRevealRadius(InStealthRevealRadius)
+	{
+	}
 };
 
 
-struct DestroyedBuildingArray
+/**
+ *	A snapshot of the world taken by the game thread at the end of its fog tick. This is
+ *	all the fog thread reads so it never needs to touch a UObject.
+ */
+struct FogFrameSnapshot
 {
-	/* Index = selectable ID */
-	// TODO make this an array of bitfields instead, unless that's how TArray<bool> is implemented in the first place...
-	bool Array[ProjectSettings::MAX_NUM_SELECTABLES_PER_PLAYER];
+	/* Every infantry, building and temporary reveal effect for each team.
+	Key = Statics::TeamToArrayIndex. Only teams whose bit is set in TeamsToCompute are filled */
+	TArray<FogRevealSource> RevealSources[ProjectSettings::MAX_NUM_TEAMS];
 
-	/* Return true if the building has been recently destroyed */
-	bool WasRecentlyDestroyed(const BuildingFogInfo & Elem) const;
+	/* Bit N set = team index N should have its tiles computed */
+	uint32 TeamsToCompute;
 
-	void SetBitToRecentlyDestroyed(uint8 BuildingsSelectableID);
-
-	void SetBitToNotRecentlyDestroyed(const BuildingFogInfo & Elem);
-
-	/* For debugging. Verify all the flags in Array are set to false */
-	bool AreAllFlagsReset() const;
-};
-
-
-struct TempRevealEffectArray
-{
-	TArray<FTemporaryFogRevealEffectInfo> Array;
-
-	FogLock ArrayLock;
-};
+	/* Team index of the local player. Their tiles also get turned into texture data */
+	uint8 LocalPlayersTeamIndex;
 
+	FogFrameSnapshot()
+		: TeamsToCompute(0)
+		, LocalPlayersTeamIndex(0)
+	{
+	}
 
-struct TempRevealEffectArray_NoLock
-{
-	TArray<FTemporaryFogRevealEffectInfo> Array;
+	void Reset()
+	{
+		for (int32 i = 0; i < ProjectSettings::MAX_NUM_TEAMS; ++i)
+		{
+			RevealSources[i].Reset();
+		}
+		TeamsToCompute = 0;
+	}
 };
 
 
-struct TeamVisibilityInfoStruct
+/**
+ *	The result of the fog thread processing one FogFrameSnapshot.
+ */
+struct FogFrameResult
 {
-	/* Index = selectable's ID */
-	EFogStatus Array[ProjectSettings::MAX_NUM_SELECTABLES_PER_PLAYER];
-
-	/* Lock for accessing Array. Do not read/write to array without first holding this */
-	FogLock ArrayLock;
-};
+	/* Visibility of every tile for each team. Key = Statics::TeamToArrayIndex */
+	TArray<EFogStatus> TeamTiles[ProjectSettings::MAX_NUM_TEAMS];
 
+	/* BGRA texture data for the local player's team ready to be sent to the render thread */
+	TArray<uint8> TextureData;
 
-struct TilesArray
-{
-	TArray<EFogStatus> Array;
-
-	FogLock Lock;
+	/* Bit N set = TeamTiles[N] is up to date */
+	uint32 ComputedTeams;
 };
 
 #endif // MULTITHREADED_FOG_OF_WAR
@@ -0,0 +1,313 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PathDistanceFields.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+#include "Engine/World.h"
+#include "Components/BoxComponent.h"
+#include "Async/TaskGraphInterfaces.h"
+
+#include "MapElements/Building.h"
+#include "GameFramework/RTSPlayerState.h"
+#include "Statics/Statics.h"
+#include "Statics/DevelopmentStatics.h"
+#include "Settings/ProjectSettings.h"
+
+
+/* Opposite directions are 4 apart so each pair of neighbours only needs to be raycast once */
+const FIntPoint FPathDistanceFields::NEIGHBOUR_OFFSETS[8] = {
+	FIntPoint(1, 0), FIntPoint(0, 1), FIntPoint(1, 1), FIntPoint(-1, 1),
+	FIntPoint(-1, 0), FIntPoint(0, -1), FIntPoint(-1, -1), FIntPoint(1, -1) };
+
+FPathDistanceFields::FPathDistanceFields()
+{
+}
+
+void FPathDistanceFields::Build(UWorld * World, const FBoxSphereBounds & MapBounds)
+{
+	Grid.Reset();
+	Depots.Reset();
+
+	/* Clients usually do not have navigation */
+	UNavigationSystemV1 * NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+	if (NavSys == nullptr)
+	{
+		return;
+	}
+
+	const ANavigationData * NavData = NavSys->GetDefaultNavDataInstance(FNavigationSystem::DontCreate);
+	if (NavData == nullptr)
+	{
+		return;
+	}
+
+	const FSharedConstNavQueryFilter QueryFilter = NavData->GetDefaultQueryFilter();
+	const float CellSize = ProjectSettings::PATH_DISTANCE_FIELD_CELL_SIZE;
+
+	TSharedRef < FGrid, ESPMode::ThreadSafe > NewGrid = MakeShared<FGrid, ESPMode::ThreadSafe>();
+	NewGrid->Origin = FVector2D(MapBounds.Origin.X - MapBounds.BoxExtent.X,
+		MapBounds.Origin.Y - MapBounds.BoxExtent.Y);
+	NewGrid->NumCells = FIntPoint(FMath::CeilToInt(MapBounds.BoxExtent.X * 2.f / CellSize),
+		FMath::CeilToInt(MapBounds.BoxExtent.Y * 2.f / CellSize));
+
+	const FIntPoint NumCells = NewGrid->NumCells;
+	const int32 NumCellsTotal = NumCells.X * NumCells.Y;
+
+	NewGrid->CellLocations.SetNumUninitialized(NumCellsTotal);
+	NewGrid->Links.Init(0, NumCellsTotal);
+
+	/* Project every cell center onto the navmesh */
+	TArray < bool > bOnNavMesh;
+	bOnNavMesh.Init(false, NumCellsTotal);
+	const FVector ProjectionExtent = FVector(CellSize * 0.5f, CellSize * 0.5f, MapBounds.BoxExtent.Z);
+	for (int32 Y = 0; Y < NumCells.Y; ++Y)
+	{
+		for (int32 X = 0; X < NumCells.X; ++X)
+		{
+			const int32 Index = Y * NumCells.X + X;
+			const FVector2D Center = NewGrid->Origin + FVector2D(X + 0.5f, Y + 0.5f) * CellSize;
+
+			FNavLocation Projected;
+			if (NavSys->ProjectPointToNavigation(FVector(Center, MapBounds.Origin.Z), Projected, 
+				ProjectionExtent, NavData))
+			{
+				NewGrid->CellLocations[Index] = Projected.Location;
+				bOnNavMesh[Index] = true;
+			}
+			else
+			{
+				NewGrid->CellLocations[Index] = FVector(Center, MapBounds.Origin.Z);
+			}
+		}
+	}
+
+	/* Link neighbours that can be walked between in a straight line */
+	for (int32 Y = 0; Y < NumCells.Y; ++Y)
+	{
+		for (int32 X = 0; X < NumCells.X; ++X)
+		{
+			const int32 Index = Y * NumCells.X + X;
+			if (!bOnNavMesh[Index])
+			{
+				continue;
+			}
+
+			for (uint8 Direction = 0; Direction < 4; ++Direction)
+			{
+				const int32 NeighbourX = X + NEIGHBOUR_OFFSETS[Direction].X;
+				const int32 NeighbourY = Y + NEIGHBOUR_OFFSETS[Direction].Y;
+				if (NeighbourX < 0 || NeighbourX >= NumCells.X || NeighbourY < 0 || NeighbourY >= NumCells.Y)
+				{
+					continue;
+				}
+
+				const int32 NeighbourIndex = NeighbourY * NumCells.X + NeighbourX;
+				if (!bOnNavMesh[NeighbourIndex])
+				{
+					continue;
+				}
+
+				FVector HitLocation;
+				if (!NavData->Raycast(NewGrid->CellLocations[Index], NewGrid->CellLocations[NeighbourIndex], 
+					HitLocation, QueryFilter))
+				{
+					NewGrid->Links[Index] |= (1 << Direction);
+					NewGrid->Links[NeighbourIndex] |= (1 << (Direction + 4));
+				}
+			}
+		}
+	}
+
+	Grid = NewGrid;
+}
+
+void FPathDistanceFields::AddDepot(ABuilding * Depot)
+{
+	if (!Grid.IsValid() || Depots.Contains(Depot))
+	{
+		return;
+	}
+
+	/* Start from every linked cell under or just around the depot. Depots carve the navmesh 
+	so the cells they are on usually are not on it */
+	const UBoxComponent * Bounds = Depot->GetBoxComponent();
+	const FVector2D Location = FVector2D(Bounds->GetComponentLocation());
+	const float SeedRadius = FVector2D(Bounds->GetScaledBoxExtent()).Size() 
+		+ ProjectSettings::PATH_DISTANCE_FIELD_CELL_SIZE;
+
+	TArray < TPair < int32, float > > Seeds;
+	const FIntPoint NumCells = Grid->NumCells;
+	const FVector2D MinCell = (Location - SeedRadius - Grid->Origin) / ProjectSettings::PATH_DISTANCE_FIELD_CELL_SIZE;
+	const FVector2D MaxCell = (Location + SeedRadius - Grid->Origin) / ProjectSettings::PATH_DISTANCE_FIELD_CELL_SIZE;
+	for (int32 Y = FMath::Max(FMath::FloorToInt(MinCell.Y), 0); Y <= FMath::Min(FMath::FloorToInt(MaxCell.Y), NumCells.Y - 1); ++Y)
+	{
+		for (int32 X = FMath::Max(FMath::FloorToInt(MinCell.X), 0); X <= FMath::Min(FMath::FloorToInt(MaxCell.X), NumCells.X - 1); ++X)
+		{
+			const int32 Index = Y * NumCells.X + X;
+			const float Distance = FVector2D::Distance(FVector2D(Grid->CellLocations[Index]), Location);
+			if (Grid->Links[Index] != 0 && Distance <= SeedRadius)
+			{
+				Seeds.Emplace(Index, Distance);
+			}
+		}
+	}
+
+	const TSharedRef < FField, ESPMode::ThreadSafe > Field = MakeShared<FField, ESPMode::ThreadSafe>();
+	Depots.Emplace(Depot, FDepotField{ Depot, Field, false });
+
+	/* Worker holds its own references so it is fine for the depot to be removed or the grid 
+	rebuilt while it is running */
+	const TSharedPtr < const FGrid, ESPMode::ThreadSafe > GridRef = Grid;
+	FFunctionGraphTask::CreateAndDispatchWhenReady([GridRef, Field, Seeds]()
+	{
+		Solve(*GridRef, Seeds, *Field);
+		Field->bReady = true;
+	}, TStatId(), nullptr, ENamedThreads::AnyBackgroundThreadNormalTask);
+}
+
+void FPathDistanceFields::RemoveDepot(ABuilding * Depot)
+{
+	Depots.Remove(Depot);
+}
+
+void FPathDistanceFields::Tick()
+{
+	for (TPair < const AActor *, FDepotField > & Pair : Depots)
+	{
+		FDepotField & Entry = Pair.Value;
+		if (!Entry.bOwnerNotified && Entry.Field->bReady)
+		{
+			Entry.bOwnerNotified = true;
+			NewlyReady.Emplace(Entry.Depot);
+		}
+	}
+
+	/* Done after iterating Depots in case owners add or remove depots */
+	for (const TWeakObjectPtr < ABuilding > & Elem : NewlyReady)
+	{
+		ABuilding * Depot = Elem.Get();
+		if (Statics::IsValid(Depot))
+		{
+			Depot->GetPS()->OnDepotPathDistancesReady(Depot);
+		}
+	}
+
+	NewlyReady.Reset();
+}
+
+bool FPathDistanceFields::GetDistanceSqr(const AActor * Depot, const FVector & Location, 
+	float & OutDistanceSqr) const
+{
+	const FDepotField * Entry = Depots.Find(Depot);
+	if (Entry == nullptr || !Entry->Field->bReady)
+	{
+		return false;
+	}
+
+	const int32 CellIndex = Grid->GetCellIndex(FVector2D(Location));
+	if (CellIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	/* Location is usually a resource spot which carves the navmesh so its own cell might not 
+	be on it. Try walking from the neighbours too */
+	const TArray < float > & Distances = Entry->Field->Distances;
+	const int32 X = CellIndex % Grid->NumCells.X;
+	const int32 Y = CellIndex / Grid->NumCells.X;
+
+	float BestDistance = FLT_MAX;
+	for (int32 i = -1; i < 8; ++i)
+	{
+		const int32 CellX = (i == -1) ? X : X + NEIGHBOUR_OFFSETS[i].X;
+		const int32 CellY = (i == -1) ? Y : Y + NEIGHBOUR_OFFSETS[i].Y;
+		if (CellX < 0 || CellX >= Grid->NumCells.X || CellY < 0 || CellY >= Grid->NumCells.Y)
+		{
+			continue;
+		}
+
+		const int32 Index = CellY * Grid->NumCells.X + CellX;
+		if (Distances[Index] != FLT_MAX)
+		{
+			BestDistance = FMath::Min(BestDistance, 
+				Distances[Index] + FVector::Dist2D(Grid->CellLocations[Index], Location));
+		}
+	}
+
+	/* Field is ready so this is a real answer: the depot cannot be walked to from here */
+	OutDistanceSqr = (BestDistance == FLT_MAX) ? FLT_MAX : FMath::Square(BestDistance);
+	return true;
+}
+
+int32 FPathDistanceFields::FGrid::GetCellIndex(const FVector2D & Location) const
+{
+	const FVector2D Local = (Location - Origin) / ProjectSettings::PATH_DISTANCE_FIELD_CELL_SIZE;
+	const int32 X = FMath::FloorToInt(Local.X);
+	const int32 Y = FMath::FloorToInt(Local.Y);
+	if (X < 0 || X >= NumCells.X || Y < 0 || Y >= NumCells.Y)
+	{
+		return INDEX_NONE;
+	}
+
+	return Y * NumCells.X + X;
+}
+
+void FPathDistanceFields::Solve(const FGrid & Grid, const TArray < TPair < int32, float > > & Seeds, 
+	FField & Field)
+{
+	TArray < float > & Distances = Field.Distances;
+	Distances.Init(FLT_MAX, Grid.CellLocations.Num());
+
+	struct FOpenCell
+	{
+		int32 Index;
+		float Distance;
+	};
+
+	/* Min heap. Cells can be in here more than once, stale entries are skipped when popped */
+	TArray < FOpenCell > Open;
+	const auto Predicate = [](const FOpenCell & A, const FOpenCell & B) { return A.Distance < B.Distance; };
+
+	for (const TPair < int32, float > & Seed : Seeds)
+	{
+		if (Seed.Value < Distances[Seed.Key])
+		{
+			Distances[Seed.Key] = Seed.Value;
+			Open.HeapPush(FOpenCell{ Seed.Key, Seed.Value }, Predicate);
+		}
+	}
+
+	while (Open.Num() > 0)
+	{
+		FOpenCell Cell;
+		Open.HeapPop(Cell, Predicate, false);
+
+		if (Cell.Distance > Distances[Cell.Index])
+		{
+			continue;
+		}
+
+		const int32 X = Cell.Index % Grid.NumCells.X;
+		const int32 Y = Cell.Index / Grid.NumCells.X;
+		const uint8 Links = Grid.Links[Cell.Index];
+
+		for (uint8 Direction = 0; Direction < 8; ++Direction)
+		{
+			if ((Links & (1 << Direction)) == 0)
+			{
+				continue;
+			}
+
+			const int32 NeighbourIndex = (Y + NEIGHBOUR_OFFSETS[Direction].Y) * Grid.NumCells.X 
+				+ X + NEIGHBOUR_OFFSETS[Direction].X;
+			const float Distance = Cell.Distance 
+				+ FVector::Dist(Grid.CellLocations[Cell.Index], Grid.CellLocations[NeighbourIndex]);
+
+			if (Distance < Distances[NeighbourIndex])
+			{
+				Distances[NeighbourIndex] = Distance;
+				Open.HeapPush(FOpenCell{ NeighbourIndex, Distance }, Predicate);
+			}
+		}
+	}
+}
@@ -0,0 +1,117 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeBool.h"
+
+class ABuilding;
+class UWorld;
+
+
+/**
+ *	Walking distances from every resource depot to anywhere on the map so the closest depot to 
+ *	a resource spot can be picked by how far collectors actually have to walk instead of 
+ *	straight line distance.
+ *
+ *	Owned by ARTSGameState. The map is split into a coarse grid of 
+ *	ProjectSettings::PATH_DISTANCE_FIELD_CELL_SIZE cells. When the match is setup each cell 
+ *	center is projected onto the navmesh and navmesh raycasts decide which neighbouring cells 
+ *	can be walked between. When a depot completes a Dijkstra search from it over the grid is 
+ *	run on a worker thread which gives the walking distance from the depot to every cell. 
+ *	Looking up a distance after that is just indexing into an array. A depot's distances are 
+ *	dropped when it is destroyed.
+ *
+ *	The grid is only built once so buildings placed during the match are not obstacles. 
+ *	Anything it cannot answer (no navigation e.g. on clients, depot's distances still being 
+ *	worked out) should fall back to straight line distance. A location that cannot be walked 
+ *	to is an answer though, not a fallback.
+ */
+class RTS_VER2_API FPathDistanceFields
+{
+public:
+
+	FPathDistanceFields();
+
+	/* Project the grid onto the navmesh. Call once the map has loaded */
+	void Build(UWorld * World, const FBoxSphereBounds & MapBounds);
+
+	/* Start working out the distances from a depot that has just completed. Does nothing if 
+	already done or being done */
+	void AddDepot(ABuilding * Depot);
+
+	/* Drop a depot's distances */
+	void RemoveDepot(ABuilding * Depot);
+
+	/* Tell the owners of depots whose distances have finished being worked out since the last 
+	call. Call once per frame */
+	void Tick();
+
+	/**
+	 *	Get the walking distance squared from a depot to a location. O(1)
+	 *
+	 *	@param Depot - depot passed into AddDepot. Anything else returns false
+	 *	@param OutDistanceSqr - walking distance squared. FLT_MAX if the location cannot be 
+	 *	walked to
+	 *	@return - false if there is no answer yet and straight line distance should be used 
+	 *	instead
+	 */
+	bool GetDistanceSqr(const AActor * Depot, const FVector & Location, float & OutDistanceSqr) const;
+
+private:
+
+	/* Navmesh layout of the map. Never changes once built so worker threads can read it */
+	struct FGrid
+	{
+		/* Location of the corner of cell (0, 0) */
+		FVector2D Origin;
+
+		/* Dimensions of grid in cells */
+		FIntPoint NumCells;
+
+		/* Cell centers projected onto the navmesh */
+		TArray < FVector > CellLocations;
+
+		/* One bit per NEIGHBOUR_OFFSETS entry set if the neighbour can be walked to in a 
+		straight line. 0 for cells not on the navmesh */
+		TArray < uint8 > Links;
+
+		/* Index of cell or INDEX_NONE if outside grid */
+		int32 GetCellIndex(const FVector2D & Location) const;
+	};
+
+	/* Distances from one depot */
+	struct FField
+	{
+		/* Walking distance from the depot to each cell. FLT_MAX if it cannot be walked to */
+		TArray < float > Distances;
+
+		/* Set by the worker thread once Distances has been filled */
+		FThreadSafeBool bReady;
+	};
+
+	struct FDepotField
+	{
+		TWeakObjectPtr < ABuilding > Depot;
+
+		TSharedRef < FField, ESPMode::ThreadSafe > Field;
+
+		/* Whether the depot's owner has been told the distances are ready */
+		bool bOwnerNotified;
+	};
+
+	/* Cell (X, Y) offsets of the 8 neighbours of a cell */
+	static const FIntPoint NEIGHBOUR_OFFSETS[8];
+
+	/* Fill in Field's distances with a Dijkstra search from the seed cells. Runs on a worker thread */
+	static void Solve(const FGrid & Grid, const TArray < TPair < int32, float > > & Seeds, FField & Field);
+
+	/* Shared with worker threads. Null if not built */
+	TSharedPtr < const FGrid, ESPMode::ThreadSafe > Grid;
+
+	/* Raw pointer keys but depots are removed when they reach zero health */
+	TMap < const AActor *, FDepotField > Depots;
+
+	/* Only a member to avoid allocating every tick */
+	TArray < TWeakObjectPtr < ABuilding > > NewlyReady;
+};
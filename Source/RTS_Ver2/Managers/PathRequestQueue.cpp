@@ -0,0 +1,196 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PathRequestQueue.h"
+#include "NavigationSystem.h"
+#include "NavFilters/NavigationQueryFilter.h"
+#include "NavMesh/NavMeshPath.h"
+#include "Engine/World.h"
+
+#include "MapElements/AIControllers/InfantryController.h"
+#include "Statics/DevelopmentStatics.h"
+#include "Settings/ProjectSettings.h"
+
+
+FPathRequestQueue::FPathRequestQueue()
+{
+	NextRequestID = 1;
+}
+
+uint32 FPathRequestQueue::Request(AInfantryController * Requester, const FVector & Start, 
+	const FVector & Goal)
+{
+	assert(Requester != nullptr);
+
+	const uint32 RequestID = NextRequestID++;
+	if (NextRequestID == 0)
+	{
+		NextRequestID = 1;
+	}
+
+	const FNavAgentProperties & AgentProperties = Requester->GetNavAgentPropertiesRef();
+	const uint64 CellsKey = GetCellsKey(Start, Goal);
+
+	/* Share a waiting query if there is one for the same cells and the same sized agent */
+	const int32 * Index = WaitingCells.Find(CellsKey);
+	if (Index != nullptr && Waiting[*Index].AgentProperties.IsEquivalent(AgentProperties))
+	{
+		Waiting[*Index].Requests.Emplace(FRequest(Requester, RequestID, Start, Goal));
+	}
+	else
+	{
+		FQuery Query;
+		Query.AgentProperties = AgentProperties;
+		Query.Requests.Emplace(FRequest(Requester, RequestID, Start, Goal));
+
+		WaitingCells.Emplace(CellsKey, Waiting.Num());
+		Waiting.Emplace(MoveTemp(Query));
+	}
+
+	return RequestID;
+}
+
+void FPathRequestQueue::StartQueries(UWorld * World, const FNavPathQueryDelegate & OnQueryFinished)
+{
+	if (Waiting.Num() == 0)
+	{
+		return;
+	}
+
+	/* Take the queries out first since delivering a failed query could cause a controller to 
+	make another request */
+	const int32 NumToStart = FMath::Min(Waiting.Num(), ProjectSettings::MAX_PATH_QUERIES_STARTED_PER_FRAME);
+	TArray < FQuery > ToStart;
+	ToStart.Reserve(NumToStart);
+	for (int32 i = 0; i < NumToStart; ++i)
+	{
+		ToStart.Emplace(MoveTemp(Waiting[i]));
+	}
+	Waiting.RemoveAt(0, NumToStart, false);
+
+	WaitingCells.Reset();
+	for (int32 i = 0; i < Waiting.Num(); ++i)
+	{
+		const FRequest & First = Waiting[i].Requests[0];
+		WaitingCells.Emplace(GetCellsKey(First.Start, First.Goal), i);
+	}
+
+	UNavigationSystemV1 * NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+
+	for (FQuery & Query : ToStart)
+	{
+		const FRequest & First = Query.Requests[0];
+		AInfantryController * Querier = First.Requester.Get();
+
+		const ANavigationData * NavData = (NavSys != nullptr) 
+			? NavSys->GetNavDataForProps(Query.AgentProperties) : nullptr;
+
+		uint32 QueryID = INVALID_NAVQUERYID;
+		if (NavData != nullptr)
+		{
+			FPathFindingQuery PathQuery(Querier, *NavData, First.Start, First.Goal,
+				UNavigationQueryFilter::GetQueryFilter(*NavData, Querier, nullptr));
+
+			QueryID = NavSys->FindPathAsync(Query.AgentProperties, PathQuery, OnQueryFinished);
+		}
+
+		if (QueryID != INVALID_NAVQUERYID)
+		{
+			InFlight.Emplace(QueryID, MoveTemp(Query.Requests));
+		}
+		else
+		{
+			Deliver(Query.Requests, nullptr);
+		}
+	}
+}
+
+void FPathRequestQueue::OnQueryFinished(uint32 QueryID, ENavigationQueryResult::Type Result, 
+	FNavPathSharedPtr Path)
+{
+	TArray < FRequest > Requests;
+	if (!InFlight.RemoveAndCopyValue(QueryID, Requests))
+	{
+		return;
+	}
+
+	const bool bFoundPath = (Result == ENavigationQueryResult::Success && Path.IsValid() 
+		&& Path->IsValid());
+
+	Deliver(Requests, bFoundPath ? Path : nullptr);
+}
+
+uint64 FPathRequestQueue::GetCellsKey(const FVector & Start, const FVector & Goal)
+{
+	/* 16 bits per coordinate. Wraps around on huge maps but that only means the odd request 
+	does not get shared */
+	const float CellSize = ProjectSettings::PATH_REQUEST_CELL_SIZE;
+	const uint64 StartX = static_cast<uint16>(FMath::FloorToInt(Start.X / CellSize));
+	const uint64 StartY = static_cast<uint16>(FMath::FloorToInt(Start.Y / CellSize));
+	const uint64 GoalX = static_cast<uint16>(FMath::FloorToInt(Goal.X / CellSize));
+	const uint64 GoalY = static_cast<uint16>(FMath::FloorToInt(Goal.Y / CellSize));
+
+	return (StartX << 48) | (StartY << 32) | (GoalX << 16) | GoalY;
+}
+
+void FPathRequestQueue::Deliver(const TArray < FRequest > & Requests, const FNavPathSharedPtr & Path)
+{
+	ANavigationData * NavData = Path.IsValid() ? Path->GetNavigationDataUsed() : nullptr;
+
+	/* Copies need the poly corridor of a navmesh path. Without it the navmesh cannot tell when 
+	a change affects them and they would never repath */
+	const FNavMeshPath * NavMeshPath = Path.IsValid() ? Path->CastPath<FNavMeshPath>() : nullptr;
+
+	for (int32 i = 0; i < Requests.Num(); ++i)
+	{
+		const FRequest & Request = Requests[i];
+
+		AInfantryController * Controller = Request.Requester.Get();
+		if (Controller == nullptr)
+		{
+			continue;
+		}
+
+		FNavPathSharedPtr RequestersPath = nullptr;
+		if (Path.IsValid())
+		{
+			if (i == 0)
+			{
+				RequestersPath = Path;
+			}
+			else if (NavData != nullptr && NavMeshPath != nullptr)
+			{
+				/* Created by the nav data so it is registered as an active path with the 
+				controller as querier, same as a path from a query of its own */
+				RequestersPath = NavData->CreatePathInstance<FNavMeshPath>(FPathFindingQueryData(
+					Controller, Request.Start, Request.Goal, Path->GetFilter()));
+				RequestersPath->SetFilter(Path->GetFilter());
+
+				FNavMeshPath * RequestersNavMeshPath = RequestersPath->CastPath<FNavMeshPath>();
+				RequestersNavMeshPath->PathCorridor = NavMeshPath->PathCorridor;
+				RequestersNavMeshPath->PathCorridorCost = NavMeshPath->PathCorridorCost;
+
+				/* Start and goal are in the same cells as the first request's so walking 
+				straight to and from its path is fine */
+				TArray < FNavPathPoint > & Points = RequestersPath->GetPathPoints();
+				Points = Path->GetPathPoints();
+				Points[0].Location = Request.Start;
+				if (!Path->IsPartial())
+				{
+					Points.Last().Location = Request.Goal;
+				}
+
+				RequestersPath->SetIsPartial(Path->IsPartial());
+				RequestersPath->MarkReady();
+			}
+
+			/* Same as AAIController::FindPathForMoveRequest */
+			if (RequestersPath.IsValid())
+			{
+				RequestersPath->EnableRecalculationOnInvalidation(true);
+			}
+		}
+
+		/* If there is a path but it could not be copied then the controller will query its own */
+		Controller->OnPathRequestFinished(Request.RequestID, RequestersPath, !Path.IsValid());
+	}
+}
@@ -0,0 +1,102 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AI/Navigation/NavigationTypes.h"
+#include "NavigationData.h"
+
+class AInfantryController;
+class UWorld;
+
+
+/**
+ *	Queue of navmesh path requests for infantry controllers. AInfantryController::Move puts 
+ *	requests in here instead of doing a path query on the spot and 
+ *	AInfantryControllerTickManager starts them at the end of its tick.
+ *
+ *	- Requests whose start and goal are in the same cells as a request already waiting share 
+ *	one query. This happens a lot when a group of units all get the same command
+ *	- Queries are solved on worker threads using UNavigationSystemV1::FindPathAsync
+ *	- At most ProjectSettings::MAX_PATH_QUERIES_STARTED_PER_FRAME queries are started each 
+ *	frame. The rest wait for the next frame
+ *	- Results are handed back through AInfantryController::OnPathRequestFinished
+ */
+class FPathRequestQueue
+{
+public:
+
+	FPathRequestQueue();
+
+	/**
+	 *	Ask for a path for a controller's pawn
+	 *
+	 *	@param Start - where the path starts. Usually the controller's nav agent location
+	 *	@param Goal - where the path should go to
+	 *	@return - ID the result will be handed back with. Never 0
+	 */
+	uint32 Request(AInfantryController * Requester, const FVector & Start, const FVector & Goal);
+
+	/**
+	 *	Start the queries for requests that are waiting. Call once per frame
+	 *
+	 *	@param OnQueryFinished - delegate the navigation system calls when a query finishes. 
+	 *	Must end up calling OnQueryFinished on this
+	 */
+	void StartQueries(UWorld * World, const FNavPathQueryDelegate & OnQueryFinished);
+
+	/* Hand the result of a query started by StartQueries to every controller that asked for it */
+	void OnQueryFinished(uint32 QueryID, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path);
+
+private:
+
+	struct FRequest
+	{
+		FRequest(AInfantryController * InRequester, uint32 InRequestID, const FVector & InStart, 
+			const FVector & InGoal)
+			: Requester(InRequester)
+			, RequestID(InRequestID)
+			, Start(InStart)
+			, Goal(InGoal)
+		{
+		}
+
+		TWeakObjectPtr < AInfantryController > Requester;
+		uint32 RequestID;
+		FVector Start;
+		FVector Goal;
+	};
+
+	/* One path query and everyone who wants its result */
+	struct FQuery
+	{
+		FNavAgentProperties AgentProperties;
+
+		/* The query is done from the first request's start to its goal */
+		TArray < FRequest > Requests;
+	};
+
+	/* Key for the cells a start and goal are in */
+	static uint64 GetCellsKey(const FVector & Start, const FVector & Goal);
+
+	/**
+	 *	Give each request its own copy of a path with the ends swapped for its own start and 
+	 *	goal, then call OnPathRequestFinished on its controller. Copies are registered with the 
+	 *	nav data and repath when the navmesh changes like any other path
+	 *
+	 *	@param Path - path from the first request's start to its goal, or null if none was found
+	 */
+	static void Deliver(const TArray < FRequest > & Requests, const FNavPathSharedPtr & Path);
+
+	/* Queries that have not been started yet, oldest first */
+	TArray < FQuery > Waiting;
+
+	/* Maps GetCellsKey to index in Waiting */
+	TMap < uint64, int32 > WaitingCells;
+
+	/* Queries the navigation system is working on. Key = query ID */
+	TMap < uint32, TArray < FRequest > > InFlight;
+
+	/* ID to give the next request */
+	uint32 NextRequestID;
+};
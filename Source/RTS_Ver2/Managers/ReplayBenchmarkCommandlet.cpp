@@ -0,0 +1,93 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ReplayBenchmarkCommandlet.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/PlatformProcess.h"
+
+#include "Managers/CommandRecording.h"
+#include "Statics/DevelopmentStatics.h"
+
+
+UReplayBenchmarkCommandlet::UReplayBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UReplayBenchmarkCommandlet::Main(const FString & Params)
+{
+	FString ReplayPath;
+	if (!FParse::Value(*Params, TEXT("Replay="), ReplayPath))
+	{
+		UE_LOG(RTSLOG, Error, TEXT("No recording given. Usage: -run=ReplayBenchmark "
+			"-Replay=<Recording> [-Output=<CSV>] [-Fps=<N>]"));
+		return 1;
+	}
+
+	ReplayPath = FPaths::ConvertRelativePathToFull(ReplayPath);
+
+	FString OutputPath;
+	if (!FParse::Value(*Params, TEXT("Output="), OutputPath))
+	{
+		OutputPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks") 
+			/ FPaths::GetBaseFilename(ReplayPath) + TEXT(".csv");
+	}
+	OutputPath = FPaths::ConvertRelativePathToFull(OutputPath);
+
+	int32 Fps = DEFAULT_FPS;
+	FParse::Value(*Params, TEXT("Fps="), Fps);
+
+	/* Make sure it is a recording before launching anything */
+	FCommandReplayer Replayer;
+	if (!Replayer.Load(ReplayPath))
+	{
+		return 1;
+	}
+
+	const FString ProjectPath = FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath());
+	const FString Args = FString::Printf(TEXT("\"%s\" -game -nullrhi -nosound -unattended "
+		"-benchmark -fps=%d -RTSReplay=\"%s\" -RTSReplayOutput=\"%s\""), *ProjectPath, Fps, 
+		*ReplayPath, *OutputPath);
+
+	/* So a summary left over from an earlier run is not mistaken for this one's */
+	IFileManager::Get().Delete(*FReplayBenchmark::GetSummaryPath(OutputPath), false, true, true);
+
+	UE_LOG(RTSLOG, Display, TEXT("Replaying [%s] at %d fps"), *ReplayPath, Fps);
+
+	FProcHandle Process = FPlatformProcess::CreateProc(FPlatformProcess::ExecutablePath(), *Args,
+		false, true, true, nullptr, 0, nullptr, nullptr);
+	if (!Process.IsValid())
+	{
+		UE_LOG(RTSLOG, Error, TEXT("Could not launch game process to replay with"));
+		return 1;
+	}
+
+	FPlatformProcess::WaitForProc(Process);
+
+	int32 ReturnCode = 0;
+	FPlatformProcess::GetProcReturnCode(Process, &ReturnCode);
+	FPlatformProcess::CloseProc(Process);
+
+	FString Summary;
+	if (!FFileHelper::LoadFileToString(Summary, *FReplayBenchmark::GetSummaryPath(OutputPath)))
+	{
+		UE_LOG(RTSLOG, Error, TEXT("Replay did not write any timings. Game process returned %d"),
+			ReturnCode);
+		return 1;
+	}
+
+	TArray < FString > Lines;
+	Summary.ParseIntoArrayLines(Lines);
+	for (const FString & Line : Lines)
+	{
+		UE_LOG(RTSLOG, Display, TEXT("%s"), *Line);
+	}
+
+	UE_LOG(RTSLOG, Display, TEXT("Per frame timings in [%s]"), *OutputPath);
+
+	return ReturnCode;
+}
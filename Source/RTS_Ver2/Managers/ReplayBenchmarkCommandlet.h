@@ -0,0 +1,35 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ReplayBenchmarkCommandlet.generated.h"
+
+
+/**
+ *	Replays a command recording in a headless game and logs how long each frame took.
+ *
+ *	Usage: UE4Editor-Cmd <Project>.uproject -run=ReplayBenchmark -Replay=<Recording> 
+ *	[-Output=<CSV>] [-Fps=<N>]
+ *
+ *	Commandlets do not run a game world so the replay itself happens in a separate -game 
+ *	-nullrhi process launched with a fixed frame rate. This waits for it and logs the summary 
+ *	it writes. See CommandRecording.h
+ */
+UCLASS()
+class RTS_VER2_API UReplayBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UReplayBenchmarkCommandlet();
+
+	virtual int32 Main(const FString & Params) override;
+
+protected:
+
+	/* Frame rate to replay at if -Fps is not given. Fixed so results can be compared */
+	static constexpr int32 DEFAULT_FPS = 30;
+};
@@ -0,0 +1,200 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SelectableSpatialGrid.h"
+#include "Algo/Sort.h"
+
+#include "GameFramework/RTSGameState.h"
+#include "GameFramework/RTSPlayerState.h"
+#include "MapElements/Infantry.h"
+#include "MapElements/Building.h"
+#include "Statics/Statics.h"
+#include "Statics/DevelopmentStatics.h"
+#include "Managers/CommandRecording.h"
+
+
+FSelectableSpatialGrid::FSelectableSpatialGrid()
+	: LastBuildFrame(UINT64_MAX)
+{
+	for (FTeamGrid & Grid : Teams)
+	{
+		Grid.BucketStarts.Init(0, NUM_BUCKETS + 1);
+		Grid.LargestBoundsLength = 0.f;
+	}
+}
+
+void FSelectableSpatialGrid::RebuildIfStale(const ARTSGameState * GameState)
+{
+	if (LastBuildFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	LastBuildFrame = GFrameCounter;
+
+	BENCHMARK_SCOPE(SelectableGrid);
+
+	const TArray < FPlayerStateArray > & AllTeams = GameState->GetTeams();
+	assert(AllTeams.Num() <= ProjectSettings::MAX_NUM_TEAMS);
+
+	for (int32 TeamIndex = 0; TeamIndex < ProjectSettings::MAX_NUM_TEAMS; ++TeamIndex)
+	{
+		FTeamGrid & Grid = Teams[TeamIndex];
+		Grid.Entries.Reset();
+		Grid.LargestBoundsLength = 0.f;
+		FMemory::Memzero(Grid.BucketStarts.GetData(), Grid.BucketStarts.Num() * sizeof(int32));
+
+		if (TeamIndex >= AllTeams.Num())
+		{
+			continue;
+		}
+
+		/* Gather. Only include things a sweep against team channels would have hit */
+		Unsorted.Reset();
+		for (ARTSPlayerState * PlayerState : AllTeams[TeamIndex].GetPlayerStates())
+		{
+			if (!Statics::IsValid(PlayerState))
+			{
+				continue;
+			}
+
+			const uint8 OwnerID = PlayerState->GetPlayerIDAsInt();
+
+			for (AInfantry * Unit : PlayerState->GetUnits())
+			{
+				if (!Statics::IsValid(Unit) || Unit->IsInsideGarrison())
+				{
+					continue;
+				}
+
+				const uint8 SelectableID = Unit->GetSelectableID();
+				if (!GameState->GetSelectableFlags(OwnerID, SelectableID).HasZeroHealth())
+				{
+					const FVector2D Location = FVector2D(Unit->GetActorLocation());
+					Unsorted.Emplace(FSelectableGridEntry{ Unit, Unit, Location, Unit->GetBoundsLength(), GetCell(Location), OwnerID, SelectableID });
+				}
+			}
+
+			for (ABuilding * Building : PlayerState->GetBuildings())
+			{
+				if (!Statics::IsValid(Building))
+				{
+					continue;
+				}
+
+				const uint8 SelectableID = Building->GetSelectableID();
+				if (!GameState->GetSelectableFlags(OwnerID, SelectableID).HasZeroHealth())
+				{
+					const FVector2D Location = FVector2D(Building->GetActorLocation());
+					Unsorted.Emplace(FSelectableGridEntry{ Building, Building, Location, Building->GetBoundsLength(), GetCell(Location), OwnerID, SelectableID });
+				}
+			}
+		}
+
+		/* Counting sort by bucket */
+		int32 * BucketStarts = Grid.BucketStarts.GetData();
+		for (const FSelectableGridEntry & Entry : Unsorted)
+		{
+			BucketStarts[GetBucket(Entry.Cell) + 1]++;
+			Grid.LargestBoundsLength = FMath::Max(Grid.LargestBoundsLength, Entry.BoundsLength);
+		}
+		for (int32 i = 1; i <= NUM_BUCKETS; ++i)
+		{
+			BucketStarts[i] += BucketStarts[i - 1];
+		}
+
+		Grid.Entries.SetNumUninitialized(Unsorted.Num());
+		TArray < int32, TInlineAllocator<NUM_BUCKETS> > WriteIndices;
+		WriteIndices.Append(BucketStarts, NUM_BUCKETS);
+		for (const FSelectableGridEntry & Entry : Unsorted)
+		{
+			Grid.Entries[WriteIndices[GetBucket(Entry.Cell)]++] = Entry;
+		}
+	}
+}
+
+void FSelectableSpatialGrid::QueryRadius(const FVector & Location, float Radius, uint32 TeamsMask, 
+	TArray < const FSelectableGridEntry * > & OutEntries, bool bSortByDistance) const
+{
+	/* Not required but expected */
+	assert(LastBuildFrame == GFrameCounter);
+
+	const FVector2D Center = FVector2D(Location);
+	const int32 FirstNewEntry = OutEntries.Num();
+
+	for (int32 TeamIndex = 0; TeamIndex < ProjectSettings::MAX_NUM_TEAMS; ++TeamIndex)
+	{
+		if ((TeamsMask & (1u << TeamIndex)) == 0)
+		{
+			continue;
+		}
+
+		const FTeamGrid & Grid = Teams[TeamIndex];
+		if (Grid.Entries.Num() == 0)
+		{
+			continue;
+		}
+
+		/* Entries whose center is further than this from a cell's edge cannot overlap */
+		const float SearchRadius = Radius + Grid.LargestBoundsLength;
+		const FIntPoint MinCell = GetCell(Center - FVector2D(SearchRadius, SearchRadius));
+		const FIntPoint MaxCell = GetCell(Center + FVector2D(SearchRadius, SearchRadius));
+
+		auto TestEntry = [&](const FSelectableGridEntry & Entry)
+		{
+			if ((Entry.Location - Center).SizeSquared() <= FMath::Square(Radius + Entry.BoundsLength))
+			{
+				OutEntries.Emplace(&Entry);
+			}
+		};
+
+		const int64 NumCells = static_cast<int64>(MaxCell.X - MinCell.X + 1) * (MaxCell.Y - MinCell.Y + 1);
+		if (NumCells >= NUM_BUCKETS)
+		{
+			/* Query covers so many cells that we would visit every bucket anyway */
+			for (const FSelectableGridEntry & Entry : Grid.Entries)
+			{
+				TestEntry(Entry);
+			}
+		}
+		else
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+			{
+				for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+				{
+					const FIntPoint Cell = FIntPoint(X, Y);
+					const int32 Bucket = GetBucket(Cell);
+					for (int32 i = Grid.BucketStarts[Bucket]; i < Grid.BucketStarts[Bucket + 1]; ++i)
+					{
+						const FSelectableGridEntry & Entry = Grid.Entries[i];
+						/* Other cells can hash to the same bucket. Checking the cell stops 
+						entries being returned twice */
+						if (Entry.Cell == Cell)
+						{
+							TestEntry(Entry);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	if (bSortByDistance && OutEntries.Num() - FirstNewEntry > 1)
+	{
+		Algo::Sort(MakeArrayView(OutEntries.GetData() + FirstNewEntry, OutEntries.Num() - FirstNewEntry), 
+			[&Center](const FSelectableGridEntry * A, const FSelectableGridEntry * B)
+		{
+			return (A->Location - Center).SizeSquared() < (B->Location - Center).SizeSquared();
+		});
+	}
+}
+
+FIntPoint FSelectableSpatialGrid::GetCell(const FVector2D & Location)
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CELL_SIZE), FMath::FloorToInt(Location.Y / CELL_SIZE));
+}
+
+int32 FSelectableSpatialGrid::GetBucket(const FIntPoint & Cell)
+{
+	return ((static_cast<uint32>(Cell.X) * 73856093u) ^ (static_cast<uint32>(Cell.Y) * 19349663u)) & (NUM_BUCKETS - 1);
+}
@@ -0,0 +1,97 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Settings/ProjectSettings.h"
+
+class ARTSGameState;
+class ISelectable;
+
+
+/* A unit or building in the grid */
+struct FSelectableGridEntry
+{
+	AActor * Actor;
+	ISelectable * Selectable;
+
+	/* Location when the grid was built. Fine for range checks since grid is rebuilt every frame */
+	FVector2D Location;
+
+	/* ISelectable::GetBoundsLength */
+	float BoundsLength;
+
+	/* Grid cell Location is in */
+	FIntPoint Cell;
+
+	/* For looking up ARTSGameState::GetSelectableFlags and FVisibilityInfo without going 
+	through the actor */
+	uint8 OwnerID;
+	uint8 SelectableID;
+};
+
+
+/**
+ *	Uniform grid of the positions of every team's units and buildings, partitioned by team.
+ *	Answers 'what is within R of here' without going to the physics scene.
+ *
+ *	Owned by ARTSGameState and rebuilt at most once per frame, the first time something 
+ *	queries it that frame. Cells are hashed into a fixed number of buckets so it does not need 
+ *	to know the map bounds. Each team's entries are stored contiguously sorted by bucket.
+ */
+class RTS_VER2_API FSelectableSpatialGrid
+{
+public:
+
+	FSelectableSpatialGrid();
+
+	/* Rebuild from the units and buildings of every team unless it has already been built 
+	this frame */
+	void RebuildIfStale(const ARTSGameState * GameState);
+
+	/**
+	 *	Get every selectable whose bounds overlap a circle. Roughly what a capsule sweep against 
+	 *	team collision channels would return, except each selectable appears at most once.
+	 *
+	 *	@param Location - center of circle. Z axis is ignored
+	 *	@param Radius - radius of circle
+	 *	@param TeamsMask - bit N set = include selectables on Statics::ArrayIndexToTeam(N)
+	 *	@param OutEntries - entries are appended to this
+	 *	@param bSortByDistance - if true OutEntries will be ordered closest first
+	 */
+	void QueryRadius(const FVector & Location, float Radius, uint32 TeamsMask, 
+		TArray < const FSelectableGridEntry * > & OutEntries, bool bSortByDistance) const;
+
+	/* Width and length of a grid cell. Ideally around the size of the most common query radius */
+	static constexpr int32 CELL_SIZE = 1024;
+
+	/* Must be a power of 2 */
+	static constexpr int32 NUM_BUCKETS = 1024;
+
+private:
+
+	FORCEINLINE static FIntPoint GetCell(const FVector2D & Location);
+	FORCEINLINE static int32 GetBucket(const FIntPoint & Cell);
+
+	struct FTeamGrid
+	{
+		/* Every selectable on the team ordered by bucket */
+		TArray < FSelectableGridEntry > Entries;
+
+		/* Index in Entries where each bucket starts. Has NUM_BUCKETS + 1 elements so 
+		bucket N's entries are [BucketStarts[N], BucketStarts[N + 1]) */
+		TArray < int32 > BucketStarts;
+
+		/* Largest BoundsLength of any entry. Queries expand their radius by this */
+		float LargestBoundsLength;
+	};
+
+	FTeamGrid Teams[ProjectSettings::MAX_NUM_TEAMS];
+
+	/* Scratch array used while building */
+	TArray < FSelectableGridEntry > Unsorted;
+
+	/* GFrameCounter when last built */
+	uint64 LastBuildFrame;
+};
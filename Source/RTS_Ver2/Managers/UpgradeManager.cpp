@@ -24,7 +24,7 @@ AUpgradeManager::AUpgradeManager()
 
 	/* For some strange reason code in here is getting called before statics and if
 	referencing GEngine in here it will return nullptr. Therefore have moved
-	SetupTimers() and SetupUpgradesCompleted to BeginPlay() */
+	SetupTimers() to BeginPlay() */
 
 	bReplicates = false;
 	bReplicateMovement = false;
@@ -78,25 +78,6 @@ void AUpgradeManager::CreateUpgradeClassesAndPopulateUnresearchedArray()
 	}
 }
 
-void AUpgradeManager::SetupUpgradesCompleted()
-{
-	/* Setup 'times researched' map */
-	for (uint8 i = 0; i < Statics::NUM_UPGRADE_TYPES; ++i)
-	{
-		UpgradesCompleted.Emplace(Statics::ArrayIndexToUpgradeType(i), 0);
-	}
-
-	/* Setup each specific selectables upgrades map */
-	for (uint8 i = 0; i < Statics::NUM_BUILDING_TYPES; ++i)
-	{
-		CompletedBuildingUpgrades.Emplace(static_cast<EBuildingType>(i), FUpgradeArray());
-	}
-	for (uint8 i = 0; i < Statics::NUM_UNIT_TYPES; ++i)
-	{
-		CompletedUnitUpgrades.Emplace(Statics::ArrayIndexToUnitType(i), FUpgradeArray());
-	}
-}
-
 void AUpgradeManager::SetupHasUpgradePrerequisiteContainers()
 {
 	for (const auto & Pair : FI->GetAllBuildingTypes())
@@ -104,20 +85,10 @@ void AUpgradeManager::SetupHasUpgradePrerequisiteContainers()
 		const EBuildingType BuildingType = Pair.Key;
 		
 		const TArray<EUpgradeType> & UpgradePrereqArray = Pair.Value.GetUpgradePrerequisites();
-		if (UpgradePrereqArray.Num() > 0)
+		for (const auto & Prereq : UpgradePrereqArray)
 		{
-			FUpgradeTypeArray & ArrayStruct = PS->BuildingTypeToMissingUpgradePrereqs.Emplace(BuildingType, FUpgradeTypeArray(UpgradePrereqArray.Num()));
-			for (const auto & Prereq : UpgradePrereqArray)
-			{
-				ArrayStruct.Array.Emplace(Prereq);
-
-				if (HasUpgradePrerequisite_Buildings.Contains(Prereq) == false)
-				{
-					HasUpgradePrerequisite_Buildings.Emplace(Prereq, FUpgradeTypeArrayPtrArray());
-				}
-
-				HasUpgradePrerequisite_Buildings[Prereq].Array.Emplace(&ArrayStruct);
-			}
+			PS->BuildingTypeToMissingUpgradePrereqs[BuildingType].Add(Prereq);
+			HasUpgradePrerequisite_Buildings[Prereq].Add(BuildingType);
 		}
 	}
 
@@ -126,20 +97,10 @@ void AUpgradeManager::SetupHasUpgradePrerequisiteContainers()
 		const EUnitType UnitType = Pair.Key;
 
 		const TArray<EUpgradeType> & UpgradePrereqArray = Pair.Value.GetUpgradePrerequisites();
-		if (UpgradePrereqArray.Num() > 0)
+		for (const auto & Prereq : UpgradePrereqArray)
 		{
-			FUpgradeTypeArray & ArrayStruct = PS->UnitTypeToMissingUpgradePrereqs.Emplace(UnitType, FUpgradeTypeArray(UpgradePrereqArray.Num()));
-			for (const auto & Prereq : UpgradePrereqArray)
-			{
-				ArrayStruct.Array.Emplace(Prereq);
-
-				if (HasUpgradePrerequisite_Units.Contains(Prereq) == false)
-				{
-					HasUpgradePrerequisite_Units.Emplace(Prereq, FUpgradeTypeArrayPtrArray());
-				}
-
-				HasUpgradePrerequisite_Units[Prereq].Array.Emplace(&ArrayStruct);
-			}
+			PS->UnitTypeToMissingUpgradePrereqs[UnitType].Add(Prereq);
+			HasUpgradePrerequisite_Units[Prereq].Add(UnitType);
 		}
 	}
 
@@ -148,20 +109,10 @@ void AUpgradeManager::SetupHasUpgradePrerequisiteContainers()
 		const EUpgradeType UpgradeType = Pair.Key;
 
 		const TArray<EUpgradeType> & UpgradePrereqArray = Pair.Value.GetUpgradePrerequisites();
-		if (UpgradePrereqArray.Num() > 0)
+		for (const auto & Prereq : UpgradePrereqArray)
 		{
-			FUpgradeTypeArray & ArrayStruct = PS->UpgradeTypeToMissingUpgradePrereqs.Emplace(UpgradeType, FUpgradeTypeArray(UpgradePrereqArray.Num()));
-			for (const auto & Prereq : UpgradePrereqArray)
-			{
-				ArrayStruct.Array.Emplace(Prereq);
-
-				if (HasUpgradePrerequisite_Upgrades.Contains(Prereq) == false)
-				{
-					HasUpgradePrerequisite_Upgrades.Emplace(Prereq, FUpgradeTypeArrayPtrArray());
-				}
-
-				HasUpgradePrerequisite_Upgrades[Prereq].Array.Emplace(&ArrayStruct);
-			}
+			PS->UpgradeTypeToMissingUpgradePrereqs[UpgradeType].Add(Prereq);
+			HasUpgradePrerequisite_Upgrades[Prereq].Add(UpgradeType);
 		}
 	}
 }
@@ -172,7 +123,6 @@ void AUpgradeManager::Init()
 	
 	SetupReferences();
 	CreateUpgradeClassesAndPopulateUnresearchedArray();
-	SetupUpgradesCompleted();
 	SetupHasUpgradePrerequisiteContainers();
 
 	bHasInited = true;
@@ -357,49 +307,37 @@ bool AUpgradeManager::OnUpgradeComplete_UpdateSomeContainers(EUpgradeType Upgrad
 
 	bool bSomethingHasZeroUpgradePrereqsNow = false;
 
-	/* Each of these is O(n^2) although there will likely be very little entries in them */
+	/* Each of these is one bit removal per thing that has the upgrade as a prereq */
 	
 	// Buildings
-	if (HasUpgradePrerequisite_Buildings.Contains(UpgradeType))
+	HasUpgradePrerequisite_Buildings[UpgradeType].ForEach([&](EBuildingType Type)
 	{
-		const TArray<FUpgradeTypeArray*> & OuterArray = HasUpgradePrerequisite_Buildings[UpgradeType].Array;
-		for (int32 i = OuterArray.Num() - 1; i >= 0; --i)
-		{
-			TArray<EUpgradeType> & InnerArray = OuterArray[i]->Array;
-			
-			assert(InnerArray.Contains(UpgradeType));
-			InnerArray.RemoveSingleSwap(UpgradeType, false);
-			bSomethingHasZeroUpgradePrereqsNow |= (InnerArray.Num() == 0);
-		}
-	}
+		TEnumBitSet < EUpgradeType > & MissingPrereqs = PS->BuildingTypeToMissingUpgradePrereqs[Type];
+
+		assert(MissingPrereqs.Contains(UpgradeType));
+		MissingPrereqs.Remove(UpgradeType);
+		bSomethingHasZeroUpgradePrereqsNow |= MissingPrereqs.IsEmpty();
+	});
 	
 	// Units
-	if (HasUpgradePrerequisite_Units.Contains(UpgradeType))
+	HasUpgradePrerequisite_Units[UpgradeType].ForEach([&](EUnitType Type)
 	{
-		const TArray<FUpgradeTypeArray*> & OuterArray = HasUpgradePrerequisite_Units[UpgradeType].Array;
-		for (int32 i = OuterArray.Num() - 1; i >= 0; --i)
-		{
-			TArray<EUpgradeType> & InnerArray = OuterArray[i]->Array;
+		TEnumBitSet < EUpgradeType > & MissingPrereqs = PS->UnitTypeToMissingUpgradePrereqs[Type];
 
-			assert(InnerArray.Contains(UpgradeType));
-			InnerArray.RemoveSingleSwap(UpgradeType, false);
-			bSomethingHasZeroUpgradePrereqsNow |= (InnerArray.Num() == 0);
-		}
-	}
+		assert(MissingPrereqs.Contains(UpgradeType));
+		MissingPrereqs.Remove(UpgradeType);
+		bSomethingHasZeroUpgradePrereqsNow |= MissingPrereqs.IsEmpty();
+	});
 	
 	// Upgrades
-	if (HasUpgradePrerequisite_Upgrades.Contains(UpgradeType))
+	HasUpgradePrerequisite_Upgrades[UpgradeType].ForEach([&](EUpgradeType Type)
 	{
-		const TArray<FUpgradeTypeArray*> & OuterArray = HasUpgradePrerequisite_Upgrades[UpgradeType].Array;
-		for (int32 i = OuterArray.Num() - 1; i >= 0; --i)
-		{
-			TArray<EUpgradeType> & InnerArray = OuterArray[i]->Array;
+		TEnumBitSet < EUpgradeType > & MissingPrereqs = PS->UpgradeTypeToMissingUpgradePrereqs[Type];
 
-			assert(InnerArray.Contains(UpgradeType));
-			InnerArray.RemoveSingleSwap(UpgradeType, false);
-			bSomethingHasZeroUpgradePrereqsNow |= (InnerArray.Num() == 0);
-		}
-	}
+		assert(MissingPrereqs.Contains(UpgradeType));
+		MissingPrereqs.Remove(UpgradeType);
+		bSomethingHasZeroUpgradePrereqsNow |= MissingPrereqs.IsEmpty();
+	});
 
 	return bSomethingHasZeroUpgradePrereqsNow;
 }
@@ -6,6 +6,7 @@
 #include "GameFramework/Info.h"
 
 #include "Statics/CommonEnums.h"
+#include "Statics/EnumTables.h"
 #include "UpgradeManager.generated.h"
 
 class ARTSPlayerState;
@@ -14,7 +15,6 @@ class AFactionInfo;
 class AInfantry;
 class ABuilding;
 class UUpgradeEffect;
-struct FUpgradeTypeArray;
 
 // TODO does this even need to be an actor? UObject probably ok since it doesnt replicate
 
@@ -26,13 +26,6 @@ enum class EUpgradeAquireMethod : uint8
 };
 
 
-/* Array of pointers to array of upgrade types */
-struct FUpgradeTypeArrayPtrArray
-{
-	TArray<FUpgradeTypeArray*> Array;
-};
-
-
 /* Array containing upgrades. Workaround for non 2D TArrays */
 USTRUCT()
 struct FUpgradeArray
@@ -85,20 +78,17 @@ private:
 
 	/* Maps upgrade type to how many times it has been researched, which is
 	limited to 0 or 1 at the moment */
-	UPROPERTY()
-	TMap <EUpgradeType, uint8> UpgradesCompleted;
+	TEnumTable < EUpgradeType, uint8 > UpgradesCompleted;
 
 	/* Maps upgrade type to its effects */
 	UPROPERTY()
 	TMap <EUpgradeType, UUpgradeEffect *> UpgradeEffects;
 
 	/* Maps building type to array of all upgrades completed for it */
-	UPROPERTY()
-	TMap <EBuildingType, FUpgradeArray> CompletedBuildingUpgrades;
+	TEnumTable < EBuildingType, FUpgradeArray > CompletedBuildingUpgrades;
 
 	/* Maps unit type to array of all upgrades completed for it */
-	UPROPERTY()
-	TMap <EUnitType, FUpgradeArray> CompletedUnitUpgrades;
+	TEnumTable < EUnitType, FUpgradeArray > CompletedUnitUpgrades;
 
 	/* Maps from upgrade type to actor (usually building) that has upgrade queued (not necessarily
 	researching it yet). Updated server-side only */
@@ -112,23 +102,18 @@ private:
 	TArray <EUpgradeType> UnresearchedUpgrades;
 
 	/** 
-	 *	Maps upgrade type to an array. The array points to arrays in PS. These arrays contain 
-	 *	upgrade types that have not yet been obtained but that are a prerequisite for a 
-	 *	building/unit/upgrade. 
-	 *
-	 *	If the upgrade isn't a prerequisite for anything then it will not have an entry 
-	 *	in any of these TMap.
+	 *	Maps upgrade type to the set of buildings/units/upgrades that have it as a prerequisite. 
+	 *	When the upgrade completes it gets removed from each of their sets in 
+	 *	PS::*ToMissingUpgradePrereqs. 
 	 */
-	TMap<EUpgradeType, FUpgradeTypeArrayPtrArray> HasUpgradePrerequisite_Buildings;
-	TMap<EUpgradeType, FUpgradeTypeArrayPtrArray> HasUpgradePrerequisite_Units;
-	TMap<EUpgradeType, FUpgradeTypeArrayPtrArray> HasUpgradePrerequisite_Upgrades;
+	TEnumTable < EUpgradeType, TEnumBitSet < EBuildingType > > HasUpgradePrerequisite_Buildings;
+	TEnumTable < EUpgradeType, TEnumBitSet < EUnitType > > HasUpgradePrerequisite_Units;
+	TEnumTable < EUpgradeType, TEnumBitSet < EUpgradeType > > HasUpgradePrerequisite_Upgrades;
 
 	void SetupReferences();
 
 	void CreateUpgradeClassesAndPopulateUnresearchedArray();
 
-	void SetupUpgradesCompleted();
-
 	void SetupHasUpgradePrerequisiteContainers();
 
 	/** 
@@ -25,6 +25,7 @@
 #include "Statics/DevelopmentStatics.h"
 #include "GameFramework/FactionInfo.h"
 #include "UI/InMatchWidgets/InfantryControllerDebugWidget.h"
+#include "Managers/InfantryControllerTickManager.h"
 
 
 // Scheduale:
@@ -36,7 +37,14 @@
 
 AInfantryController::AInfantryController()
 {
+	/* AInfantryControllerTickManager ticks us */
+	PrimaryActorTick.bCanEverTick = false;
+
+	AccumulatedTickBehaviorTime = 0.f;
+	IdleBehaviorFrameSlot = 0;
 	DoOnMoveComplete = nullptr;
+	PendingPathRequestID = 0;
+	PendingMoveAcceptanceRadius = 0.f;
 	PendingContextAction = nullptr;
 	SetPendingContextActionType(EContextButton::None);
 
@@ -214,17 +222,12 @@ void AInfantryController::StartBehavior(ABuilding * BuildingSpawnedFrom)
 		}
 	}
 
-	// Tick will do behavior
+	// AInfantryControllerTickManager will do behavior from here
+	GS->GetInfantryControllerTickManager()->RegisterInfantryController(this);
 }
 
-void AInfantryController::Tick(float DeltaTime)
+bool AInfantryController::TickTimers(float DeltaTime)
 {
-	if (UnitState == EUnitState::PossessedUnitDestroyed || UnitState == EUnitState::BehaviorNotStarted)
-	{
-		Super::Tick(DeltaTime);
-		return;
-	}
-
 	// Check if attack needs resetting and reset it if so
 	bool bIsAttackCoolingDown = TimeTillAttackResets > 0.f;
 	TimeTillAttackResets -= DeltaTime;
@@ -235,14 +238,14 @@ void AInfantryController::Tick(float DeltaTime)
 		OnResetFire();
 	}
 
+	/* Tick manager resets this when it actually does the behavior tick. It may hold off a 
+	frame or two for some states */
 	AccumulatedTickBehaviorTime += DeltaTime;
-	if (AccumulatedTickBehaviorTime >= BehaviorTickRate)
-	{
-		AccumulatedTickBehaviorTime = 0.f;
-
-		TickBehavior();
-	}
+	return AccumulatedTickBehaviorTime >= BehaviorTickRate;
+}
 
+void AInfantryController::TickAttackAndRotation(float DeltaTime)
+{
 	if (AnimStateForBehavior == EUnitAnimState::NotPlayingImportantAnim)
 	{
 		// Check if in a state that actually tries to attack target
@@ -261,7 +264,8 @@ void AInfantryController::Tick(float DeltaTime)
 		}
 	}
 
-	Super::Tick(DeltaTime);
+	/* What AAIController::Tick would have done */
+	UpdateControlRotation(DeltaTime, true);
 }
 
 void AInfantryController::UpdateControlRotation(float DeltaTime, bool bUpdatePawn)
@@ -348,6 +352,21 @@ void AInfantryController::UpdateControlRotation(float DeltaTime, bool bUpdatePaw
 	}
 }
 
+void AInfantryController::StopMovement()
+{
+	PendingPathRequestID = 0;
+
+	Super::StopMovement();
+}
+
+FPathFollowingRequestResult AInfantryController::MoveTo(const FAIMoveRequest & MoveRequest, 
+	FNavPathSharedPtr * OutPath)
+{
+	PendingPathRequestID = 0;
+
+	return Super::MoveTo(MoveRequest, OutPath);
+}
+
 void AInfantryController::OnMoveCompleted(FAIRequestID RequestID, const FPathFollowingResult & Result)
 {
 	/* For this to be called basically unit must be moving @See UPathFollowingComponent::AbortMove
@@ -403,14 +422,6 @@ void AInfantryController::OnMoveCompleted(FAIRequestID RequestID, const FPathFol
 	}
 }
 
-void AInfantryController::TickBehavior()
-{
-	/* TODO: make sure range checks take into account bounds of enemy */
-
-	/* Call correct function based on state */
-	(this->* (TickFunctions[UnitState]))();
-}
-
 void AInfantryController::TickAI_MovingToBarracksInitialPoint()
 {
 }
@@ -1194,7 +1205,7 @@ void AInfantryController::OnAttackMoveCommand(const FVector & Location, ISelecta
 }
 
 // Right click command version where a world location was clicked on, not another selectable
-void AInfantryController::OnRightClickCommand(const FVector & Location)
+void AInfantryController::OnRightClickCommand(const FVector & Location, const FNavPathSharedPtr & GroupPath)
 {
 	if (AnimStateForBehavior == EUnitAnimState::DoingUninterruptibleContextActionAnim)
 	{
@@ -1213,7 +1224,7 @@ void AInfantryController::OnRightClickCommand(const FVector & Location)
 	SetUnitState(EUnitState::MovingToRightClickLocation);
 
 	DoOnMoveComplete = &AInfantryController::GoIdle;
-	Move(Location);
+	Move(Location, GroupPath);
 }
 
 void AInfantryController::OnRightClickCommand(ISelectable * TargetAsSelectable, const FSelectableAttributesBase & TargetInfo)
@@ -2716,8 +2727,18 @@ void AInfantryController::TryLayFoundations()
 		SetAnimStateForBehavior(EUnitAnimState::NotPlayingImportantAnim);
 
 		/* Once this function completes it will then call OnContextMenuPlaceBuildingSuccess */
-		PS->GetPC()->Server_PlaceBuilding(FoundationType, ClickLocation, FoundationRotation,
-			Unit->GetSelectableID());
+		if (PS->GetPC() != nullptr)
+		{
+			PS->GetPC()->Server_PlaceBuilding(FoundationType, ClickLocation, FoundationRotation,
+				Unit->GetSelectableID());
+		}
+		else
+		{
+			/* Human player that is being replayed from a command recording */
+			ARTSPlayerController * LocalPlayCon = CastChecked<ARTSPlayerController>(GetWorld()->GetFirstPlayerController());
+			LocalPlayCon->PlaceBuildingForReplayedPlayer(PS, FoundationType, ClickLocation, 
+				FoundationRotation, Unit->GetSelectableID());
+		}
 
 		// OnContextMenuPlaceBuildingResult will be called next by PC
 	}
@@ -3745,6 +3766,17 @@ bool AInfantryController::CanTargetBeAquired(const AActor * PotentialNewTarget)
 		&& !Statics::HasZeroHealth(PotentialNewTarget);
 }
 
+bool AInfantryController::CanTargetBeAquired(const FSelectableGridEntry & PotentialNewTarget, FSelectableFlags TargetFlags) const
+{
+	/* Grid query should not be returning friendlies in the first place */
+	assert(TargetFlags.IsHostile(PS->GetTeam()));
+
+	return !TargetFlags.HasZeroHealth()
+		&& (Unit->AtkAttr.CanAttackAir() || !TargetFlags.IsAirUnit())
+		&& Statics::CanTypeBeTargeted(TargetFlags, Unit->AtkAttr.GetAcceptableTargetTypes())
+		&& TeamVisInfo->IsSelectableVisible(PotentialNewTarget.OwnerID, PotentialNewTarget.SelectableID);
+}
+
 bool AInfantryController::HasTarget() const
 {
 	return Statics::IsValid(AttackTarget);
@@ -3802,41 +3834,37 @@ void AInfantryController::OnResetFire()
 
 AActor * AInfantryController::FindClosestValidEnemyInRange(float Radius, bool bForceOnTargetChangeCall)
 {
-	TArray<FHitResult> NearbyEnemies;
+	TArray<const FSelectableGridEntry *> NearbyEnemies;
 
-	/* Setup channels to query */
-	FCollisionObjectQueryParams ObjectQueryParams;
-	for (const uint8 & EnemyChannel : GS->GetEnemyChannels(PS->GetTeam()))
-	{
-		ObjectQueryParams.AddObjectTypesToQuery(static_cast<ECollisionChannel>(EnemyChannel));
-	}
-
-	/* This can be changed to a single sweep if two conditions are met:
-	1. Radius <= Range is always true
-	2. We don't prioritize attack capable selectables over non-attackers when choosing target */
-	Statics::CapsuleSweep(GetWorld(), NearbyEnemies, Unit->GetActorLocation(), ObjectQueryParams,
-		Radius);
+	GS->GetSelectableGrid().QueryRadius(Unit->GetActorLocation(), Radius, 
+		GS->GetEnemyTeamsMask(PS->GetTeam()), NearbyEnemies, true);
 
 	/* Closest enemy that isn't capable of attacking. Return this if all nearby enemies cannot
 	attack */
 	AActor * ClosestEnemyWithoutAttack = nullptr;
 
 	/* Now return closest enemy. Prefer units/buildings that can attack over those that can't.
-	Assumes array already ordered from closest to futherest away */
+	Array is ordered from closest to furthest away */
 	for (int32 i = 0; i < NearbyEnemies.Num(); ++i)
 	{
-		AActor * Enemy = NearbyEnemies[i].GetActor();
+		const FSelectableGridEntry & Entry = *NearbyEnemies[i];
+		AActor * Enemy = Entry.Actor;
 
-		/* Can these sweeps pickup nulls or non-valids? If so then this may need to be changed to
-		an if(UStatics::IsValid) instead */
-		assert(Enemy != nullptr);
+		/* Grid is built at most a frame ago so things may have been destroyed since */
+		if (!Statics::IsValid(Enemy))
+		{
+			continue;
+		}
 		assert(Enemy != Unit);
 
+		/* Read from the table instead of the grid entry since these can change mid frame */
+		const FSelectableFlags EnemyFlags = GS->GetSelectableFlags(Entry.OwnerID, Entry.SelectableID);
+
 		/* Check if outside fog, type etc */
-		if (CanTargetBeAquired(Enemy))
+		if (CanTargetBeAquired(Entry, EnemyFlags))
 		{
 			/* Check if enemy can attack because prefer attackers over non-attackers */
-			if (Statics::HasAttack(Enemy))
+			if (EnemyFlags.HasAttack())
 			{
 				if (Enemy != AttackTarget || bForceOnTargetChangeCall)
 				{
@@ -3862,7 +3890,8 @@ AActor * AInfantryController::FindClosestValidEnemyInRange(float Radius, bool bF
 
 bool AInfantryController::IsMoving() const
 {
-	return GetMoveStatus() != EPathFollowingStatus::Idle;
+	/* Waiting on a path counts as moving */
+	return PendingPathRequestID != 0 || GetMoveStatus() != EPathFollowingStatus::Idle;
 }
 
 bool AInfantryController::CanFire() const
@@ -3987,6 +4016,12 @@ void AInfantryController::StopBehaviour()
 }
 
 EPathFollowingRequestResult::Type AInfantryController::Move(const FVector & Location, float AcceptanceRadius)
+{
+	return Move(Location, nullptr, AcceptanceRadius);
+}
+
+EPathFollowingRequestResult::Type AInfantryController::Move(const FVector & Location, 
+	const FNavPathSharedPtr & Path, float AcceptanceRadius)
 {
 	/* Play a 'moving while holding resources' anim if unit is holding resources and anim was
 	set in editor */
@@ -4004,7 +4039,82 @@ EPathFollowingRequestResult::Type AInfantryController::Move(const FVector & Loca
 
 	SetFacing_MovementDirection();
 
-	return MoveToLocation(Location, AcceptanceRadius);
+	/* This replaces whatever move we were waiting on */
+	PendingPathRequestID = 0;
+
+	if (Path.IsValid())
+	{
+		return MoveAlongPath(Location, Path, AcceptanceRadius);
+	}
+
+	/* Already there. MoveToLocation will finish the move straight away without a path query 
+	which OnMoveCompleted relies on */
+	if (GetPathFollowingComponent()->HasReached(Location, EPathFollowingReachMode::OverlapAgent, AcceptanceRadius)
+		|| GS->GetInfantryControllerTickManager() == nullptr)
+	{
+		return MoveToLocation(Location, AcceptanceRadius);
+	}
+
+	/* Stop following the old path. NewRequest flag means OnMoveCompleted ignores it the same 
+	way it would if MoveToLocation had been called */
+	if (GetMoveStatus() != EPathFollowingStatus::Idle)
+	{
+		GetPathFollowingComponent()->AbortMove(*this, FPathFollowingResultFlags::NewRequest, 
+			FAIRequestID::CurrentRequest, EPathFollowingVelocityMode::Keep);
+	}
+
+	PendingMoveLocation = Location;
+	PendingMoveAcceptanceRadius = AcceptanceRadius;
+	PendingPathRequestID = GS->GetInfantryControllerTickManager()->RequestPath(this, 
+		GetNavAgentLocation(), Location);
+
+	return EPathFollowingRequestResult::RequestSuccessful;
+}
+
+EPathFollowingRequestResult::Type AInfantryController::MoveAlongPath(const FVector & Location, 
+	const FNavPathSharedPtr & Path, float AcceptanceRadius)
+{
+	/* Same settings MoveToLocation uses */
+	FAIMoveRequest MoveRequest(Location);
+	MoveRequest.SetAcceptanceRadius(AcceptanceRadius);
+	MoveRequest.SetReachTestIncludesAgentRadius(true);
+	MoveRequest.SetCanStrafe(true);
+
+	const FAIRequestID RequestID = RequestMove(MoveRequest, Path);
+
+	return RequestID.IsValid() ? EPathFollowingRequestResult::RequestSuccessful 
+		: EPathFollowingRequestResult::Failed;
+}
+
+void AInfantryController::OnPathRequestFinished(uint32 RequestID, const FNavPathSharedPtr & Path, 
+	bool bNoPathExists)
+{
+	/* Ignore it if there has been another move or a stop since it was asked for */
+	if (RequestID != PendingPathRequestID || UnitState == EUnitState::PossessedUnitDestroyed)
+	{
+		return;
+	}
+
+	PendingPathRequestID = 0;
+
+	if (Path.IsValid())
+	{
+		if (MoveAlongPath(PendingMoveLocation, Path, PendingMoveAcceptanceRadius) 
+			!= EPathFollowingRequestResult::Failed)
+		{
+			return;
+		}
+	}
+	else if (!bNoPathExists)
+	{
+		/* The queue could not give us a copy of the shared path so query our own */
+		MoveToLocation(PendingMoveLocation, PendingMoveAcceptanceRadius);
+		return;
+	}
+
+	/* Finish the move the same way AAIController::MoveTo does when it cannot find a path so 
+	OnMoveCompleted still gets called and the unit does not get stuck in its current state */
+	GetPathFollowingComponent()->RequestMoveWithImmediateFinish(EPathFollowingResult::Invalid);
 }
 
 void AInfantryController::Delay(FTimerHandle & TimerHandle, void(AInfantryController::* Function)(), float Delay)
@@ -4024,115 +4134,49 @@ void AInfantryController::SetupReferences(APawn * InPawn)
 	CharacterMovement = Unit->GetCharacterMovement();
 }
 
-TMap<EUnitState, AInfantryController::FunctionPtrType> AInfantryController::SetupTickFunctions() const
-{
-	TMap <EUnitState, AInfantryController::FunctionPtrType> Functions;
-
-	const int32 NumContainerEntries = static_cast<uint8>(EUnitState::z_ALWAYS_LAST_IN_ENUM) - 2;
-	Functions.Reserve(NumContainerEntries);
-
-	AInfantryController::FunctionPtrType Ptr;
-
-	Ptr = &AInfantryController::TickAI_AttackMoveCommandWithNoTargetAquired;
-	Functions.Emplace(EUnitState::AttackMoveCommand_WithNoTargetAquired, Ptr);
-
-	Ptr = &AInfantryController::TickAI_AttackMoveCommandWithTargetAquired;
-	Functions.Emplace(EUnitState::AttackMoveCommand_WithTargetAquired, Ptr);
-
-	Ptr = &AInfantryController::TickAI_AttackMoveCommand_ReturningToLeashLocation;
-	Functions.Emplace(EUnitState::AttackMoveCommand_ReturningToLeashLocation, Ptr);
-
-	Ptr = &AInfantryController::TickAI_Idle_ReturningToLeashLocation;
-	Functions.Emplace(EUnitState::Idle_ReturningToLeashLocation, Ptr);
-
-	Ptr = &AInfantryController::TickAI_ChasingTargetToDoContextCommand;
-	Functions.Emplace(EUnitState::ChasingTargetToDoContextCommand, Ptr);
-
-	Ptr = &AInfantryController::TickAI_HeadingToBuildingToDoBuildingTargetingAbility;
-	Functions.Emplace(EUnitState::HeadingToBuildingToDoBuildingTargetingAbility, Ptr);
-
-	Ptr = &AInfantryController::TickAI_HeadingToBuildingToEnterItsGarrison;
-	Functions.Emplace(EUnitState::HeadingToBuildingToEnterItsGarrison, Ptr);
-
-	Ptr = &AInfantryController::TickAI_InsideBuildingGarrison;
-	Functions.Emplace(EUnitState::InsideBuildingGarrison, Ptr);
-
-	Ptr = &AInfantryController::TickAI_HeadingToConstructionSite;
-	Functions.Emplace(EUnitState::HeadingToConstructionSite, Ptr);
-
-	Ptr = &AInfantryController::TickAI_HeadingToContextCommandWorldLocation;
-	Functions.Emplace(EUnitState::HeadingToContextCommandWorldLocation, Ptr);
-
-	Ptr = &AInfantryController::TickAI_HeadingToPotentialConstructionSite;
-	Functions.Emplace(EUnitState::HeadingToPotentialConstructionSite, Ptr);
-
-	Ptr = &AInfantryController::TickAI_HeadingToResourceSpot;
-	Functions.Emplace(EUnitState::HeadingToResourceSpot, Ptr);
-
-	Ptr = &AInfantryController::TickAI_HoldingPositionWithoutTarget;
-	Functions.Emplace(EUnitState::HoldingPositionWithoutTarget, Ptr);
-
-	Ptr = &AInfantryController::TickAI_HoldingPositionWithTarget;
-	Functions.Emplace(EUnitState::HoldingPositionWithTarget, Ptr);
-
-	Ptr = &AInfantryController::TickAI_IdleWithoutTarget;
-	Functions.Emplace(EUnitState::Idle_WithoutTarget, Ptr);
-
-	Ptr = &AInfantryController::TickAI_IdleWithTarget;
-	Functions.Emplace(EUnitState::Idle_WithTarget, Ptr);
-
-	Ptr = &AInfantryController::TickAI_MoveCommandToFriendlyMobileSelectable;
-	Functions.Emplace(EUnitState::MoveCommandToFriendlyMobileSelectable, Ptr);
-
-	Ptr = &AInfantryController::TickAI_MovingToRightClickLocation;
-	Functions.Emplace(EUnitState::MovingToRightClickLocation, Ptr);
-
-	Ptr = &AInfantryController::TickAI_ReturningToResourceDepot;
-	Functions.Emplace(EUnitState::ReturningToResourceDepot, Ptr);
-
-	Ptr = &AInfantryController::TickAI_RightClickOnEnemy;
-	Functions.Emplace(EUnitState::RightClickOnEnemy, Ptr);
-
-	Ptr = &AInfantryController::TickAI_WaitingForFoundationsToBePlaced;
-	Functions.Emplace(EUnitState::WaitingForFoundationsToBePlaced, Ptr);
-
-	Ptr = &AInfantryController::TickAI_WaitingToGatherResources;
-	Functions.Emplace(EUnitState::WaitingToGatherResources, Ptr);
-
-	Ptr = &AInfantryController::TickAI_GatheringResources;
-	Functions.Emplace(EUnitState::GatheringResources, Ptr);
-
-	Ptr = &AInfantryController::TickAI_DoingContextActionAnim;
-	Functions.Emplace(EUnitState::DoingContextActionAnim, Ptr);
-
-	Ptr = &AInfantryController::TickAI_DoingSpecialBuildingTargetingAbility;
-	Functions.Emplace(EUnitState::DoingSpecialBuildingTargetingAbility, Ptr);
-
-	Ptr = &AInfantryController::TickAI_ConstructingBuilding;
-	Functions.Emplace(EUnitState::ConstructingBuilding, Ptr);
-
-	Ptr = &AInfantryController::TickAI_DroppingOffResources;
-	Functions.Emplace(EUnitState::DroppingOfResources, Ptr);
-
-	Ptr = &AInfantryController::TickAI_MovingToPointNearStaticSelectable;
-	Functions.Emplace(EUnitState::MovingToPointNearStaticSelectable, Ptr);
-
-	Ptr = &AInfantryController::TickAI_MovingToBarracksInitialPoint;
-	Functions.Emplace(EUnitState::MovingToBarracksInitialPoint, Ptr);
-
-	Ptr = &AInfantryController::TickAI_MovingToBarracksRallyPoint;
-	Functions.Emplace(EUnitState::MovingToBarracksRallyPoint, Ptr);
-
-	Ptr = &AInfantryController::TickAI_GoingToPickUpInventoryItem;
-	Functions.Emplace(EUnitState::GoingToPickUpInventoryItem, Ptr);
-
-	Ptr = &AInfantryController::TickAI_PickingUpInventoryItem;
-	Functions.Emplace(EUnitState::PickingUpInventoryItem, Ptr);
-
-	assert(Functions.Num() == NumContainerEntries);
-
-	return Functions;
-}
+constexpr AInfantryController::FTickFunctionTable AInfantryController::SetupTickFunctions()
+{
+	/* BehaviorNotStarted and PossessedUnitDestroyed stay null. Controllers in those states 
+	never get behavior ticks */
+	FTickFunctionTable Table = {};
+
+	Table.Functions[static_cast<uint8>(EUnitState::AttackMoveCommand_WithNoTargetAquired)] = &AInfantryController::TickAI_AttackMoveCommandWithNoTargetAquired;
+	Table.Functions[static_cast<uint8>(EUnitState::AttackMoveCommand_WithTargetAquired)] = &AInfantryController::TickAI_AttackMoveCommandWithTargetAquired;
+	Table.Functions[static_cast<uint8>(EUnitState::AttackMoveCommand_ReturningToLeashLocation)] = &AInfantryController::TickAI_AttackMoveCommand_ReturningToLeashLocation;
+	Table.Functions[static_cast<uint8>(EUnitState::Idle_ReturningToLeashLocation)] = &AInfantryController::TickAI_Idle_ReturningToLeashLocation;
+	Table.Functions[static_cast<uint8>(EUnitState::ChasingTargetToDoContextCommand)] = &AInfantryController::TickAI_ChasingTargetToDoContextCommand;
+	Table.Functions[static_cast<uint8>(EUnitState::HeadingToBuildingToDoBuildingTargetingAbility)] = &AInfantryController::TickAI_HeadingToBuildingToDoBuildingTargetingAbility;
+	Table.Functions[static_cast<uint8>(EUnitState::HeadingToBuildingToEnterItsGarrison)] = &AInfantryController::TickAI_HeadingToBuildingToEnterItsGarrison;
+	Table.Functions[static_cast<uint8>(EUnitState::InsideBuildingGarrison)] = &AInfantryController::TickAI_InsideBuildingGarrison;
+	Table.Functions[static_cast<uint8>(EUnitState::HeadingToConstructionSite)] = &AInfantryController::TickAI_HeadingToConstructionSite;
+	Table.Functions[static_cast<uint8>(EUnitState::HeadingToContextCommandWorldLocation)] = &AInfantryController::TickAI_HeadingToContextCommandWorldLocation;
+	Table.Functions[static_cast<uint8>(EUnitState::HeadingToPotentialConstructionSite)] = &AInfantryController::TickAI_HeadingToPotentialConstructionSite;
+	Table.Functions[static_cast<uint8>(EUnitState::HeadingToResourceSpot)] = &AInfantryController::TickAI_HeadingToResourceSpot;
+	Table.Functions[static_cast<uint8>(EUnitState::HoldingPositionWithoutTarget)] = &AInfantryController::TickAI_HoldingPositionWithoutTarget;
+	Table.Functions[static_cast<uint8>(EUnitState::HoldingPositionWithTarget)] = &AInfantryController::TickAI_HoldingPositionWithTarget;
+	Table.Functions[static_cast<uint8>(EUnitState::Idle_WithoutTarget)] = &AInfantryController::TickAI_IdleWithoutTarget;
+	Table.Functions[static_cast<uint8>(EUnitState::Idle_WithTarget)] = &AInfantryController::TickAI_IdleWithTarget;
+	Table.Functions[static_cast<uint8>(EUnitState::MoveCommandToFriendlyMobileSelectable)] = &AInfantryController::TickAI_MoveCommandToFriendlyMobileSelectable;
+	Table.Functions[static_cast<uint8>(EUnitState::MovingToRightClickLocation)] = &AInfantryController::TickAI_MovingToRightClickLocation;
+	Table.Functions[static_cast<uint8>(EUnitState::ReturningToResourceDepot)] = &AInfantryController::TickAI_ReturningToResourceDepot;
+	Table.Functions[static_cast<uint8>(EUnitState::RightClickOnEnemy)] = &AInfantryController::TickAI_RightClickOnEnemy;
+	Table.Functions[static_cast<uint8>(EUnitState::WaitingForFoundationsToBePlaced)] = &AInfantryController::TickAI_WaitingForFoundationsToBePlaced;
+	Table.Functions[static_cast<uint8>(EUnitState::WaitingToGatherResources)] = &AInfantryController::TickAI_WaitingToGatherResources;
+	Table.Functions[static_cast<uint8>(EUnitState::GatheringResources)] = &AInfantryController::TickAI_GatheringResources;
+	Table.Functions[static_cast<uint8>(EUnitState::DoingContextActionAnim)] = &AInfantryController::TickAI_DoingContextActionAnim;
+	Table.Functions[static_cast<uint8>(EUnitState::DoingSpecialBuildingTargetingAbility)] = &AInfantryController::TickAI_DoingSpecialBuildingTargetingAbility;
+	Table.Functions[static_cast<uint8>(EUnitState::ConstructingBuilding)] = &AInfantryController::TickAI_ConstructingBuilding;
+	Table.Functions[static_cast<uint8>(EUnitState::DroppingOfResources)] = &AInfantryController::TickAI_DroppingOffResources;
+	Table.Functions[static_cast<uint8>(EUnitState::MovingToPointNearStaticSelectable)] = &AInfantryController::TickAI_MovingToPointNearStaticSelectable;
+	Table.Functions[static_cast<uint8>(EUnitState::MovingToBarracksInitialPoint)] = &AInfantryController::TickAI_MovingToBarracksInitialPoint;
+	Table.Functions[static_cast<uint8>(EUnitState::MovingToBarracksRallyPoint)] = &AInfantryController::TickAI_MovingToBarracksRallyPoint;
+	Table.Functions[static_cast<uint8>(EUnitState::GoingToPickUpInventoryItem)] = &AInfantryController::TickAI_GoingToPickUpInventoryItem;
+	Table.Functions[static_cast<uint8>(EUnitState::PickingUpInventoryItem)] = &AInfantryController::TickAI_PickingUpInventoryItem;
+
+	return Table;
+}
+
+const AInfantryController::FTickFunctionTable AInfantryController::TickFunctions = AInfantryController::SetupTickFunctions();
 
 void AInfantryController::DoNothing()
 {
@@ -19,6 +19,7 @@ class AFactionInfo;
 class UCharacterMovementComponent;
 class UCanvas;
 class AResourceSpot;
+class AInfantryControllerTickManager;
 struct FContextButtonInfo;
 struct FContextButton;
 struct FSelectableAttributesBase;
@@ -30,12 +31,14 @@ struct FBuildingTargetingAbilityPerSelectableInfo;
 struct FBuildingTargetingAbilityStaticInfo;
 struct FBuildingGarrisonAttributes;
 struct FVisibilityInfo;
+struct FSelectableGridEntry;
+struct FSelectableFlags;
 
 
 /** 
  *	This holds behavior states. 
  *	Make sure if you add any new values to this enum that you add a TickAI_ func too and then assign 
- *	it in SetupTickFunctions()
+ *	it in SetupTickFunctions(). AInfantryControllerTickManager buckets controllers by this
  */
 UENUM()
 enum class EUnitState : uint8
@@ -235,6 +238,18 @@ public:
 
 	AInfantryController();
 
+	/* Typedef for function pointer */
+	typedef void (AInfantryController:: *FunctionPtrType)(void);
+
+	/* Number of values in EUnitState */
+	static constexpr uint8 NUM_UNIT_STATES = static_cast<uint8>(EUnitState::z_ALWAYS_LAST_IN_ENUM);
+
+	/* Flat table of TickAI_ functions. Key = EUnitState as uint8 */
+	struct FTickFunctionTable
+	{
+		FunctionPtrType Functions[NUM_UNIT_STATES];
+	};
+
 	// 4.22: changed this from Possess to OnPossess since Possess is final
 	virtual void OnPossess(APawn * InPawn) override;
 
@@ -252,9 +267,6 @@ public:
 
 protected:
 
-	// Typedef for function pointer 
-	typedef void (AInfantryController:: *FunctionPtrType)(void);
-
 	/* Path following result of the last move completed */
 	FString LastCompletedMoveResult;
 
@@ -267,19 +279,50 @@ public:
 	/* @param BuildingSpawnedFrom - the building the infantry was produced from */
 	void StartBehavior(ABuilding * BuildingSpawnedFrom);
 
-	virtual void Tick(float DeltaTime) override;
-
 	/* Update direction AI is looking based on FocalPoint */
 	virtual void UpdateControlRotation(float DeltaTime, bool bUpdatePawn) override;
 
 	virtual void OnMoveCompleted(FAIRequestID RequestID, const FPathFollowingResult & Result) override;
 
-	void TickBehavior();
+	/* Also drops any path request we are waiting on */
+	virtual void StopMovement() override;
+
+	/* Every MoveToActor/MoveToLocation goes through here. Drops any path request we are 
+	waiting on so it does not replace this move when it arrives */
+	virtual FPathFollowingRequestResult MoveTo(const FAIMoveRequest & MoveRequest, 
+		FNavPathSharedPtr * OutPath = nullptr) override;
+
+	/**
+	 *	Called by FPathRequestQueue when a path we asked for in Move is ready
+	 *
+	 *	@param RequestID - ID the request was made with
+	 *	@param Path - path to follow, or null if there is not one
+	 *	@param bNoPathExists - if Path is null: true if the query found no path, false if the 
+	 *	queue could not share its path with us and we should query our own
+	 */
+	void OnPathRequestFinished(uint32 RequestID, const FNavPathSharedPtr & Path, bool bNoPathExists);
 
 private:
 
-	/* Functions for what to do on AI ticks based on state */
-	const TMap<EUnitState, FunctionPtrType> TickFunctions = SetupTickFunctions();
+	friend AInfantryControllerTickManager;
+
+	/* Infantry controllers do not tick. AInfantryControllerTickManager calls these each 
+	frame instead */
+
+	/**
+	 *	Count down attack cooldown and the time till the next behavior tick 
+	 *	
+	 *	@return - true if a behavior tick is due 
+	 */
+	bool TickTimers(float DeltaTime);
+
+	/* Start an attack if we want to and can, then update rotation. Part of what used to be 
+	done after TickBehavior in AActor::Tick */
+	void TickAttackAndRotation(float DeltaTime);
+
+	/* Functions for what to do on AI ticks based on state. Null for states that never do 
+	behavior ticks */
+	static const FTickFunctionTable TickFunctions;
 
 	void TickAI_MovingToBarracksInitialPoint();
 	void TickAI_MovingToBarracksRallyPoint();
@@ -434,6 +477,10 @@ private:
 	// Time towards calling TickAI
 	float AccumulatedTickBehaviorTime;
 
+	/* Assigned by AInfantryControllerTickManager. Which frame out of every 
+	ProjectSettings::IDLE_INFANTRY_BEHAVIOR_FRAME_INTERVAL we can do idle behavior ticks on */
+	uint8 IdleBehaviorFrameSlot;
+
 	// Time towards resetting attack. If less than or equal to 0 then unit can attack
 	float TimeTillAttackResets;
 
@@ -604,8 +651,13 @@ public:
 	void OnAttackMoveCommand(const FVector & Location, ISelectable * TargetSelectable, 
 		const FSelectableAttributesBase * TargetInfo);
 
-	/** Called when player issues a right-click command and they did not click on another selectable */
-	void OnRightClickCommand(const FVector & Location);
+	/** 
+	 *	Called when player issues a right-click command and they did not click on another selectable 
+	 *
+	 *	@param GroupPath - path shared with the rest of the group that was given the command. 
+	 *	Null = find our own path
+	 */
+	void OnRightClickCommand(const FVector & Location, const FNavPathSharedPtr & GroupPath);
 	
 	/** 
 	 *	Called by owning unit
@@ -953,6 +1005,10 @@ protected:
 	targets */
 	bool CanTargetBeAquired(const AActor * PotentialNewTarget) const;
 
+	/* Version for entries from the selectable grid. Only uses the target's flags and IDs so 
+	never touches the target actor */
+	bool CanTargetBeAquired(const FSelectableGridEntry & PotentialNewTarget, FSelectableFlags TargetFlags) const;
+
 	bool HasTarget() const;
 
 	bool IsTargetAttackable() const;
@@ -1044,6 +1100,22 @@ protected:
 
 	EPathFollowingRequestResult::Type Move(const FVector & Location, float AcceptanceRadius = 1.f);
 
+	/* Move along a path that has already been found. If Path is null then one is asked for 
+	from the tick manager's path request queue and the move starts when it arrives */
+	EPathFollowingRequestResult::Type Move(const FVector & Location, const FNavPathSharedPtr & Path, 
+		float AcceptanceRadius = 1.f);
+
+	/* Start following a path. Does not play any anims */
+	EPathFollowingRequestResult::Type MoveAlongPath(const FVector & Location, 
+		const FNavPathSharedPtr & Path, float AcceptanceRadius);
+
+	/* ID of the path request Move is waiting on, or 0 if not waiting on one */
+	uint32 PendingPathRequestID;
+
+	/* Location and acceptance radius of the move waiting on PendingPathRequestID */
+	FVector PendingMoveLocation;
+	float PendingMoveAcceptanceRadius;
+
 	/* Call function with no return after delay, or crash if delay is <= 0
 	@param TimerHandle timer handle to use
 	@param Function function to call
@@ -1056,7 +1128,7 @@ protected:
 	void SetupReferences(APawn * InPawn);
 
 	/* Setup function pointers */
-	TMap <EUnitState, FunctionPtrType> SetupTickFunctions() const;
+	static constexpr FTickFunctionTable SetupTickFunctions();
 
 	// For timer handles
 	void DoNothing();
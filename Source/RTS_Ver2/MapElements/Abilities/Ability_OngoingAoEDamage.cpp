@@ -115,18 +115,16 @@ void AAbility_OngoingAoEDamage::DoDamageTick(AActor * AbilityInstigator, ETeam I
 {
 	SERVER_CHECK;
 
-	// Build query params. Because this actor is shared by many teams we can't just create it once and forget about it
-	FCollisionObjectQueryParams QueryParams;
+	/* Work out which teams can be hit. Because this actor is shared by many teams it 
+	cannot be worked out once and used forever */
+	uint32 TeamsMask = 0;
 	if (bCanHitEnemies)
 	{
-		for (const auto & EnemyChannel : GS->GetEnemyChannels(InstigatorsTeam))
-		{
-			QueryParams.AddObjectTypesToQuery(Statics::IntToCollisionChannel(EnemyChannel));
-		}
+		TeamsMask |= GS->GetEnemyTeamsMask(InstigatorsTeam);
 	}
 	if (bCanHitFriendlies)
 	{
-		QueryParams.AddObjectTypesToQuery(GS->GetTeamCollisionChannel(InstigatorsTeam));
+		TeamsMask |= GS->GetTeamMask(InstigatorsTeam);
 	}
 
 	FVector Location;
@@ -139,18 +137,22 @@ void AAbility_OngoingAoEDamage::DoDamageTick(AActor * AbilityInstigator, ETeam I
 		Location = AbilityInstigator->GetActorLocation();
 	}
 
-	TArray <FHitResult> HitResults;
-	Statics::CapsuleSweep(GetWorld(), HitResults, Location, QueryParams, Radius);
+	TArray <const FSelectableGridEntry *> HitSelectables;
+	GS->GetSelectableGrid().QueryRadius(Location, Radius, TeamsMask, HitSelectables, false);
 
 	const bool bCheckIfSelf = (bCanHitFriendlies && !bCanHitSelf);
 
-	for (const auto & Elem : HitResults)
+	for (const FSelectableGridEntry * Elem : HitSelectables)
 	{
-		AActor * HitActor = Elem.GetActor();
+		AActor * HitActor = Elem->Actor;
 
-		// Validity check needed here or has engine already done it? Maybe not since it's a weak pointer
+		/* Damage dealt earlier in this loop may have destroyed it */
+		if (!Statics::IsValid(HitActor))
+		{
+			continue;
+		}
 
-		if (bCanHitFlying || Statics::IsAirUnit(HitActor) == false)
+		if (bCanHitFlying || GS->GetSelectableFlags(Elem->OwnerID, Elem->SelectableID).IsAirUnit() == false)
 		{
 			if (!bCheckIfSelf || HitActor != AbilityInstigator)
 			{
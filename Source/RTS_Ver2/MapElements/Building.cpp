@@ -650,6 +650,13 @@ void ABuilding::SetupSelectionInfo()
 
 	Attributes.SetupSelectionInfo(PS->GetPlayerID(), PS->GetTeam());
 
+	/* Same info as the tags but packed */
+	Attributes.SetSelectableFlags(FSelectableFlags(PS->GetPlayerIDAsInt(), PS->GetTeam(), 
+		Attributes.GetTargetingType(), 
+		GetShopAttributes() != nullptr && GetShopAttributes()->AcceptsRefunds() ? ESelectableInventoryFlag::ShopThatAcceptsRefunds : ESelectableInventoryFlag::None,
+		FSelectableFlags::BUILDING | (Attributes.IsDefenseBuilding() ? FSelectableFlags::HAS_ATTACK : 0)));
+	GS->UpdateSelectableFlags(this);
+
 	/* Assign PC and get local player state too */
 	APlayerController * const LocalPlayerController = GetWorld()->GetFirstPlayerController();
 	PC = CastChecked<ARTSPlayerController>(LocalPlayerController);
@@ -923,136 +930,7 @@ void ABuilding::Tick(float DeltaTime)
 
 	// TODO disable tick until Owner and ID rep ?
 
-#if TICKABLE_BUFF_AND_DEBUFF_ENABLED_GAME && ALLOW_BUFFS_AND_DEBUFFS_ON_BUILDINGS
-	
-	/* Basically just copied and pasted this code from AInfantry. Should be fine but just keep 
-	that in mind */
-
-	const bool bIsCurrentSelected = Attributes.IsPrimarySelected();
-
-	/* Update all the buffs applied to us */
-	for (int32 i = Attributes.GetTickableBuffs().Num() - 1; i >= 0; --i)
-	{
-		FTickableBuffOrDebuffInstanceInfo & Elem = Attributes.GetTickableBuffs()[i];
-
-		Elem.DecrementDeltaTime(DeltaTime);
-
-		const FTickableBuffOrDebuffInfo * Info = Elem.GetInfoStruct();
-		const float TickInterval = Info->GetTickInterval();
-
-		/* Going to while statement here instead of just if statement so we can do multiple ticks
-		for extremly fast tick rate buffs/debuffs */
-		uint8 NumTicksToExecute = 0;
-		while (Elem.GetTimeRemainingTillNextTick() <= 0.f)
-		{
-			NumTicksToExecute++;
-			Elem.IncreaseTimeRemainingTillNextTick(TickInterval);
-		}
-
-		const bool bExpiresOverTime = Info->ExpiresOverTime();
-		bool bUpdatedUI = false;
-
-		for (uint8 k = 0; k < NumTicksToExecute; ++k)
-		{
-			Elem.IncrementTickCount();
-
-			Info->ExecuteDoTickBehavior(this, Elem);
-
-			/* Check if buff/debuff has 'ticked out' */
-			if (bExpiresOverTime && Elem.GetTickCount() == Info->GetNumberOfTicks())
-			{
-				/* Will avoid RemoveAtSwap to preserve ordering since it will look strange
-				if buffs/debuffs are swapping location on HUD */
-				Attributes.GetTickableBuffs().RemoveAt(i, 1, false);
-
-				Info->ExecuteOnRemovedBehavior(this, Elem, nullptr, nullptr,
-					EBuffAndDebuffRemovalReason::Expired);
-
-				/* Update HUD. For now will not update world widgets but can easily do that
-				by using similar logic to HUD */
-				if (Attributes.IsSelected())
-				{
-					PC->GetHUDWidget()->Selected_OnTickableBuffRemoved(this, i,
-						EBuffAndDebuffRemovalReason::Expired, bIsCurrentSelected);
-				}
-
-				bUpdatedUI = true;
-
-				break;
-			}
-		}
-
-		/* Going to do this as we iterate loop. Could maybe batch them together in their own
-		loop could see if it's faster */
-		if (Attributes.IsSelected() && bExpiresOverTime && !bUpdatedUI)
-		{
-			PC->GetHUDWidget()->Selected_UpdateTickableBuffDuration(this, i,
-				Elem.CalculateDurationRemaining(), bIsCurrentSelected);
-		}
-	}
-
-	/* Do exactly the same for debuffs */
-	for (int32 i = Attributes.GetTickableDebuffs().Num() - 1; i >= 0; --i)
-	{
-		FTickableBuffOrDebuffInstanceInfo & Elem = Attributes.GetTickableDebuffs()[i];
-
-		Elem.DecrementDeltaTime(DeltaTime);
-
-		const FTickableBuffOrDebuffInfo * Info = Elem.GetInfoStruct();
-		const float TickInterval = Info->GetTickInterval();
-
-		/* Going to while statement here instead of just if statement so we can do multiple ticks
-		for extremly fast tick rate buffs/debuffs */
-		uint8 NumTicksToExecute = 0;
-		while (Elem.GetTimeRemainingTillNextTick() <= 0.f)
-		{
-			NumTicksToExecute++;
-			Elem.IncreaseTimeRemainingTillNextTick(TickInterval);
-		}
-
-		const bool bExpiresOverTime = Info->ExpiresOverTime();
-		bool bUpdatedUI = false;
-
-		for (uint8 k = 0; k < NumTicksToExecute; ++k)
-		{
-			Elem.IncrementTickCount();
-
-			Info->ExecuteDoTickBehavior(this, Elem);
-
-			/* Check if buff/debuff has 'ticked out' */
-			if (bExpiresOverTime && Elem.GetTickCount() == Info->GetNumberOfTicks())
-			{
-				/* Will avoid RemoveAtSwap to preserve ordering since it will look strange
-				if buffs/debuffs are swapping location on HUD */
-				Attributes.GetTickableDebuffs().RemoveAt(i, 1, false);
-
-				Info->ExecuteOnRemovedBehavior(this, Elem, nullptr, nullptr,
-					EBuffAndDebuffRemovalReason::Expired);
-
-				/* Update HUD. For now will not update world widgets but can easily do that
-				by using similar logic to HUD */
-				if (Attributes.IsSelected())
-				{
-					PC->GetHUDWidget()->Selected_OnTickableDebuffRemoved(this, i,
-						EBuffAndDebuffRemovalReason::Expired, bIsCurrentSelected);
-				}
-
-				bUpdatedUI = true;
-
-				break;
-			}
-		}
-
-		/* Going to do this as we iterate loop. Could maybe batch them together in their own
-		loop could see if it's faster */
-		if (Attributes.IsSelected() && bExpiresOverTime && !bUpdatedUI)
-		{
-			PC->GetHUDWidget()->Selected_UpdateTickableDebuffDuration(this, i,
-				Elem.CalculateDurationRemaining(), bIsCurrentSelected);
-		}
-	}
-
-#endif // TICKABLE_BUFF_AND_DEBUFF_ENABLED_GAME && ALLOW_BUFFS_AND_DEBUFFS_ON_BUILDINGS
+	/* Tickable buffs/debuffs are ticked by ABuffAndDebuffManager, not here */
 
 	if (IsBeingBuilt())
 	{
@@ -2455,7 +2333,7 @@ AResourceSpot * ABuilding::GetClosestResourceSpot(const FResourceGatheringProper
 			// Skip resource spots with nothing left
 			if (ResourceSpot->IsDepleted() == false)
 			{
-				const float DistanceSqr = Statics::GetPathDistanceSqr(this, ResourceSpot);
+				const float DistanceSqr = Statics::GetPathDistanceSqr(GS, this, ResourceSpot);
 				if (DistanceSqr < BestDistanceSqr)
 				{
 					BestDistanceSqr = DistanceSqr;
@@ -3015,6 +2893,7 @@ void ABuilding::Server_OnProductionComplete_Inner(FProductionQueue & Queue)
 	{
 		assert(Front.IsForUpgrade());
 
+		GS->FlushAbilityEvents();
 		GS->Multicast_OnUpgradeComplete(PS->GetPlayerIDAsInt(), Front.GetUpgradeType());
 	}
 
@@ -3394,6 +3273,7 @@ void ABuilding::AICon_OnQueueProductionComplete_Inner(FProductionQueue & Queue)
 	else // Assumed upgrade
 	{
 		assert(Front.IsForUpgrade());
+		GS->FlushAbilityEvents();
 		GS->Multicast_OnUpgradeComplete(PS->GetPlayerIDAsInt(), Front.GetUpgradeType());
 	}
 
@@ -4455,6 +4335,8 @@ void ABuilding::OnZeroHealth(EOnZeroHealthCallSite CalledFrom)
 	
 	// Set this tag
 	Tags[Statics::GetZeroHealthTagIndex()] = Statics::HasZeroHealthTag;
+	Attributes.GetSelectableFlagsModifiable().SetHasZeroHealth();
+	GS->UpdateSelectableFlags(this);
 
 	/* Make unselectable */
 	Bounds->SetVisibility(false);
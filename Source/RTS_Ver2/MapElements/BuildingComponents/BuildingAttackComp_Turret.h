@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Interface.h"
+
+#include "Managers/HeavyTaskManagerTypes.h"
 #include "BuildingAttackComp_Turret.generated.h"
 
 struct FTraceHandle;
@@ -68,18 +70,11 @@ public:
 	/* Return the radius of the sweep */
 	virtual float GetTargetingSweepRadius() const PURE_VIRTUAL(IBuildingAttackComp_Turret::GetTargetingSweepRadius, { return -1.f; });
 
-	/* Set what bucket in the heavy task manager this comp is placed in */
-	virtual void SetTaskManagerBucketIndices(uint8 BucketIndex, int16 ArrayIndex) PURE_VIRTUAL(IBuildingAttackComp_Turret::SetTaskManagerBucketIndices, );
-
-	/* Just set the array index */
-	virtual void SetTaskManagerArrayIndex(int16 ArrayIndex) PURE_VIRTUAL(IBuildingAttackComp_Turret::SetTaskManagerArrayIndex, );
+	/* Set the job in the heavy task manager that does this comp's sweeps */
+	virtual void SetHeavyTaskHandle(const FHeavyTaskHandle & InHandle) PURE_VIRTUAL(IBuildingAttackComp_Turret::SetHeavyTaskHandle, );
 
-	/** 
-	 *	Get the heavy task manager indicies info. I called it grab cause calling it 
-	 *	Get would make it's name only 1 letter different from the setter and I know it'll cause a 
-	 *	headache in the future. 
-	 */
-	virtual void GrabTaskManagerBucketIndices(uint8 & OutBucketIndex, int16 & OutArrayIndex) const PURE_VIRTUAL(IBuildingAttackComp_Turret::GrabTaskManagerBucketIndices, );
+	/* Get the job in the heavy task manager that does this comp's sweeps */
+	virtual FHeavyTaskHandle GetHeavyTaskHandle() const PURE_VIRTUAL(IBuildingAttackComp_Turret::GetHeavyTaskHandle, { return FHeavyTaskHandle(); });
 
 	/* [Client] Called on clients when an attack is made on server */
 	virtual void ClientDoAttack(AActor * AttackTarget) PURE_VIRTUAL(IBuildingAttackComp_Turret::ClientDoAttack, );
@@ -430,20 +430,14 @@ float UBuildingAttackComponent_SK::GetTargetingSweepRadius() const
 	return AttackAttributes.GetAttackRange();
 }
 
-void UBuildingAttackComponent_SK::SetTaskManagerBucketIndices(uint8 BucketIndex, int16 ArrayIndex)
+void UBuildingAttackComponent_SK::SetHeavyTaskHandle(const FHeavyTaskHandle & InHandle)
 {
-	TaskManagerBucket = FTaskManagerBucketInfo(BucketIndex, ArrayIndex);
+	HeavyTaskHandle = InHandle;
 }
 
-void UBuildingAttackComponent_SK::SetTaskManagerArrayIndex(int16 ArrayIndex)
+FHeavyTaskHandle UBuildingAttackComponent_SK::GetHeavyTaskHandle() const
 {
-	TaskManagerBucket.ArrayIndex = ArrayIndex;
-}
-
-void UBuildingAttackComponent_SK::GrabTaskManagerBucketIndices(uint8 & OutBucketIndex, int16 & OutArrayIndex) const
-{
-	OutBucketIndex = TaskManagerBucket.BucketIndex;
-	OutArrayIndex = TaskManagerBucket.ArrayIndex;
+	return HeavyTaskHandle;
 }
 
 void UBuildingAttackComponent_SK::OnParentBuildingExitFogOfWar(bool bOnServer)
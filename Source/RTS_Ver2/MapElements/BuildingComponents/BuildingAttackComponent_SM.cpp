@@ -244,20 +244,14 @@ float UBuildingAttackComponent_SM::GetTargetingSweepRadius() const
 	return AttackAttributes.GetAttackRange();
 }
 
-void UBuildingAttackComponent_SM::SetTaskManagerBucketIndices(uint8 BucketIndex, int16 ArrayIndex)
+void UBuildingAttackComponent_SM::SetHeavyTaskHandle(const FHeavyTaskHandle & InHandle)
 {
-	TaskManagerBucket = FTaskManagerBucketInfo(BucketIndex, ArrayIndex);
+	HeavyTaskHandle = InHandle;
 }
 
-void UBuildingAttackComponent_SM::SetTaskManagerArrayIndex(int16 ArrayIndex)
+FHeavyTaskHandle UBuildingAttackComponent_SM::GetHeavyTaskHandle() const
 {
-	TaskManagerBucket.ArrayIndex = ArrayIndex;
-}
-
-void UBuildingAttackComponent_SM::GrabTaskManagerBucketIndices(uint8 & OutBucketIndex, int16 & OutArrayIndex) const
-{
-	OutBucketIndex = TaskManagerBucket.BucketIndex;
-	OutArrayIndex = TaskManagerBucket.ArrayIndex;
+	return HeavyTaskHandle;
 }
 
 void UBuildingAttackComponent_SM::OnParentBuildingEnterFogOfWar(bool bOnServer)
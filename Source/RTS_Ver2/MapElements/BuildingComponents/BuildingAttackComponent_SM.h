@@ -60,9 +60,8 @@ public:
 	virtual FCollisionObjectQueryParams GetTargetingQueryParams() const override;
 	virtual FVector GetTargetingSweepOrigin() const override;
 	virtual float GetTargetingSweepRadius() const override;
-	virtual void SetTaskManagerBucketIndices(uint8 BucketIndex, int16 ArrayIndex) override;
-	virtual void SetTaskManagerArrayIndex(int16 ArrayIndex) override;
-	virtual void GrabTaskManagerBucketIndices(uint8 & OutBucketIndex, int16 & OutArrayIndex) const override;
+	virtual void SetHeavyTaskHandle(const FHeavyTaskHandle & InHandle) override;
+	virtual FHeavyTaskHandle GetHeavyTaskHandle() const override;
 	virtual void OnParentBuildingEnterFogOfWar(bool bOnServer) override;
 	virtual void OnParentBuildingExitFogOfWar(bool bOnServer) override;
 	//~ End IBuildingAttackComp_Turret interface
@@ -197,8 +196,8 @@ protected:
 	/* Delegate that fires when an async sweep for targets within range finishes */
 	FOverlapDelegate TargetingTraceDelegate;
 	
-	/* Where in UHeavyTaskManager::BuildingAttackComps this object is stored at */
-	FTaskManagerBucketInfo TaskManagerBucket;
+	/* Job in the heavy task manager that does this comp's target sweeps */
+	FHeavyTaskHandle HeavyTaskHandle;
 
 	/**
 	 *	Time it takes to prepare attack. Use 0 to attack as soon as possible. Probably
@@ -68,31 +68,32 @@ void UCAbility_AoEDamage::DealDamageAfterDelay(const FVector & Location, ETeam I
 
 void UCAbility_AoEDamage::DealDamage(const FVector & TargetLocation, ETeam InstigatorsTeam)
 {
-	/* Build the query params. Because this object is used by many different players it 
-	cannot be created once and used forever */
-	FCollisionObjectQueryParams QueryParams;
+	/* Work out which teams can be hit. Because this object is used by many different players it 
+	cannot be worked out once and used forever */
+	uint32 TeamsMask = 0;
 	if (bCanHitEnemies)
 	{
-		for (const auto & EnemyChannel : GS->GetEnemyChannels(InstigatorsTeam))
-		{
-			QueryParams.AddObjectTypesToQuery(Statics::IntToCollisionChannel(EnemyChannel));
-		}
+		TeamsMask |= GS->GetEnemyTeamsMask(InstigatorsTeam);
 	}
 	if (bCanHitFriendlies)
 	{
-		QueryParams.AddObjectTypesToQuery(GS->GetTeamCollisionChannel(InstigatorsTeam));
+		TeamsMask |= GS->GetTeamMask(InstigatorsTeam);
 	}
 
-	TArray <FHitResult> HitResults;
-	Statics::CapsuleSweep(GetWorld(), HitResults, TargetLocation, QueryParams, Radius);
+	TArray <const FSelectableGridEntry *> HitSelectables;
+	GS->GetSelectableGrid().QueryRadius(TargetLocation, Radius, TeamsMask, HitSelectables, false);
 
-	for (const auto & Elem : HitResults)
+	for (const FSelectableGridEntry * Elem : HitSelectables)
 	{
-		AActor * HitActor = Elem.GetActor();
+		AActor * HitActor = Elem->Actor;
 
-		// Validity check needed here or has engine already done it? Maybe not since it's a weak pointer
+		/* Damage dealt earlier in this loop may have destroyed it */
+		if (!Statics::IsValid(HitActor))
+		{
+			continue;
+		}
 
-		if (bCanHitFlying || Statics::IsAirUnit(HitActor) == false)
+		if (bCanHitFlying || GS->GetSelectableFlags(Elem->OwnerID, Elem->SelectableID).IsAirUnit() == false)
 		{
 			HitActor->TakeDamage(CalculateDamage(TargetLocation, HitActor), FDamageEvent(DamageInfo.AoEDamageType), nullptr, nullptr);
 		}
@@ -30,6 +30,7 @@
 #include "MapElements/Projectiles/ProjectileBase.h"
 #include "Managers/ObjectPoolingManager.h"
 #include "Managers/UpgradeManager.h"
+#include "Managers/BuffAndDebuffManager.h"
 #include "Statics/DevelopmentStatics.h"
 #include "UI/RTSHUD.h"
 #include "UI/WorldWidgets/WorldWidget.h"
@@ -54,8 +55,8 @@ void FInfantryGarrisonStatus::ClearEnteredSelectable()
 
 AInfantry::AInfantry()
 {
-	// Set this character to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
+	/* Tickable buffs/debuffs are ticked by ABuffAndDebuffManager so nothing to tick here */
+	PrimaryActorTick.bCanEverTick = false;
 
 	GetCapsuleComponent()->bReceivesDecals = false;
 	GetCapsuleComponent()->SetGenerateOverlapEvents(false);
@@ -315,145 +316,6 @@ void AInfantry::Setup()
 	}
 }
 
-void AInfantry::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime); 
-
-#if TICKABLE_BUFF_AND_DEBUFF_ENABLED_GAME
-
-	/* This code should be fairly fast, but may want to look at the UI updated code see if 
-	can make it faster */
-
-	const bool bIsCurrentSelected = Attributes.IsPrimarySelected();
-
-	/* Update all the buffs applied to us */
-	for (int32 i = Attributes.GetTickableBuffs().Num() - 1; i >= 0; --i)
-	{
-		FTickableBuffOrDebuffInstanceInfo & Elem = Attributes.GetTickableBuffs()[i];
-		
-		Elem.DecrementDeltaTime(DeltaTime);
-		
-		const FTickableBuffOrDebuffInfo * Info = Elem.GetInfoStruct();
-		const float TickInterval = Info->GetTickInterval();
-
-		/* Going to while statement here instead of just if statement so we can do multiple ticks 
-		for extremly fast tick rate buffs/debuffs */
-		uint8 NumTicksToExecute = 0;
-		while (Elem.GetTimeRemainingTillNextTick() <= 0.f)
-		{
-			NumTicksToExecute++;
-			Elem.IncreaseTimeRemainingTillNextTick(TickInterval);
-		}
-
-		const bool bExpiresOverTime = Info->ExpiresOverTime();
-		bool bUpdatedUI = false;
-
-		for (uint8 k = 0; k < NumTicksToExecute; ++k)
-		{
-			Elem.IncrementTickCount();
-
-			Info->ExecuteDoTickBehavior(this, Elem);
-
-			/* Check if buff/debuff has 'ticked out' */
-			if (bExpiresOverTime && Elem.GetTickCount() == Info->GetNumberOfTicks())
-			{
-				/* Will avoid RemoveAtSwap to preserve ordering since it will look strange 
-				if buffs/debuffs are swapping location on HUD */
-				Attributes.GetTickableBuffs().RemoveAt(i, 1, false);
-				
-				Info->ExecuteOnRemovedBehavior(this, Elem, nullptr, nullptr,
-					EBuffAndDebuffRemovalReason::Expired);
-
-				/* Update HUD. For now will not update world widgets but can easily do that 
-				by using similar logic to HUD */
-				if (Attributes.IsSelected())
-				{
-					PC->GetHUDWidget()->Selected_OnTickableBuffRemoved(this, i, 
-						EBuffAndDebuffRemovalReason::Expired, bIsCurrentSelected);
-				}
-
-				bUpdatedUI = true;
-
-				break;
-			}
-		}
-
-		/* Going to do this as we iterate loop. Could maybe batch them together in their own 
-		loop could see if it's faster */
-		if (Attributes.IsSelected() && bExpiresOverTime && !bUpdatedUI)
-		{
-			PC->GetHUDWidget()->Selected_UpdateTickableBuffDuration(this, i, 
-				Elem.CalculateDurationRemaining(), bIsCurrentSelected);
-		}
-	}
-
-	/* Do exactly the same for debuffs */
-	for (int32 i = Attributes.GetTickableDebuffs().Num() - 1; i >= 0; --i)
-	{
-		FTickableBuffOrDebuffInstanceInfo & Elem = Attributes.GetTickableDebuffs()[i];
-
-		Elem.DecrementDeltaTime(DeltaTime);
-
-		const FTickableBuffOrDebuffInfo * Info = Elem.GetInfoStruct();
-		const float TickInterval = Info->GetTickInterval();
-
-		/* Going to while statement here instead of just if statement so we can do multiple ticks
-		for extremly fast tick rate buffs/debuffs */
-		uint8 NumTicksToExecute = 0;
-		while (Elem.GetTimeRemainingTillNextTick() <= 0.f)
-		{
-			NumTicksToExecute++;
-			Elem.IncreaseTimeRemainingTillNextTick(TickInterval);
-		}
-
-		const bool bExpiresOverTime = Info->ExpiresOverTime();
-		bool bUpdatedUI = false;
-
-		for (uint8 k = 0; k < NumTicksToExecute; ++k)
-		{
-			Elem.IncrementTickCount();
-
-			Info->ExecuteDoTickBehavior(this, Elem);
-
-			/* Check if buff/debuff has 'ticked out' */
-			if (bExpiresOverTime && Elem.GetTickCount() == Info->GetNumberOfTicks())
-			{
-				/* Will avoid RemoveAtSwap to preserve ordering since it will look strange
-				if buffs/debuffs are swapping location on HUD */
-				Attributes.GetTickableDebuffs().RemoveAt(i, 1, false);
-
-				Info->ExecuteOnRemovedBehavior(this, Elem, nullptr, nullptr,
-					EBuffAndDebuffRemovalReason::Expired);
-
-				/* Update HUD. For now will not update world widgets but can easily do that
-				by using similar logic to HUD */
-				if (Attributes.IsSelected())
-				{
-					PC->GetHUDWidget()->Selected_OnTickableDebuffRemoved(this, i,
-						EBuffAndDebuffRemovalReason::Expired, bIsCurrentSelected);
-				}
-
-				bUpdatedUI = true;
-
-				break;
-			}
-		}
-
-		/* Going to do this as we iterate loop. Could maybe batch them together in their own
-		loop could see if it's faster */
-		if (Attributes.IsSelected() && bExpiresOverTime && !bUpdatedUI)
-		{
-			PC->GetHUDWidget()->Selected_UpdateTickableDebuffDuration(this, i,
-				Elem.CalculateDurationRemaining(), bIsCurrentSelected);
-		}
-	}
-
-	/* Might need to update the HUD durations on becoming selected. Should test this to see if it 
-	is required or not. The logic could actually probably go in URTSHUD::OnPlayerCurrentSelectedChanged */
-
-#endif // TICKABLE_BUFF_AND_DEBUFF_ENABLED_GAME
-}
-
 void AInfantry::SetupSelectionInfo()
 {
 	assert(Tags.Num() == 0);
@@ -493,6 +355,13 @@ void AInfantry::SetupSelectionInfo()
 
 	Attributes.SetupSelectionInfo(PS->GetPlayerID(), PS->GetTeam());
 
+	/* Same info as the tags but packed */
+	Attributes.SetSelectableFlags(FSelectableFlags(PS->GetPlayerIDAsInt(), PS->GetTeam(), 
+		Attributes.GetTargetingType(), 
+		Attributes.GetInventory().GetCapacity() > 0 ? ESelectableInventoryFlag::HasInventory : ESelectableInventoryFlag::ZeroCapacity,
+		FSelectableFlags::UNIT | (bHasAttack ? FSelectableFlags::HAS_ATTACK : 0)));
+	GS->UpdateSelectableFlags(this);
+
 	if (LocalPlayerState->GetPlayerID() == PS->GetPlayerID())
 	{
 		Attributes.SetAffiliation(EAffiliation::Owned);
@@ -838,6 +707,7 @@ void AInfantry::GainExperience(float EnemyBounty, bool bApplyRandomness)
 				GetTotalExperienceRequiredForNextLevel(), Attributes.IsPrimarySelected());
 		}
 
+		GS->FlushAbilityEvents();
 		GS->Multicast_OnSelectableLevelUp(GetSelectableID(), GetOwnersID(), Rank);
 	}
 	else
@@ -1317,11 +1187,10 @@ void AInfantry::ServerEnterBuildingGarrison(ABuilding * Building, FBuildingGarri
 	TArray<FVisibilityInfo> & VisInfos = GS->GetAllTeamsVisibilityInfo();
 	for (int32 i = 0; i < VisInfos.Num(); ++i)
 	{
-		/* Skip our own team cause we don't put our own units into it and therefore will get a
-		TMap::operator[] crash */
+		/* Skip our own team cause we don't put our own units into it */
 		if (i != IndexToAvoid)
 		{
-			VisInfos[i].SetVisibility(this, false); 
+			VisInfos[i].SetSelectableVisibility(this, false); 
 		}
 	}
 	
@@ -1828,13 +1697,13 @@ FSelectableRootComponent2DShapeInfo AInfantry::GetRootComponent2DCollisionInfo()
 	return FSelectableRootComponent2DShapeInfo(GetCapsuleComponent()->GetScaledCapsuleRadius());
 }
 
-void AInfantry::OnRightClickCommand(const FVector & Location)
+void AInfantry::OnRightClickCommand(const FVector & Location, const FNavPathSharedPtr & GroupPath)
 {
 	/* Trying this as an assert instead of a if then return. PC should really check this stuff 
 	before issuing these */
 	assert(!Statics::HasZeroHealth(this));
 
-	Control->OnRightClickCommand(Location);
+	Control->OnRightClickCommand(Location, GroupPath);
 }
 
 void AInfantry::OnRightClickCommand(ISelectable * TargetAsSelectable, const FSelectableAttributesBase & TargetInfo)
@@ -2718,6 +2587,13 @@ void AInfantry::RegisterBuff(ETickableBuffAndDebuffType BuffType, AActor * BuffI
 	Attributes.TickableBuffs.Emplace(FTickableBuffOrDebuffInstanceInfo(Info, BuffInstigator,
 		InstigatorAsSelectable));
 
+	/* First tickable buff/debuff. Have the manager start ticking us */
+	if (Attributes.TickableBuffs.Num() + Attributes.TickableDebuffs.Num() == 1)
+	{
+		GS->GetBuffAndDebuffManager()->RegisterTickableBuffHolder(this, this, &Attributes.TickableBuffs,
+			&Attributes.TickableDebuffs);
+	}
+
 	/* Make sure UI knows about this */
 	if (Attributes.IsSelected())
 	{
@@ -2751,6 +2627,13 @@ void AInfantry::RegisterDebuff(ETickableBuffAndDebuffType DebuffType, AActor * D
 	Attributes.TickableDebuffs.Emplace(FTickableBuffOrDebuffInstanceInfo(Info, DebuffInstigator,
 		InstigatorAsSelectable));
 
+	/* First tickable buff/debuff. Have the manager start ticking us */
+	if (Attributes.TickableBuffs.Num() + Attributes.TickableDebuffs.Num() == 1)
+	{
+		GS->GetBuffAndDebuffManager()->RegisterTickableBuffHolder(this, this, &Attributes.TickableBuffs,
+			&Attributes.TickableDebuffs);
+	}
+
 	/* Make sure HUD knows about this */
 	if (Attributes.IsSelected())
 	{
@@ -3234,6 +3117,8 @@ void AInfantry::OnRep_Health()
 void AInfantry::OnZeroHealth()
 {
 	Tags[Statics::GetZeroHealthTagIndex()] = Statics::HasZeroHealthTag;
+	Attributes.GetSelectableFlagsModifiable().SetHasZeroHealth();
+	GS->UpdateSelectableFlags(this);
 
 	/* Make unselectable */
 	GetCapsuleComponent()->SetVisibility(false);
@@ -3469,6 +3354,8 @@ void AInfantry::SetHasAttack(bool bCanNowAttack)
 	const int32 TagsIndex = Statics::GetHasAttackTagIndex();
 	assert(Tags[TagsIndex] == Statics::HasAttackTag || Tags[TagsIndex] == Statics::NotHasAttackTag);
 	Tags[TagsIndex] = bCanNowAttack ? Statics::HasAttackTag : Statics::NotHasAttackTag;
+	Attributes.GetSelectableFlagsModifiable().SetHasAttack(bCanNowAttack);
+	GS->UpdateSelectableFlags(this);
 
 	/* Update AI controller behavior */
 	Control->OnUnitHasAttackChanged(bCanNowAttack);
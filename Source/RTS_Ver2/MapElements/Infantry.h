@@ -149,8 +149,6 @@ public:
 
 	//~ End ISelectable Interface
 
-	virtual void Tick(float DeltaTime) override;
-
 protected:
 
 	void SetupSelectionInfo();
@@ -570,7 +568,7 @@ public:
 	//~ Begin ISelectable interface
 	virtual UBoxComponent * GetBounds() const override;
 	virtual FSelectableRootComponent2DShapeInfo GetRootComponent2DCollisionInfo() const override;
-	virtual void OnRightClickCommand(const FVector & Location) override;
+	virtual void OnRightClickCommand(const FVector & Location, const FNavPathSharedPtr & GroupPath) override;
 	virtual void OnRightClickCommand(ISelectable * TargetAsSelectable, const FSelectableAttributesBase & TargetInfo) override;
 	virtual void IssueCommand_MoveTo(const FVector & Location) override;
 	virtual void IssueCommand_PickUpItem(const FVector & SomeLocation, AInventoryItem * TargetItem) override;
@@ -62,6 +62,8 @@ AInventoryItem::AInventoryItem()
 
 	Attributes.SetupSelectionInfo(Statics::NeutralID, ETeam::Neutral);
 	Attributes.SetupBasicTypeInfo(ESelectableType::InventoryItem, EBuildingType::NotBuilding, EUnitType::NotUnit);
+	Attributes.SetSelectableFlags(FSelectableFlags(0, ETeam::Neutral, ETargetingType::None,
+		ESelectableInventoryFlag::None, FSelectableFlags::INVENTORY_ITEM | FSelectableFlags::ZERO_HEALTH));
 	Type = EInventoryItem::None;
 	Quantity = 1;
 	AcceptanceRadius = 250.f;
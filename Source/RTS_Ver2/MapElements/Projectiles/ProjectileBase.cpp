@@ -41,6 +41,7 @@ AProjectileBase::AProjectileBase()
 	ImpactShakeRadius = 300.f;
 	ImpactShakeFalloff = 1.f;
 	bCanAoEHitEnemies = true;
+	AoETeamsMask = 0;
 }
 
 // Called when the game starts or when spawned
@@ -107,7 +108,7 @@ void AProjectileBase::AddToPool(bool bActuallyAddToPool, bool bDisableTrailParti
 	if (bActuallyAddToPool)
 	{
 		/* Recently moved this from below the reset timers line */
-		AoEObjectQueryParams = FCollisionObjectQueryParams::DefaultObjectQueryParam;
+		AoETeamsMask = 0;
 		
 		PoolingManager->AddToPool(this, Projectile_BP);
 	}
@@ -127,15 +128,15 @@ void AProjectileBase::DisableTrailsAndTryAddToPool()
 	projectile will add itself to pool */
 	if (TimerManager->IsTimerActive(TimerHandle_DealDamage) == false)
 	{
-		// Reset AoEObjectQueryParams here like in AddToPool? 
+		// Reset AoETeamsMask here like in AddToPool? 
 		PoolingManager->AddToPool(this, Projectile_BP);
 	}
 }
 
 void AProjectileBase::GetTargetsWithinRadius(const FVector & Location)
 {
-	HitResults.Reset();
-	Statics::CapsuleSweep(GetWorld(), HitResults, Location, AoEObjectQueryParams, AoERadius);
+	AoETargets.Reset();
+	GS->GetSelectableGrid().QueryRadius(Location, AoERadius, AoETeamsMask, AoETargets, false);
 }
 
 void AProjectileBase::OnHit(const FHitResult & Hit)
@@ -226,7 +227,7 @@ void AProjectileBase::DealDamageAndTryAddToPool()
 	/* If trails are still going then wait for them */
 	if (TimerManager->IsTimerActive(TimerHandle_TrailParticles) == false)
 	{
-		// Reset AoEObjectQueryParams here like in AddToPool?
+		// Reset AoETeamsMask here like in AddToPool?
 		PoolingManager->AddToPool(this, Projectile_BP);
 	}
 }
@@ -252,11 +253,18 @@ void AProjectileBase::DealDamage(const FHitResult & Hit)
 	{
 		GetTargetsWithinRadius(Hit.ImpactPoint);
 
-		for (const auto & Elem : HitResults)
+		for (const FSelectableGridEntry * Elem : AoETargets)
 		{
-			AActor * const Actor = Elem.GetActor();
+			AActor * const Actor = Elem->Actor;
+
+			/* Damage dealt earlier in this loop may have destroyed it */
+			if (!Statics::IsValid(Actor))
+			{
+				continue;
+			}
 
-			const float DistanceToActor = 0.f;// TODO 
+			/* Distance to bounds, not to center */
+			const float DistanceToActor = FMath::Max(0.f, (Elem->Location - FVector2D(Hit.ImpactPoint)).Size() - Elem->BoundsLength);
 			const float MultiFromDistance = GetDamageDistanceMultiplier(DistanceToActor);
 			const float DamageMulti = MultiFromDistance * FMath::FRandRange(1.f - AoERandomDamageFactor,
 				1.f + AoERandomDamageFactor);
@@ -321,17 +329,14 @@ USoundBase * AProjectileBase::GetImpactSound(const FHitResult & Hit) const
 
 void AProjectileBase::SetupAoECollisionChannels(ETeam Team)
 {
+	AoETeamsMask = 0;
 	if (bCanAoEHitEnemies)
 	{
-		for (const auto & Channel : GS->GetEnemyChannels(Team))
-		{
-			AoEObjectQueryParams.AddObjectTypesToQuery(static_cast<ECollisionChannel>(Channel));
-		}
+		AoETeamsMask |= GS->GetEnemyTeamsMask(Team);
 	}
 	if (bCanAoEHitFriendlies)
 	{
-		const ECollisionChannel TeamChannel = GS->GetTeamCollisionChannel(Team);
-		AoEObjectQueryParams.AddObjectTypesToQuery(TeamChannel);
+		AoETeamsMask |= GS->GetTeamMask(Team);
 	}
 }
 
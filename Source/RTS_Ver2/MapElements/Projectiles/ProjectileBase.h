@@ -19,6 +19,7 @@ class UParticleSystemComponent;
 struct FBasicDamageInfo;
 class URTSDamageType;
 class AAbilityBase;
+struct FSelectableGridEntry;
 
 
 /* A particle system and a sound */
@@ -113,8 +114,8 @@ protected:
 	void DisableTrailsAndTryAddToPool();
 
 	/* Gets all selectables this can damage within AoERadius (measured from param Location
-	to bounds of other selectables in 2D - no Z axis) and stores them in in hit results in
-	the array HitResults */
+	to bounds of other selectables in 2D - no Z axis) and stores them in the array 
+	AoETargets */
 	virtual void GetTargetsWithinRadius(const FVector & Location);
 
 	/** 
@@ -154,10 +155,14 @@ protected:
 	 */
 	USoundBase * GetImpactSound(const FHitResult & Hit) const;
 
-	/* Hit results from capsule sweep against viable collision channels */
+	/* Stores the hit while waiting to deal delayed damage */
 	UPROPERTY()
 	TArray <FHitResult> HitResults;
 
+	/* Selectables within AoERadius from the game state's selectable grid. Only valid for 
+	the frame GetTargetsWithinRadius was called in */
+	TArray <const FSelectableGridEntry *> AoETargets;
+
 	/** Base damage to deal to what the projectile impacts. Overridable by firer */
 	UPROPERTY(EditDefaultsOnly, Category = "RTS|Damage", meta = (DisplayName = "Impact Damage"))
 	float ImpactDamage;
@@ -313,8 +318,9 @@ protected:
 	UPROPERTY()
 	bool bQueryPhysicalMaterialForHits;
 
-	/* Holds what object types to check for when checking what is hit by AoE */
-	FCollisionObjectQueryParams AoEObjectQueryParams;
+	/* Which teams can be hit by AoE. Bit N = Statics::ArrayIndexToTeam(N). Same format as 
+	ARTSGameState::GetTeamMask */
+	uint32 AoETeamsMask;
 
 	void SetupAoECollisionChannels(ETeam Team);
 
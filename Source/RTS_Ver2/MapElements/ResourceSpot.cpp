@@ -89,6 +89,10 @@ void AResourceSpot::BeginPlay()
 	Tags.Emplace(Statics::NotHasInventoryTag);
 	assert(Tags.Num() == Statics::NUM_ACTOR_TAGS);
 
+	/* Not owned by a player so not added to game state's flags table */
+	Attributes.SetSelectableFlags(FSelectableFlags(0, ETeam::Neutral, ETargetingType::None,
+		ESelectableInventoryFlag::None, FSelectableFlags::BUILDING | FSelectableFlags::ZERO_HEALTH));
+
 	CurrentAmount = Capacity;
 
 	/* Leave it up to game mode to call Setup() */
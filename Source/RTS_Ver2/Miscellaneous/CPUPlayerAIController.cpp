@@ -3,6 +3,7 @@
 #include "CPUPlayerAIController.h"
 #include "Engine/World.h"
 #include "Public/TimerManager.h"
+#include "Async/TaskGraphInterfaces.h"
 #include "VisualLogger/VisualLogger.h"
 
 #include "GameFramework/RTSPlayerState.h"
@@ -1299,10 +1300,23 @@ void ACPUPlayerAIController::PerformFinalSetup()
 		for (const auto & Spot : GS->GetResourceSpots(ResourceType))
 		{
 			NumCollectors.Emplace(Spot, FUint8Set());
+
+			FCPUPlayerSnapshot::FResourceSpotInfo & SpotInfo = Snapshot.ResourceSpots.Emplace_GetRef();
+			SpotInfo.Spot = Spot;
+			SpotInfo.Type = ResourceType;
+			SpotInfo.Location = Spot->GetActorLocation();
 		}
 	}
 }
 
+void ACPUPlayerAIController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	/* Task reads from this */
+	WaitForDecisionTask();
+
+	Super::EndPlay(EndPlayReason);
+}
+
 #if ENABLE_VISUAL_LOG
 void ACPUPlayerAIController::GrabDebugSnapshot(FVisualLogEntry * Snapshot) const
 {
@@ -1360,11 +1374,15 @@ void ACPUPlayerAIController::GrabDebugSnapshot(FVisualLogEntry * Snapshot) const
 
 void ACPUPlayerAIController::TickFromManager()
 {
+	/* We only tick every few frames so this will have almost always finished already */
+	WaitForDecisionTask();
+
 	PreBehaviorPass();
 
 	/* Tell any idle harvesters to go collect resources */
 	AssignIdleCollectors();
 
+	bool bIsPlacingBuilding = false;
 	if (IsTryingToPlaceBuilding())
 	{
 		if (TryingToPlaceBuildingInfo.IsProducerUsable()
@@ -1374,13 +1392,13 @@ void ACPUPlayerAIController::TickFromManager()
 			// Continue trying to place this building
 			TryingToPlaceBuildingInfo.TryPlaceForTick(this);
 
-			/* This return means while trying to place building no more behaviour will run.
+			/* While trying to place building no more behaviour will run.
 			This could mean if no spot can ever be found then AI could potentially always try
 			and place a building and do nothing else, but that is a whole nother issue.
 			Issues can happen when the available areas to build on become congested. AI will
 			need to make a history of failed attempts to place buildings and take that into
 			account when deciding whether to try and place a building */
-			return;
+			bIsPlacingBuilding = true;
 		}
 		else
 		{
@@ -1388,7 +1406,13 @@ void ACPUPlayerAIController::TickFromManager()
 		}
 	}
 
-	DoBehavior();
+	if (!bIsPlacingBuilding)
+	{
+		DoBehavior();
+	}
+
+	/* Decide what to do next tick while the rest of the game carries on */
+	StartDecisionTask();
 }
 
 void ACPUPlayerAIController::PreBehaviorPass()
@@ -1424,16 +1448,8 @@ void ACPUPlayerAIController::PreBehaviorPass()
 
 void ACPUPlayerAIController::DoBehavior()
 {
-	/* The 'Decide' functions return true if they issue a command */
-	
-	/* Decide if should build a resource collector */
-	if (DecideIfShouldBuildCollector())
-	{	
-		return;
-	}
-	
-	/* Decide if should build a resource depot */
-	if (DecideIfShouldBuildResourceDepot())
+	/* Collectors and depots are more important than whatever we are saving up or waiting for */
+	if (CarryOutDecisions(true))
 	{
 		return;
 	}
@@ -1527,108 +1543,128 @@ void ACPUPlayerAIController::DoBehavior()
 		return;
 	}
 
-	/* Decide if should build a worker or construction yard */
-	if (DecideIfShouldBuildInfastructureProducingThing())
+	if (CarryOutDecisions(false))
 	{
 		return;
 	}
 
-	/* Decide if should build an army producing building */
-	if (DecideIfShouldBuildBarracks())
+	/* If here then we didn't take any action */
+
+	UE_VLOG(this, RTSLOG, Verbose, TEXT("Did not issue macro command this tick "));
+}
+
+void FCPUPlayerSnapshot::Decide(TArray < FCPUMacroDecision > & OutDecisions) const
+{
+	OutDecisions.Reset();
+
+	/* The 'Decide' functions return true if they set OutDecision */
+	FCPUMacroDecision Candidate;
+	auto AddCandidate = [&OutDecisions, &Candidate](bool bBeforeStateChecks)
 	{
-		return;
+		Candidate.bBeforeStateChecks = bBeforeStateChecks;
+		OutDecisions.Emplace(Candidate);
+	};
+
+	/* Decide if should build a resource collector */
+	if (DecideIfShouldBuildCollector(Candidate))
+	{
+		AddCandidate(true);
 	}
 
-	if (DecideIfShouldResearchUpgrade())
+	/* Decide if should build a resource depot */
+	Candidate = FCPUMacroDecision();
+	if (DecideIfShouldBuildResourceDepot(Candidate))
 	{
-		return;
+		AddCandidate(true);
 	}
 
-	if (DecideIfShouldBuildBaseDefense())
+	/* Decide if should build a worker or construction yard */
+	Candidate = FCPUMacroDecision();
+	if (DecideIfShouldBuildInfastructureProducingThing(Candidate))
 	{
-		return;
+		AddCandidate(false);
 	}
 
-	if (DecideIfShouldBuildArmyUnit())
-	{	
-		return;
+	/* Decide if should build an army producing building */
+	Candidate = FCPUMacroDecision();
+	if (DecideIfShouldBuildBarracks(Candidate))
+	{
+		AddCandidate(false);
 	}
 
-	/* If here then we didn't take any action */
+	Candidate = FCPUMacroDecision();
+	if (DecideIfShouldResearchUpgrade(Candidate))
+	{
+		AddCandidate(false);
+	}
 
-	UE_VLOG(this, RTSLOG, Verbose, TEXT("Did not issue macro command this tick "));
+	Candidate = FCPUMacroDecision();
+	if (DecideIfShouldBuildBaseDefense(Candidate))
+	{
+		AddCandidate(false);
+	}
+
+	Candidate = FCPUMacroDecision();
+	if (DecideIfShouldBuildArmyUnit(Candidate))
+	{
+		AddCandidate(false);
+	}
 }
 
-bool ACPUPlayerAIController::DecideIfShouldBuildCollector()
+bool FCPUPlayerSnapshot::DecideIfShouldBuildCollector(FCPUMacroDecision & OutDecision) const
 {
-	/* This first check is a common theme  in any of the DecideIf... funcs that build selectables. 
-	Not a very costly check but consider doing just one check inside DoBehavior() if possible */
-	if (PS->IsAtSelectableCap(true, false) == true)
+	/* This first check is a common theme in any of the DecideIf... funcs that build selectables */
+	if (bIsAtSelectableCap)
 	{
 		return false;
 	}
 
-	// Note: TSet iteration here
-	for (const auto & SpotWeakPtr : AquiredResourceSpots)
-	{	
-		AResourceSpot * ResourceSpot = SpotWeakPtr.Get();
-		
-		const EResourceType ResourceType = ResourceSpot->GetType();
+	for (const FResourceSpotInfo & SpotInfo : ResourceSpots)
+	{
+		const int32 * NumCollectorsAssigned = AquiredResourceSpots.Find(SpotInfo.Spot);
+		if (NumCollectorsAssigned == nullptr)
+		{
+			continue;
+		}
+
+		const EResourceType ResourceType = SpotInfo.Type;
 
-		// Need to implement GetNumCollectorsAssigned. Also I do not currently update the container it queries
-		const int32 Difference = GetOptimalNumCollectors(ResourceSpot) - GetNumCollectorsAssigned(ResourceSpot) - CommandReasons_TrainCollector[ResourceType];
+		const int32 Difference = GetOptimalNumCollectors(SpotInfo) - *NumCollectorsAssigned - CommandReasons_TrainCollector[ResourceType];
 
 		if (Difference > 0)
-		{	
+		{
 			TArray < EUnitType > MissingPrereq;
 			TArray < EUnitType > NoBuildingCapableOfProducing;
 
 			/* For each collector type for this resource type this faction has... */
 			for (const auto & CollectorType : FI->GetCollectorTypes(ResourceType))
-			{	
-				if (PS->IsAtUniqueUnitCap(CollectorType, true, false))
+			{
+				const FUnitTypeInfo & CollectorInfo = UnitTypes[CollectorType];
+
+				if (CollectorInfo.bIsAtUniqueCap)
 				{
 					continue;
 				}
-				
+
 				/* Check if its prereqs are met */
-				if (PS->ArePrerequisitesMet(CollectorType, false))
+				if (CollectorInfo.bArePrerequisitesMet)
 				{
-					/* Pick one of the buildings that can build it. */
-					ABuilding * Barracks = nullptr;
-					for (const auto & Building : PS->GetProductionCapableBuildings(FContextButton(CollectorType)))
+					/* Just using first usable building, may want to change this to choose
+					fastest queue in future */
+					const TWeakObjectPtr < ABuilding > Producer = FindProducer(CollectorType);
+					if (Producer.IsValid())
 					{
-						/* Validity check should not be needed given the building removes 
-						itself from arrays the moment it hits zero health */
-						
-						/* Just using first usable building, may want to change this to choose 
-						fastest queue in future */
-						if (CanTrainFromBuilding(Building, CollectorType))
-						{
-							Barracks = Building;
-							break;
-						}
-					}
+						OutDecision.UnitType = CollectorType;
+						OutDecision.Producer = Producer;
+						OutDecision.CommandReason = FMacroCommandReason(EMacroCommandSecondaryType::TrainingUnit, 
+							CollectorType, EMacroCommandType::TrainCollector, ResourceType);
 
-					if (Barracks != nullptr)
-					{
-						/* Check if we can afford it */
-						if (PS->HasEnoughResources(CollectorType, false))
-						{
-							// Build collector
-							ActuallyIssueTrainUnitCommand(CollectorType, Barracks, 
-								FMacroCommandReason(EMacroCommandSecondaryType::TrainingUnit, CollectorType, 
-									EMacroCommandType::TrainCollector, ResourceType));
-							return true;
-						}
-						else
-						{
-							// Cannot afford. Start saving up for it
-							SetSavingsTarget(CollectorType, Barracks, 
-								FMacroCommandReason(EMacroCommandSecondaryType::TrainingUnit, CollectorType, 
-									EMacroCommandType::TrainCollector, ResourceType));
-							return true;
-						}
+						/* Check if we can afford it. If not start saving up for it */
+						OutDecision.Type = CollectorInfo.bHasEnoughResources 
+							? ECPUMacroDecisionType::TrainUnit 
+							: ECPUMacroDecisionType::SaveUpForUnit;
+
+						return true;
 					}
 					else
 					{
@@ -1641,67 +1677,68 @@ bool ACPUPlayerAIController::DecideIfShouldBuildCollector()
 					MissingPrereq.Emplace(CollectorType);
 				}
 			}
-				
-			/* If there then we need to train a collector for this resource type but cannot 
-			either because prereq or no built building can train one. So work towards 
-			that */	
+
+			/* If there then we need to train a collector for this resource type but cannot
+			either because prereq or no built building can train one. So work towards
+			that */
 
 			if (NoBuildingCapableOfProducing.Num() > 0)
 			{
-				return InitialRecursiveTryBuildWrapper(NoBuildingCapableOfProducing[0], 
-					FMacroCommandReason(EMacroCommandSecondaryType::TrainingUnit, NoBuildingCapableOfProducing[0], 
+				SetRecursiveTryBuild(OutDecision, NoBuildingCapableOfProducing[0],
+					FMacroCommandReason(EMacroCommandSecondaryType::TrainingUnit, NoBuildingCapableOfProducing[0],
 						EMacroCommandType::TrainCollector, ResourceType));
+				return true;
 			}
-			
+
 			if (MissingPrereq.Num() > 0)
 			{
-				return InitialRecursiveTryBuildWrapper(MissingPrereq[0], 
-					FMacroCommandReason(EMacroCommandSecondaryType::TrainingUnit, MissingPrereq[0], 
+				SetRecursiveTryBuild(OutDecision, MissingPrereq[0],
+					FMacroCommandReason(EMacroCommandSecondaryType::TrainingUnit, MissingPrereq[0],
 						EMacroCommandType::TrainCollector, ResourceType));
+				return true;
 			}
-				
-			/* If here it means faction does not have any collector types for the resource spots 
+
+			/* If here it means faction does not have any collector types for the resource spots
 			type. Confirm this with assert */
-			assert(FI->HasCollectorType(ResourceSpot->GetType()) == false);
+			assert(FI->HasCollectorType(ResourceType) == false);
 		}
 	}
 
 	return false;
 }
 
-bool ACPUPlayerAIController::DecideIfShouldBuildResourceDepot()
+bool FCPUPlayerSnapshot::DecideIfShouldBuildResourceDepot(FCPUMacroDecision & OutDecision) const
 {
-	if (PS->IsAtSelectableCap(true, false) == true)
+	if (bIsAtSelectableCap)
 	{
 		return false;
 	}
-	
+
 	// For each resource type...
 	for (uint8 i = 0; i < Statics::NUM_RESOURCE_TYPES; ++i)
 	{
 		const EResourceType ResourceType = Statics::ArrayIndexToResourceType(i);
 
 		const int32 ExpectedNumDepots = GetExpectedNumDepots(ResourceType);
-		const int32 NumDepots = GetNumAquiredResourceSpots(ResourceType);
+		const int32 NumDepots = NumAquiredResourceSpots[ResourceType];
 		const int32 NumPendingDepotBuildCommands = CommandReasons_BuildResourceDepot[ResourceType];
 
 		const int32 Difference = ExpectedNumDepots - NumDepots - NumPendingDepotBuildCommands;
 
 		if (Difference > 0)
 		{
-			AResourceSpot * BestResourceSpot = nullptr;
+			const FResourceSpotInfo * BestResourceSpot = nullptr;
 			float BestDistanceSqr = FLT_MAX;
-			/* Need to choose resource spot to build depot at. Want to try and choose one
-			that is 'unclaimed' */
-			for (const auto & ResourceSpot : GS->GetResourceSpots(ResourceType))
+			/* Need to choose resource spot to build depot at. Choose the closest 'unclaimed' 
+			resource spot to our starting spot */
+			for (const FResourceSpotInfo & SpotInfo : ResourceSpots)
 			{
-				/* Choose the closest 'unclaimed' resource spot to our starting spot. */
-				if (!AquiredResourceSpots.Contains(ResourceSpot))
+				if (SpotInfo.Type == ResourceType && !AquiredResourceSpots.Contains(SpotInfo.Spot))
 				{
-					const float DistanceSqr = Statics::GetDistance2DSquared(StartingSpotLocation, ResourceSpot->GetActorLocation());
+					const float DistanceSqr = Statics::GetDistance2DSquared(StartingSpotLocation, SpotInfo.Location);
 					if (DistanceSqr < BestDistanceSqr)
 					{
-						BestResourceSpot = ResourceSpot;
+						BestResourceSpot = &SpotInfo;
 						BestDistanceSqr = DistanceSqr;
 					}
 				}
@@ -1717,14 +1754,16 @@ bool ACPUPlayerAIController::DecideIfShouldBuildResourceDepot()
 				TArray < EBuildingType > CannotAfford;
 				for (const auto & DepotType : FI->GetAllDepotsForResource(ResourceType))
 				{
-					if (PS->IsAtUniqueBuildingCap(DepotType, true, false))
+					const FBuildingTypeInfo & DepotTypeInfo = BuildingTypes[DepotType];
+
+					if (DepotTypeInfo.bIsAtUniqueCap)
 					{
 						continue;
 					}
-					
-					if (PS->HasEnoughResources(DepotType, false))
+
+					if (DepotTypeInfo.bHasEnoughResources)
 					{
-						if (PS->ArePrerequisitesMet(DepotType, false))
+						if (DepotTypeInfo.bArePrerequisitesMet)
 						{
 							DepotToBuild = DepotType;
 							break;
@@ -1736,7 +1775,7 @@ bool ACPUPlayerAIController::DecideIfShouldBuildResourceDepot()
 					}
 					else
 					{
-						if (PS->ArePrerequisitesMet(DepotType, false))
+						if (DepotTypeInfo.bArePrerequisitesMet)
 						{
 							CannotAfford.Emplace(DepotType);
 						}
@@ -1746,47 +1785,40 @@ bool ACPUPlayerAIController::DecideIfShouldBuildResourceDepot()
 				if (DepotToBuild != EBuildingType::NotBuilding)
 				{
 					/* Need to find a constructionYard/worker that can build it */
-					
+
 					const FBuildingInfo * DepotInfo = FI->GetBuildingInfo(DepotToBuild);
-					
+
+					OutDecision.Type = ECPUMacroDecisionType::BuildResourceDepot;
+					OutDecision.BuildingType = DepotToBuild;
+					OutDecision.ResourceSpot = BestResourceSpot->Spot;
+					OutDecision.CommandReason = FMacroCommandReason(EMacroCommandSecondaryType::BuildingBuilding,
+						DepotToBuild, EMacroCommandType::BuildResourceDepot, ResourceType);
+
 					// Check if can build from construction yard
-					if (DepotInfo->CanBeBuiltByConstructionYard())
+					if (DepotInfo->CanBeBuiltByConstructionYard() && UsableConstructionYard.IsValid())
 					{
-						for (const auto & ConYard : PS->GetPersistentQueueSupportingBuildings())
-						{
-							// Use first one but should try for shortest queue time
-							if (CanUseConstructionYard(ConYard))
-							{	
-								TryIssueBuildResourceDepotCommand(DepotToBuild, ConYard, BestResourceSpot, 
-									FMacroCommandReason(EMacroCommandSecondaryType::BuildingBuilding, 
-										DepotToBuild, EMacroCommandType::BuildResourceDepot, ResourceType));
-								return true;
-							}
-						}
+						OutDecision.Producer = UsableConstructionYard;
+						return true;
 					}
-					
-					/* Check if any idle worker can build one. Because resource depots are important 
+
+					/* Check if any idle worker can build one. Because resource depots are important
 					should probably even consider non-idle workers */
 					if (DepotInfo->CanBeBuiltByWorkers())
-					{	
-						for (const auto & Worker : IdleWorkers)
-						{	
-							if (CanUseIdleWorker(Worker.Get(), DepotToBuild))
-							{
-								TryIssueBuildResourceDepotCommand(DepotToBuild, Worker.Get(), 
-									BestResourceSpot, 
-									FMacroCommandReason(EMacroCommandSecondaryType::BuildingBuilding, 
-										DepotToBuild, EMacroCommandType::BuildResourceDepot, ResourceType));
-								return true;
-							}
+					{
+						OutDecision.Worker = FindIdleWorker(DepotToBuild);
+						if (OutDecision.Worker.IsValid())
+						{
+							return true;
 						}
 					}
+
+					OutDecision = FCPUMacroDecision();
 				}
 				else
 				{
 					/* Cannot build a depot for this resource type. Check if can build any
 					of the prereqs for it so can work towards it */
-					/* These two loops may look like we're building a lot of things but we're 
+					/* These two loops may look like we're building a lot of things but we're
 					actually just building the first in the array */
 
 					for (const auto & Elem : PrereqsNotMet)
@@ -1794,25 +1826,24 @@ bool ACPUPlayerAIController::DecideIfShouldBuildResourceDepot()
 						/* Doubling up on the uniqueness checks here because it will be done again
 						in RecursiveTryBuild but we really want to just skip over those we can't
 						build */
-						if (PS->IsAtUniqueBuildingCap(Elem, true, false) == false)
+						if (BuildingTypes[Elem].bIsAtUniqueCap == false)
 						{
-							return InitialRecursiveTryBuildWrapper(Elem,
+							SetRecursiveTryBuild(OutDecision, Elem,
 								FMacroCommandReason(EMacroCommandSecondaryType::BuildingBuilding, Elem,
 									EMacroCommandType::BuildResourceDepot, ResourceType));
+							return true;
 						}
 					}
 
 					for (const auto & Elem : CannotAfford)
 					{
-						/* Doubling up on the uniqueness checks here because it will be done again 
-						in RecursiveTryBuild but we really want to just skip over those we can't 
-						build */
-						if (PS->IsAtUniqueBuildingCap(Elem, true, false) == false)
+						if (BuildingTypes[Elem].bIsAtUniqueCap == false)
 						{
 							/* Should really do SetSavingsTarget here instead */
-							return InitialRecursiveTryBuildWrapper(Elem,
+							SetRecursiveTryBuild(OutDecision, Elem,
 								FMacroCommandReason(EMacroCommandSecondaryType::BuildingBuilding, Elem,
 									EMacroCommandType::BuildResourceDepot, ResourceType));
+							return true;
 						}
 					}
 				}
@@ -1827,170 +1858,153 @@ bool ACPUPlayerAIController::DecideIfShouldBuildResourceDepot()
 	return false;
 }
 
-bool ACPUPlayerAIController::DecideIfShouldBuildInfastructureProducingThing()
-{	
-	if (PS->IsAtSelectableCap(true, false) == true)
+bool FCPUPlayerSnapshot::DecideIfShouldBuildInfastructureProducingThing(FCPUMacroDecision & OutDecision) const
+{
+	if (bIsAtSelectableCap)
 	{
 		return false;
 	}
-	
+
 	// Check if should build a construction yard type building
 	{
-		const int32 NumConstructionYards = GetNumConstructionYards();
 		const int32 ExpectedNumConstructionYards = GetExpectedNumConstructionYards();
 		const int32 PendingBuildConstructionYardOrders = CommandReasons_PendingCommands[EMacroCommandType::BuildConstructionYard];
 		const int32 Difference = ExpectedNumConstructionYards - NumConstructionYards - PendingBuildConstructionYardOrders;
 
 		if (Difference > 0)
 		{
-			// Try build the first construction yard we can. Note: will likely be the same building every 
+			// Try build the first construction yard we can. Note: will likely be the same building every
 			// time. Should add some randomness to it instead
 			for (const auto & ConstructionYardType : FI->GetPersistentQueueTypes())
 			{
-				if (PS->IsAtUniqueBuildingCap(ConstructionYardType, true, false) == false)
+				if (BuildingTypes[ConstructionYardType].bIsAtUniqueCap == false)
 				{
-					return InitialRecursiveTryBuildWrapper(ConstructionYardType,
+					SetRecursiveTryBuild(OutDecision, ConstructionYardType,
 						FMacroCommandReason(EMacroCommandSecondaryType::BuildingBuilding, ConstructionYardType,
 							EMacroCommandType::BuildConstructionYard, ConstructionYardType));
+					return true;
 				}
 			}
-			
+
 			/* If here then faction does not have any construction yard type buildings on its roster */
 		}
 	}
 
 	// Check if should build a worker type unit
 	{
-		const int32 CurrentNumWorkers = GetNumWorkers();
 		const int32 ExpectedNumWorkers = GetExpectedNumWorkers();
 		const int32 NumPendingBuildWorkerCommands = CommandReasons_PendingCommands[EMacroCommandType::TrainWorker];
-		const int32 Difference = ExpectedNumWorkers - CurrentNumWorkers - NumPendingBuildWorkerCommands;
+		const int32 Difference = ExpectedNumWorkers - NumWorkers - NumPendingBuildWorkerCommands;
 
 		if (Difference > 0)
 		{
-			/* Same as construction yard way done above. Could perhaps be better to choose a 
+			/* Same as construction yard way done above. Could perhaps be better to choose a
 			worker we haven't already built */
 			for (const auto & WorkerType : FI->GetWorkerTypes())
 			{
-				if (PS->IsAtUniqueUnitCap(WorkerType, true, false) == false)
+				if (UnitTypes[WorkerType].bIsAtUniqueCap == false)
 				{
-					return InitialRecursiveTryBuildWrapper(WorkerType,
+					SetRecursiveTryBuild(OutDecision, WorkerType,
 						FMacroCommandReason(EMacroCommandSecondaryType::TrainingUnit, WorkerType,
 							EMacroCommandType::TrainWorker));
+					return true;
 				}
 			}
-			
+
 			/* If here then faction has no worker type units */
 		}
 	}
-	
+
 	return false;
 }
 
-bool ACPUPlayerAIController::DecideIfShouldBuildBarracks()
+bool FCPUPlayerSnapshot::DecideIfShouldBuildBarracks(FCPUMacroDecision & OutDecision) const
 {
-	if (PS->IsAtSelectableCap(true, false) == true)
+	if (bIsAtSelectableCap)
 	{
 		return false;
 	}
-	
-	const int32 CurrentNumBarracks = GetNumBarracks();
+
 	const int32 ExpectedNumBarracks = GetExpectedNumBarracks();
 	const int32 NumBuildBarracksCommandsPending = CommandReasons_PendingCommands[EMacroCommandType::BuildBarracks];
-	const int32 Difference = ExpectedNumBarracks - CurrentNumBarracks - NumBuildBarracksCommandsPending;
+	const int32 Difference = ExpectedNumBarracks - NumBarracks - NumBuildBarracksCommandsPending;
 
 	if (Difference > 0)
 	{
-		/* Checks that need to happen: 
-		- prereqs 
-		- resources 
+		/* Checks that need to happen:
+		- prereqs
+		- resources
 		- if a building/unit can build it */
-		
-		/* This will just build the same barracks every time given resources are ok. 
+
+		/* This will just build the same barracks every time given resources are ok.
 		Need to mix it up a bit */
 		for (const auto & BuildingType : FI->GetBarracksBuildingTypes())
-		{	
-			if (PS->IsAtUniqueBuildingCap(BuildingType, true, false))
+		{
+			const FBuildingTypeInfo & BarracksTypeInfo = BuildingTypes[BuildingType];
+
+			if (BarracksTypeInfo.bIsAtUniqueCap)
 			{
 				continue;
 			}
-			
-			if (PS->HasEnoughResources(BuildingType, false))
-			{
-				if (PS->ArePrerequisitesMet(BuildingType, false))
-				{
-					bool bHasSelectableThatCanBuildIt = false;
 
-					const FBuildingInfo * BuildingInfo = FI->GetBuildingInfo(BuildingType);
+			if (BarracksTypeInfo.bHasEnoughResources && BarracksTypeInfo.bArePrerequisitesMet)
+			{
+				const FBuildingInfo * BuildingInfo = FI->GetBuildingInfo(BuildingType);
 
-					// If statement checks for fast path
-					if (BuildingInfo->CanBeBuiltByConstructionYard())
-					{
-						ABuilding * BestBuilding = nullptr;
-						// Note: iterating TSet here
-						for (const auto & Building : PS->GetPersistentQueueSupportingBuildings())
-						{
-							// Looking for empty queue here
-							if (Building->GetPersistentProductionQueue()->AICon_HasRoom())
-							{
-								BestBuilding = Building;
-								break;
-							}
-						}
+				OutDecision.Type = ECPUMacroDecisionType::BuildBuilding;
+				OutDecision.BuildingType = BuildingType;
+				OutDecision.CommandReason = FMacroCommandReason(EMacroCommandSecondaryType::BuildingBuilding,
+					BuildingType, EMacroCommandType::BuildBarracks, BuildingType);
 
-						if (BestBuilding != nullptr)
-						{
-							TryIssueBuildBuildingCommand(BuildingType, BestBuilding, 
-								FMacroCommandReason(EMacroCommandSecondaryType::BuildingBuilding, 
-									BuildingType, EMacroCommandType::BuildBarracks, BuildingType));
-							return true;
-						}
-					}
+				// If statement checks for fast path
+				if (BuildingInfo->CanBeBuiltByConstructionYard() && UsableConstructionYard.IsValid())
+				{
+					OutDecision.Producer = UsableConstructionYard;
+					return true;
+				}
 
-					// If statement checks for fast path
-					if (BuildingInfo->CanBeBuiltByWorkers())
+				// If statement checks for fast path
+				if (BuildingInfo->CanBeBuiltByWorkers())
+				{
+					OutDecision.Worker = FindIdleWorker(BuildingType);
+					if (OutDecision.Worker.IsValid())
 					{
-						for (const auto & IdleWorker : IdleWorkers)
-						{
-							if (IdleWorker->GetContextMenu()->HasButton(FContextButton(BuildingType)))
-							{
-								TryIssueBuildBuildingCommand(BuildingType, IdleWorker.Get(), 
-									FMacroCommandReason(EMacroCommandSecondaryType::BuildingBuilding, 
-										BuildingType, EMacroCommandType::BuildBarracks, BuildingType));
-								return true;
-							}
-						}
+						return true;
 					}
+				}
+
+				OutDecision = FCPUMacroDecision();
 
-					/* If here then prereqs are met and we can afford building, but we don't
-					have a building/unit built that can build the building. So choose something
-					that can build this and build it */
+				/* If here then prereqs are met and we can afford building, but we don't
+				have a building/unit built that can build the building. So choose something
+				that can build this and build it */
 
-					// Check if faction has any construction yards and build one if so
-					for (const auto & ConYardType : BuildingInfo->GetTechTreeParentBuildings())
+				// Check if faction has any construction yards and build one if so
+				for (const auto & ConYardType : BuildingInfo->GetTechTreeParentBuildings())
+				{
+					if (BuildingTypes[ConYardType].bIsAtUniqueCap == false)
 					{
-						if (PS->IsAtUniqueBuildingCap(ConYardType, true, false) == false)
-						{
-							return InitialRecursiveTryBuildWrapper(ConYardType,
-								FMacroCommandReason(EMacroCommandSecondaryType::BuildingBuilding,
-									ConYardType, EMacroCommandType::BuildBarracks, BuildingType));
-						}
+						SetRecursiveTryBuild(OutDecision, ConYardType,
+							FMacroCommandReason(EMacroCommandSecondaryType::BuildingBuilding,
+								ConYardType, EMacroCommandType::BuildBarracks, BuildingType));
+						return true;
 					}
+				}
 
-					// Check if any workers can build this
-					for (const auto & WorkerType : BuildingInfo->GetTechTreeParentUnits())
+				// Check if any workers can build this
+				for (const auto & WorkerType : BuildingInfo->GetTechTreeParentUnits())
+				{
+					if (UnitTypes[WorkerType].bIsAtUniqueCap == false)
 					{
-						if (PS->IsAtUniqueUnitCap(WorkerType, true, false) == false)
-						{
-							return InitialRecursiveTryBuildWrapper(WorkerType,
-								FMacroCommandReason(EMacroCommandSecondaryType::TrainingUnit,
-									WorkerType, EMacroCommandType::BuildBarracks, BuildingType));
-						}
+						SetRecursiveTryBuild(OutDecision, WorkerType,
+							FMacroCommandReason(EMacroCommandSecondaryType::TrainingUnit,
+								WorkerType, EMacroCommandType::BuildBarracks, BuildingType));
+						return true;
 					}
-
-					/* If here then nothing in this faction can build this building. Could be that 
-					it is a building that the player only ever starts the match with */
 				}
+
+				/* If here then nothing in this faction can build this building. Could be that
+				it is a building that the player only ever starts the match with */
 			}
 		}
 	}
@@ -1998,60 +2012,54 @@ bool ACPUPlayerAIController::DecideIfShouldBuildBarracks()
 	return false;
 }
 
-bool ACPUPlayerAIController::DecideIfShouldResearchUpgrade()
+bool FCPUPlayerSnapshot::DecideIfShouldResearchUpgrade(FCPUMacroDecision & OutDecision) const
 {
 	/* Check fast path: whether faction even has any upgrades */
 	if (FI->HasUpgrades())
 	{
-		const AUpgradeManager * UpgradeManager = PS->GetUpgradeManager();
-		
 		/* Check if all upgrades have already been researched */
-		if (UpgradeManager->HasResearchedAllUpgrades() == false)
+		if (bHasResearchedAllUpgrades == false)
 		{
-			const int32 NumUnits = PS->GetUnits().Num();
-
 			/* Base it on how many units we have. Need a better metric */
 			const bool bResearchUpgrade = (NumUnits == 10);
 
 			if (bResearchUpgrade)
 			{
-				/* Choose one randomly */
-				const EUpgradeType UpgradeType = UpgradeManager->Random_GetUnresearchedUpgrade();
-
-				return InitialRecursiveTryBuildWrapper(UpgradeType, 
-					FMacroCommandReason(EMacroCommandSecondaryType::ResearchingUpgrade, UpgradeType, 
+				SetRecursiveTryBuild(OutDecision, RandomUnresearchedUpgrade,
+					FMacroCommandReason(EMacroCommandSecondaryType::ResearchingUpgrade, RandomUnresearchedUpgrade,
 						EMacroCommandType::ResearchUpgrade));
+				return true;
 			}
 		}
 	}
-	
+
 	return false;
 }
 
-bool ACPUPlayerAIController::DecideIfShouldBuildBaseDefense()
+bool FCPUPlayerSnapshot::DecideIfShouldBuildBaseDefense(FCPUMacroDecision & OutDecision) const
 {
-	if (PS->IsAtSelectableCap(true, false) == true)
+	if (bIsAtSelectableCap)
 	{
 		return false;
 	}
-	
+
 	/* Check fast path: if faction even has any base defense buildings on its roster */
 	if (FI->HasBaseDefenseTypeBuildings())
 	{
-		const int32 CurrentNumBaseDefenses = GetNumBaseDefenses();
 		const int32 ExpectedNumBaseDefenses = GetExpectedNumBaseDefenses();
 		const int32 ExpectedNumFromCommands = CommandReasons_PendingCommands[EMacroCommandType::BuildBaseDefense];
-		const int32 Difference = ExpectedNumBaseDefenses - CurrentNumBaseDefenses - ExpectedNumFromCommands;
+		const int32 Difference = ExpectedNumBaseDefenses - NumBaseDefenses - ExpectedNumFromCommands;
 
 		if (Difference > 0)
 		{
 			for (const auto & BaseDefenseType : FI->GetBaseDefenseTypes())
 			{
-				if (PS->IsAtUniqueBuildingCap(BaseDefenseType, true, false) == false)
+				if (BuildingTypes[BaseDefenseType].bIsAtUniqueCap == false)
 				{
-					return InitialRecursiveTryBuildWrapper(BaseDefenseType,
+					SetRecursiveTryBuild(OutDecision, BaseDefenseType,
 						FMacroCommandReason(EMacroCommandSecondaryType::BuildingBuilding, BaseDefenseType,
 							EMacroCommandType::BuildBaseDefense, BaseDefenseType));
+					return true;
 				}
 			}
 		}
@@ -2060,25 +2068,22 @@ bool ACPUPlayerAIController::DecideIfShouldBuildBaseDefense()
 	return false;
 }
 
-bool ACPUPlayerAIController::DecideIfShouldBuildArmyUnit()
+bool FCPUPlayerSnapshot::DecideIfShouldBuildArmyUnit(FCPUMacroDecision & OutDecision) const
 {
-	if (PS->IsAtSelectableCap(true, false) == true)
+	if (bIsAtSelectableCap)
 	{
 		return false;
 	}
-	
+
 	/* Check fast path: whether faction even has any army units */
 	if (FI->HasAttackingUnitTypes())
 	{
-		const int32 CurrentArmyStrength = GetArmyStrength();
 		const int32 ExpectedArmyStrength = GetExpectedArmyStrength();
 		const int32 ExpectedStrengthFromBuildCommands = PendingCommands_ArmyStrength;
-		const int32 Difference = ExpectedArmyStrength - CurrentArmyStrength - ExpectedStrengthFromBuildCommands;
+		const int32 Difference = ExpectedArmyStrength - ArmyStrength - ExpectedStrengthFromBuildCommands;
 
 		if (Difference > 0)
 		{
-			const int32 NumUnits = PS->GetUnits().Num();
-
 			const bool bTrainUnit = (NumUnits < 0);
 
 			if (bTrainUnit)
@@ -2086,11 +2091,12 @@ bool ACPUPlayerAIController::DecideIfShouldBuildArmyUnit()
 				// Will likely result in training the same unit every time
 				for (const auto & UnitType : FI->GetAttackingUnitTypes())
 				{
-					if (PS->IsAtUniqueUnitCap(UnitType, true, false) == false)
+					if (UnitTypes[UnitType].bIsAtUniqueCap == false)
 					{
-						return InitialRecursiveTryBuildWrapper(UnitType,
+						SetRecursiveTryBuild(OutDecision, UnitType,
 							FMacroCommandReason(EMacroCommandSecondaryType::TrainingUnit, UnitType,
 								EMacroCommandType::TrainArmyUnit));
+						return true;
 					}
 				}
 			}
@@ -2100,6 +2106,301 @@ bool ACPUPlayerAIController::DecideIfShouldBuildArmyUnit()
 	return false;
 }
 
+TWeakObjectPtr < AInfantry > FCPUPlayerSnapshot::FindIdleWorker(EBuildingType BuildingType) const
+{
+	const FContextButton Button = FContextButton(BuildingType);
+
+	/* Same check as ACPUPlayerAIController::CanUseIdleWorker except the unit type's context 
+	menu is used instead of the unit's */
+	for (const FIdleWorkerInfo & WorkerInfo : IdleWorkers)
+	{
+		if (FI->GetUnitInfo(WorkerInfo.Type)->GetContextMenu()->HasButton(Button))
+		{
+			return WorkerInfo.Worker;
+		}
+	}
+
+	return nullptr;
+}
+
+TWeakObjectPtr < ABuilding > FCPUPlayerSnapshot::FindProducer(EUnitType UnitType) const
+{
+	const FContextButton Button = FContextButton(UnitType);
+
+	/* Just using first usable building, may want to change this to choose fastest queue in 
+	future */
+	for (const FProducerInfo & ProducerInfo : UsableProducers)
+	{
+		if (FI->GetBuildingInfo(ProducerInfo.Type)->GetContextMenu()->HasButton(Button))
+		{
+			return ProducerInfo.Building;
+		}
+	}
+
+	return nullptr;
+}
+
+int32 FCPUPlayerSnapshot::GetOptimalNumCollectors(const FResourceSpotInfo & SpotInfo) const
+{
+	/* For now this just returns 2 no matter what, but would like to take into account: 
+	- distance from spot to depot 
+	- the collectors already gathering from it and their gather rates */
+	return 1;
+}
+
+void FCPUPlayerSnapshot::SetRecursiveTryBuild(FCPUMacroDecision & OutDecision, EBuildingType BuildingType,
+	const FMacroCommandReason & CommandReason)
+{
+	OutDecision.Type = ECPUMacroDecisionType::RecursiveTryBuildBuilding;
+	OutDecision.BuildingType = BuildingType;
+	OutDecision.CommandReason = CommandReason;
+}
+
+void FCPUPlayerSnapshot::SetRecursiveTryBuild(FCPUMacroDecision & OutDecision, EUnitType UnitType,
+	const FMacroCommandReason & CommandReason)
+{
+	OutDecision.Type = ECPUMacroDecisionType::RecursiveTryBuildUnit;
+	OutDecision.UnitType = UnitType;
+	OutDecision.CommandReason = CommandReason;
+}
+
+void FCPUPlayerSnapshot::SetRecursiveTryBuild(FCPUMacroDecision & OutDecision, EUpgradeType UpgradeType,
+	const FMacroCommandReason & CommandReason)
+{
+	OutDecision.Type = ECPUMacroDecisionType::RecursiveTryBuildUpgrade;
+	OutDecision.UpgradeType = UpgradeType;
+	OutDecision.CommandReason = CommandReason;
+}
+
+void ACPUPlayerAIController::TakeSnapshot()
+{
+	Snapshot.FI = FI;
+	Snapshot.MatchTime = GS->Server_GetMatchTime();
+	Snapshot.StartingSpotLocation = StartingSpotLocation;
+	Snapshot.bIsAtSelectableCap = PS->IsAtSelectableCap(true, false);
+	Snapshot.NumUnits = PS->GetUnits().Num();
+	Snapshot.NumConstructionYards = GetNumConstructionYards();
+	Snapshot.NumWorkers = GetNumWorkers();
+	Snapshot.NumBarracks = GetNumBarracks();
+	Snapshot.NumBaseDefenses = GetNumBaseDefenses();
+	Snapshot.ArmyStrength = GetArmyStrength();
+	Snapshot.PendingCommands_ArmyStrength = PendingCommands_ArmyStrength;
+	Snapshot.NumAquiredResourceSpots = NumAquiredResourceSpots;
+	Snapshot.CommandReasons_BuildResourceDepot = CommandReasons_BuildResourceDepot;
+	Snapshot.CommandReasons_TrainCollector = CommandReasons_TrainCollector;
+	Snapshot.CommandReasons_PendingCommands = CommandReasons_PendingCommands;
+
+	/* Resource spots. The spots themselves were gathered in PerformFinalSetup */
+	Snapshot.AquiredResourceSpots.Reset();
+	for (const auto & SpotWeakPtr : AquiredResourceSpots)
+	{
+		Snapshot.AquiredResourceSpots.Emplace(SpotWeakPtr, GetNumCollectorsAssigned(SpotWeakPtr.Get()));
+	}
+
+	/* Producers. Just use the first usable one, may want to change this to choose fastest 
+	queue in future */
+	Snapshot.UsableConstructionYard = nullptr;
+	for (const auto & ConYard : PS->GetPersistentQueueSupportingBuildings())
+	{
+		if (CanUseConstructionYard(ConYard))
+		{
+			Snapshot.UsableConstructionYard = ConYard;
+			break;
+		}
+	}
+
+	/* Which of these can produce what is worked out while deciding */
+	Snapshot.UsableProducers.Reset();
+	for (const auto & Building : PS->GetBuildings())
+	{
+		if (Building->IsConstructionComplete() 
+			&& !Statics::HasZeroHealth(Building) 
+			&& Building->GetContextProductionQueue().AICon_HasRoom())
+		{
+			FCPUPlayerSnapshot::FProducerInfo & ProducerInfo = Snapshot.UsableProducers.Emplace_GetRef();
+			ProducerInfo.Building = Building;
+			ProducerInfo.Type = Building->GetType();
+		}
+	}
+
+	Snapshot.IdleWorkers.Reset();
+	for (const auto & WorkerWeakPtr : IdleWorkers)
+	{
+		AInfantry * Worker = WorkerWeakPtr.Get();
+
+		/* IdleWorkers was populated before this tick's commands were issued */
+		if (IsUnitIdle(Worker) && !Statics::HasZeroHealth(Worker))
+		{
+			FCPUPlayerSnapshot::FIdleWorkerInfo & WorkerInfo = Snapshot.IdleWorkers.Emplace_GetRef();
+			WorkerInfo.Worker = Worker;
+			WorkerInfo.Type = Worker->GetType();
+		}
+	}
+
+	/* Building types */
+	for (const auto & Elem : FI->GetAllBuildingTypes())
+	{
+		const EBuildingType BuildingType = Elem.Key;
+
+		FCPUPlayerSnapshot::FBuildingTypeInfo & TypeInfo = Snapshot.BuildingTypes.FindOrAdd(BuildingType);
+		TypeInfo.bIsAtUniqueCap = PS->IsAtUniqueBuildingCap(BuildingType, true, false);
+		TypeInfo.bArePrerequisitesMet = PS->ArePrerequisitesMet(BuildingType, false);
+		TypeInfo.bHasEnoughResources = PS->HasEnoughResources(BuildingType, false);
+	}
+
+	/* Unit types */
+	for (const auto & Elem : FI->GetAllUnitTypes())
+	{
+		const EUnitType UnitType = Elem.Key;
+
+		FCPUPlayerSnapshot::FUnitTypeInfo & TypeInfo = Snapshot.UnitTypes.FindOrAdd(UnitType);
+		TypeInfo.bIsAtUniqueCap = PS->IsAtUniqueUnitCap(UnitType, true, false);
+		TypeInfo.bArePrerequisitesMet = PS->ArePrerequisitesMet(UnitType, false);
+		TypeInfo.bHasEnoughResources = PS->HasEnoughResources(UnitType, false);
+	}
+
+	/* Upgrades */
+	const AUpgradeManager * UpgradeManager = PS->GetUpgradeManager();
+	Snapshot.bHasResearchedAllUpgrades = UpgradeManager->HasResearchedAllUpgrades();
+	Snapshot.RandomUnresearchedUpgrade = Snapshot.bHasResearchedAllUpgrades 
+		? EUpgradeType::None 
+		: UpgradeManager->Random_GetUnresearchedUpgrade();
+}
+
+void ACPUPlayerAIController::StartDecisionTask()
+{
+	assert(!DecisionTask.IsValid());
+
+	TakeSnapshot();
+
+	DecisionTask = FFunctionGraphTask::CreateAndDispatchWhenReady([this]()
+	{
+		Snapshot.Decide(Decisions);
+	}, TStatId(), nullptr, ENamedThreads::AnyBackgroundThreadNormalTask);
+}
+
+void ACPUPlayerAIController::WaitForDecisionTask()
+{
+	if (DecisionTask.IsValid())
+	{
+		FTaskGraphInterface::Get().WaitUntilTaskCompletes(DecisionTask);
+		DecisionTask.SafeRelease();
+	}
+}
+
+bool ACPUPlayerAIController::CarryOutDecision(const FCPUMacroDecision & InDecision)
+{
+	switch (InDecision.Type)
+	{
+		case ECPUMacroDecisionType::None:
+		{
+			return false;
+		}
+		case ECPUMacroDecisionType::TrainUnit:
+		{
+			ABuilding * Barracks = InDecision.Producer.Get();
+			if (Barracks != nullptr
+				&& CanTrainFromBuilding(Barracks, InDecision.UnitType)
+				&& PS->IsAtSelectableCap(true, false) == false
+				&& PS->HasEnoughResources(InDecision.UnitType, false))
+			{
+				ActuallyIssueTrainUnitCommand(InDecision.UnitType, Barracks, InDecision.CommandReason);
+				return true;
+			}
+			return false;
+		}
+		case ECPUMacroDecisionType::SaveUpForUnit:
+		{
+			ABuilding * Barracks = InDecision.Producer.Get();
+			if (Barracks != nullptr && !Statics::HasZeroHealth(Barracks))
+			{
+				SetSavingsTarget(InDecision.UnitType, Barracks, InDecision.CommandReason);
+				return true;
+			}
+			return false;
+		}
+		case ECPUMacroDecisionType::BuildResourceDepot:
+		case ECPUMacroDecisionType::BuildBuilding:
+		{
+			AResourceSpot * ResourceSpot = InDecision.ResourceSpot.Get();
+			if ((InDecision.Type == ECPUMacroDecisionType::BuildResourceDepot && ResourceSpot == nullptr)
+				|| PS->IsAtSelectableCap(true, false)
+				|| !PS->HasEnoughResources(InDecision.BuildingType, false)
+				|| !PS->ArePrerequisitesMet(InDecision.BuildingType, false))
+			{
+				return false;
+			}
+
+			ABuilding * ConstructionYard = InDecision.Producer.Get();
+			AInfantry * Worker = InDecision.Worker.Get();
+			if (ConstructionYard != nullptr && CanUseConstructionYard(ConstructionYard))
+			{
+				if (InDecision.Type == ECPUMacroDecisionType::BuildResourceDepot)
+				{
+					TryIssueBuildResourceDepotCommand(InDecision.BuildingType, ConstructionYard,
+						ResourceSpot, InDecision.CommandReason);
+				}
+				else
+				{
+					TryIssueBuildBuildingCommand(InDecision.BuildingType, ConstructionYard,
+						InDecision.CommandReason);
+				}
+				return true;
+			}
+			else if (Worker != nullptr && IsUnitIdle(Worker) && CanUseIdleWorker(Worker, InDecision.BuildingType))
+			{
+				if (InDecision.Type == ECPUMacroDecisionType::BuildResourceDepot)
+				{
+					TryIssueBuildResourceDepotCommand(InDecision.BuildingType, Worker, ResourceSpot,
+						InDecision.CommandReason);
+				}
+				else
+				{
+					TryIssueBuildBuildingCommand(InDecision.BuildingType, Worker, InDecision.CommandReason);
+				}
+				return true;
+			}
+			return false;
+		}
+		case ECPUMacroDecisionType::RecursiveTryBuildBuilding:
+		{
+			return InitialRecursiveTryBuildWrapper(InDecision.BuildingType, InDecision.CommandReason);
+		}
+		case ECPUMacroDecisionType::RecursiveTryBuildUnit:
+		{
+			return InitialRecursiveTryBuildWrapper(InDecision.UnitType, InDecision.CommandReason);
+		}
+		case ECPUMacroDecisionType::RecursiveTryBuildUpgrade:
+		{
+			return InitialRecursiveTryBuildWrapper(InDecision.UpgradeType, InDecision.CommandReason);
+		}
+		default:
+		{
+			UE_LOG(RTSLOG, Fatal, TEXT("Unknown decision type: %d"), static_cast<int32>(InDecision.Type));
+			return false;
+		}
+	}
+}
+
+bool ACPUPlayerAIController::CarryOutDecisions(bool bBeforeStateChecks)
+{
+	for (const FCPUMacroDecision & Elem : Decisions)
+	{
+		if (Elem.bBeforeStateChecks == bBeforeStateChecks)
+		{
+			if (CarryOutDecision(Elem))
+			{
+				return true;
+			}
+
+			UE_VLOG(this, RTSLOG, Verbose, TEXT("Could not carry out decision of type %d, trying next "
+				"one"), static_cast<int32>(Elem.Type));
+		}
+	}
+
+	return false;
+}
+
 void ACPUPlayerAIController::AssignIdleCollectors()
 {		
 	for (const auto & UnitWeakPtr : IdleCollectors)
@@ -3136,10 +3437,8 @@ int32 ACPUPlayerAIController::GetArmyStrength() const
 	return ArmyStrength;
 }
 
-int32 ACPUPlayerAIController::GetExpectedNumDepots(EResourceType ResourceType) const
+int32 FCPUPlayerSnapshot::GetExpectedNumDepots(EResourceType ResourceType) const
 {
-	const float MatchTime = GS->Server_GetMatchTime();
-	
 	/* Just based on how long match has been going for */
 	if (MatchTime < 3.f * MINUTE)
 	{
@@ -3155,10 +3454,8 @@ int32 ACPUPlayerAIController::GetExpectedNumDepots(EResourceType ResourceType) c
 	}
 }
 
-int32 ACPUPlayerAIController::GetExpectedNumConstructionYards() const
+int32 FCPUPlayerSnapshot::GetExpectedNumConstructionYards() const
 {
-	const float MatchTime = GS->Server_GetMatchTime();
-	
 	if (MatchTime < 15.f * MINUTE)
 	{
 		return 1;
@@ -3169,10 +3466,8 @@ int32 ACPUPlayerAIController::GetExpectedNumConstructionYards() const
 	}
 }
 
-int32 ACPUPlayerAIController::GetExpectedNumWorkers() const
+int32 FCPUPlayerSnapshot::GetExpectedNumWorkers() const
 {
-	const float MatchTime = GS->Server_GetMatchTime();
-	
 	if (MatchTime < 2.f * MINUTE)
 	{
 		return 2;
@@ -3183,10 +3478,8 @@ int32 ACPUPlayerAIController::GetExpectedNumWorkers() const
 	}
 }
 
-int32 ACPUPlayerAIController::GetExpectedNumBarracks() const
+int32 FCPUPlayerSnapshot::GetExpectedNumBarracks() const
 {
-	const float MatchTime = GS->Server_GetMatchTime();
-	
 	if (MatchTime < 0.03f * MINUTE)
 	{
 		return 0;
@@ -3205,10 +3498,8 @@ int32 ACPUPlayerAIController::GetExpectedNumBarracks() const
 	}
 }
 
-int32 ACPUPlayerAIController::GetExpectedNumBaseDefenses() const
+int32 FCPUPlayerSnapshot::GetExpectedNumBaseDefenses() const
 {
-	const float MatchTime = GS->Server_GetMatchTime();
-
 	if (MatchTime < 5.f * MINUTE)
 	{
 		return 0;
@@ -3219,10 +3510,8 @@ int32 ACPUPlayerAIController::GetExpectedNumBaseDefenses() const
 	}
 }
 
-int32 ACPUPlayerAIController::GetExpectedArmyStrength() const
+int32 FCPUPlayerSnapshot::GetExpectedArmyStrength() const
 {
-	const float MatchTime = GS->Server_GetMatchTime();
-	
 	return 9000;
 }
 
@@ -3560,14 +3849,6 @@ bool ACPUPlayerAIController::RecursiveTryBuild(EUpgradeType UpgradeType, FMacroC
 	}
 }
 
-int32 ACPUPlayerAIController::GetOptimalNumCollectors(AResourceSpot * ResourceSpot) const
-{
-	/* For now this just returns 2 no matter what, but would like to take into account: 
-	- distance from spot to depot 
-	- the collectors already gathering from it and their gather rates */
-	return 1;
-}
-
 int32 ACPUPlayerAIController::GetNumCollectorsAssigned(AResourceSpot * ResourceSpot) const
 {
 	return NumCollectors[ResourceSpot].Num();
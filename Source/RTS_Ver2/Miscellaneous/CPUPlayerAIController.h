@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "AIController.h"
+#include "Async/TaskGraphInterfaces.h"
 
 #include "Statics/CommonEnums.h"
 //#include "Statics/OtherEnums.h"
@@ -149,7 +150,6 @@ the UPROPERTY macro above them to function properly? */
  - Review: ISelectable::GetCOntextMenu maybe can be moved to be a ABuilding func instead
  - Constructing FContextButton for each HasButton call could be costly especially since 
  FContextButton::operator== checks 4 vars. Consider developing quicker comparison method. 
- PS::ProductionCapableBuildings also relies on FContextButton as key
  - Need to create a master func to check if a queue can be used for something, or a func that 
  finds the queue with the smallest wait time
  
@@ -704,6 +704,227 @@ public:
 };
 
 
+//=============================================================================================
+//	Decision Making Structs
+//=============================================================================================
+//	Deciding what macro command to issue next is done on a worker thread against a snapshot of 
+//	the player's state taken on the game thread. The decision comes back as a FCPUMacroDecision 
+//	and is carried out on the game thread the next time the AI controller ticks.
+
+/* Which command issuing function a FCPUMacroDecision wants called */
+enum class ECPUMacroDecisionType : uint8
+{
+	/* Nothing to do */
+	None,
+
+	/* ActuallyIssueTrainUnitCommand */
+	TrainUnit,
+
+	/* SetSavingsTarget for a unit */
+	SaveUpForUnit,
+
+	/* TryIssueBuildResourceDepotCommand */
+	BuildResourceDepot,
+
+	/* TryIssueBuildBuildingCommand */
+	BuildBuilding,
+
+	/* InitialRecursiveTryBuildWrapper */
+	RecursiveTryBuildBuilding,
+	RecursiveTryBuildUnit,
+	RecursiveTryBuildUpgrade
+};
+
+
+/* The result of a decision making pass. Only one of Producer or Worker will be set */
+struct FCPUMacroDecision
+{
+	FCPUMacroDecision()
+		: Type(ECPUMacroDecisionType::None)
+		, bBeforeStateChecks(false)
+		, BuildingType(EBuildingType::NotBuilding)
+		, UnitType(EUnitType::None)
+		, UpgradeType(EUpgradeType::None)
+	{}
+
+	ECPUMacroDecisionType Type;
+
+	/* True if the decision should be carried out before checking whether we are saving up or 
+	waiting for a queue. Collectors and depots are considered more important than those */
+	bool bBeforeStateChecks;
+
+	EBuildingType BuildingType;
+	EUnitType UnitType;
+	EUpgradeType UpgradeType;
+
+	/* Building that will produce what we want */
+	TWeakObjectPtr < ABuilding > Producer;
+
+	/* Worker that will build what we want */
+	TWeakObjectPtr < AInfantry > Worker;
+
+	/* Resource spot to build depot at */
+	TWeakObjectPtr < AResourceSpot > ResourceSpot;
+
+	FMacroCommandReason CommandReason;
+};
+
+
+/**
+ *	Everything the decision making functions need to know about a CPU player. Taken on the game 
+ *	thread then read from a worker thread.
+ *
+ *	Only raw inputs are copied in here. Anything that needs combining e.g. which idle worker 
+ *	can build which building type is worked out while deciding so the game thread does not 
+ *	pay for it.
+ *
+ *	Actor pointers in here are only there to be passed back in a FCPUMacroDecision. They must 
+ *	never be dereferenced while deciding. Faction info is the exception: it does not change 
+ *	during a match so it is read directly.
+ */
+struct FCPUPlayerSnapshot
+{
+	/* Info about a resource spot. Resource spots do not move or change type so these are 
+	gathered once at the start of the match */
+	struct FResourceSpotInfo
+	{
+		TWeakObjectPtr < AResourceSpot > Spot;
+		EResourceType Type;
+		FVector Location;
+	};
+
+	/* An idle worker that is still alive */
+	struct FIdleWorkerInfo
+	{
+		TWeakObjectPtr < AInfantry > Worker;
+		EUnitType Type;
+	};
+
+	/* A building that is still alive and has room in its context production queue */
+	struct FProducerInfo
+	{
+		TWeakObjectPtr < ABuilding > Building;
+		EBuildingType Type;
+	};
+
+	/* Info about a building type on the faction's roster */
+	struct FBuildingTypeInfo
+	{
+		bool bIsAtUniqueCap;
+		bool bArePrerequisitesMet;
+		bool bHasEnoughResources;
+	};
+
+	/* Info about a unit type on the faction's roster */
+	struct FUnitTypeInfo
+	{
+		bool bIsAtUniqueCap;
+		bool bArePrerequisitesMet;
+		bool bHasEnoughResources;
+	};
+
+	const AFactionInfo * FI;
+
+	float MatchTime;
+
+	FVector StartingSpotLocation;
+
+	bool bIsAtSelectableCap;
+
+	int32 NumUnits;
+	int32 NumConstructionYards;
+	int32 NumWorkers;
+	int32 NumBarracks;
+	int32 NumBaseDefenses;
+	int32 ArmyStrength;
+	int32 PendingCommands_ArmyStrength;
+
+	TMap < EResourceType, int16 > NumAquiredResourceSpots;
+	TMap < EResourceType, int32 > CommandReasons_BuildResourceDepot;
+	TMap < EResourceType, int32 > CommandReasons_TrainCollector;
+	TMap < EMacroCommandType, int32 > CommandReasons_PendingCommands;
+
+	/* Every resource spot on the map */
+	TArray < FResourceSpotInfo > ResourceSpots;
+
+	/* Maps each spot in the AI controller's AquiredResourceSpots to how many collectors are 
+	assigned to it */
+	TMap < TWeakObjectPtr < AResourceSpot >, int32 > AquiredResourceSpots;
+
+	TArray < FIdleWorkerInfo > IdleWorkers;
+	TArray < FProducerInfo > UsableProducers;
+
+	TMap < EBuildingType, FBuildingTypeInfo > BuildingTypes;
+	TMap < EUnitType, FUnitTypeInfo > UnitTypes;
+
+	/* First construction yard with room in its queue, or null if none have room */
+	TWeakObjectPtr < ABuilding > UsableConstructionYard;
+
+	bool bHasResearchedAllUpgrades;
+
+	/* Unresearched upgrade to research if we decide to. Picked when snapshot was taken */
+	EUpgradeType RandomUnresearchedUpgrade;
+
+	/** 
+	 *	Decide what macro commands could be issued. Same order of checks as DoBehavior used to 
+	 *	do them, except every check gets a say instead of stopping at the first one. That way 
+	 *	if the most important decision cannot be carried out the next one can be tried instead. 
+	 *	Safe to call off the game thread 
+	 *
+	 *	@param OutDecisions - decisions in the order they should be tried 
+	 */
+	void Decide(TArray < FCPUMacroDecision > & OutDecisions) const;
+
+protected:
+
+	/* The 'Decide' functions return true if they set OutDecision */
+	bool DecideIfShouldBuildCollector(FCPUMacroDecision & OutDecision) const;
+	bool DecideIfShouldBuildResourceDepot(FCPUMacroDecision & OutDecision) const;
+	bool DecideIfShouldBuildInfastructureProducingThing(FCPUMacroDecision & OutDecision) const;
+	bool DecideIfShouldBuildBarracks(FCPUMacroDecision & OutDecision) const;
+	bool DecideIfShouldResearchUpgrade(FCPUMacroDecision & OutDecision) const;
+	bool DecideIfShouldBuildBaseDefense(FCPUMacroDecision & OutDecision) const;
+	bool DecideIfShouldBuildArmyUnit(FCPUMacroDecision & OutDecision) const;
+
+	/* First idle worker that can build a building type, or null if none can */
+	TWeakObjectPtr < AInfantry > FindIdleWorker(EBuildingType BuildingType) const;
+
+	/* First building that can train a unit type right now, or null if none can */
+	TWeakObjectPtr < ABuilding > FindProducer(EUnitType UnitType) const;
+
+	/** 
+	 *	Given a resource spot return how many collectors should be assigned to it for max resource 
+	 *	gathering rate. e.g. in SCII a vespene gyser is 3 but can be larger depending on how far 
+	 *	away the closest nexus is.
+	 *	This function cannot really be 100% correct though without taking into account if the 
+	 *	collectors have different gathering speeds and the distance from the nearest depot 
+	 *
+	 *	@param SpotInfo - resource spot we want to know how many collectors is optimal
+	 *	@return - optimal number of collectors
+	 */
+	int32 GetOptimalNumCollectors(const FResourceSpotInfo & SpotInfo) const;
+
+	/* Set OutDecision to recursively try build something */
+	static void SetRecursiveTryBuild(FCPUMacroDecision & OutDecision, EBuildingType BuildingType, 
+		const FMacroCommandReason & CommandReason);
+	static void SetRecursiveTryBuild(FCPUMacroDecision & OutDecision, EUnitType UnitType, 
+		const FMacroCommandReason & CommandReason);
+	static void SetRecursiveTryBuild(FCPUMacroDecision & OutDecision, EUpgradeType UpgradeType, 
+		const FMacroCommandReason & CommandReason);
+
+	/** 
+	 *	Getters that drive when the player should build more of something. They do not take into 
+	 *	account any pending commands
+	 */
+	int32 GetExpectedNumDepots(EResourceType ResourceType) const;
+	int32 GetExpectedNumConstructionYards() const;
+	int32 GetExpectedNumWorkers() const;
+	int32 GetExpectedNumBarracks() const;
+	int32 GetExpectedNumBaseDefenses() const;
+	int32 GetExpectedArmyStrength() const;
+};
+
+
 //=============================================================================================
 //	CPU Player AI Controller Implementation
 //=============================================================================================
@@ -784,13 +1005,16 @@ public:
 	/* Called right after NotifyOfStartingSelectables. */
 	void PerformFinalSetup();
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 #if ENABLE_VISUAL_LOG
 	virtual void GrabDebugSnapshot(FVisualLogEntry * Snapshot) const override;
 #endif // ENABLE_VISUAL_LOG
 
 	/** 
-	 *	This is this class's tick. It is called from a tick manager. This is where all the 
-	 *	behavior decisions are made 
+	 *	This is this class's tick. It is called from a tick manager. This carries out the 
+	 *	decision made since the last tick then starts deciding what to do next tick on a 
+	 *	worker thread 
 	 */
 	void TickFromManager();
 
@@ -937,33 +1161,48 @@ protected:
 	necessary data about them. */
 	void PreBehaviorPass();
 
-	/* What is called during each AI tick that handles doing a lot of behavior. It handles 
-	deciding if player should take an action and will carry out that action */
+	/* What is called during each AI tick that handles doing a lot of behavior. It carries out 
+	the decision made last tick and handles the saving up/queue waiting state */
 	void DoBehavior();
 
 	//=========================================================================================
-	//	Decision Making Queries
+	//	Decision Making
 	//=========================================================================================
 
-	/* Decide if should build a resource collector and if yes then take action towards making 
-	it happen */
-	bool DecideIfShouldBuildCollector();
+	/* Copy everything the decision making functions need into Snapshot */
+	void TakeSnapshot();
 
-	bool DecideIfShouldBuildResourceDepot();
+	/* Take a snapshot and start deciding what to do next tick on a worker thread */
+	void StartDecisionTask();
 
-	/* Decide if should build either a worker or a construction yard type building. */
-	bool DecideIfShouldBuildInfastructureProducingThing();
+	/* Block until DecisionTask has finished if it is running */
+	void WaitForDecisionTask();
 
-	/* Decide if should build a building that can make army units */
-	bool DecideIfShouldBuildBarracks();
-	
-	bool DecideIfShouldResearchUpgrade();
+	/** 
+	 *	Carry out a decision made by the decision task. Things may have changed since the 
+	 *	snapshot was taken so anything that matters is checked again first.
+	 *	
+	 *	@return - true if a command was issued or a savings target was set 
+	 */
+	bool CarryOutDecision(const FCPUMacroDecision & InDecision);
+
+	/** 
+	 *	Try carry out each of Decisions in order until one works 
+	 *	
+	 *	@param bBeforeStateChecks - only try the decisions with this value for bBeforeStateChecks 
+	 *	@return - true if a decision was carried out 
+	 */
+	bool CarryOutDecisions(bool bBeforeStateChecks);
+
+	/* State the decision task reads. Only written to while the task is not running */
+	FCPUPlayerSnapshot Snapshot;
 
-	/* Decide if should build a base defense building */
-	bool DecideIfShouldBuildBaseDefense();
+	/* What the decision task decided, most important first. Only read once the task has 
+	completed */
+	TArray < FCPUMacroDecision > Decisions;
 
-	/* Decide if should train a unit to use as an army unit */
-	bool DecideIfShouldBuildArmyUnit();
+	/* Task deciding what to do next tick. May not be valid */
+	FGraphEventRef DecisionTask;
 
 
 	//=========================================================================================
@@ -1177,18 +1416,6 @@ protected:
 	int32 GetNumBaseDefenses() const;
 	int32 GetArmyStrength() const;
 
-	/** 
-	 *	Getters that drive when the player should build more of something. They do not take into 
-	 *	account any pending commands
-	 */
-
-	int32 GetExpectedNumDepots(EResourceType ResourceType) const;
-	int32 GetExpectedNumConstructionYards() const;
-	int32 GetExpectedNumWorkers() const;
-	int32 GetExpectedNumBarracks() const;
-	int32 GetExpectedNumBaseDefenses() const;
-	int32 GetExpectedArmyStrength() const;
-
 
 	//=========================================================================================
 	//	Utility functions
@@ -1236,18 +1463,6 @@ protected:
 
 	bool RecursiveTryBuild(EUpgradeType UpgradeType, FMacroCommandReason CommandReason);
 
-	/** 
-	 *	Given a resource spot return how many collectors should be assigned to it for max resource 
-	 *	gathering rate. e.g. in SCII a vespene gyser is 3 but can be larger depending on how far 
-	 *	away the closest nexus is.
-	 *	This function cannot really be 100% correct though without taking into account if the 
-	 *	collectors have different gathering speeds and the distance from the nearest depot 
-	 *
-	 *	@param ResourceSpot - resource spot we want to know how many collectors is optimal
-	 *	@return - optimal number of collectors
-	 */
-	int32 GetOptimalNumCollectors(AResourceSpot * ResourceSpot) const;
-
 	/* Given a resource spot get the number of collectors that have been assigned to it */
 	int32 GetNumCollectorsAssigned(AResourceSpot * ResourceSpot) const;
 
@@ -55,6 +55,7 @@ FORCEINLINE bool RepGraphConditionalActorBreakpoint(AActor* Actor, UNetConnectio
 
 URTSReplicationGraph::URTSReplicationGraph()
 {
+	GS = nullptr;
 	ReplicationConnectionManagerClass = URTSReplicationGraphConnection::StaticClass();
 }
 
@@ -139,6 +140,8 @@ void URTSReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnecti
 
 void URTSReplicationGraph::NotifyOfNumTeams(uint8 NumTeams, ARTSGameState * GameState)
 {
+	GS = GameState;
+
 	//-------------------------------------------------------
 	//	Team nodes. Create one for each team
 	//-------------------------------------------------------
@@ -417,6 +420,8 @@ int32 URTSReplicationGraph::ServerReplicateActors(float DeltaSeconds)
 		{
 			Node->PrepareForReplication();
 		}
+
+		ApplyTeamVisibilityChanges();
 	}
 
 	// -------------------------------------------------------
@@ -1360,6 +1365,57 @@ void URTSReplicationGraph::NotifyOfBuildingDestroyed(ABuilding * Building)
 	// NOOP
 }
 
+void URTSReplicationGraph::ApplyTeamVisibilityChanges()
+{
+	for (int32 i = 0; i < TeamVisibilityInfos.Num(); ++i)
+	{
+		FVisibilityInfo & TeamVisibilityInfo = *TeamVisibilityInfos[i];
+		
+		if (TeamVisibilityInfo.HasAnyChangedSelectables() == false)
+		{
+			continue;
+		}
+
+		TeamVisibilityInfo.ForEachChangedSelectable([&](uint8 OwnerID, uint8 SelectableID, bool bIsNowVisible)
+		{
+			/* Player could have left or been defeated since */
+			ARTSPlayerState * Owner = GS->FindPlayerFromID(OwnerID);
+			if (Owner == nullptr)
+			{
+				return;
+			}
+
+			AActor * Selectable = Owner->GetSelectableFromID(SelectableID);
+			
+			/* Null means it has been destroyed since. Its node will have already marked every 
+			team's list as stale */
+			if (Selectable == nullptr)
+			{
+				return;
+			}
+
+			if (ABuilding * Building = Cast<ABuilding>(Selectable))
+			{
+				/* Not routed to a node yet. Node will rebuild its lists once it is */
+				if (HasSelectableSetUp<ABuilding>(Building))
+				{
+					GetBuildingsNodeForTeam(Building->GetTeam())->OnSelectableVisibilityChanged(i, Building, OwnerID, SelectableID, bIsNowVisible);
+				}
+			}
+			else
+			{
+				AInfantry * Infantry = CastChecked<AInfantry>(Selectable);
+				if (HasSelectableSetUp<AInfantry>(Infantry))
+				{
+					GetInfantryNodeForTeam(Infantry->GetTeam())->OnSelectableVisibilityChanged(i, Infantry, OwnerID, SelectableID, bIsNowVisible);
+				}
+			}
+		});
+
+		TeamVisibilityInfo.ClearChangedSelectables();
+	}
+}
+
 void URTSReplicationGraph::ForceNetUpdate(AActor * Actor)
 {
 	if (FGlobalActorReplicationInfo * RepInfo = GlobalActorReplicationInfoMap.Find(Actor))
@@ -1509,6 +1565,13 @@ void URTSReplicationGraphNode_TeamBuildings::SetupNode(ETeam InTeam, ARTSGameSta
 	URTSReplicationGraphNode_ActorList::SetupNode();
 
 	Team = InTeam;
+
+	for (int32 i = 0; i < ProjectSettings::MAX_NUM_TEAMS; ++i)
+	{
+		TeamVisibleLists[i].Reset();
+	}
+	FMemory::Memzero(InTeamVisibleListBits);
+	StaleTeamListsMask = UINT32_MAX;
 }
 
 void URTSReplicationGraphNode_TeamBuildings::NotifyAddNetworkActor(const FNewReplicatedActorInfo & ActorInfo)
@@ -1518,11 +1581,13 @@ void URTSReplicationGraphNode_TeamBuildings::NotifyAddNetworkActor(const FNewRep
 	ReplicationActorList.Add(ActorInfo.Actor);
 
 	Buildings.Emplace(ActorInfo.Actor);
+	StaleTeamListsMask = UINT32_MAX;
 }
 
 bool URTSReplicationGraphNode_TeamBuildings::NotifyRemoveNetworkActor(const FNewReplicatedActorInfo & ActorInfo, bool bWarnIfNotFound)
 {
 	const bool bFoundActor = Buildings.RemoveSingleSwap(ActorInfo.GetActor());
+	StaleTeamListsMask = UINT32_MAX;
 
 	if (bWarnIfNotFound && !bFoundActor)
 	{
@@ -1535,6 +1600,7 @@ bool URTSReplicationGraphNode_TeamBuildings::NotifyRemoveNetworkActor(const FNew
 void URTSReplicationGraphNode_TeamBuildings::NotifyResetAllNetworkActors()
 {
 	Buildings.Reset();
+	StaleTeamListsMask = UINT32_MAX;
 
 	Super::NotifyResetAllNetworkActors();
 }
@@ -1550,23 +1616,73 @@ void URTSReplicationGraphNode_TeamBuildings::GatherActorListsForConnection(const
 	}
 	else
 	{
-		ReplicationActorList.Reset();
+		const int32 TeamIndex = Statics::TeamToArrayIndex(ConnectionsTeam);
+
+		/* Visibility changes are patched in as they happen by OnSelectableVisibilityChanged so 
+		this only needs rebuilding if the node's actors have changed. Only the first connection 
+		on the team to gather since then pays for it */
+		if (StaleTeamListsMask & (1 << TeamIndex))
+		{
+			RebuildTeamVisibleList(TeamIndex, CastChecked<URTSReplicationGraph>(GetOuter())->GetTeamVisibilityInfo(ConnectionsTeam));
+		}
 
-		const FVisibilityInfo & TeamVisibilityInfo = CastChecked<URTSReplicationGraph>(GetOuter())->GetTeamVisibilityInfo(ConnectionsTeam);
+		Params.OutGatheredReplicationLists.AddReplicationActorList(TeamVisibleLists[TeamIndex]);
+	}
+}
 
-		/* Anything:
-		1. outside fog of war and
-		2. not in stealth mode or in stealth mode but revealed by stealth detection
-		is relevant. */
-		for (const auto & Building : Buildings)
+void URTSReplicationGraphNode_TeamBuildings::RebuildTeamVisibleList(int32 TeamIndex, const FVisibilityInfo & TeamVisibilityInfo)
+{
+	FActorRepListRefView & VisibleList = TeamVisibleLists[TeamIndex];
+	uint64 * InListBits = InTeamVisibleListBits[TeamIndex];
+	
+	VisibleList.Reset();
+	FMemory::Memzero(InListBits, sizeof(InTeamVisibleListBits[TeamIndex]));
+
+	/* Anything:
+	1. outside fog of war and
+	2. not in stealth mode or in stealth mode but revealed by stealth detection
+	is relevant. */
+	for (const auto & Building : Buildings)
+	{
+		const ISelectable * AsSelectable = CastChecked<ABuilding>(Building);
+		const uint8 OwnerID = AsSelectable->GetOwnersID();
+		const uint8 SelectableID = AsSelectable->GetSelectableID();
+		
+		if (TeamVisibilityInfo.IsSelectableVisible(OwnerID, SelectableID))
 		{
-			if (TeamVisibilityInfo.IsVisible(Building))
-			{
-				ReplicationActorList.Add(Building);
-			}
+			VisibleList.Add(Building);
+
+			const int32 BitIndex = FVisibilityInfo::GetBitIndex(OwnerID, SelectableID);
+			InListBits[BitIndex >> 6] |= (1ULL << (BitIndex & 63));
 		}
+	}
 
-		Params.OutGatheredReplicationLists.AddReplicationActorList(ReplicationActorList);
+	StaleTeamListsMask &= ~(1 << TeamIndex);
+}
+
+void URTSReplicationGraphNode_TeamBuildings::OnSelectableVisibilityChanged(int32 TeamIndex, AActor * Selectable, uint8 OwnerID, uint8 SelectableID, bool bIsNowVisible)
+{
+	if (StaleTeamListsMask & (1 << TeamIndex))
+	{
+		// Will be rebuilt on next gather anyway
+		return;
+	}
+
+	const int32 BitIndex = FVisibilityInfo::GetBitIndex(OwnerID, SelectableID);
+	uint64 & Word = InTeamVisibleListBits[TeamIndex][BitIndex >> 6];
+	const uint64 Mask = 1ULL << (BitIndex & 63);
+	const bool bIsInList = (Word & Mask) != 0;
+
+	/* Several flips may have collapsed into one change so it could already be in the right state */
+	if (bIsNowVisible && !bIsInList)
+	{
+		TeamVisibleLists[TeamIndex].Add(Selectable);
+		Word |= Mask;
+	}
+	else if (!bIsNowVisible && bIsInList)
+	{
+		TeamVisibleLists[TeamIndex].Remove(Selectable);
+		Word &= ~Mask;
 	}
 }
 
@@ -1578,6 +1694,13 @@ void URTSReplicationGraphNode_TeamInfantry::SetupNode(ETeam InTeam, ARTSGameStat
 	URTSReplicationGraphNode_ActorList::SetupNode();
 
 	Team = InTeam;
+
+	for (int32 i = 0; i < ProjectSettings::MAX_NUM_TEAMS; ++i)
+	{
+		TeamVisibleLists[i].Reset();
+	}
+	FMemory::Memzero(InTeamVisibleListBits);
+	StaleTeamListsMask = UINT32_MAX;
 }
 
 void URTSReplicationGraphNode_TeamInfantry::NotifyAddNetworkActor(const FNewReplicatedActorInfo & ActorInfo)
@@ -1585,11 +1708,13 @@ void URTSReplicationGraphNode_TeamInfantry::NotifyAddNetworkActor(const FNewRepl
 	ReplicationActorList.Add(ActorInfo.Actor);
 
 	Infantry.Emplace(ActorInfo.Actor);
+	StaleTeamListsMask = UINT32_MAX;
 }
 
 bool URTSReplicationGraphNode_TeamInfantry::NotifyRemoveNetworkActor(const FNewReplicatedActorInfo & ActorInfo, bool bWarnIfNotFound)
 {
 	const bool bFoundActor = Infantry.RemoveSingleSwap(ActorInfo.GetActor());
+	StaleTeamListsMask = UINT32_MAX;
 
 	if (bWarnIfNotFound && !bFoundActor)
 	{
@@ -1602,6 +1727,7 @@ bool URTSReplicationGraphNode_TeamInfantry::NotifyRemoveNetworkActor(const FNewR
 void URTSReplicationGraphNode_TeamInfantry::NotifyResetAllNetworkActors()
 {
 	Infantry.Reset();
+	StaleTeamListsMask = UINT32_MAX;
 
 	Super::NotifyResetAllNetworkActors();
 }
@@ -1616,23 +1742,73 @@ void URTSReplicationGraphNode_TeamInfantry::GatherActorListsForConnection(const
 	}
 	else
 	{
-		ReplicationActorList.Reset();
+		const int32 TeamIndex = Statics::TeamToArrayIndex(ConnectionsTeam);
 
-		const FVisibilityInfo & TeamVisibilityInfo = CastChecked<URTSReplicationGraph>(GetOuter())->GetTeamVisibilityInfo(ConnectionsTeam);
+		/* Visibility changes are patched in as they happen by OnSelectableVisibilityChanged so 
+		this only needs rebuilding if the node's actors have changed. Only the first connection 
+		on the team to gather since then pays for it */
+		if (StaleTeamListsMask & (1 << TeamIndex))
+		{
+			RebuildTeamVisibleList(TeamIndex, CastChecked<URTSReplicationGraph>(GetOuter())->GetTeamVisibilityInfo(ConnectionsTeam));
+		}
 
-		/* Anything:
-		1. outside fog of war and
-		2. not in stealth mode or in stealth mode but revealed by stealth detection
-		is relevant. */
-		for (const auto & Unit : Infantry)
+		Params.OutGatheredReplicationLists.AddReplicationActorList(TeamVisibleLists[TeamIndex]);
+	}
+}
+
+void URTSReplicationGraphNode_TeamInfantry::RebuildTeamVisibleList(int32 TeamIndex, const FVisibilityInfo & TeamVisibilityInfo)
+{
+	FActorRepListRefView & VisibleList = TeamVisibleLists[TeamIndex];
+	uint64 * InListBits = InTeamVisibleListBits[TeamIndex];
+	
+	VisibleList.Reset();
+	FMemory::Memzero(InListBits, sizeof(InTeamVisibleListBits[TeamIndex]));
+
+	/* Anything:
+	1. outside fog of war and
+	2. not in stealth mode or in stealth mode but revealed by stealth detection
+	is relevant. */
+	for (const auto & Unit : Infantry)
+	{
+		const ISelectable * AsSelectable = CastChecked<AInfantry>(Unit);
+		const uint8 OwnerID = AsSelectable->GetOwnersID();
+		const uint8 SelectableID = AsSelectable->GetSelectableID();
+		
+		if (TeamVisibilityInfo.IsSelectableVisible(OwnerID, SelectableID))
 		{
-			if (TeamVisibilityInfo.IsVisible(Unit))
-			{
-				ReplicationActorList.Add(Unit);
-			}
+			VisibleList.Add(Unit);
+
+			const int32 BitIndex = FVisibilityInfo::GetBitIndex(OwnerID, SelectableID);
+			InListBits[BitIndex >> 6] |= (1ULL << (BitIndex & 63));
 		}
+	}
 
-		Params.OutGatheredReplicationLists.AddReplicationActorList(ReplicationActorList);
+	StaleTeamListsMask &= ~(1 << TeamIndex);
+}
+
+void URTSReplicationGraphNode_TeamInfantry::OnSelectableVisibilityChanged(int32 TeamIndex, AActor * Selectable, uint8 OwnerID, uint8 SelectableID, bool bIsNowVisible)
+{
+	if (StaleTeamListsMask & (1 << TeamIndex))
+	{
+		// Will be rebuilt on next gather anyway
+		return;
+	}
+
+	const int32 BitIndex = FVisibilityInfo::GetBitIndex(OwnerID, SelectableID);
+	uint64 & Word = InTeamVisibleListBits[TeamIndex][BitIndex >> 6];
+	const uint64 Mask = 1ULL << (BitIndex & 63);
+	const bool bIsInList = (Word & Mask) != 0;
+
+	/* Several flips may have collapsed into one change so it could already be in the right state */
+	if (bIsNowVisible && !bIsInList)
+	{
+		TeamVisibleLists[TeamIndex].Add(Selectable);
+		Word |= Mask;
+	}
+	else if (!bIsNowVisible && bIsInList)
+	{
+		TeamVisibleLists[TeamIndex].Remove(Selectable);
+		Word &= ~Mask;
 	}
 }
 
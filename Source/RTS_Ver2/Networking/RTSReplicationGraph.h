@@ -4,6 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "ReplicationGraph.h"
+
+#include "Settings/ProjectSettings.h"
+#include "Statics/Structs_2.h"
 #include "RTSReplicationGraph.generated.h"
 
 class URTSReplicationGraphNode_AlwaysRelevant;
@@ -12,7 +15,6 @@ class URTSReplicationGraphNode_TeamBuildings;
 class URTSReplicationGraphNode_TeamInfantry;
 enum class ETeam : uint8;
 class ARTSGameState;
-struct FVisibilityInfo;
 class ABuilding;
 class AInfantry;
 
@@ -151,6 +153,14 @@ public:
 
 	const FVisibilityInfo & GetTeamVisibilityInfo(ETeam Team) const;
 
+protected:
+
+	/* Drain every team's FVisibilityInfo changes and patch the team nodes' cached lists with 
+	them. Called once per replication frame before anything gathers */
+	void ApplyTeamVisibilityChanges();
+
+public:
+
 	void NotifyOfBuildingDestroyed(ABuilding * Building);
 
 protected:
@@ -175,6 +185,9 @@ protected:
 
 	TArray<FVisibilityInfo*> TeamVisibilityInfos;
 
+	UPROPERTY()
+	ARTSGameState * GS;
+
 	/** Actors that are only supposed to replicate to their owning connection, but that did not
 	have a connection on spawn */
 	UPROPERTY()
@@ -315,6 +328,15 @@ public:
 	virtual void NotifyResetAllNetworkActors() override;
 	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters & Params) override;
 
+	/**
+	 *	Patch a team's cached visible list because a selectable in this node changed visibility 
+	 *	for them. Called by the graph when it drains the team's FVisibilityInfo changes
+	 *
+	 *	@param TeamIndex - array index of the team whose visibility changed
+	 *	@param bIsNowVisible - whether the selectable is visible to that team now
+	 */
+	void OnSelectableVisibilityChanged(int32 TeamIndex, AActor * Selectable, uint8 OwnerID, uint8 SelectableID, bool bIsNowVisible);
+
 protected:
 
 	//-------------------------------------------------------------------
@@ -325,6 +347,20 @@ protected:
 	not a single element, so this is the array to add */
 	TArray<AActor*> Buildings;
 
+	/* The buildings in this node that are visible to each team. Shared by every connection on
+	that team and only rebuilt when stale. Key = Statics::TeamToArrayIndex */
+	FActorRepListRefView TeamVisibleLists[ProjectSettings::MAX_NUM_TEAMS];
+
+	/* Bit set = selectable is in that team's TeamVisibleLists entry. Indexed the same way
+	FVisibilityInfo indexes its bits */
+	uint64 InTeamVisibleListBits[ProjectSettings::MAX_NUM_TEAMS][FVisibilityInfo::NUM_WORDS];
+
+	/* Bit N set = TeamVisibleLists[N] needs rebuilding because buildings were added/removed */
+	uint32 StaleTeamListsMask;
+
+	/* Rebuild a team's visible list from scratch */
+	void RebuildTeamVisibleList(int32 TeamIndex, const FVisibilityInfo & TeamVisibilityInfo);
+
 	// Team this node is for
 	ETeam Team;
 };
@@ -345,6 +381,15 @@ public:
 	virtual void NotifyResetAllNetworkActors() override;
 	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters & Params) override;
 
+	/**
+	 *	Patch a team's cached visible list because a selectable in this node changed visibility 
+	 *	for them. Called by the graph when it drains the team's FVisibilityInfo changes
+	 *
+	 *	@param TeamIndex - array index of the team whose visibility changed
+	 *	@param bIsNowVisible - whether the selectable is visible to that team now
+	 */
+	void OnSelectableVisibilityChanged(int32 TeamIndex, AActor * Selectable, uint8 OwnerID, uint8 SelectableID, bool bIsNowVisible);
+
 protected:
 
 	//-------------------------------------------------------------------
@@ -353,6 +398,20 @@ protected:
 
 	TArray<AActor*> Infantry;
 
+	/* The infantry in this node that are visible to each team. Shared by every connection on
+	that team and only rebuilt when stale. Key = Statics::TeamToArrayIndex */
+	FActorRepListRefView TeamVisibleLists[ProjectSettings::MAX_NUM_TEAMS];
+
+	/* Bit set = selectable is in that team's TeamVisibleLists entry. Indexed the same way
+	FVisibilityInfo indexes its bits */
+	uint64 InTeamVisibleListBits[ProjectSettings::MAX_NUM_TEAMS][FVisibilityInfo::NUM_WORDS];
+
+	/* Bit N set = TeamVisibleLists[N] needs rebuilding because infantry were added/removed */
+	uint32 StaleTeamListsMask;
+
+	/* Rebuild a team's visible list from scratch */
+	void RebuildTeamVisibleList(int32 TeamIndex, const FVisibilityInfo & TeamVisibilityInfo);
+
 	// Team this node is for
 	ETeam Team;
 };
@@ -11,7 +11,7 @@ public class RTS_Ver2 : ModuleRules
         // Added NavigationSystem for 4.20 to support vehicle AI controller
         PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "AIModule", "RHI", "RenderCore", "PhysXVehicles", "NavigationSystem" });
 
-        PrivateDependencyModuleNames.AddRange(new string[] { "ReplicationGraph" }); 
+        PrivateDependencyModuleNames.AddRange(new string[] { "ReplicationGraph", "AssetRegistry" }); 
 
         // Uncomment if you are using Slate UI. ETextCommit needed this 
         PrivateDependencyModuleNames.AddRange(new string[] { "Slate", "SlateCore" });
@@ -295,6 +295,58 @@ namespace ProjectSettings
 	 *	My notes: post edit needs to run after changing this, but that's on my agenda anyway
 	 */
 	constexpr float GAME_TICK_RATE = 0.2f; 
+
+	/**
+	 *	Infantry that are idle without a target only do their behavior tick (the one that looks 
+	 *	for targets) on every Nth frame, on top of waiting for their BehaviorTickRate. Infantry 
+	 *	are spread evenly across the N frames. Higher = cheaper but idle units will take slightly 
+	 *	longer to notice enemies. 1 means every frame.
+	 */
+	constexpr uint8 IDLE_INFANTRY_BEHAVIOR_FRAME_INTERVAL = 4;
+
+	/**
+	 *	Infantry path queries are done on worker threads (see FPathRequestQueue). This is the 
+	 *	most that are started each frame. Ones that do not fit wait for the next frame so a 
+	 *	big command only delays movement a little instead of spiking the frame.
+	 */
+	constexpr int32 MAX_PATH_QUERIES_STARTED_PER_FRAME = 16;
+
+	/**
+	 *	Size of the cells used to tell if two infantry path requests are close enough to share 
+	 *	one query. Requests share a query if their starts are in the same cell and their goals 
+	 *	are in the same cell.
+	 */
+	constexpr float PATH_REQUEST_CELL_SIZE = 100.f;
+
+	/**
+	 *	Size of the cells of the grid resource depots' walking distances are worked out on 
+	 *	(see FPathDistanceFields). Smaller = more accurate around narrow gaps but more memory 
+	 *	per depot and longer to work out.
+	 */
+	constexpr float PATH_DISTANCE_FIELD_CELL_SIZE = 400.f;
+
+	/**
+	 *	How long the heavy task manager is allowed to spend running jobs each frame in 
+	 *	microseconds. Jobs that do not fit are deferred to the next frame. At least one job of 
+	 *	each priority always runs so this can be exceeded.
+	 */
+	constexpr float HEAVY_TASK_FRAME_BUDGET_MICROSECONDS = 1000.f;
+
+	/**
+	 *	Abilities used on the server are gathered up and sent to clients in a single reliable 
+	 *	multicast at the end of the frame (see ARTSGameState::FlushAbilityEvents). If this many 
+	 *	build up before then they are sent early so one RPC does not get too big.
+	 */
+	constexpr int32 MAX_ABILITY_EVENTS_PER_MULTICAST = 64;
+
+	/**
+	 *	Most hits a single ability event can have. One for every selectable that could exist. 
+	 *	Events received with more than this are rejected
+	 */
+	constexpr uint32 MAX_ABILITY_EVENT_HITS = MAX_NUM_PLAYERS * 256;
+
+	/* How precisely ability locations are sent to clients, in world units */
+	constexpr float ABILITY_EVENT_LOCATION_PRECISION = 1.f;
 }
 
 
@@ -308,10 +360,10 @@ namespace FogOfWarOptions
 	// then should reveal self
 
 	/** 
-	 *	If true then fog of war will be calculated on a thread(s) seperate from the game thread. 
-	 *	As a result it will likely be 1+ frames behind. Check out 
-	 *	MultithreadedFogOfWarManager::GetNumFogOfWarThreadsToCreate to edit how many threads 
-	 *	are created for fog of war.
+	 *	If true then fog of war will be calculated on a thread seperate from the game thread. 
+	 *	As a result it will likely be 1+ frames behind. The game thread and fog thread pass 
+	 *	data to each other through lock free triple buffers so neither ever waits on the other. 
+	 *	See MultithreadedFogOfWar.h
 	 */
 #define MULTITHREADED_FOG_OF_WAR 0
 
@@ -322,6 +374,18 @@ namespace FogOfWarOptions
 	 *	TODO After changing this have to make sure post edit runs on each building blueprint
 	 */
 	constexpr float FOG_TILE_SIZE = 64.f;
+
+	/**
+	 *	How often in seconds the server computes the fog of war of teams other than its local 
+	 *	player's team. Those teams' fog is only used for gameplay (AI target aquiring, 
+	 *	replication) so doesn't need updating every frame. The local player's team is still 
+	 *	computed every frame since it is rendered. Clients are unaffected by this.
+	 *
+	 *	Teams are staggered i.e. when a pass starts one team is computed on the first frame, 
+	 *	the next team on the frame after that, etc so a pass always takes at least as many 
+	 *	frames as there are non-local teams. Only affects the game thread fog of war.
+	 */
+	constexpr float SERVER_FOG_SIMULATION_RATE = 0.1f;
 }
 
 
@@ -683,6 +747,20 @@ namespace CommandIssuingOptions
 	 *	defined above. Currently all of them are single types. 
 	 */
 	constexpr EPickUpInventoryItemCommandIssuingRule PickUpInventoryItemRule = EPickUpInventoryItemCommandIssuingRule::Single_CheckIfCanPickUp;
+
+	/** 
+	 *	How precisely command locations are sent from client to server, in world units. Context 
+	 *	commands are used to place buildings so they are sent more precisely than right clicks. 
+	 *	Smaller = more bits per command. 
+	 */
+	constexpr float RIGHT_CLICK_LOCATION_PRECISION = 1.f;
+	constexpr float CONTEXT_COMMAND_LOCATION_PRECISION = 0.1f;
+
+	/** 
+	 *	When a group is given a move command they share one navmesh path (see GroupMovement). 
+	 *	Units further than this from the middle of the group find a path of their own instead. 
+	 */
+	constexpr float GROUP_MOVE_MAX_SPREAD = 2000.f;
 }
 
 
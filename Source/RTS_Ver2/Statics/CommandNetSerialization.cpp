@@ -0,0 +1,204 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CommandNetSerialization.h"
+#include "Engine/PackageMapClient.h"
+
+#include "Statics/Statics.h"
+#include "GameFramework/Selectable.h"
+#include "GameFramework/RTSGameState.h"
+#include "GameFramework/RTSPlayerState.h"
+
+
+namespace CommandNetSerialization
+{
+	/* Box locations are quantised to. Invalid until SetMapBounds is called */
+	static FBox QuantisationBox(ForceInit);
+
+	/* Number of bits in a selectable ID bitmap. One per possible uint8 ID */
+	static constexpr uint32 BITMAP_NUM_BITS = 256;
+
+	/* How a command's target is sent */
+	enum class ETargetEncoding : uint8
+	{
+		None,
+		/* (owner ID, selectable ID) */
+		PlayerOwnedSelectable,
+		/* Object reference through the package map */
+		Object,
+
+		z_ALWAYS_LAST_IN_ENUM
+	};
+
+	static constexpr uint32 TARGET_ENCODING_NUM_BITS = 2;
+	static_assert(static_cast<uint8>(ETargetEncoding::z_ALWAYS_LAST_IN_ENUM) <= (1 << TARGET_ENCODING_NUM_BITS),
+		"Not enough bits for ETargetEncoding");
+
+	/* Serialize a single bit */
+	static void SerializeBit(FArchive & Ar, bool & bValue)
+	{
+		uint8 Bit = bValue ? 1 : 0;
+		Ar.SerializeBits(&Bit, 1);
+		bValue = (Bit != 0);
+	}
+
+	void SetMapBounds(const FBoxSphereBounds & MapBounds)
+	{
+		QuantisationBox = MapBounds.GetBox();
+	}
+
+	void SerializeGroup(FArchive & Ar, bool & bSameGroup, bool & bIsDelta, TArray < uint8 > & IDs)
+	{
+		SerializeBit(Ar, bSameGroup);
+		if (bSameGroup)
+		{
+			if (Ar.IsLoading())
+			{
+				bIsDelta = false;
+				IDs.Reset();
+			}
+			return;
+		}
+
+		SerializeBit(Ar, bIsDelta);
+
+		/* A list costs 8 bits for the count plus 8 per ID so past 31 IDs the bitmap is smaller */
+		bool bUseBitmap = Ar.IsSaving() && (8 + 8 * IDs.Num() > BITMAP_NUM_BITS);
+		SerializeBit(Ar, bUseBitmap);
+
+		if (bUseBitmap)
+		{
+			uint8 Bitmap[BITMAP_NUM_BITS / 8];
+			if (Ar.IsSaving())
+			{
+				FMemory::Memzero(Bitmap);
+				for (const uint8 ID : IDs)
+				{
+					Bitmap[ID >> 3] |= (1 << (ID & 7));
+				}
+			}
+
+			Ar.SerializeBits(Bitmap, BITMAP_NUM_BITS);
+
+			if (Ar.IsLoading())
+			{
+				IDs.Reset();
+				for (uint32 ID = 0; ID < BITMAP_NUM_BITS; ++ID)
+				{
+					if (Bitmap[ID >> 3] & (1 << (ID & 7)))
+					{
+						IDs.Emplace(static_cast<uint8>(ID));
+					}
+				}
+			}
+		}
+		else
+		{
+			uint32 Num = IDs.Num();
+			Ar.SerializeInt(Num, BITMAP_NUM_BITS);
+
+			if (Ar.IsLoading())
+			{
+				IDs.SetNumUninitialized(Num);
+			}
+
+			for (uint8 & ID : IDs)
+			{
+				Ar << ID;
+			}
+		}
+	}
+
+	void SerializeLocation(FArchive & Ar, FVector & Location, float Precision)
+	{
+		bool bIsQuantised = Ar.IsSaving() && QuantisationBox.IsValid && QuantisationBox.IsInsideOrOn(Location);
+		SerializeBit(Ar, bIsQuantised);
+
+		if (bIsQuantised)
+		{
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				const float Min = QuantisationBox.Min[Axis];
+				const uint32 NumSteps = static_cast<uint32>(FMath::CeilToInt((QuantisationBox.Max[Axis] - Min) / Precision)) + 1;
+
+				uint32 Step = 0;
+				if (Ar.IsSaving())
+				{
+					Step = static_cast<uint32>(FMath::Clamp<int32>(FMath::RoundToInt((Location[Axis] - Min) / Precision), 0, NumSteps - 1));
+				}
+
+				Ar.SerializeInt(Step, NumSteps);
+
+				if (Ar.IsLoading())
+				{
+					Location[Axis] = Min + Step * Precision;
+				}
+			}
+		}
+		else
+		{
+			Ar << Location;
+		}
+	}
+
+	bool SerializeTarget(FArchive & Ar, UPackageMap * Map, AActor *& Target, uint8 & OwnerID,
+		uint8 & SelectableID)
+	{
+		uint8 Encoding = static_cast<uint8>(ETargetEncoding::None);
+		uint8 TargetOwnerID = 0;
+		uint8 TargetSelectableID = 0;
+		if (Ar.IsSaving() && Statics::IsValid(Target))
+		{
+			const ISelectable * AsSelectable = Cast<ISelectable>(Target);
+			const FSelectableFlags Flags = (AsSelectable != nullptr)
+				? AsSelectable->GetAttributesBase().GetSelectableFlags() : FSelectableFlags();
+			/* Resource spots have the building flag but no owner */
+			if ((Flags.IsAUnit() || Flags.IsABuilding()) && Flags.GetOwnerID() != 0)
+			{
+				Encoding = static_cast<uint8>(ETargetEncoding::PlayerOwnedSelectable);
+				TargetOwnerID = Flags.GetOwnerID();
+				TargetSelectableID = AsSelectable->GetSelectableID();
+			}
+			else
+			{
+				Encoding = static_cast<uint8>(ETargetEncoding::Object);
+			}
+		}
+
+		Ar.SerializeBits(&Encoding, TARGET_ENCODING_NUM_BITS);
+
+		bool bSuccess = true;
+		UObject * Object = nullptr;
+
+		if (Encoding == static_cast<uint8>(ETargetEncoding::PlayerOwnedSelectable))
+		{
+			Ar << TargetOwnerID;
+			Ar << TargetSelectableID;
+		}
+		else if (Encoding == static_cast<uint8>(ETargetEncoding::Object))
+		{
+			Object = Target;
+			bSuccess = Map->SerializeObject(Ar, AActor::StaticClass(), Object);
+		}
+
+		if (Ar.IsLoading())
+		{
+			Target = Cast<AActor>(Object);
+			OwnerID = TargetOwnerID;
+			SelectableID = TargetSelectableID;
+		}
+
+		return bSuccess;
+	}
+
+	AActor * ResolveTarget(const ARTSGameState * GameState, AActor * Target, uint8 OwnerID,
+		uint8 SelectableID)
+	{
+		if (OwnerID == 0 || SelectableID == 0)
+		{
+			return Target;
+		}
+
+		ARTSPlayerState * Owner = GameState->FindPlayerFromID(OwnerID);
+		return (Owner != nullptr) ? Owner->GetSelectableFromID(SelectableID) : nullptr;
+	}
+}
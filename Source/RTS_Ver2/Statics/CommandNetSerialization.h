@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UPackageMap;
+class ARTSGameState;
+
+
+/**
+ *	Bit packing shared by the NetSerialize overloads of the player command structs
+ *	(FContextCommand, FRightClickCommandBase and the structs derived from them).
+ *	FAbilityEvent uses SerializeLocation too.
+ *
+ *	- Selection: 1 bit if it is the same group as the last command. Otherwise either the full
+ *	group or only the IDs that changed since the last group (see ARTSPlayerController::CommandIDs),
+ *	each sent as a list of IDs or as a 256 bit bitmap, whichever is smaller.
+ *	- Targets: selectables owned by a player are sent as (owner ID, selectable ID) and resolved
+ *	through the game state on the server. Anything else falls back to an object reference.
+ *	- Locations: quantised to the current map's bounds. Falls back to full floats if the
+ *	location is outside them.
+ */
+namespace CommandNetSerialization
+{
+	/**
+	 *	Set the box locations are quantised to. Client and server must both call this with the
+	 *	same map before any commands are sent.
+	 *
+	 *	@param MapBounds - bounds of the map being played on
+	 */
+	void SetMapBounds(const FBoxSphereBounds & MapBounds);
+
+	/**
+	 *	Serialize the group of selectables a command is for
+	 *
+	 *	@param bSameGroup - whether the group is the same as the last command's group
+	 *	@param bIsDelta - whether IDs are only the IDs that were added or removed from the last
+	 *	command's group
+	 *	@param IDs - selectable IDs
+	 */
+	void SerializeGroup(FArchive & Ar, bool & bSameGroup, bool & bIsDelta, TArray < uint8 > & IDs);
+
+	/**
+	 *	Serialize a world location
+	 *
+	 *	@param Precision - how many units each quantisation step is
+	 */
+	void SerializeLocation(FArchive & Ar, FVector & Location, float Precision);
+
+	/**
+	 *	Serialize a command's target
+	 *
+	 *	@param Target - target actor. When loading this is only set if the target was not a player
+	 *	owned selectable
+	 *	@param OwnerID - when loading set to the target's owner's ID if it is a player owned
+	 *	selectable, otherwise 0
+	 *	@param SelectableID - when loading set to the target's selectable ID if it is a player
+	 *	owned selectable, otherwise 0
+	 *	@return - false if the object reference could not be serialized
+	 */
+	bool SerializeTarget(FArchive & Ar, UPackageMap * Map, AActor *& Target, uint8 & OwnerID,
+		uint8 & SelectableID);
+
+	/* Get the target that SerializeTarget loaded */
+	AActor * ResolveTarget(const ARTSGameState * GameState, AActor * Target, uint8 OwnerID,
+		uint8 SelectableID);
+}
@@ -0,0 +1,217 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Statics/CommonEnums.h"
+#include "Statics/Statics.h"
+
+
+/**--------------------------------------------------------------------------------------------
+ *	Fixed size containers keyed by the small uint8 enums (building, unit and upgrade type).
+ *	These replace TMaps keyed by those enums where every lookup would otherwise hash.
+ *
+ *	Neither container is a UPROPERTY so do not put UObject pointers in them unless something
+ *	else is keeping those objects alive.
+ ----------------------------------------------------------------------------------------------*/
+
+
+/* How many values an enum has and how to turn one into an array index. Specialized below for
+each enum that can be used with TEnumTable/TEnumBitSet */
+template <typename TEnum>
+struct TEnumTableTraits;
+
+template <>
+struct TEnumTableTraits < EBuildingType >
+{
+	static constexpr int32 Num = Statics::NUM_BUILDING_TYPES;
+
+	static FORCEINLINE int32 ToIndex(EBuildingType Type) { return static_cast<int32>(Type); }
+	static FORCEINLINE EBuildingType FromIndex(int32 Index) { return static_cast<EBuildingType>(Index); }
+};
+
+template <>
+struct TEnumTableTraits < EUnitType >
+{
+	static constexpr int32 Num = Statics::NUM_UNIT_TYPES;
+
+	/* EUnitType::None is 0 so everything is shifted down by 1, same as
+	Statics::UnitTypeToArrayIndex */
+	static FORCEINLINE int32 ToIndex(EUnitType Type) { return static_cast<int32>(Type) - 1; }
+	static FORCEINLINE EUnitType FromIndex(int32 Index) { return static_cast<EUnitType>(Index + 1); }
+};
+
+template <>
+struct TEnumTableTraits < EUpgradeType >
+{
+	static constexpr int32 Num = Statics::NUM_UPGRADE_TYPES;
+
+	static FORCEINLINE int32 ToIndex(EUpgradeType Type) { return static_cast<int32>(Type); }
+	static FORCEINLINE EUpgradeType FromIndex(int32 Index) { return static_cast<EUpgradeType>(Index); }
+};
+
+
+/* One value for every value of an enum. Unlike a TMap every key always has a value */
+template <typename TEnum, typename TValue>
+struct TEnumTable
+{
+	typedef TEnumTableTraits < TEnum > Traits;
+
+	TEnumTable()
+		: Values()
+	{
+	}
+
+	explicit TEnumTable(const TValue & InitialValue)
+	{
+		Fill(InitialValue);
+	}
+
+	FORCEINLINE TValue & operator[](TEnum Key)
+	{
+		const int32 Index = Traits::ToIndex(Key);
+		assert(Index >= 0 && Index < Traits::Num);
+		return Values[Index];
+	}
+
+	FORCEINLINE const TValue & operator[](TEnum Key) const
+	{
+		const int32 Index = Traits::ToIndex(Key);
+		assert(Index >= 0 && Index < Traits::Num);
+		return Values[Index];
+	}
+
+	void Fill(const TValue & Value)
+	{
+		for (TValue & Elem : Values)
+		{
+			Elem = Value;
+		}
+	}
+
+	static constexpr int32 Num() { return Traits::Num; }
+
+	/* Range for support. Iterates values only, use Traits::FromIndex if the key is needed */
+	TValue * begin() { return Values; }
+	TValue * end() { return Values + Traits::Num; }
+	const TValue * begin() const { return Values; }
+	const TValue * end() const { return Values + Traits::Num; }
+
+protected:
+
+	TValue Values[Traits::Num];
+};
+
+
+/* A set of enum values stored as bits */
+template <typename TEnum>
+struct TEnumBitSet
+{
+	typedef TEnumTableTraits < TEnum > Traits;
+
+	static constexpr int32 NUM_WORDS = (Traits::Num + 63) / 64;
+
+	TEnumBitSet()
+		: Words()
+	{
+	}
+
+	FORCEINLINE void Add(TEnum Value)
+	{
+		const int32 Index = GetIndex(Value);
+		Words[Index >> 6] |= (1ULL << (Index & 63));
+	}
+
+	FORCEINLINE void Remove(TEnum Value)
+	{
+		const int32 Index = GetIndex(Value);
+		Words[Index >> 6] &= ~(1ULL << (Index & 63));
+	}
+
+	FORCEINLINE bool Contains(TEnum Value) const
+	{
+		const int32 Index = GetIndex(Value);
+		return (Words[Index >> 6] & (1ULL << (Index & 63))) != 0;
+	}
+
+	FORCEINLINE bool IsEmpty() const
+	{
+		for (const uint64 Word : Words)
+		{
+			if (Word != 0)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void Reset()
+	{
+		for (uint64 & Word : Words)
+		{
+			Word = 0;
+		}
+	}
+
+	int32 Num() const
+	{
+		int32 Count = 0;
+		for (const uint64 Word : Words)
+		{
+			Count += static_cast<int32>(FPlatformMath::CountBits(Word));
+		}
+
+		return Count;
+	}
+
+	/* Value with the lowest index in the set. Set must not be empty */
+	TEnum GetFirst() const
+	{
+		for (int32 i = 0; i < NUM_WORDS; ++i)
+		{
+			if (Words[i] != 0)
+			{
+				return Traits::FromIndex(i * 64 + static_cast<int32>(FMath::CountTrailingZeros64(Words[i])));
+			}
+		}
+
+		assert(0);
+		return Traits::FromIndex(0);
+	}
+
+	/**
+	 *	Call a function for every value in the set. Set can be modified by the function but
+	 *	values added during iteration might not be visited
+	 *
+	 *	@param Func - void(TEnum Value)
+	 */
+	template <typename TFunc>
+	void ForEach(TFunc Func) const
+	{
+		for (int32 i = 0; i < NUM_WORDS; ++i)
+		{
+			uint64 Word = Words[i];
+			while (Word != 0)
+			{
+				Func(Traits::FromIndex(i * 64 + static_cast<int32>(FMath::CountTrailingZeros64(Word))));
+
+				/* Clear lowest set bit */
+				Word &= Word - 1;
+			}
+		}
+	}
+
+protected:
+
+	static FORCEINLINE int32 GetIndex(TEnum Value)
+	{
+		const int32 Index = Traits::ToIndex(Value);
+		assert(Index >= 0 && Index < Traits::Num);
+		return Index;
+	}
+
+	uint64 Words[NUM_WORDS];
+};
@@ -0,0 +1,141 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Statics/CommonEnums.h"
+
+
+/* What a selectable's inventory looks like as far as FSelectableFlags is concerned. Same
+values the inventory actor tag can have */
+enum class ESelectableInventoryFlag : uint8
+{
+	/* No FInventory at all */
+	None,
+	/* Has an FInventory but its capacity is 0 */
+	ZeroCapacity,
+	/* Has an FInventory with capacity greater than 0 */
+	HasInventory,
+	/* Is a shop that items can be sold to */
+	ShopThatAcceptsRefunds
+};
+
+
+/**
+ *	Everything the actor tag system (see Statics::GetTeamTagIndex and friends) says about a
+ *	selectable packed into a single word: owner, team, targeting type and a handful of yes/no
+ *	flags. Target acquisition loops can test these with a mask compare instead of comparing
+ *	FNames in AActor::Tags.
+ *
+ *	Lives on FSelectableAttributesBase. Player owned selectables are also mirrored into
+ *	ARTSGameState's per-ID table so they can be looked up knowing only the IDs.
+ *
+ *	The actor tags are still kept up to date alongside these for code that only has an AActor.
+ */
+struct FSelectableFlags
+{
+	//---------------------------------------------------------
+	//	Bit layout
+	//---------------------------------------------------------
+
+	static constexpr uint32 OWNER_ID_SHIFT = 0;
+	static constexpr uint32 OWNER_ID_MASK = 0xFFu << OWNER_ID_SHIFT;
+
+	static constexpr uint32 TEAM_SHIFT = 8;
+	static constexpr uint32 TEAM_MASK = 0xFu << TEAM_SHIFT;
+
+	static constexpr uint32 TARGETING_TYPE_SHIFT = 12;
+	static constexpr uint32 TARGETING_TYPE_MASK = 0x1Fu << TARGETING_TYPE_SHIFT;
+
+	static constexpr uint32 INVENTORY_SHIFT = 17;
+	static constexpr uint32 INVENTORY_MASK = 0x3u << INVENTORY_SHIFT;
+
+	static constexpr uint32 AIR = 1u << 19;
+	static constexpr uint32 BUILDING = 1u << 20;
+	static constexpr uint32 UNIT = 1u << 21;
+	static constexpr uint32 INVENTORY_ITEM = 1u << 22;
+	static constexpr uint32 HAS_ATTACK = 1u << 23;
+	static constexpr uint32 ZERO_HEALTH = 1u << 24;
+
+	/* Set once the selectable has setup. Default constructed flags do not have this */
+	static constexpr uint32 INITIALIZED = 1u << 25;
+
+	static_assert(static_cast<uint8>(ETeam::Observer) <= (TEAM_MASK >> TEAM_SHIFT),
+		"Too many teams to fit in FSelectableFlags");
+	static_assert(static_cast<uint8>(ETargetingType::z_ALWAYS_LAST_IN_ENUM) <= (TARGETING_TYPE_MASK >> TARGETING_TYPE_SHIFT) + 1,
+		"Too many targeting types to fit in FSelectableFlags");
+
+	//---------------------------------------------------------
+	//	Construction
+	//---------------------------------------------------------
+
+	FSelectableFlags()
+		: Word(0)
+	{
+	}
+
+	/**
+	 *	@param OwnerID - owning player's ID as an int. 0 for selectables not owned by a player
+	 *	@param Team - team selectable is on
+	 *	@param TargetingType - selectable's targeting type
+	 *	@param Inventory - what kind of inventory selectable has
+	 *	@param Bits - any of AIR, BUILDING, UNIT, INVENTORY_ITEM, HAS_ATTACK, ZERO_HEALTH
+	 */
+	FSelectableFlags(uint8 OwnerID, ETeam Team, ETargetingType TargetingType,
+		ESelectableInventoryFlag Inventory, uint32 Bits)
+		: Word((static_cast<uint32>(OwnerID) << OWNER_ID_SHIFT)
+			| MakeTeamBits(Team)
+			| (static_cast<uint32>(TargetingType) << TARGETING_TYPE_SHIFT)
+			| (static_cast<uint32>(Inventory) << INVENTORY_SHIFT)
+			| Bits
+			| INITIALIZED)
+	{
+	}
+
+	static FORCEINLINE uint32 MakeTeamBits(ETeam Team)
+	{
+		return static_cast<uint32>(Team) << TEAM_SHIFT;
+	}
+
+	//---------------------------------------------------------
+	//	Queries
+	//---------------------------------------------------------
+
+	/* Whether (flags & Mask) == Value. Lets several things be tested with one compare e.g.
+	Matches(ZERO_HEALTH | AIR, 0) = above zero health and not flying */
+	FORCEINLINE bool Matches(uint32 Mask, uint32 Value) const { return (Word & Mask) == Value; }
+
+	FORCEINLINE bool IsInitialized() const { return (Word & INITIALIZED) != 0; }
+	FORCEINLINE uint8 GetOwnerID() const { return static_cast<uint8>((Word & OWNER_ID_MASK) >> OWNER_ID_SHIFT); }
+	FORCEINLINE ETeam GetTeam() const { return static_cast<ETeam>((Word & TEAM_MASK) >> TEAM_SHIFT); }
+	FORCEINLINE ETargetingType GetTargetingType() const { return static_cast<ETargetingType>((Word & TARGETING_TYPE_MASK) >> TARGETING_TYPE_SHIFT); }
+	FORCEINLINE ESelectableInventoryFlag GetInventory() const { return static_cast<ESelectableInventoryFlag>((Word & INVENTORY_MASK) >> INVENTORY_SHIFT); }
+	FORCEINLINE bool IsAirUnit() const { return (Word & AIR) != 0; }
+	FORCEINLINE bool IsABuilding() const { return (Word & BUILDING) != 0; }
+	FORCEINLINE bool IsAUnit() const { return (Word & UNIT) != 0; }
+	FORCEINLINE bool IsAnInventoryItem() const { return (Word & INVENTORY_ITEM) != 0; }
+	FORCEINLINE bool HasAttack() const { return (Word & HAS_ATTACK) != 0; }
+	FORCEINLINE bool HasZeroHealth() const { return (Word & ZERO_HEALTH) != 0; }
+	FORCEINLINE bool HasInventory() const { return GetInventory() == ESelectableInventoryFlag::HasInventory; }
+	FORCEINLINE bool IsAShopThatAcceptsRefunds() const { return GetInventory() == ESelectableInventoryFlag::ShopThatAcceptsRefunds; }
+	FORCEINLINE bool IsOwned(uint8 PlayerID) const { return GetOwnerID() == PlayerID; }
+	FORCEINLINE bool IsFriendly(ETeam Team) const { return Matches(TEAM_MASK, MakeTeamBits(Team)); }
+	FORCEINLINE bool IsHostile(ETeam Team) const { return !IsFriendly(Team); }
+
+	//---------------------------------------------------------
+	//	Modifiers. Only the things that can change after setup
+	//---------------------------------------------------------
+
+	FORCEINLINE void SetHasAttack(bool bHasAttack)
+	{
+		Word = bHasAttack ? (Word | HAS_ATTACK) : (Word & ~HAS_ATTACK);
+	}
+
+	FORCEINLINE void SetHasZeroHealth()
+	{
+		Word |= ZERO_HEALTH;
+	}
+
+	uint32 Word;
+};
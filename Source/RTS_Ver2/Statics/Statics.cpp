@@ -401,7 +401,8 @@ bool Statics::IsBuildableLocation(const UWorld * World, ARTSGameState * GameStat
 	- Check ghost is outside fog of war
 	- Check ghost is not colliding with any selectables
 	- If applicable check ghost is within distance of another owned/allied building
-	- Check ground below ghost is considered flat enough
+	- Check ground below ghost is considered flat enough. The game state's placement grid is 
+	asked first so traces it already knows will miss are never done
 
 	If all these pass then location is buildable */
 
@@ -548,12 +549,27 @@ bool Statics::IsBuildableLocation(const UWorld * World, ARTSGameState * GameStat
 
 	/* Now check if ground is flat enough */
 
-	/* Distance of line trace */
-	const float TraceDistance = 64.f;
+	/* Distance of line trace. Shared with the placement grid so it agrees with us */
+	const float TraceDistance = FBuildingPlacementGrid::FLATNESS_TRACE_DISTANCE;
 
 	/* How much higher or lower a corner point trace impact can be from the center point trace
 	impact. Needs to be <= TraceDistance / 2  */
-	const float HeightDiffAllowance = 20.f;
+	const float HeightDiffAllowance = FBuildingPlacementGrid::FLATNESS_HEIGHT_ALLOWANCE;
+
+	/* Any of the traces below not hitting anything fails the check, so if the placement grid 
+	already knows one will miss then do not bother doing them */
+	const FBuildingPlacementGrid & PlacementGrid = GameState->GetPlacementGrid();
+	if (PlacementGrid.WillGroundTraceMiss(Center - FVector(0.f, 0.f, Extent.Z)))
+	{
+		return IsBuildableLocationReturn(PlayerState, EGameWarning::Building_GroundNotFlatEnough, bShowHUDMessage);
+	}
+	for (const auto & Point : BoxCompCorners)
+	{
+		if (PlacementGrid.WillGroundTraceMiss(Point))
+		{
+			return IsBuildableLocationReturn(PlayerState, EGameWarning::Building_GroundNotFlatEnough, bShowHUDMessage);
+		}
+	}
 
 	/* Do trace from center of bounds but shifted to the building's floor, then shifted up by half
 	TraceDistance */
@@ -856,6 +872,7 @@ UFogObeyingAudioComponent * Statics::SpawnSoundAtLocation(ARTSGameState * GameSt
 		AudioComponent->bAutoDestroy = bAutoDestroy;
 		AudioComponent->SubtitlePriority = Sound->GetSubtitlePriority();
 		AudioComponent->Play(StartTime);
+		AudioComponent->FogObeyingRule = FogRules;
 
 		/* Add audio component to container and possibly mute it if it shouldn't be heard right now. 
 		If I can still hear sounds briefly maybe try muting before Play(StartTime) call ?*/
@@ -864,8 +881,7 @@ UFogObeyingAudioComponent * Statics::SpawnSoundAtLocation(ARTSGameState * GameSt
 			const bool bOutsideFog = GameState->GetFogManager()->IsLocationVisibleNotChecked(Location, LocalPlayersTeam);
 			if (!bOutsideFog)
 			{
-				GameState->FogSoundsContainer_AlwaysKnownOnceHeard.Add(AudioComponent);
-				AudioComponent->bInContainer = true;
+				AudioComponent->AddToFogContainer(GameState, GameState->FogSoundsContainer_AlwaysKnownOnceHeard);
 
 				AudioComponent->PseudoMute();
 			}
@@ -874,8 +890,7 @@ UFogObeyingAudioComponent * Statics::SpawnSoundAtLocation(ARTSGameState * GameSt
 		{
 			if (SoundOwnersTeam != LocalPlayersTeam)
 			{
-				GameState->FogSoundsContainer_DynamicExceptForInstigatorsTeam.Add(AudioComponent);
-				AudioComponent->bInContainer = true;
+				AudioComponent->AddToFogContainer(GameState, GameState->FogSoundsContainer_DynamicExceptForInstigatorsTeam);
 
 				const bool bOutsideFog = GameState->GetFogManager()->IsLocationVisibleNotChecked(Location, LocalPlayersTeam);
 				if (!bOutsideFog)
@@ -886,8 +901,7 @@ UFogObeyingAudioComponent * Statics::SpawnSoundAtLocation(ARTSGameState * GameSt
 		}
 		else if (FogRules == ESoundFogRules::Dynamic)
 		{
-			GameState->FogSoundsContainer_Dynamic.Add(AudioComponent);
-			AudioComponent->bInContainer = true;
+			AudioComponent->AddToFogContainer(GameState, GameState->FogSoundsContainer_Dynamic);
 
 			const bool bOutsideFog = GameState->GetFogManager()->IsLocationVisibleNotChecked(Location, LocalPlayersTeam);
 			if (!bOutsideFog)
@@ -1045,9 +1059,22 @@ float Statics::GetDistance2DSquared(const FVector & Loc1, const FVector & Loc2)
 	return (FVector2D(Loc1) - FVector2D(Loc2)).SizeSquared();
 }
 
-float Statics::GetPathDistanceSqr(const AActor * Actor1, const AActor * Actor2)
+float Statics::GetPathDistanceSqr(const ARTSGameState * GameState, const AActor * Actor1, 
+	const AActor * Actor2, bool * bOutIsWalkingDistance)
 {
-	return (Actor1->GetActorLocation() - Actor2->GetActorLocation()).SizeSquared();
+	const FPathDistanceFields & PathDistanceFields = GameState->GetPathDistanceFields();
+
+	float DistanceSqr;
+	const bool bIsWalkingDistance = PathDistanceFields.GetDistanceSqr(Actor1, Actor2->GetActorLocation(), DistanceSqr)
+		|| PathDistanceFields.GetDistanceSqr(Actor2, Actor1->GetActorLocation(), DistanceSqr);
+
+	if (bOutIsWalkingDistance != nullptr)
+	{
+		*bOutIsWalkingDistance = bIsWalkingDistance;
+	}
+
+	return bIsWalkingDistance 
+		? DistanceSqr : (Actor1->GetActorLocation() - Actor2->GetActorLocation()).SizeSquared();
 }
 
 bool Statics::IsSelectableInRangeForAbility(const FContextButtonInfo & AbilityInfo, ISelectable * AbilityUser, ISelectable * AbilityTarget)
@@ -1112,7 +1139,13 @@ bool Statics::IsSelectableVisibleLocally(const AActor * Selectable)
 bool Statics::IsSelectableVisible(const AActor * Selectable, const FVisibilityInfo * TeamVisibilityInfo)
 {
 	assert(Statics::IsValid(Selectable));
-	return TeamVisibilityInfo->Actors[Selectable] == true;
+	
+	if (Selectable->Tags[Statics::GetTeamTagIndex()] == Statics::NEUTRAL_TEAM_TAG)
+	{
+		return TeamVisibilityInfo->IsVisible(Selectable);
+	}
+	
+	return TeamVisibilityInfo->IsSelectableVisible(CastChecked<const ISelectable>(Selectable));
 }
 
 bool Statics::IsOutsideFog(const AActor * Selectable, const ISelectable * AsSelectable, ETeam Team,
@@ -1132,11 +1165,21 @@ bool Statics::IsOutsideFog(const AActor * Selectable, const ISelectable * AsSele
 	const FVisibilityInfo & TeamVisibilityInfo = GameState->GetTeamVisibilityInfo(Team);
 	
 	assert(Statics::IsValid(Selectable));
-	UE_CLOG(TeamVisibilityInfo.Actors.Contains(Selectable) == false, RTSLOG, Fatal,
-		TEXT("[%s] not found in team [%s] visiblity info"), *Selectable->GetName(),
-		TO_STRING(ETeam, Team));
+
+	if (Selectable->Tags[Statics::GetTeamTagIndex()] == Statics::NEUTRAL_TEAM_TAG)
+	{
+		UE_CLOG(TeamVisibilityInfo.IsInMap(Selectable) == false, RTSLOG, Fatal,
+			TEXT("[%s] not found in team [%s] visiblity info"), *Selectable->GetName(),
+			TO_STRING(ETeam, Team));
+
+		return TeamVisibilityInfo.IsVisible(Selectable);
+	}
 	
-	return TeamVisibilityInfo.IsVisible(Selectable);
+	UE_CLOG(TeamVisibilityInfo.IsSelectableRegistered(AsSelectable->GetOwnersID(), AsSelectable->GetSelectableID()) == false, 
+		RTSLOG, Fatal, TEXT("[%s] not found in team [%s] visiblity info"), *Selectable->GetName(),
+		TO_STRING(ETeam, Team));
+
+	return TeamVisibilityInfo.IsSelectableVisible(AsSelectable);
 #elif MULTITHREADED_FOG_OF_WAR
 	return MultithreadedFogOfWarManager::Get().IsSelectableOutsideFog(AsSelectable, Team);
 #else
@@ -1149,7 +1192,7 @@ bool Statics::IsLocationOutsideFog(const FVector & Location, ETeam Team, AFogOfW
 #if GAME_THREAD_FOG_OF_WAR
 	return FogManager->IsLocationVisibleNotChecked(Location, Team);
 #elif MULTITHREADED_FOG_OF_WAR
-	return MultithreadedFogOfWarManager::Get()....
+	return MultithreadedFogOfWarManager::Get().IsLocationVisibleNotChecked(Location, Team);
 #else
 	return true;
 #endif
@@ -1182,7 +1225,6 @@ EFogStatus Statics::GetLocationVisionStatusLocally(const FVector & Location, AFo
 #if GAME_THREAD_FOG_OF_WAR
 	return FogManager->GetLocationVisibilityStatusLocally(Location);
 #elif MULTITHREADED_FOG_OF_WAR
-	// I probably need to implement this function
 	return MultithreadedFogOfWarManager::Get().GetLocationVisibilityStatusLocally(Location);
 #else
 	/* Probably not correct. It could be StealthRevealed also. Perhaps add another preproc 
@@ -1196,7 +1238,7 @@ EFogStatus Statics::GetLocationVisionStatusLocallyNotChecked(const FVector & Loc
 #if GAME_THREAD_FOG_OF_WAR
 	return FogManager->GetLocationVisibilityStatusLocallyNotChecked(Location);
 #elif MULTITHREADED_FOG_OF_WAR
-	//TODO
+	return MultithreadedFogOfWarManager::Get().GetLocationVisibilityStatusLocallyNotChecked(Location);
 #else
 	/* Probably not correct. It could be StealthRevealed also. Perhaps add another preproc
 	like ALLOW_STEALTH. If false then yes this is correct but if true then no this is not correct 
@@ -1329,6 +1371,13 @@ bool Statics::CanTypeBeTargeted(const AActor * Target, const TSet<FName>& TypesT
 	return TypesThatCanBeTargeted.Contains(GetTargetingType(Target));;
 }
 
+bool Statics::CanTypeBeTargeted(FSelectableFlags Flags, const TSet<FName>& TypesThatCanBeTargeted)
+{
+	/* None = untargetable */
+	return Flags.GetTargetingType() != ETargetingType::None
+		&& TypesThatCanBeTargeted.Contains(GetTargetingType(Flags.GetTargetingType()));
+}
+
 bool Statics::HasAttack(const AActor * Selectable)
 {
 	return Selectable->Tags[Statics::GetHasAttackTagIndex()] == Statics::HasAttackTag;
@@ -25,6 +25,7 @@ class AFogOfWarManager;
 class UFogObeyingAudioComponent;
 enum class ESoundFogRules : uint8;
 struct FVisibilityInfo;
+struct FSelectableFlags;
 enum class EFogStatus : uint8;
 
 
@@ -451,10 +452,17 @@ public:
 	/* Simple function to get the distance squared between two locations excluding the Z axis */
 	static float GetDistance2DSquared(const FVector & Loc1, const FVector & Loc2);
 
-	/* Calculate distance squared bewteen two actors. Just uses straight
-	line but in future should use path distance i.e. taking into account
-	obstacles */
-	static float GetPathDistanceSqr(const AActor * Actor1, const AActor * Actor2);
+	/** 
+	 *	Calculate walking distance squared between two actors. One of them needs to be a 
+	 *	resource depot whose walking distances have been worked out (see FPathDistanceFields), 
+	 *	otherwise this is just straight line distance squared. 
+	 *
+	 *	@param bOutIsWalkingDistance - optional. Set to false if straight line distance was 
+	 *	returned. Do not compare the two kinds against each other
+	 *	@return - distance squared. FLT_MAX if walking distance says they cannot be walked between
+	 */
+	static float GetPathDistanceSqr(const ARTSGameState * GameState, const AActor * Actor1, 
+		const AActor * Actor2, bool * bOutIsWalkingDistance = nullptr);
 
 	/** 
 	 *	Return whether a selectable is in range of another selectable to use an ability. Assumes 
@@ -701,6 +709,13 @@ public:
 	/* Return whether the selectable is a shop that can also have items sold to it */
 	static bool IsAShopThatAcceptsRefunds(const AActor * Selectable);
 
+	//----------------------------------------------
+	// Queries That Use FSelectableFlags
+	//----------------------------------------------
+
+	/* Return whether a type can be targeted. Most other queries are on FSelectableFlags itself */
+	static bool CanTypeBeTargeted(FSelectableFlags Flags, const TSet < FName > & TypesThatCanBeTargeted);
+
 	/* Given a body location get the FName of a socket that represents that location */
 	static const FName & GetSocketName(ESelectableBodySocket SocketType);
 
@@ -21,6 +21,7 @@
 #include "MapElements/InventoryItem.h"
 #include "MapElements/BuildingComponents/BuildingAttackComp_Turret.h"
 #include "MapElements/BuildingTargetingAbilities//BuildingTargetingAbilityBase.h"
+#include "Statics/CommandNetSerialization.h"
 
 
 //==========================================================================================
@@ -154,12 +155,16 @@ bool FCursorInfo::ContainsCustomCursor() const
 
 FContextCommand::FContextCommand(bool bUseSameGroup, const FContextButton & Button) 
 	: bSameGroup(bUseSameGroup) 
+	, bGroupIsDelta(false)
+	, SubType(0)
 {
 	SetupTypes(Button);
 }
 
 FContextCommand::FContextCommand(bool bUseSameGroup, EContextButton AbilityType) 
 	: bSameGroup(bUseSameGroup)
+	, bGroupIsDelta(false)
+	, SubType(0)
 {
 	SetupTypes(AbilityType);
 }
@@ -176,6 +181,21 @@ void FContextCommand::AddSelectable(uint8 SelectableID)
 	AffectedSelectables.Emplace(SelectableID);
 }
 
+bool FContextCommand::NetSerialize(FArchive & Ar, UPackageMap * Map, bool & bOutSuccess)
+{
+	bool bUseSameGroup = bSameGroup;
+	bool bIsDelta = bGroupIsDelta;
+	CommandNetSerialization::SerializeGroup(Ar, bUseSameGroup, bIsDelta, AffectedSelectables);
+	bSameGroup = bUseSameGroup;
+	bGroupIsDelta = bIsDelta;
+
+	Ar << Type;
+	Ar << SubType;
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
 void FContextCommand::SetupTypes(EContextButton AbilityType)
 {
 	/* If thrown then you will want to call the FContextButton param version instead */
@@ -227,6 +247,15 @@ FContextCommandWithLocation::FContextCommandWithLocation(EContextButton AbilityT
 {
 }
 
+bool FContextCommandWithLocation::NetSerialize(FArchive & Ar, UPackageMap * Map, bool & bOutSuccess)
+{
+	Super::NetSerialize(Ar, Map, bOutSuccess);
+	CommandNetSerialization::SerializeLocation(Ar, ClickLocation, CommandIssuingOptions::CONTEXT_COMMAND_LOCATION_PRECISION);
+
+	bOutSuccess = bOutSuccess && !Ar.IsError();
+	return true;
+}
+
 
 //======================================================================================
 //	>FContextCommandWithTarget
@@ -237,6 +266,8 @@ FContextCommandWithTarget::FContextCommandWithTarget(EContextButton AbilityType,
 	: Super(bUseSameGroup, AbilityType)
 	, ClickLocation(ClickLoc) 
 	, Target(ClickTarget)
+	, TargetOwnerID(0)
+	, TargetSelectableID(0)
 {
 }
 
@@ -246,6 +277,24 @@ FContextCommandWithTarget::FContextCommandWithTarget()
 	// Commented because crash here on startup after migrating to 4.21
 	//assert(0);
 	Target = nullptr;
+	TargetOwnerID = 0;
+	TargetSelectableID = 0;
+}
+
+AActor * FContextCommandWithTarget::GetTarget(const ARTSGameState * GameState) const
+{
+	return CommandNetSerialization::ResolveTarget(GameState, Target, TargetOwnerID, TargetSelectableID);
+}
+
+bool FContextCommandWithTarget::NetSerialize(FArchive & Ar, UPackageMap * Map, bool & bOutSuccess)
+{
+	Super::NetSerialize(Ar, Map, bOutSuccess);
+	CommandNetSerialization::SerializeLocation(Ar, ClickLocation, CommandIssuingOptions::CONTEXT_COMMAND_LOCATION_PRECISION);
+	const bool bSerializedTarget = CommandNetSerialization::SerializeTarget(Ar, Map, Target, 
+		TargetOwnerID, TargetSelectableID);
+
+	bOutSuccess = bOutSuccess && bSerializedTarget && !Ar.IsError();
+	return true;
 }
 
 
@@ -259,7 +308,8 @@ FRightClickCommandBase::FRightClickCommandBase()
 }
 
 FRightClickCommandBase::FRightClickCommandBase(const FVector & ClickLoc) 
-	: ClickLocation(ClickLoc)
+	: bGroupIsDelta(false)
+	, ClickLocation(ClickLoc)
 {
 }
 
@@ -280,11 +330,35 @@ void FRightClickCommandBase::SetUseSameGroup(bool bValue)
 	bSameGroup = bValue;
 }
 
+void FRightClickCommandBase::SetGroupIsDelta(bool bValue)
+{
+	bGroupIsDelta = bValue;
+}
+
+bool FRightClickCommandBase::NetSerialize(FArchive & Ar, UPackageMap * Map, bool & bOutSuccess)
+{
+	bool bUseSameGroup = bSameGroup;
+	bool bIsDelta = bGroupIsDelta;
+	CommandNetSerialization::SerializeGroup(Ar, bUseSameGroup, bIsDelta, AffectedSelectables);
+	bSameGroup = bUseSameGroup;
+	bGroupIsDelta = bIsDelta;
+
+	CommandNetSerialization::SerializeLocation(Ar, ClickLocation, CommandIssuingOptions::RIGHT_CLICK_LOCATION_PRECISION);
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
 bool FRightClickCommandBase::UseSameGroup() const
 {
 	return bSameGroup;
 }
 
+bool FRightClickCommandBase::IsGroupDelta() const
+{
+	return bGroupIsDelta;
+}
+
 const TArray<uint8>& FRightClickCommandBase::GetAffectedSelectables() const
 {
 	return AffectedSelectables;
@@ -303,17 +377,32 @@ const FVector & FRightClickCommandBase::GetClickLocation() const
 FRightClickCommandWithTarget::FRightClickCommandWithTarget(const FVector & ClickLoc, AActor * InTarget) 
 	: Super(ClickLoc) 
 	, Target(InTarget)
+	, TargetOwnerID(0)
+	, TargetSelectableID(0)
 {
 }
 
 FRightClickCommandWithTarget::FRightClickCommandWithTarget()
+	: Target(nullptr)
+	, TargetOwnerID(0)
+	, TargetSelectableID(0)
 {
 	/* Not expected to be called, but will be for RPCs */
 }
 
-AActor * FRightClickCommandWithTarget::GetTarget() const
+AActor * FRightClickCommandWithTarget::GetTarget(const ARTSGameState * GameState) const
 {
-	return Target;
+	return CommandNetSerialization::ResolveTarget(GameState, Target, TargetOwnerID, TargetSelectableID);
+}
+
+bool FRightClickCommandWithTarget::NetSerialize(FArchive & Ar, UPackageMap * Map, bool & bOutSuccess)
+{
+	Super::NetSerialize(Ar, Map, bOutSuccess);
+	const bool bSerializedTarget = CommandNetSerialization::SerializeTarget(Ar, Map, Target, 
+		TargetOwnerID, TargetSelectableID);
+
+	bOutSuccess = bOutSuccess && bSerializedTarget && !Ar.IsError();
+	return true;
 }
 
 
@@ -336,6 +425,15 @@ AInventoryItem * FRightClickCommandOnInventoryItem::GetClickedInventoryItem(ARTS
 	return GameState->GetInventoryItemFromID(ItemID);
 }
 
+bool FRightClickCommandOnInventoryItem::NetSerialize(FArchive & Ar, UPackageMap * Map, bool & bOutSuccess)
+{
+	Super::NetSerialize(Ar, Map, bOutSuccess);
+	Ar << ItemID.ID;
+
+	bOutSuccess = bOutSuccess && !Ar.IsError();
+	return true;
+}
+
 
 //======================================================================================
 //	>FContextButton
@@ -6369,6 +6467,17 @@ FBuildingInfo::FBuildingInfo()
 	BuildingBuildMethod = EBuildingBuildMethod::None;
 }
 
+void FBuildingInfo::SerializeForCache(FArchive & Ar)
+{
+	StaticStruct()->SerializeBin(Ar, this);
+
+	/* Bitfields are not UPROPERTYs */
+	uint8 Flags = (bIsBarracksType << 0) | (bIsBaseDefenseType << 1);
+	Ar << Flags;
+	bIsBarracksType = (Flags >> 0) & 1;
+	bIsBaseDefenseType = (Flags >> 1) & 1;
+}
+
 void FBuildingInfo::AddTechTreeParent(EBuildingType BuildingThatCanBuildThis)
 {
 	expensiveAssert(!TechTreeParentBuildings.Contains(BuildingThatCanBuildThis));
@@ -6561,6 +6670,25 @@ void FUnitInfo::SetIsAAttackingType(bool bInValue)
 	bIsArmyType = bInValue;
 }
 
+void FUnitInfo::SerializeForCache(FArchive & Ar)
+{
+	StaticStruct()->SerializeBin(Ar, this);
+
+	/* The rest are not UPROPERTYs */
+	Ar << ImpactDamage;
+	Ar << ImpactDamageType;
+	Ar << ImpactRandomDamageFactor;
+	Ar << AoEDamage;
+	Ar << AoEDamageType;
+	Ar << AoERandomDamageFactor;
+
+	uint8 Flags = (bIsCollectorType << 0) | (bIsWorkerType << 1) | (bIsArmyType << 2);
+	Ar << Flags;
+	bIsCollectorType = (Flags >> 0) & 1;
+	bIsWorkerType = (Flags >> 1) & 1;
+	bIsArmyType = (Flags >> 2) & 1;
+}
+
 bool FUnitInfo::IsTrainable() const
 {
 	return TechTreeParents.Num() > 0;
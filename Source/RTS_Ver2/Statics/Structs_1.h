@@ -10,6 +10,7 @@
 #include "Statics/Structs_4.h"
 #include "Statics/CoreDefinitions.h"
 #include "Statics/Statics.h" // Added for NUM_BUILDING_GARRISON_NETWORK_TYPES
+#include "Statics/SelectableFlags.h"
 #include "Structs_1.generated.h"
 
 struct FBuildInfo;
@@ -42,6 +43,7 @@ struct FInventory;
 struct FInventorySlotState;
 struct FSlateBrush;
 class AInventoryItem;
+class UPackageMap;
 enum class ECommanderSkillTreeNodeType : uint8;
 class UCommanderAbilityBase;
 class UBuildingTargetingAbilityBase;
@@ -314,6 +316,11 @@ struct FContextCommand
 	UPROPERTY()
 	uint8 bSameGroup : 1;
 
+	/* If true then AffectedSelectables are only the IDs that were added to or removed from 
+	the group of the last order */
+	UPROPERTY()
+	uint8 bGroupIsDelta : 1;
+
 	/**
 	 *	Just static_cast<uint8>(EContextAction). Don't really need to convert to uint8
 	 */
@@ -334,12 +341,24 @@ struct FContextCommand
 
 	void AddSelectable(uint8 SelectableID);
 
+	/* See CommandNetSerialization.h for how this is packed */
+	bool NetSerialize(FArchive & Ar, UPackageMap * Map, bool & bOutSuccess);
+
 private:
 
 	void SetupTypes(EContextButton AbilityType);
 	void SetupTypes(const FContextButton & Button);
 };
 
+template<>
+struct TStructOpsTypeTraits<FContextCommand> : public TStructOpsTypeTraitsBase2<FContextCommand>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
 
 /* A context command that requires a location. */
 USTRUCT()
@@ -358,6 +377,17 @@ public:
 	FContextCommandWithLocation(EContextButton AbilityType, bool bUseSameGroup, const FVector & ClickLoc);
 
 	FVector_NetQuantize10 GetClickLocation() const { return ClickLocation; }
+
+	bool NetSerialize(FArchive & Ar, UPackageMap * Map, bool & bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FContextCommandWithLocation> : public TStructOpsTypeTraitsBase2<FContextCommandWithLocation>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
 };
 
 
@@ -374,14 +404,34 @@ struct FContextCommandWithTarget : public FContextCommand
 	UPROPERTY()
 	FVector_NetQuantize10 ClickLocation;
 
+	/* Only set on the receiving end if the target was not a player owned selectable. Use 
+	GetTarget instead */
 	UPROPERTY()
 	AActor * Target;
 
+	/* Set on the receiving end if the target was a player owned selectable */
+	uint8 TargetOwnerID;
+	uint8 TargetSelectableID;
+
 	FContextCommandWithTarget(EContextButton AbilityType, bool bUseSameGroup, const FVector & ClickLoc, 
 		AActor * ClickTarget);
 
 	/* Don't think this is ever called */
 	FContextCommandWithTarget();
+
+	// Get the selectable that was clicked on, or null if none
+	AActor * GetTarget(const ARTSGameState * GameState) const;
+
+	bool NetSerialize(FArchive & Ar, UPackageMap * Map, bool & bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FContextCommandWithTarget> : public TStructOpsTypeTraitsBase2<FContextCommandWithTarget>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
 };
 
 
@@ -397,6 +447,11 @@ protected:
 	UPROPERTY()
 	uint8 bSameGroup : 1;
 
+	/* If true then AffectedSelectables are only the IDs that were added to or removed from 
+	the group of the last order */
+	UPROPERTY()
+	uint8 bGroupIsDelta : 1;
+
 	/* Selectable IDs for all selectables given the command */
 	UPROPERTY()
 	TArray <uint8> AffectedSelectables;
@@ -419,6 +474,11 @@ public:
 
 	void SetUseSameGroup(bool bValue);
 
+	void SetGroupIsDelta(bool bValue);
+
+	/* See CommandNetSerialization.h for how this is packed */
+	bool NetSerialize(FArchive & Ar, UPackageMap * Map, bool & bOutSuccess);
+
 	//-----------------------------------------------------------------------
 	//	Simple getters
 	//-----------------------------------------------------------------------
@@ -426,6 +486,9 @@ public:
 	// Return whether the PC should use the last set of selectable IDs when issuing command
 	bool UseSameGroup() const;
 
+	// Return whether GetAffectedSelectables are only the changes from the last set of selectable IDs
+	bool IsGroupDelta() const;
+
 	// Array of selectable IDs of selectables to be issued with command
 	const TArray < uint8 > & GetAffectedSelectables() const;
 
@@ -433,23 +496,33 @@ public:
 	const FVector & GetClickLocation() const;
 };
 
+template<>
+struct TStructOpsTypeTraits<FRightClickCommandBase> : public TStructOpsTypeTraitsBase2<FRightClickCommandBase>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
 
 /* Struct to send over wire when issuing a right-click command */
 USTRUCT()
 struct FRightClickCommandWithTarget : public FRightClickCommandBase
 {
-	/* TODO: add NetSerialize overload for this */
-
 	GENERATED_BODY()
 
 protected:
 
-	/* Target if there was one clicked on. This gets rid of some of the efficiency
-	of using this struct. TODO: make seperate structs: one for no targets and one for
-	targets */
+	/* Target if there was one clicked on. Only set on the receiving end if the target was 
+	not a player owned selectable */
 	UPROPERTY()
 	AActor * Target;
 
+	/* Set on the receiving end if the target was a player owned selectable */
+	uint8 TargetOwnerID;
+	uint8 TargetSelectableID;
+
 public:
 
 	FRightClickCommandWithTarget(const FVector & ClickLoc, AActor * InTarget);
@@ -457,7 +530,18 @@ public:
 	FRightClickCommandWithTarget();
 
 	// Get the selectable that was clicked on, or null if none
-	AActor * GetTarget() const;
+	AActor * GetTarget(const ARTSGameState * GameState) const;
+
+	bool NetSerialize(FArchive & Ar, UPackageMap * Map, bool & bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FRightClickCommandWithTarget> : public TStructOpsTypeTraitsBase2<FRightClickCommandWithTarget>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
 };
 
 
@@ -485,6 +569,17 @@ public:
 	// Mainly here for debugging. Should never need to be called normally
 	FInventoryItemID GetClickedInventoryItemID() const { return ItemID; }
 #endif
+
+	bool NetSerialize(FArchive & Ar, UPackageMap * Map, bool & bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FRightClickCommandOnInventoryItem> : public TStructOpsTypeTraitsBase2<FRightClickCommandOnInventoryItem>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
 };
 
 
@@ -2520,6 +2615,10 @@ public:
 
 	FBuildingInfo();
 
+	/* Read/write everything set by ABuilding::SetupBuildingInfo for the faction info cache. 
+	Tech tree parents are worked out afterwards so they should be empty when this is called */
+	void SerializeForCache(FArchive & Ar);
+
 	void AddTechTreeParent(EBuildingType BuildingThatCanBuildThis);
 	void AddTechTreeParent(EUnitType UnitThatCanBuildThis);
 
@@ -2650,6 +2749,10 @@ protected:
 
 public:
 
+	/* Read/write everything set by AInfantry::SetupBuildInfo for the faction info cache. 
+	Tech tree parents are worked out afterwards so they should be empty when this is called */
+	void SerializeForCache(FArchive & Ar);
+
 	void SetupHousingCostsArray(const TMap < EHousingResourceType, int16 > & InCostMap);
 
 	const TArray <int16> & GetHousingCosts() const;
@@ -4683,6 +4786,9 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "RTS", meta = (ClampMin = 0))
 	int32 ParticleSize;
 
+	/* Packed version of the selectable's actor tags. Set by the selectable during setup */
+	FSelectableFlags SelectableFlags;
+
 public: 
 
 	//===============================================================================
@@ -4730,6 +4836,9 @@ public:
 	void SetHUDImage_Hovered(const FSlateBrush & InImage) { HUDImage_Hovered = InImage; }
 	void SetHUDImage_Pressed(const FSlateBrush & InImage) { HUDImage_Pressed = InImage; }
 	int32 GetParticleSize() const { return ParticleSize; }
+	FSelectableFlags GetSelectableFlags() const { return SelectableFlags; }
+	void SetSelectableFlags(FSelectableFlags InFlags) { SelectableFlags = InFlags; }
+	FSelectableFlags & GetSelectableFlagsModifiable() { return SelectableFlags; }
 };
 
 
@@ -28,6 +28,81 @@ FUnifiedMouseFocusImage::FUnifiedMouseFocusImage()
 //	>FVisibilityInfo
 //=============================================================================================
 
+FVisibilityInfo::FVisibilityInfo()
+{
+	FMemory::Memzero(VisibleBits);
+	FMemory::Memzero(ChangedBits);
+	FMemory::Memzero(RegisteredBits);
+}
+
+void FVisibilityInfo::AddSelectable(const ISelectable * Selectable)
+{
+	assert(Selectable != nullptr);
+	
+	const int32 BitIndex = GetBitIndex(Selectable->GetOwnersID(), Selectable->GetSelectableID());
+	const uint64 Mask = 1ULL << (BitIndex & 63);
+	const int32 WordIndex = BitIndex >> 6;
+
+	/* Selectable IDs get reused so this ID may have been visible before it was removed. 
+	Start off hidden like AddToMap does */
+	if (VisibleBits[WordIndex] & Mask)
+	{
+		VisibleBits[WordIndex] &= ~Mask;
+		ChangedBits[WordIndex] |= Mask;
+	}
+	RegisteredBits[WordIndex] |= Mask;
+}
+
+void FVisibilityInfo::RemoveSelectable(const ISelectable * Selectable)
+{
+	assert(Selectable != nullptr);
+
+	const int32 BitIndex = GetBitIndex(Selectable->GetOwnersID(), Selectable->GetSelectableID());
+	const uint64 Mask = 1ULL << (BitIndex & 63);
+	const int32 WordIndex = BitIndex >> 6;
+
+	if (VisibleBits[WordIndex] & Mask)
+	{
+		VisibleBits[WordIndex] &= ~Mask;
+		ChangedBits[WordIndex] |= Mask;
+	}
+	RegisteredBits[WordIndex] &= ~Mask;
+}
+
+bool FVisibilityInfo::IsSelectableVisible(const ISelectable * Selectable) const
+{
+	assert(Selectable != nullptr);
+
+	return IsSelectableVisible(Selectable->GetOwnersID(), Selectable->GetSelectableID());
+}
+
+void FVisibilityInfo::SetSelectableVisibility(const ISelectable * Selectable, bool bNewVisibility)
+{
+	assert(Selectable != nullptr);
+
+	SetSelectableVisibility(Selectable->GetOwnersID(), Selectable->GetSelectableID(), bNewVisibility);
+}
+
+bool FVisibilityInfo::IsSelectableRegistered(uint8 OwnerID, uint8 SelectableID) const
+{
+	return IsBitSet(RegisteredBits, GetBitIndex(OwnerID, SelectableID));
+}
+
+bool FVisibilityInfo::HasAnyChangedSelectables() const
+{
+	uint64 Combined = 0;
+	for (int32 i = 0; i < NUM_WORDS; ++i)
+	{
+		Combined |= ChangedBits[i];
+	}
+	return Combined != 0;
+}
+
+void FVisibilityInfo::ClearChangedSelectables()
+{
+	FMemory::Memzero(ChangedBits);
+}
+
 void FVisibilityInfo::AddToMap(AActor * Actor)
 {
 	assert(Actor != nullptr);
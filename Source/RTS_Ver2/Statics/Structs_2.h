@@ -8,6 +8,7 @@
 #include "Statics/OtherEnums.h"
 #include "Statics/Structs_4.h"
 #include "Statics/Structs_5.h"
+#include "Settings/ProjectSettings.h"
 #include "Structs_2.generated.h"
 
 class AActor;
@@ -188,16 +189,129 @@ protected:
 };
 
 
-/* Holds a TMap that maps each unit to whether it is currently
-visible or hidden. */
+/**
+ *	Whether each selectable is visible from the perspective of a team.
+ *
+ *	Selectables owned by players are stored in bitsets indexed by (owner's player ID, selectable
+ *	ID) so a lookup is just a bit test. Because player IDs start at 1 bit index is
+ *	(OwnerID - 1) * BITS_PER_PLAYER + SelectableID.
+ *	Actors that are not owned by a player (resource spots, inventory items) are rare so they
+ *	stay in a TMap.
+ *
+ *	Also keeps track of which selectables have changed visibility since ClearChangedSelectables
+ *	was last called. This is a lazy delta stream: the fog manager only ever sets bits and the
+ *	consumer (the replication graph) iterates and clears them whenever it gets around to it.
+ *	Several flips between two consumes collapse into one entry holding the latest visibility.
+ */
 USTRUCT()
 struct FVisibilityInfo
 {
 	GENERATED_BODY()
 
+	FVisibilityInfo();
+
+	/* One bit for every value a uint8 selectable ID can be */
+	static constexpr int32 BITS_PER_PLAYER = 256;
+	static constexpr int32 WORDS_PER_PLAYER = BITS_PER_PLAYER / 64;
+	static constexpr int32 NUM_WORDS = ProjectSettings::MAX_NUM_PLAYERS * WORDS_PER_PLAYER;
+
+protected:
+
+	/* Bit set = selectable is visible */
+	uint64 VisibleBits[NUM_WORDS];
+
+	/* Bit set = selectable's visibility has changed since ClearChangedSelectables was last called */
+	uint64 ChangedBits[NUM_WORDS];
+
+	/* Bit set = selectable has been added with AddSelectable. Only really here so we can catch
+	querying selectables that were never added like the TMap used to */
+	uint64 RegisteredBits[NUM_WORDS];
+
+	/* Actors not owned by a player */
 	UPROPERTY()
 	TMap <AActor *, bool> Actors;
 
+public:
+
+	static FORCEINLINE int32 GetBitIndex(uint8 OwnerID, uint8 SelectableID)
+	{
+		assert(OwnerID > 0 && OwnerID <= ProjectSettings::MAX_NUM_PLAYERS);
+		return (OwnerID - 1) * BITS_PER_PLAYER + SelectableID;
+	}
+
+	static FORCEINLINE bool IsBitSet(const uint64 * Words, int32 BitIndex)
+	{
+		return (Words[BitIndex >> 6] & (1ULL << (BitIndex & 63))) != 0;
+	}
+
+	//-------------------------------------------------------------------------------------
+	//	Selectables owned by players
+	//-------------------------------------------------------------------------------------
+
+	/* Add selectable and set visibility false */
+	void AddSelectable(const ISelectable * Selectable);
+
+	void RemoveSelectable(const ISelectable * Selectable);
+
+	/* Returns true if a selectable is currently visible */
+	FORCEINLINE bool IsSelectableVisible(uint8 OwnerID, uint8 SelectableID) const
+	{
+		const int32 BitIndex = GetBitIndex(OwnerID, SelectableID);
+		assert(IsBitSet(RegisteredBits, BitIndex));
+		return IsBitSet(VisibleBits, BitIndex);
+	}
+
+	bool IsSelectableVisible(const ISelectable * Selectable) const;
+
+	FORCEINLINE void SetSelectableVisibility(uint8 OwnerID, uint8 SelectableID, bool bNewVisibility)
+	{
+		const int32 BitIndex = GetBitIndex(OwnerID, SelectableID);
+		assert(IsBitSet(RegisteredBits, BitIndex));
+		const uint64 Mask = 1ULL << (BitIndex & 63);
+		uint64 & Word = VisibleBits[BitIndex >> 6];
+		const uint64 NewWord = bNewVisibility ? (Word | Mask) : (Word & ~Mask);
+		ChangedBits[BitIndex >> 6] |= (Word ^ NewWord);
+		Word = NewWord;
+	}
+
+	void SetSelectableVisibility(const ISelectable * Selectable, bool bNewVisibility);
+
+	/* Returns true if the selectable has been added with AddSelectable */
+	bool IsSelectableRegistered(uint8 OwnerID, uint8 SelectableID) const;
+
+	/* Returns true if any selectable has changed visibility since ClearChangedSelectables was 
+	last called */
+	bool HasAnyChangedSelectables() const;
+
+	/**
+	 *	Call a function for every selectable whose visibility has changed since
+	 *	ClearChangedSelectables was last called
+	 *
+	 *	@param Func - void(uint8 OwnerID, uint8 SelectableID, bool bIsNowVisible)
+	 */
+	template <typename TFunc>
+	void ForEachChangedSelectable(TFunc && Func) const
+	{
+		for (int32 WordIndex = 0; WordIndex < NUM_WORDS; ++WordIndex)
+		{
+			uint64 Word = ChangedBits[WordIndex];
+			while (Word != 0)
+			{
+				const int32 BitIndex = WordIndex * 64 + static_cast<int32>(FMath::CountTrailingZeros64(Word));
+				Word &= Word - 1;
+
+				Func(static_cast<uint8>(BitIndex / BITS_PER_PLAYER + 1), static_cast<uint8>(BitIndex % BITS_PER_PLAYER),
+					IsBitSet(VisibleBits, BitIndex));
+			}
+		}
+	}
+
+	void ClearChangedSelectables();
+
+	//-------------------------------------------------------------------------------------
+	//	Actors not owned by a player e.g. resource spots, inventory items
+	//-------------------------------------------------------------------------------------
+
 	/* Add to map and set visibility info false */
 	void AddToMap(AActor * Actor);
 
@@ -207,6 +321,8 @@ struct FVisibilityInfo
 	bool IsVisible(const AActor * Actor) const;
 
 	void SetVisibility(const AActor * Actor, bool bNewVisibility);
+
+	bool IsInMap(const AActor * Actor) const { return Actors.Contains(Actor); }
 };
 
 
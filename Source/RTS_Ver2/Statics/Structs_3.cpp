@@ -5,6 +5,10 @@
 #include "GameFramework/RTSGameState.h"
 #include "GameFramework/Selectable.h"
 #include "GameFramework/RTSPlayerState.h"
+#include "Statics/DevelopmentStatics.h"
+#include "Statics/CommonEnums.h"
+#include "Statics/CommandNetSerialization.h"
+#include "Settings/ProjectSettings.h"
 
 
 //=========================================================================================
@@ -45,7 +49,9 @@ FSelectableIdentifier::FSelectableIdentifier(ARTSPlayerState * InPlayerState)
 
 AActor * FSelectableIdentifier::GetSelectable(ARTSGameState * GameState) const
 {
-	return GameState->GetPlayerFromID(HitSelectablesOwnerID)->GetSelectableFromID(HitSelectableID);
+	/* Owner could have left the match */
+	ARTSPlayerState * Owner = GameState->FindPlayerFromID(HitSelectablesOwnerID);
+	return (Owner != nullptr) ? Owner->GetSelectableFromID(HitSelectableID) : nullptr;
 }
 
 AActor * FSelectableIdentifier::GetPlayerState(ARTSGameState * GameState) const
@@ -103,6 +109,160 @@ EAbilityOutcome FHitActorAndOutcome::GetOutcome() const
 }
 
 
+//===============================================================================================
+//	>FAbilityEvent
+//===============================================================================================
+
+FAbilityEvent::FAbilityEvent()
+	: Header(0)
+	, AbilityTypeOrSlotIndex(0)
+	, Outcome(EAbilityOutcome::Default)
+	, Location(FVector::ZeroVector)
+	, RandomNumberSeed(0)
+	, TickCount(UINT8_MAX)
+{
+}
+
+FAbilityEvent::FAbilityEvent(EContextButton InAbilityType, const FSelectableIdentifier & InInstigator)
+	: Header(0)
+	, AbilityTypeOrSlotIndex(static_cast<uint8>(InAbilityType))
+	, Instigator(InInstigator)
+	, Outcome(EAbilityOutcome::Default)
+	, Location(FVector::ZeroVector)
+	, RandomNumberSeed(0)
+	, TickCount(UINT8_MAX)
+{
+}
+
+FAbilityEvent::FAbilityEvent(uint8 ServerInventorySlotIndex, const FSelectableIdentifier & InInstigator)
+	: Header(INVENTORY_SLOT_USE)
+	, AbilityTypeOrSlotIndex(ServerInventorySlotIndex)
+	, Instigator(InInstigator)
+	, Outcome(EAbilityOutcome::Default)
+	, Location(FVector::ZeroVector)
+	, RandomNumberSeed(0)
+	, TickCount(UINT8_MAX)
+{
+}
+
+void FAbilityEvent::SetOutcome(EAbilityOutcome InOutcome)
+{
+	Header |= HAS_OUTCOME;
+	Outcome = InOutcome;
+}
+
+void FAbilityEvent::SetHits(TArray < FAbilityHitWithOutcome > && InHits, bool bSendOutcomes)
+{
+	Header |= HAS_HITS;
+	if (bSendOutcomes)
+	{
+		Header |= HITS_HAVE_OUTCOMES;
+	}
+	Hits = MoveTemp(InHits);
+}
+
+void FAbilityEvent::SetTarget(const FSelectableIdentifier & InTarget)
+{
+	Header |= HAS_TARGET;
+	Target = InTarget;
+}
+
+void FAbilityEvent::SetLocation(const FVector & InLocation)
+{
+	Header |= HAS_LOCATION;
+	Location = InLocation;
+}
+
+void FAbilityEvent::SetRandomNumberSeed(int16 InSeed)
+{
+	Header |= HAS_RANDOM_SEED;
+	RandomNumberSeed = InSeed;
+}
+
+void FAbilityEvent::SetTickCount(uint8 InTickCount)
+{
+	Header |= HAS_TICK_COUNT;
+	TickCount = InTickCount;
+}
+
+EContextButton FAbilityEvent::GetAbilityType() const
+{
+	assert(!IsInventorySlotUse());
+	return static_cast<EContextButton>(AbilityTypeOrSlotIndex);
+}
+
+bool FAbilityEvent::NetSerialize(FArchive & Ar, UPackageMap * Map, bool & bOutSuccess)
+{
+	Ar << Header;
+	Ar << AbilityTypeOrSlotIndex;
+	Ar << Instigator.HitSelectablesOwnerID;
+	Ar << Instigator.HitSelectableID;
+
+	if (HasFlag(HAS_OUTCOME))
+	{
+		Ar << Outcome;
+	}
+
+	if (HasFlag(HAS_HITS))
+	{
+		uint32 NumHits = Hits.Num();
+		Ar.SerializeIntPacked(NumHits);
+
+		if (Ar.IsLoading())
+		{
+			/* Corrupt or hostile stream. Do not allocate whatever it asks for */
+			if (NumHits > ProjectSettings::MAX_ABILITY_EVENT_HITS)
+			{
+				Ar.SetError();
+				bOutSuccess = false;
+				return false;
+			}
+
+			Hits.SetNum(NumHits);
+		}
+
+		const bool bHitsHaveOutcomes = HasFlag(HITS_HAVE_OUTCOMES);
+		for (FAbilityHitWithOutcome & Hit : Hits)
+		{
+			Ar << Hit.HitSelectablesOwnerID;
+			Ar << Hit.HitSelectableID;
+			if (bHitsHaveOutcomes)
+			{
+				Ar << Hit.Outcome;
+			}
+			else if (Ar.IsLoading())
+			{
+				Hit.Outcome = EAbilityOutcome::Default;
+			}
+		}
+	}
+
+	if (HasFlag(HAS_TARGET))
+	{
+		Ar << Target.HitSelectablesOwnerID;
+		Ar << Target.HitSelectableID;
+	}
+
+	if (HasFlag(HAS_LOCATION))
+	{
+		CommandNetSerialization::SerializeLocation(Ar, Location, ProjectSettings::ABILITY_EVENT_LOCATION_PRECISION);
+	}
+
+	if (HasFlag(HAS_RANDOM_SEED))
+	{
+		Ar << RandomNumberSeed;
+	}
+
+	if (HasFlag(HAS_TICK_COUNT))
+	{
+		Ar << TickCount;
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+
 //===============================================================================================
 //	>FHousingResourceState
 //===============================================================================================
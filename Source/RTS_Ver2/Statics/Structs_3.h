@@ -11,7 +11,9 @@ class ARTSGameState;
 class ISelectable;
 struct FAbilityHitWithOutcome;
 enum class EAbilityOutcome : uint8;
+enum class EContextButton : uint8;
 class ARTSPlayerState;
+class UPackageMap;
 
 
 /** 
@@ -61,6 +63,8 @@ public:
 	/* Returns the player that owns the selectable, or if this is just being used to store a 
 	player state then returns that player state */
 	AActor * GetPlayerState(ARTSGameState * GameState) const;
+
+	friend struct FAbilityEvent;
 };
 
 
@@ -99,6 +103,8 @@ public:
 	{
 		return static_cast<T>(Outcome);
 	}
+
+	friend struct FAbilityEvent;
 };
 
 
@@ -133,6 +139,99 @@ public:
 };
 
 
+/**
+ *	The use of a context menu ability or an inventory item on the server, sent to clients
+ *	through ARTSGameState::Multicast_OnAbilityEvents.
+ *
+ *	The first byte says which of the other fields are present so only what the ability needs
+ *	goes over the wire: e.g. the outcome only if the ability has multiple outcomes, a per hit
+ *	outcome only if its AoE hits have multiple outcomes, the target only if it requires one etc.
+ */
+USTRUCT()
+struct FAbilityEvent
+{
+	GENERATED_BODY()
+
+	//---------------------------------------------------------
+	//	Header bits
+	//---------------------------------------------------------
+
+	/* Set = use of an inventory slot, AbilityTypeOrSlotIndex is the server slot index. 
+	Unset = use of an ability from the action bar, AbilityTypeOrSlotIndex is the EContextButton */
+	static constexpr uint8 INVENTORY_SLOT_USE = 1 << 0;
+	static constexpr uint8 HAS_OUTCOME = 1 << 1;
+	static constexpr uint8 HAS_HITS = 1 << 2;
+	/* Only relevant with HAS_HITS */
+	static constexpr uint8 HITS_HAVE_OUTCOMES = 1 << 3;
+	static constexpr uint8 HAS_TARGET = 1 << 4;
+	static constexpr uint8 HAS_LOCATION = 1 << 5;
+	static constexpr uint8 HAS_RANDOM_SEED = 1 << 6;
+	static constexpr uint8 HAS_TICK_COUNT = 1 << 7;
+
+protected:
+
+	uint8 Header;
+
+	uint8 AbilityTypeOrSlotIndex;
+
+	FSelectableIdentifier Instigator;
+
+	FSelectableIdentifier Target;
+
+	EAbilityOutcome Outcome;
+
+	TArray < FAbilityHitWithOutcome > Hits;
+
+	FVector Location;
+
+	int16 RandomNumberSeed;
+
+	uint8 TickCount;
+
+public:
+
+	// Only for the engine to use when receiving
+	FAbilityEvent();
+
+	/* Ctor for an ability used from a selectable's action bar */
+	FAbilityEvent(EContextButton InAbilityType, const FSelectableIdentifier & InInstigator);
+
+	/* Ctor for an ability used from a selectable's inventory */
+	FAbilityEvent(uint8 ServerInventorySlotIndex, const FSelectableIdentifier & InInstigator);
+
+	void SetOutcome(EAbilityOutcome InOutcome);
+	void SetHits(TArray < FAbilityHitWithOutcome > && InHits, bool bSendOutcomes);
+	void SetTarget(const FSelectableIdentifier & InTarget);
+	void SetLocation(const FVector & InLocation);
+	void SetRandomNumberSeed(int16 InSeed);
+	void SetTickCount(uint8 InTickCount);
+
+	bool HasFlag(uint8 Flag) const { return (Header & Flag) != 0; }
+	bool IsInventorySlotUse() const { return HasFlag(INVENTORY_SLOT_USE); }
+
+	EContextButton GetAbilityType() const;
+	uint8 GetServerInventorySlotIndex() const { return AbilityTypeOrSlotIndex; }
+	const FSelectableIdentifier & GetInstigator() const { return Instigator; }
+	const FSelectableIdentifier & GetTarget() const { return Target; }
+	EAbilityOutcome GetOutcome() const { return Outcome; }
+	const TArray < FAbilityHitWithOutcome > & GetHits() const { return Hits; }
+	const FVector & GetLocation() const { return Location; }
+	int16 GetRandomNumberSeed() const { return RandomNumberSeed; }
+	uint8 GetTickCount() const { return TickCount; }
+
+	bool NetSerialize(FArchive & Ar, UPackageMap * Map, bool & bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FAbilityEvent> : public TStructOpsTypeTraitsBase2<FAbilityEvent>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+
 /* Holds how much of a housing resource we are consuming and how much we are providing */
 USTRUCT()
 struct FHousingResourceState
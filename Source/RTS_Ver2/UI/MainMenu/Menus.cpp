@@ -399,6 +399,28 @@ void URTSGameInstance::HidePopupWidget()
 
 void URTSGameInstance::OnEnterMainMenuFromStartup()
 {
+	/* Launched to replay a command recording. Skip the main menu and go straight to the match */
+	FString ReplayPath;
+	if (FParse::Value(FCommandLine::Get(), TEXT("RTSReplay="), ReplayPath))
+	{
+		if (CommandReplayer.Load(ReplayPath))
+		{
+			if (!FParse::Value(FCommandLine::Get(), TEXT("RTSReplayOutput="), ReplayOutputPath))
+			{
+				ReplayOutputPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks") 
+					/ FPaths::GetBaseFilename(ReplayPath) + TEXT(".csv");
+			}
+
+			LoadLobbyMapForReplay();
+		}
+		else
+		{
+			QuitGame();
+		}
+
+		return;
+	}
+
 	// Start playing menu music
 	PlayMusic(MainMenuMusic);
 
@@ -498,6 +520,48 @@ void URTSGameInstance::SetupLobbyWidget_Singleplayer()
 	ShowWidget(EWidgetType::Lobby, ESlateVisibility::Collapsed);
 }
 
+bool URTSGameInstance::IsReplayingCommands() const
+{
+	return CommandReplayer.IsLoaded();
+}
+
+FCommandReplayer & URTSGameInstance::GetCommandReplayer()
+{
+	return CommandReplayer;
+}
+
+const FString & URTSGameInstance::GetReplayOutputPath() const
+{
+	return ReplayOutputPath;
+}
+
+void URTSGameInstance::LoadLobbyMapForReplay()
+{
+	bIsInMainMenuMap = false;
+
+	/* Same as LoadLobbyMapForSingleplayer except no lobby widget */
+	bHasSpawnedInfoActors = false;
+
+	UGameplayStatics::OpenLevel(GetWorld(), MapOptions::BLANK_PERSISTENT_LEVEL);
+
+	const FLatentActionInfo LatentAction = FLatentActionInfo(0, 0,
+		*FString("StartReplayMatch"), this);
+	UGameplayStatics::LoadStreamLevel(GetWorld(), MapOptions::LOBBY_MAP_NAME, true, false,
+		LatentAction);
+}
+
+void URTSGameInstance::StartReplayMatch()
+{
+	ARTSPlayerState * LocalPlayerState = CastChecked<ARTSPlayerState>(GetWorld()->GetFirstPlayerController()->PlayerState);
+	const FMapInfo & MapInfo = GetMapInfo(FMapID(CommandReplayer.GetHeader().MapID));
+
+	MatchInfo = FMatchInfo();
+	CommandReplayer.SetupMatchInfo(MatchInfo, LocalPlayerState, MapInfo.GetMapFName(), 
+		MapInfo.GetDisplayName());
+
+	LoadMatch();
+}
+
 void URTSGameInstance::CreateNetworkedSession(const FText & LobbyName, bool bIsLAN, const FText & Password,
 	uint32 NumSlots, uint8 MapID, EStartingResourceAmount StartingResources,
 	EDefeatCondition DefeatCondition)